@@ -46,9 +46,9 @@ enum class AssetType : u8 {
 };
 
 /**
- * @brief Asset metadata
+ * @brief Metadata the asset browser shows for a file
  */
-struct AssetMetadata {
+struct AssetBrowserMetadata {
     // Common metadata
     std::string uuid;
     std::string importDate;
@@ -83,7 +83,7 @@ struct AssetBrowserEntry {
     bool isDirectory = false;
     u64 size = 0;
     std::string modifiedTime;
-    AssetMetadata metadata;
+    AssetBrowserMetadata metadata;
     bool hasThumbnail = false;
     u32 thumbnailId = 0;
 };
@@ -310,7 +310,7 @@ public:
     /**
      * @brief Get metadata for asset
      */
-    [[nodiscard]] const AssetMetadata* getAssetMetadata(const std::string& path) const;
+    [[nodiscard]] const AssetBrowserMetadata* getAssetMetadata(const std::string& path) const;
 
     /**
      * @brief Refresh metadata for asset
@@ -20,11 +20,17 @@
 #include <unordered_map>
 #include <optional>
 
+namespace NovelMind::renderer
+{
+struct DecodedImage;
+}
+
 namespace NovelMind::editor
 {
 
 // Forward declarations
 class AssetDatabase;
+struct ManifestScanResult;
 
 /**
  * @brief Asset type enumeration
@@ -78,6 +84,11 @@ struct ImageImportSettings
     bool powerOfTwo = false;
     f32 compressionQuality = 0.8f;
 
+    // Half and quarter size variants for lower output resolutions, skipped
+    // once the smaller side would drop below variantMinSize
+    bool generateVariants = true;
+    i32 variantMinSize = 256;
+
     // Sprite sheet settings
     bool isSpriteSheet = false;
     i32 spriteWidth = 0;
@@ -106,7 +117,14 @@ struct FontImportSettings
     std::string charset = "ascii";  // ascii, latin1, unicode
     bool antialiased = true;
     i32 padding = 2;
-    bool generateSDF = false;   // Signed Distance Field
+    bool generateSDF = true;    // Signed Distance Field
+
+    // SDF atlases serve every size, so `sizes` is unused when generateSDF
+    // is set. The outline width a font supports is half the distance range
+    // at sdfEmSize, scaled with the text size.
+    f32 sdfEmSize = 32.0f;        // Atlas texels per em
+    f32 sdfDistanceRange = 6.0f;  // Texels
+    i32 atlasPageSize = 1024;
 };
 
 /**
@@ -216,6 +234,10 @@ public:
 private:
     Result<void> processImage(const std::string& sourcePath,
                                const std::string& destPath);
+    Result<void> writeVariants(const renderer::DecodedImage& original,
+                                const std::string& destPath);
+    Result<void> writeRawTexture(const renderer::DecodedImage& image,
+                                  const std::string& path);
     Result<void> generateThumbnail(const std::string& sourcePath,
                                     const std::string& thumbnailPath);
 
@@ -280,6 +302,7 @@ public:
 private:
     Result<void> processFont(const std::string& sourcePath,
                               const std::string& destPath);
+    Result<void> writeSdfFont(const std::vector<u8>& fontData, const std::string& destPath);
 
     FontImportSettings m_settings;
 };
@@ -434,6 +457,17 @@ public:
      */
     [[nodiscard]] std::vector<std::string> getOutdatedAssets() const;
 
+    /**
+     * @brief Import or reimport only the files a manifest scan reported changed
+     *
+     * Assets whose source was removed are unregistered. Files under the
+     * database's own assets folder are import output and are skipped.
+     *
+     * @param projectRoot Root the scan's relative paths are under
+     * @return Number of assets imported or reimported
+     */
+    usize applyManifestChanges(const ManifestScanResult& changes, const std::string& projectRoot);
+
     // =========================================================================
     // Dependency Tracking
     // =========================================================================
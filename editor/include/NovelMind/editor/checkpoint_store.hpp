@@ -0,0 +1,175 @@
+#pragma once
+
+/**
+ * @file checkpoint_store.hpp
+ * @brief Incremental runtime checkpoints encoded on a worker thread
+ *
+ * Taking a checkpoint costs the main thread one copy of the script and scene
+ * state. CheckpointStore serializes the copy on a worker thread into a flat
+ * image made of entries: a header, each variable, each flag, the scene header
+ * and each scene object. Entries equal to one in the previous checkpoint are
+ * stored as references to it, the rest as bytes, LZ4-compressed; matching by
+ * content keeps a string that changes length from invalidating every entry
+ * after it. Every few checkpoints the whole image is stored instead (a
+ * keyframe), so restoring decodes at most one keyframe and keyframeInterval
+ * deltas.
+ *
+ * The store is bounded by a byte budget on the compressed records: the
+ * oldest checkpoints are dropped first, and a delta left without its base is
+ * rewritten as a keyframe.
+ *
+ * Record payload before compression:
+ *   keyframe: { u32 entryCount, u32 entryEnd[entryCount], image }
+ *   delta:    u32 entryCount, then for each run of entries either
+ *             { u8 1, u32 firstPreviousEntry, u32 count } reusing entries of the
+ *             previous image, or { u8 2, u32 length, bytes } for one new entry
+ */
+
+#include "NovelMind/core/types.hpp"
+#include "NovelMind/core/result.hpp"
+#include "NovelMind/scene/scene_graph.hpp"
+#include "NovelMind/scripting/script_runtime.hpp"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace NovelMind::editor
+{
+
+/**
+ * @brief Runtime state captured for a checkpoint
+ */
+struct CheckpointSnapshot
+{
+    scripting::RuntimeSaveState runtime{};
+    scene::SceneState scene;
+    std::string description;
+    u64 timestamp = 0;
+    f64 runtimeTimeSeconds = 0.0;
+};
+
+/**
+ * @brief A stored checkpoint, without its state
+ */
+struct CheckpointInfo
+{
+    u64 id = 0;
+    u64 timestamp = 0;
+    std::string description;
+    std::string sceneName;
+    f64 runtimeTimeSeconds = 0.0;
+    usize stateBytes = 0;  // Serialized image size
+    usize storedBytes = 0; // Compressed record size
+    bool keyframe = false;
+};
+
+struct CheckpointStoreConfig
+{
+    usize byteBudget = 8 * 1024 * 1024; // Compressed bytes kept across all checkpoints
+    u32 keyframeInterval = 16;          // Longest run of deltas between keyframes
+};
+
+class CheckpointStore
+{
+public:
+    explicit CheckpointStore(const CheckpointStoreConfig& config = {});
+    ~CheckpointStore();
+
+    CheckpointStore(const CheckpointStore&) = delete;
+    CheckpointStore& operator=(const CheckpointStore&) = delete;
+
+    /**
+     * @brief Applies to checkpoints encoded after the call
+     */
+    void setConfig(const CheckpointStoreConfig& config);
+    [[nodiscard]] CheckpointStoreConfig getConfig() const;
+
+    /**
+     * @brief Queue a snapshot for encoding
+     * @return Id of the checkpoint, usable with restore() once it is stored
+     */
+    u64 submit(CheckpointSnapshot snapshot);
+
+    /**
+     * @brief Stored checkpoints, oldest first
+     *
+     * Snapshots still being encoded are not listed.
+     */
+    [[nodiscard]] std::vector<CheckpointInfo> getCheckpoints() const;
+    [[nodiscard]] usize getCheckpointCount() const;
+    [[nodiscard]] usize getStoredBytes() const;
+
+    /**
+     * @brief Rebuild a checkpoint's state, waiting for queued snapshots first
+     */
+    [[nodiscard]] Result<CheckpointSnapshot> restore(u64 id) const;
+    [[nodiscard]] Result<CheckpointSnapshot> restoreLatest() const;
+
+    /**
+     * @brief Drop stored checkpoints; queued snapshots are still stored
+     */
+    void clear();
+
+    [[nodiscard]] bool hasPending() const;
+    void waitForAll() const;
+
+    /**
+     * @brief Finish queued snapshots and stop the worker
+     */
+    void shutdown();
+
+    [[nodiscard]] static std::vector<u8> serialize(const CheckpointSnapshot& snapshot);
+    [[nodiscard]] static Result<CheckpointSnapshot> deserialize(const u8* data, usize size);
+
+private:
+    struct Job
+    {
+        u64 id;
+        CheckpointSnapshot snapshot;
+    };
+
+    struct Record
+    {
+        CheckpointInfo info;
+        usize payloadSize; // Before compression
+        std::vector<u8> data;
+    };
+
+    /**
+     * @brief Serialized state and where each of its entries ends
+     */
+    struct Image
+    {
+        std::vector<u8> bytes;
+        std::vector<u32> entryEnds;
+    };
+
+    void workerLoop();
+    void store(u64 id, const CheckpointSnapshot& snapshot);
+    void enforceBudget();
+    Result<Image> rebuildImage(usize index) const;
+    static bool applyRecord(const Record& record, Image& image);
+
+    // Queue; the main thread only ever takes this lock
+    mutable std::mutex m_jobMutex;
+    std::condition_variable m_work;
+    mutable std::condition_variable m_idle;
+    std::deque<Job> m_jobs;
+    usize m_inFlight = 0;
+    u64 m_nextId = 1;
+    std::thread m_worker;
+    bool m_stopWorker = false;
+
+    // Stored records, written by the worker
+    mutable std::mutex m_recordMutex;
+    CheckpointStoreConfig m_config;
+    std::deque<Record> m_records;
+    usize m_storedBytes = 0;
+    Image m_lastImage; // Image of m_records.back()
+    u32 m_deltasSinceKeyframe = 0;
+};
+
+} // namespace NovelMind::editor
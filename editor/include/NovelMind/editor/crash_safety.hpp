@@ -14,6 +14,7 @@
 
 #include "NovelMind/core/types.hpp"
 #include "NovelMind/core/result.hpp"
+#include "NovelMind/editor/checkpoint_store.hpp"
 #include <string>
 #include <vector>
 #include <functional>
@@ -82,24 +83,6 @@ struct RuntimeError
     std::string suggestedAction;
 };
 
-/**
- * @brief Checkpoint for state recovery
- */
-struct RuntimeCheckpoint
-{
-    u64 timestamp = 0;
-    std::string sceneName;
-    i32 scriptPosition = 0;
-    std::vector<u8> sceneState;
-    std::vector<u8> variableState;
-    std::vector<u8> flagState;
-    std::string description;
-
-    // Metadata
-    size_t memoryUsage = 0;
-    f64 runtimeTimeSeconds = 0.0;
-};
-
 /**
  * @brief Configuration for crash safety
  */
@@ -113,7 +96,8 @@ struct CrashSafetyConfig
     // Checkpoint settings
     bool enableAutoCheckpoints = true;
     f64 checkpointIntervalSeconds = 30.0;
-    i32 maxCheckpoints = 10;
+    size_t checkpointBudgetBytes = 8 * 1024 * 1024; // Compressed, oldest dropped first
+    u32 checkpointKeyframeInterval = 16;
 
     // Recovery settings
     bool enableAutoRecovery = true;
@@ -248,11 +232,15 @@ public:
 
     /**
      * @brief Create a checkpoint
+     *
+     * Copies the script and scene state; encoding and compression happen on
+     * the checkpoint store's worker thread.
      */
     Result<void> createCheckpoint(const std::string& description = "");
 
     /**
      * @brief Restore to a checkpoint
+     * @param checkpointIndex Index into getCheckpoints()
      */
     Result<void> restoreCheckpoint(size_t checkpointIndex);
 
@@ -262,9 +250,11 @@ public:
     Result<void> restoreLatestCheckpoint();
 
     /**
-     * @brief Get available checkpoints
+     * @brief Get available checkpoints, oldest first
      */
-    [[nodiscard]] const std::vector<RuntimeCheckpoint>& getCheckpoints() const { return m_checkpoints; }
+    [[nodiscard]] std::vector<CheckpointInfo> getCheckpoints() const;
+
+    [[nodiscard]] const CheckpointStore& getCheckpointStore() const { return m_checkpointStore; }
 
     /**
      * @brief Clear all checkpoints
@@ -353,7 +343,6 @@ public:
 
 private:
     void createAutoCheckpoint();
-    void trimCheckpoints();
     void notifyErrorOccurred(const RuntimeError& error);
     void notifyRecoveryStarted(const std::string& description);
     void notifyRecoveryCompleted(bool success);
@@ -361,8 +350,8 @@ private:
     void notifyRuntimeIsolated();
     void notifyRuntimeResumed();
 
-    RuntimeCheckpoint captureCurrentState();
-    void restoreState(const RuntimeCheckpoint& checkpoint);
+    CheckpointSnapshot captureCurrentState();
+    Result<void> restoreState(const CheckpointSnapshot& snapshot);
 
     std::string formatStackTrace();
     std::string getCurrentContext();
@@ -376,8 +365,9 @@ private:
     size_t m_maxRecentErrors = 100;
 
     // Checkpoints
-    std::vector<RuntimeCheckpoint> m_checkpoints;
+    CheckpointStore m_checkpointStore;
     f64 m_timeSinceLastCheckpoint = 0.0;
+    f64 m_runtimeTimeSeconds = 0.0;
 
     // Isolation
     bool m_isIsolated = false;
@@ -461,7 +451,7 @@ public:
 
 private:
     CrashSafetyManager* m_manager;
-    RuntimeCheckpoint m_preReloadCheckpoint;
+    CheckpointSnapshot m_preReloadCheckpoint;
     bool m_checkpointCreated = false;
 };
 
@@ -14,10 +14,12 @@
 #include "NovelMind/core/types.hpp"
 #include "NovelMind/core/result.hpp"
 #include "NovelMind/scene/animation.hpp"
+#include "NovelMind/scene/easing_curve.hpp"
 #include "NovelMind/renderer/renderer.hpp"
 #include "editor_app.hpp"
 #include <string>
 #include <vector>
+#include <atomic>
 #include <memory>
 #include <functional>
 #include <unordered_map>
@@ -63,6 +65,12 @@ public:
     AnimationCurve(const std::string& name);
     ~AnimationCurve() = default;
 
+    // Copies read the baked table atomically, like const evaluation
+    AnimationCurve(const AnimationCurve& other);
+    AnimationCurve& operator=(const AnimationCurve& other);
+    AnimationCurve(AnimationCurve&&) noexcept = default;
+    AnimationCurve& operator=(AnimationCurve&&) noexcept = default;
+
     [[nodiscard]] const std::string& getName() const { return m_name; }
     void setName(const std::string& name) { m_name = name; }
 
@@ -75,12 +83,21 @@ public:
     [[nodiscard]] const std::vector<CurvePoint>& getPoints() const { return m_points; }
     [[nodiscard]] size_t getPointCount() const { return m_points.size(); }
 
-    // Evaluation
+    // Evaluation (evaluate() uses the baked table, built on first use; safe
+    // to call from several threads while the curve is not modified)
     [[nodiscard]] f32 evaluate(f32 t) const;
+    [[nodiscard]] f32 evaluateExact(f32 t) const;
     [[nodiscard]] f32 evaluateDerivative(f32 t) const;
+    void evaluateBatch(const f32* times, f32* out, size_t count) const;
+
+    // Baking
+    void setBakeTolerance(f32 tolerance);
+    [[nodiscard]] f32 getBakeTolerance() const { return m_bakeTolerance; }
+    [[nodiscard]] std::shared_ptr<const scene::EasingCurve> getBakedCurve() const;
 
     // Sampling
     [[nodiscard]] std::vector<renderer::Vec2> sample(i32 numSamples = 100) const;
+    void sample(i32 numSamples, std::vector<renderer::Vec2>& out) const;
 
     // Presets
     static AnimationCurve createLinear();
@@ -118,10 +135,20 @@ public:
 private:
     f32 evaluateBezierSegment(const CurvePoint& p0, const CurvePoint& p1, f32 localT) const;
     i32 findSegment(f32 t) const;
+    void invalidateBake()
+    {
+        std::atomic_store(&m_baked, std::shared_ptr<const scene::EasingCurve>());
+    }
 
     std::string m_id;
     std::string m_name;
     std::vector<CurvePoint> m_points;
+
+    // Baked lookup table, dropped whenever the points change. Const callers
+    // may bake concurrently, so it is only accessed through std::atomic_load
+    // and std::atomic_store
+    mutable std::shared_ptr<const scene::EasingCurve> m_baked;
+    f32 m_bakeTolerance = scene::EasingCurve::DEFAULT_TOLERANCE;
 };
 
 /**
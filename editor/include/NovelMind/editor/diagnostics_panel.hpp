@@ -10,9 +10,11 @@
  * - Compilation errors
  * - Filtering by severity and file
  * - Click-to-navigate to source location
+ * - Script profile: hot scenes, lines and host callbacks from play mode
  */
 
 #include "NovelMind/editor/editor_app.hpp"
+#include "NovelMind/editor/editor_runtime_host.hpp"
 #include "NovelMind/scripting/script_error.hpp"
 #include "NovelMind/scripting/validator.hpp"
 #include <string>
@@ -271,6 +273,30 @@ public:
      */
     void setOnDiagnosticDoubleClicked(OnDiagnosticDoubleClicked callback);
 
+    // =========================================================================
+    // Script Profile
+    // =========================================================================
+
+    /**
+     * @brief Show a profile collected by EditorRuntimeHost
+     */
+    void setScriptProfile(const scripting::ScriptProfileReport& report,
+                          std::vector<ScriptHotspot> hotspots);
+
+    /**
+     * @brief Remove the profile section
+     */
+    void clearScriptProfile();
+
+    [[nodiscard]] bool hasScriptProfile() const;
+    [[nodiscard]] const scripting::ScriptProfileReport& getScriptProfile() const;
+    [[nodiscard]] const std::vector<ScriptHotspot>& getScriptHotspots() const;
+
+    /**
+     * @brief Navigate to a hot line through the double-click callback
+     */
+    void openScriptHotspot(size_t index);
+
     // =========================================================================
     // Display Options
     // =========================================================================
@@ -295,6 +321,11 @@ public:
      */
     void setAutoScrollToErrors(bool autoScroll);
 
+    /**
+     * @brief Show/hide the script profile section
+     */
+    void setShowScriptProfile(bool show);
+
 private:
     // Rendering helpers
     void renderToolbar();
@@ -304,6 +335,7 @@ private:
     void renderSummaryBar();
     void renderGroupedList();
     void renderGroupHeader(const DiagnosticGroup& group);
+    void renderScriptProfile();
 
     // Filtering helpers
     bool matchesFilter(const DiagnosticEntry& entry) const;
@@ -340,6 +372,12 @@ private:
     bool m_showErrorCodes = true;
     bool m_showFilePaths = true;
     bool m_autoScrollToErrors = true;
+    bool m_showScriptProfile = true;
+
+    // Script profile
+    scripting::ScriptProfileReport m_scriptProfile;
+    std::vector<ScriptHotspot> m_scriptHotspots;
+    bool m_hasScriptProfile = false;
 
     // Scroll state
     f32 m_scrollY = 0.0f;
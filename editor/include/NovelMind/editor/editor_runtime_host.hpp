@@ -10,10 +10,12 @@
  * - Provides inspection APIs for debugging
  * - Scene state snapshots for instant jumps
  * - Variable and call stack inspection
+ * - Script profiling (hot scenes, lines and callbacks)
  */
 
 #include "NovelMind/core/types.hpp"
 #include "NovelMind/core/result.hpp"
+#include "NovelMind/scripting/script_profiler.hpp"
 #include "NovelMind/scripting/script_runtime.hpp"
 #include "NovelMind/scripting/compiler.hpp"
 #include "NovelMind/scripting/parser.hpp"
@@ -26,6 +28,7 @@
 #include <vector>
 #include <functional>
 #include <unordered_map>
+#include <optional>
 #include <queue>
 
 namespace NovelMind::editor
@@ -82,6 +85,7 @@ struct SceneSnapshot
  */
 struct CallStackEntry
 {
+    std::string scriptPath;
     std::string sceneName;
     std::string functionName;
     u32 instructionPointer;
@@ -109,6 +113,19 @@ struct Breakpoint
     std::string condition;  // Optional conditional expression
 };
 
+/**
+ * @brief A profiled script line, mapped back to its source file
+ */
+struct ScriptHotspot
+{
+    std::string scriptPath;
+    std::string sceneName;
+    u32 line = 0;
+    u64 instructions = 0;
+    u64 callbackCalls = 0;
+    u64 callbackNanos = 0;
+};
+
 /**
  * @brief Callback types for runtime events
  */
@@ -345,6 +362,40 @@ public:
      */
     void clearBreakpoints();
 
+    // =========================================================================
+    // Script Profiling
+    // =========================================================================
+
+    /**
+     * @brief Count instructions and time host callbacks while playing
+     *
+     * Counts accumulate across play sessions until reset or recompiled.
+     */
+    void setScriptProfilingEnabled(bool enabled);
+    [[nodiscard]] bool isScriptProfilingEnabled() const;
+
+    /**
+     * @brief Discard collected counts
+     */
+    void resetScriptProfile();
+
+    /**
+     * @brief Per-scene and per-callback totals; line numbers are program lines
+     */
+    [[nodiscard]] scripting::ScriptProfileReport getScriptProfile() const;
+
+    /**
+     * @brief Hottest lines by callback time, then instruction count
+     * @param maxCount Maximum number of lines to return
+     */
+    [[nodiscard]] std::vector<ScriptHotspot> getScriptHotspots(usize maxCount = 20) const;
+
+    /**
+     * @brief Write the profile as folded stacks labelled "file:line"
+     */
+    Result<void> exportScriptProfile(const std::string& path,
+                                     scripting::ScriptProfileMetric metric) const;
+
     // =========================================================================
     // Callbacks
     // =========================================================================
@@ -401,7 +452,11 @@ private:
     Result<void> compileProject();
     Result<void> initializeRuntime();
     void resetRuntime();
-    bool checkBreakpoint(const scripting::SourceLocation& location);
+    void syncBreakpoints();
+    bool onBreakpointTrap(u32 ip);
+    [[nodiscard]] std::optional<u32> toProgramLine(const std::string& scriptPath, u32 line) const;
+    [[nodiscard]] scripting::SourceLocation toScriptLocation(const scripting::SourceLocation& location,
+                                                             std::string& scriptPath) const;
     void fireStateChanged(EditorRuntimeState newState);
     void fireBreakpointHit(const Breakpoint& bp);
     void onRuntimeEvent(const scripting::ScriptEvent& event);
@@ -428,6 +483,29 @@ private:
     // Breakpoints
     std::vector<Breakpoint> m_breakpoints;
 
+    // A breakpoint patched into the VM as a BREAK trap at one instruction
+    struct BreakpointSite
+    {
+        usize breakpointIndex = 0;
+        bool conditional = false;
+        scripting::CompiledExpression condition;
+    };
+    std::unordered_map<u32, BreakpointSite> m_breakpointSites;
+
+    // Where each script file sits in the concatenated program source
+    struct ScriptFileSpan
+    {
+        std::string path;
+        std::string relativePath;
+        u32 firstLine = 1;
+        u32 lineCount = 0;
+    };
+    std::vector<ScriptFileSpan> m_scriptFiles;
+
+    // Script profiling
+    scripting::ScriptProfiler m_scriptProfiler;
+    bool m_scriptProfiling = false;
+
     // Callbacks
     OnStateChanged m_onStateChanged;
     OnBreakpointHit m_onBreakpointHit;
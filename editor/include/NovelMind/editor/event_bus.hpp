@@ -21,16 +21,28 @@
  * - PlayModeStarted/Stopped: Play mode state changes
  * - AssetImported/Deleted/Renamed: Asset operations
  * - ErrorOccurred: Error reporting
+ *
+ * Dispatch looks subscribers up in per-type buckets instead of testing every
+ * subscriber. Queued events live in a per-frame arena, events posted from
+ * other threads pass through a lock-free ring, and high-frequency events
+ * (property edits, node drags, transforms) are coalesced while queued.
  */
 
 #include "NovelMind/core/types.hpp"
+#include "NovelMind/editor/mpsc_ring.hpp"
 #include "NovelMind/scripting/ir.hpp"
 #include <any>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <queue>
 #include <string>
+#include <thread>
 #include <typeindex>
 #include <unordered_map>
 #include <variant>
@@ -118,6 +130,12 @@ enum class EditorEventType : u32 {
   Custom = 1000
 };
 
+/**
+ * @brief Number of built-in event types (those below Custom)
+ */
+inline constexpr size_t BUILTIN_EDITOR_EVENT_TYPE_COUNT =
+    static_cast<size_t>(EditorEventType::ThemeChanged) + 1;
+
 /**
  * @brief Base class for all editor events
  */
@@ -136,6 +154,18 @@ struct EditorEvent {
   [[nodiscard]] virtual std::string getDescription() const {
     return "EditorEvent";
   }
+
+  /**
+   * @brief Key under which queued events of the same type are merged
+   *
+   * An empty key (the default) means the event is never coalesced.
+   */
+  [[nodiscard]] virtual std::string getCoalesceKey() const { return {}; }
+
+  /**
+   * @brief Fold a newer queued event with the same type and key into this one
+   */
+  virtual void coalesce(const EditorEvent &newer) { timestamp = newer.timestamp; }
 };
 
 // ============================================================================
@@ -169,6 +199,17 @@ struct PropertyChangedEvent : EditorEvent {
   [[nodiscard]] std::string getDescription() const override {
     return "Property '" + propertyName + "' changed on " + objectId;
   }
+
+  [[nodiscard]] std::string getCoalesceKey() const override {
+    return objectId + '\n' + propertyName;
+  }
+
+  void coalesce(const EditorEvent &newer) override {
+    EditorEvent::coalesce(newer);
+    if (auto *event = dynamic_cast<const PropertyChangedEvent *>(&newer)) {
+      newValue = event->newValue; // keep the first oldValue
+    }
+  }
 };
 
 struct PropertyChangeStartedEvent : EditorEvent {
@@ -216,6 +257,23 @@ struct GraphNodeMovedEvent : EditorEvent {
   f32 deltaY = 0.0f;
 
   GraphNodeMovedEvent() : EditorEvent(EditorEventType::GraphNodeMoved) {}
+
+  [[nodiscard]] std::string getCoalesceKey() const override {
+    std::string key;
+    for (auto id : nodeIds) {
+      key += std::to_string(id);
+      key += ',';
+    }
+    return key;
+  }
+
+  void coalesce(const EditorEvent &newer) override {
+    EditorEvent::coalesce(newer);
+    if (auto *event = dynamic_cast<const GraphNodeMovedEvent *>(&newer)) {
+      deltaX += event->deltaX;
+      deltaY += event->deltaY;
+    }
+  }
 };
 
 struct GraphConnectionAddedEvent : EditorEvent {
@@ -297,6 +355,19 @@ struct SceneObjectTransformedEvent : EditorEvent {
 
   SceneObjectTransformedEvent()
       : EditorEvent(EditorEventType::SceneObjectTransformed) {}
+
+  [[nodiscard]] std::string getCoalesceKey() const override { return objectId; }
+
+  void coalesce(const EditorEvent &newer) override {
+    EditorEvent::coalesce(newer);
+    if (auto *event = dynamic_cast<const SceneObjectTransformedEvent *>(&newer)) {
+      newX = event->newX;
+      newY = event->newY;
+      newRotation = event->newRotation;
+      newScaleX = event->newScaleX;
+      newScaleY = event->newScaleY;
+    }
+  }
 };
 
 // ============================================================================
@@ -503,11 +574,32 @@ public:
 
   /**
    * @brief Queue an event for deferred processing
+   *
+   * Safe from any thread. Calls from the dispatch thread go straight into
+   * the frame queue; other threads post through a lock-free ring.
    */
   void queueEvent(std::unique_ptr<EditorEvent> event);
 
+  /**
+   * @brief Publish a typed event, constructing queued copies in the arena
+   */
+  template <typename T> void post(T event) {
+    static_assert(std::is_base_of_v<EditorEvent, T>);
+    if (m_synchronous) {
+      dispatchEvent(event);
+    } else if (isDispatchThread()) {
+      enqueueLocal(m_frames[m_writeFrame].arena.create<T>(std::move(event)),
+                   false);
+    } else {
+      queueEvent(std::make_unique<T>(std::move(event)));
+    }
+  }
+
   /**
    * @brief Process all queued events
+   *
+   * The calling thread becomes the dispatch thread. Events queued while
+   * processing are delivered on the next call.
    */
   void processQueuedEvents();
 
@@ -551,6 +643,23 @@ public:
     });
   }
 
+  /**
+   * @brief Subscribe with typed handler to a single event type
+   *
+   * Unlike the untyped-filter overload, the handler only sits in the bucket
+   * for @p type and is never invoked for other events.
+   */
+  template <typename T>
+  EventSubscription subscribe(EditorEventType type,
+                              TypedEventHandler<T> handler) {
+    return subscribe(type,
+                     [handler = std::move(handler)](const EditorEvent &event) {
+                       if (auto *typed = dynamic_cast<const T *>(&event)) {
+                         handler(*typed);
+                       }
+                     });
+  }
+
   /**
    * @brief Unsubscribe using subscription handle
    */
@@ -599,6 +708,19 @@ public:
    */
   [[nodiscard]] bool isSynchronous() const;
 
+  /**
+   * @brief Enable/disable merging of queued events with equal coalesce keys
+   *
+   * A merged event is dispatched at the position of its latest occurrence.
+   */
+  void setCoalescingEnabled(bool enabled);
+  [[nodiscard]] bool isCoalescingEnabled() const;
+
+  /**
+   * @brief Number of queued events merged into earlier ones so far
+   */
+  [[nodiscard]] u64 getCoalescedEventCount() const;
+
 private:
   struct Subscriber {
     u64 id;
@@ -607,15 +729,88 @@ private:
     std::optional<EventFilter> customFilter;
   };
 
+  /**
+   * @brief Immutable snapshot of subscribers bucketed by event type
+   *
+   * Rebuilt on (un)subscribe; dispatch only takes a reference under the
+   * lock. Buckets are ordered by subscriber id.
+   */
+  struct DispatchTable {
+    std::array<std::vector<Subscriber>, BUILTIN_EDITOR_EVENT_TYPE_COUNT>
+        builtin;
+    std::unordered_map<u32, std::vector<Subscriber>> custom;
+    std::vector<Subscriber> wildcard; // no type filter
+  };
+
+  /**
+   * @brief Bump allocator for queued events, reset once per frame
+   */
+  class EventArena {
+  public:
+    template <typename T, typename... Args> T *create(Args &&...args) {
+      void *memory = allocate(sizeof(T), alignof(T));
+      return new (memory) T(std::forward<Args>(args)...);
+    }
+
+    void reset();
+
+  private:
+    static constexpr size_t BLOCK_SIZE = 16 * 1024;
+
+    void *allocate(size_t size, size_t alignment);
+
+    std::vector<std::unique_ptr<std::byte[]>> m_blocks;
+    std::vector<size_t> m_blockSizes;
+    size_t m_block = 0;
+    size_t m_offset = 0;
+  };
+
+  struct QueuedEvent {
+    EditorEvent *event = nullptr;
+    bool heapOwned = false;
+  };
+
+  struct FrameQueue {
+    EventArena arena;
+    std::vector<QueuedEvent> events;
+    std::unordered_map<std::string, size_t> coalesceIndex;
+  };
+
   void dispatchEvent(const EditorEvent &event);
+  void enqueueLocal(EditorEvent *event, bool heapOwned);
+  void drainCrossThreadEvents();
+  void releaseFrame(FrameQueue &frame);
+  void rebuildDispatchTable();
+  [[nodiscard]] bool isDispatchThread() const {
+    return m_dispatchThread.load(std::memory_order_relaxed) ==
+           std::this_thread::get_id();
+  }
+
+  static void invokeSubscriber(const Subscriber &subscriber,
+                               const EditorEvent &event);
 
   std::vector<Subscriber> m_subscribers;
-  std::queue<std::unique_ptr<EditorEvent>> m_eventQueue;
+  std::shared_ptr<const DispatchTable> m_dispatchTable;
   u64 m_nextSubscriberId = 1;
 
+  // Queued events: written by the dispatch thread only, double-buffered so
+  // events queued by handlers land in the next frame
+  std::array<FrameQueue, 2> m_frames;
+  size_t m_writeFrame = 0;
+  bool m_processing = false;
+  std::atomic<std::thread::id> m_dispatchThread;
+
+  // Events posted from other threads
+  static constexpr size_t CROSS_THREAD_RING_SIZE = 1024;
+  MpscRing<EditorEvent *> m_crossThreadRing{CROSS_THREAD_RING_SIZE};
+  std::vector<std::unique_ptr<EditorEvent>> m_overflow; // guarded by m_mutex
+  std::atomic<bool> m_hasOverflow{false};
+
   bool m_synchronous = true;
+  bool m_coalescing = true;
+  u64 m_coalescedCount = 0;
   bool m_historyEnabled = false;
-  std::vector<std::string> m_eventHistory;
+  std::deque<std::string> m_eventHistory;
   static constexpr size_t MAX_HISTORY_SIZE = 100;
 
   mutable std::mutex m_mutex;
@@ -9,6 +9,7 @@
  * - Handles property change callbacks (onBefore/onAfter)
  * - Automatic dependent system updates
  * - Undo/Redo integration for property changes
+ * - Setting one property on many selected objects as a single edit
  *
  * This bridges the Property Introspection System with the actual objects,
  * enabling the GUI Inspector to display and edit properties.
@@ -17,6 +18,7 @@
 #include "NovelMind/core/property_system.hpp"
 #include "NovelMind/core/result.hpp"
 #include "NovelMind/core/types.hpp"
+#include "NovelMind/editor/undo_system.hpp"
 #include "NovelMind/scripting/ir.hpp"
 #include <functional>
 #include <memory>
@@ -31,7 +33,6 @@ namespace NovelMind::editor {
 
 // Forward declarations
 class InspectorBindingManager;
-class UndoManager;
 class EventBus;
 
 /**
@@ -127,6 +128,53 @@ struct PropertyGroup {
   std::vector<const IPropertyAccessor *> properties;
 };
 
+/**
+ * @brief Undo entry for one value written to a property on many objects
+ *
+ * Holds the objects by pointer, like InspectorTarget; they must outlive the
+ * undo history entry.
+ */
+template <typename PropType> class PropertyBatchCommand : public IEditorCommand {
+public:
+  PropertyBatchCommand(PropertyHandle<PropType> property,
+                       std::vector<void *> objects,
+                       std::vector<PropType> oldValues, PropType newValue)
+      : m_property(property), m_objects(std::move(objects)),
+        m_oldValues(std::move(oldValues)), m_newValue(std::move(newValue)) {}
+
+  void execute() override {
+    for (void *object : m_objects) {
+      m_property.set(object, m_newValue);
+    }
+  }
+
+  void undo() override {
+    for (size_t i = 0; i < m_objects.size(); ++i) {
+      m_property.set(m_objects[i], m_oldValues[i]);
+    }
+  }
+
+  [[nodiscard]] std::string getDescription() const override {
+    std::string description = "Set " + m_property.getMeta().displayName;
+    if (m_objects.size() > 1) {
+      description += " on " + std::to_string(m_objects.size()) + " objects";
+    }
+    return description;
+  }
+
+  [[nodiscard]] std::string getCategory() const override {
+    return "Inspector";
+  }
+
+  [[nodiscard]] size_t getObjectCount() const { return m_objects.size(); }
+
+private:
+  PropertyHandle<PropType> m_property;
+  std::vector<void *> m_objects;
+  std::vector<PropType> m_oldValues;
+  PropType m_newValue;
+};
+
 /**
  * @brief Inspector binding manager
  *
@@ -256,6 +304,58 @@ public:
    */
   [[nodiscard]] bool isInBatch() const;
 
+  // =========================================================================
+  // Multi-Object Editing
+  // =========================================================================
+
+  /**
+   * @brief Set a property to one value on several objects of the same type
+   *
+   * The property is resolved and the value validated once, then each object
+   * is written through the typed accessor. Handlers and listeners see one
+   * change whose context names the first target; the undo manager gets one
+   * entry and the event bus one PropertyChangedEvent for the whole set.
+   * @return Error message if validation fails, empty optional on success
+   */
+  std::optional<std::string>
+  setPropertyValueOnTargets(const std::vector<InspectorTarget> &targets,
+                            const std::string &name,
+                            const PropertyValue &value);
+
+  /**
+   * @brief Typed version taking a handle resolved from the targets' TypeInfo
+   */
+  template <typename PropType>
+  std::optional<std::string>
+  setPropertyValueOnTargets(const std::vector<InspectorTarget> &targets,
+                            const PropertyHandle<PropType> &property,
+                            const PropType &value) {
+    if (!property) {
+      return "Property not found";
+    }
+
+    PropertyChangeContext context;
+    if (auto error = prepareTargetsChange(targets, *property.getAccessor(),
+                                          PropertyValue(value), context)) {
+      return error;
+    }
+
+    std::vector<void *> objects;
+    std::vector<PropType> oldValues;
+    objects.reserve(targets.size());
+    oldValues.reserve(targets.size());
+    for (const auto &target : targets) {
+      objects.push_back(target.object);
+      oldValues.push_back(property.get(target.object));
+    }
+
+    commitTargetsChange(context, property.getMeta(), targets,
+                        std::make_unique<PropertyBatchCommand<PropType>>(
+                            property, std::move(objects), std::move(oldValues),
+                            value));
+    return std::nullopt;
+  }
+
   // =========================================================================
   // Property Binding Configuration
   // =========================================================================
@@ -360,14 +460,26 @@ public:
 private:
   // Internal methods
   const TypeInfo *getTypeInfoForTarget() const;
+  const TypeInfo *getTypeInfoFor(const std::type_index &type) const;
   bool validatePropertyChange(const PropertyChangeContext &context,
+                              const PropertyMeta &meta,
                               std::string &error) const;
+  std::optional<std::string>
+  prepareTargetsChange(const std::vector<InspectorTarget> &targets,
+                       const IPropertyAccessor &property,
+                       const PropertyValue &value,
+                       PropertyChangeContext &context);
+  void commitTargetsChange(const PropertyChangeContext &context,
+                           const PropertyMeta &meta,
+                           const std::vector<InspectorTarget> &targets,
+                           std::unique_ptr<IEditorCommand> command);
   void notifyTargetChanged();
   void notifyPropertyWillChange(const PropertyChangeContext &context);
   void notifyPropertyDidChange(const PropertyChangeContext &context);
   void recordPropertyChange(const PropertyChangeContext &context);
   void refreshDependentProperties(const std::string &propertyName);
-  void publishPropertyChangedEvent(const PropertyChangeContext &context);
+  void publishPropertyChangedEvent(const PropertyChangeContext &context,
+                                   const std::string &objectId);
 
   // Current target
   InspectorTarget m_target;
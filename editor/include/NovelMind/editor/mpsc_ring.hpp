@@ -0,0 +1,96 @@
+#pragma once
+
+/**
+ * @file mpsc_ring.hpp
+ * @brief Bounded lock-free multi-producer / single-consumer ring buffer
+ *
+ * Each slot carries a sequence number so producers claim slots with a single
+ * CAS and the consumer never takes a lock. Capacity is rounded up to a power
+ * of two. push() fails instead of blocking when the ring is full.
+ */
+
+#include "NovelMind/core/types.hpp"
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace NovelMind::editor {
+
+template <typename T> class MpscRing {
+public:
+  explicit MpscRing(size_t capacity) {
+    size_t size = 2;
+    while (size < capacity) {
+      size <<= 1;
+    }
+    m_mask = size - 1;
+    m_cells = std::make_unique<Cell[]>(size);
+    for (size_t i = 0; i < size; ++i) {
+      m_cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  MpscRing(const MpscRing &) = delete;
+  MpscRing &operator=(const MpscRing &) = delete;
+
+  /**
+   * @brief Enqueue a value; safe from any thread
+   * @return false if the ring is full
+   */
+  bool push(T value) {
+    size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+    Cell *cell = nullptr;
+    for (;;) {
+      cell = &m_cells[pos & m_mask];
+      const size_t seq = cell->sequence.load(std::memory_order_acquire);
+      const auto diff =
+          static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+      if (diff == 0) {
+        if (m_enqueuePos.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = m_enqueuePos.load(std::memory_order_relaxed);
+      }
+    }
+    cell->value = std::move(value);
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Dequeue a value; only the consumer thread may call this
+   * @return false if the ring is empty
+   */
+  bool pop(T &out) {
+    Cell &cell = m_cells[m_dequeuePos & m_mask];
+    const size_t seq = cell.sequence.load(std::memory_order_acquire);
+    if (static_cast<std::ptrdiff_t>(seq) -
+            static_cast<std::ptrdiff_t>(m_dequeuePos + 1) <
+        0) {
+      return false;
+    }
+    out = std::move(cell.value);
+    cell.sequence.store(m_dequeuePos + m_mask + 1, std::memory_order_release);
+    ++m_dequeuePos;
+    return true;
+  }
+
+  [[nodiscard]] size_t capacity() const { return m_mask + 1; }
+
+private:
+  struct Cell {
+    std::atomic<size_t> sequence{0};
+    T value{};
+  };
+
+  std::unique_ptr<Cell[]> m_cells;
+  size_t m_mask = 0;
+  alignas(64) std::atomic<size_t> m_enqueuePos{0};
+  alignas(64) size_t m_dequeuePos = 0;
+};
+
+} // namespace NovelMind::editor
@@ -26,6 +26,7 @@
 
 #include "NovelMind/core/result.hpp"
 #include "NovelMind/core/types.hpp"
+#include "NovelMind/editor/project_manifest.hpp"
 #include <chrono>
 #include <filesystem>
 #include <functional>
@@ -246,10 +247,40 @@ public:
   /**
    * @brief Get all project files of a certain type
    * @param extension File extension filter (e.g., ".nms", ".png")
+   *
+   * Answered from the project manifest while one is loaded; call
+   * refreshManifest() to pick up files changed on disk since.
    */
   [[nodiscard]] std::vector<std::string>
   getProjectFiles(const std::string &extension) const;
 
+  // =========================================================================
+  // Project Manifest
+  // =========================================================================
+
+  /**
+   * @brief Rescan the project against the manifest and save the manifest
+   *
+   * Runs when a project opens. Only files whose size or modification time
+   * changed are read again.
+   */
+  Result<ManifestScanResult> refreshManifest();
+
+  /**
+   * @brief Files listed by the last scan
+   */
+  [[nodiscard]] const ProjectManifest &getManifest() const;
+
+  /**
+   * @brief Files added, modified and removed at the last scan
+   */
+  [[nodiscard]] const ManifestScanResult &getLastManifestScan() const;
+
+  /**
+   * @brief Where the manifest of the open project is cached
+   */
+  [[nodiscard]] std::string getManifestPath() const;
+
   // =========================================================================
   // Folder Structure
   // =========================================================================
@@ -454,6 +485,10 @@ private:
   // Backup
   size_t m_maxBackups = 5;
 
+  // Manifest
+  ProjectManifest m_manifest;
+  ManifestScanResult m_lastManifestScan;
+
   // Listeners
   std::vector<IProjectListener *> m_listeners;
 
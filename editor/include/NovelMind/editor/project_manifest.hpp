@@ -0,0 +1,123 @@
+#pragma once
+
+/**
+ * @file project_manifest.hpp
+ * @brief Cached listing of every project file with its size, time and hash
+ *
+ * Opening a project validates the cached manifest instead of rebuilding it:
+ * scan() walks the tree in parallel, one job per directory, and re-hashes
+ * only files whose size or modification time differ from the cache. The
+ * result lists which files were added, modified or removed, so importers
+ * only revisit those.
+ *
+ * A file whose time changed but whose content hash did not is refreshed in
+ * the manifest without being reported as modified.
+ *
+ * Layout (little-endian):
+ *   ProjectManifestHeader (24 bytes), then per entry, sorted by path:
+ *   u16 prefix shared with the previous path, u16 suffix length, suffix,
+ *   u64 size, i64 modification time, u64 content hash
+ */
+
+#include "NovelMind/core/types.hpp"
+#include "NovelMind/core/result.hpp"
+#include <string>
+#include <vector>
+
+namespace NovelMind::editor
+{
+
+constexpr u32 PROJECT_MANIFEST_MAGIC = 0x4D504D4E; // "NMPM" in little-endian
+constexpr u16 PROJECT_MANIFEST_VERSION = 1;
+
+struct ProjectManifestHeader
+{
+    u32 magic;
+    u16 version;
+    u16 flags;        // Reserved, 0
+    u32 entryCount;
+    u32 payloadSize;  // Entry bytes after the header
+    u64 payloadHash;  // FNV-1a of the payload
+};
+static_assert(sizeof(ProjectManifestHeader) == 24, "ProjectManifestHeader layout is part of the file format");
+
+struct ManifestEntry
+{
+    std::string path;  // Relative to the project root, '/' separated
+    u64 size = 0;
+    i64 modifiedTime = 0; // File clock ticks
+    u64 hash = 0;         // FNV-1a of the content
+};
+
+struct ManifestScanOptions
+{
+    u32 threadCount = 0; // 0 uses one per core
+    std::vector<std::string> excludedDirectories = {".temp", ".backup", ".thumbnails", "Build"};
+};
+
+/**
+ * @brief What a scan found relative to the previous manifest
+ *
+ * Paths are relative to the project root and sorted.
+ */
+struct ManifestScanResult
+{
+    std::vector<std::string> added;
+    std::vector<std::string> modified;
+    std::vector<std::string> removed;
+    usize unchangedCount = 0;
+    usize hashedCount = 0;    // Files whose content was read
+    usize directoryCount = 0;
+
+    [[nodiscard]] bool hasChanges() const
+    {
+        return !added.empty() || !modified.empty() || !removed.empty();
+    }
+};
+
+class ProjectManifest
+{
+public:
+    /**
+     * @brief Walk @p root and bring the manifest up to date with it
+     *
+     * Directories whose project-relative path is excluded are skipped with
+     * everything below them; symlinked directories are not followed.
+     */
+    Result<ManifestScanResult> scan(const std::string& root, const ManifestScanOptions& options = {});
+
+    Result<void> load(const std::string& path);
+
+    /**
+     * @brief Write the manifest, replacing @p path in one step
+     */
+    Result<void> save(const std::string& path) const;
+
+    [[nodiscard]] std::vector<u8> encode() const;
+    Result<void> decode(const u8* data, usize size);
+
+    /**
+     * @brief Entry for a project-relative path, nullptr if not listed
+     */
+    [[nodiscard]] const ManifestEntry* find(const std::string& path) const;
+
+    /**
+     * @brief Project-relative paths ending in @p extension (e.g. ".nms")
+     */
+    [[nodiscard]] std::vector<std::string> getFiles(const std::string& extension) const;
+
+    [[nodiscard]] const std::vector<ManifestEntry>& getEntries() const { return m_entries; }
+    [[nodiscard]] usize size() const { return m_entries.size(); }
+    [[nodiscard]] bool empty() const { return m_entries.empty(); }
+    void clear() { m_entries.clear(); }
+
+    /**
+     * @brief FNV-1a of a file's content
+     */
+    [[nodiscard]] static Result<u64> hashFile(const std::string& path);
+
+private:
+    std::vector<ManifestEntry> m_entries; // Sorted by path
+};
+
+} // namespace NovelMind::editor
@@ -0,0 +1,185 @@
+#pragma once
+
+/**
+ * @file story_flow_analysis.hpp
+ * @brief Linear-time story flow analysis for the script reference map
+ *
+ * Works on the scene/choice graph extracted from scripts:
+ * - Tarjan SCC condensation (cycle detection)
+ * - Path counts over the condensed DAG (saturating, no enumeration)
+ * - Dominator tree ("every route passes here")
+ * - Reachability and depth from the entry points via one BFS
+ *
+ * The graph is stored per source file so a changed file only replaces its
+ * own nodes and edges. Analysis can run on a background worker thread.
+ */
+
+#include "NovelMind/core/types.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace NovelMind::editor
+{
+
+/**
+ * @brief Directed edge between two scenes or choice targets
+ */
+struct StoryFlowEdge
+{
+    std::string from;
+    std::string to;
+};
+
+/**
+ * @brief Result of a story flow analysis
+ *
+ * Per-node arrays are indexed by the position of the node in @c nodes.
+ */
+struct StoryFlowResult
+{
+    static constexpr i32 NO_NODE = -1;
+
+    std::vector<std::string> nodes;
+    std::unordered_map<std::string, u32> nodeIndex;
+    std::vector<u32> entryPoints;
+    std::vector<u32> endpoints;         // Nodes without outgoing edges
+
+    // Strongly connected components (ids are in reverse topological order)
+    std::vector<u32> componentOf;
+    u32 componentCount = 0;
+    std::vector<bool> inCycle;
+    u32 cycleCount = 0;                 // Components that contain a cycle
+
+    // Reachability from the entry points
+    std::vector<bool> reachable;
+    std::vector<i32> depth;             // BFS distance, -1 if unreachable
+
+    // Path counts over the condensed DAG, saturating at UINT64_MAX
+    std::vector<u64> pathsFromEntry;    // Entry -> node
+    std::vector<u64> pathsToEnding;     // Node -> any endpoint
+    u64 totalPaths = 0;                 // Entry -> endpoint
+    bool pathCountSaturated = false;
+
+    // Immediate dominator of each node, NO_NODE for entries and unreachable
+    std::vector<i32> immediateDominator;
+
+    u64 revision = 0;
+    f64 analysisTimeMs = 0.0;
+
+    [[nodiscard]] i32 find(const std::string& id) const;
+    [[nodiscard]] bool isReachable(const std::string& id) const;
+
+    /**
+     * @brief Check whether every route from an entry to @p node passes @p dominator
+     */
+    [[nodiscard]] bool dominates(const std::string& dominator, const std::string& node) const;
+
+    /**
+     * @brief Scenes that every route to @p id passes through, nearest first
+     */
+    [[nodiscard]] std::vector<std::string> getDominators(const std::string& id) const;
+};
+
+/**
+ * @brief Incremental story flow graph with optional background analysis
+ */
+class StoryFlowAnalyzer
+{
+public:
+    using CompletionCallback = std::function<void(std::shared_ptr<const StoryFlowResult>)>;
+
+    StoryFlowAnalyzer();
+    ~StoryFlowAnalyzer();
+
+    StoryFlowAnalyzer(const StoryFlowAnalyzer&) = delete;
+    StoryFlowAnalyzer& operator=(const StoryFlowAnalyzer&) = delete;
+
+    // Graph updates (thread-safe)
+
+    /**
+     * @brief Replace the nodes and edges contributed by one file
+     */
+    void setFileGraph(const std::string& filePath, std::vector<std::string> nodes,
+                      std::vector<StoryFlowEdge> edges);
+    void removeFile(const std::string& filePath);
+    void clear();
+
+    /**
+     * @brief Set explicit entry points (otherwise nodes without callers are used)
+     */
+    void setEntryPoints(std::vector<std::string> entryPoints);
+
+    [[nodiscard]] u64 getRevision() const;
+
+    // Analysis
+
+    /**
+     * @brief Analyze the current graph on the calling thread
+     */
+    [[nodiscard]] StoryFlowResult analyze() const;
+
+    /**
+     * @brief Schedule analysis on the worker thread
+     *
+     * Requests made while an analysis is running are merged into one rerun.
+     */
+    void requestAnalysis();
+
+    /**
+     * @brief Block until the latest requested analysis has been published
+     */
+    void waitForIdle();
+
+    /**
+     * @brief Latest published result (null before the first analysis)
+     */
+    [[nodiscard]] std::shared_ptr<const StoryFlowResult> getResult() const;
+
+    /**
+     * @brief Called on the worker thread whenever a result is published
+     */
+    void setOnAnalysisCompleted(CompletionCallback callback);
+
+private:
+    struct FileGraph
+    {
+        std::vector<std::string> nodes;
+        std::vector<StoryFlowEdge> edges;
+    };
+
+    struct Snapshot
+    {
+        std::map<std::string, FileGraph> files;
+        std::vector<std::string> entryPoints;
+        u64 revision = 0;
+    };
+
+    [[nodiscard]] Snapshot takeSnapshot() const;
+    static StoryFlowResult analyzeSnapshot(const Snapshot& snapshot);
+    void workerLoop();
+
+    mutable std::mutex m_mutex;
+    std::map<std::string, FileGraph> m_files;
+    std::vector<std::string> m_entryPoints;
+    u64 m_revision = 0;
+
+    // Worker state (guarded by m_mutex)
+    std::condition_variable m_wake;
+    std::condition_variable m_idle;
+    std::unique_ptr<std::thread> m_worker;
+    bool m_pending = false;
+    bool m_running = false;
+    bool m_stop = false;
+    std::shared_ptr<const StoryFlowResult> m_result;
+    CompletionCallback m_onCompleted;
+};
+
+} // namespace NovelMind::editor
@@ -0,0 +1,177 @@
+#pragma once
+
+/**
+ * @file symbol_index.hpp
+ * @brief Project-wide symbol index for NovelMind scripts
+ *
+ * A single incremental index shared by the reference map, integrity checker,
+ * voice manager and panels:
+ * - Maps scenes, characters, variables, flags, asset ids and localization
+ *   keys to their definition and use sites
+ * - Updated per changed file using the real lexer/parser
+ * - Persisted to a compact binary file so startup only reparses files whose
+ *   size, timestamp or content hash changed
+ *
+ * Lookups are a single hash probe followed by a scan of that symbol's sites.
+ */
+
+#include "NovelMind/core/types.hpp"
+#include "NovelMind/core/result.hpp"
+#include "NovelMind/scripting/ast.hpp"
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace NovelMind::editor
+{
+
+/**
+ * @brief Kind of indexed symbol
+ */
+enum class SymbolKind : u8
+{
+    Scene,
+    Character,
+    Variable,
+    Flag,           // Variable assigned a boolean literal
+    Asset,          // Resources referenced by show/play and default sprites
+    LocalizationKey // String passed to tr("...") / loc("...")
+};
+
+/**
+ * @brief Whether a site defines or uses the symbol
+ */
+enum class SymbolRole : u8
+{
+    Definition,
+    Use
+};
+
+/**
+ * @brief A definition or use site
+ */
+struct SymbolLocation
+{
+    std::string filePath;
+    u32 line = 0;
+    u32 column = 0;
+    SymbolRole role = SymbolRole::Use;
+};
+
+/**
+ * @brief Incremental, persistent symbol index
+ */
+class SymbolIndex
+{
+public:
+    static constexpr u32 FILE_MAGIC = 0x49534D4E; // "NMSI"
+    static constexpr u32 FILE_VERSION = 1;
+
+    SymbolIndex() = default;
+    ~SymbolIndex() = default;
+
+    SymbolIndex(const SymbolIndex&) = delete;
+    SymbolIndex& operator=(const SymbolIndex&) = delete;
+
+    // Updates
+
+    /**
+     * @brief Index a script file from disk, skipping it if unchanged
+     * @return true if the file was (re)parsed
+     */
+    Result<bool> indexFile(const std::string& filePath);
+
+    /**
+     * @brief Index script source for a file path, replacing previous sites
+     */
+    Result<void> indexSource(const std::string& filePath, const std::string& source);
+
+    /**
+     * @brief Index an already parsed program
+     */
+    void indexProgram(const std::string& filePath, const scripting::Program& program);
+
+    void removeFile(const std::string& filePath);
+    void clear();
+
+    /**
+     * @brief Re-index every listed file that changed and drop files no longer listed
+     * @return Number of files that were reparsed
+     */
+    Result<usize> refresh(const std::vector<std::string>& filePaths);
+
+    // Queries
+
+    [[nodiscard]] std::vector<SymbolLocation> findReferences(SymbolKind kind,
+                                                             const std::string& name) const;
+    [[nodiscard]] std::optional<SymbolLocation> findDefinition(SymbolKind kind,
+                                                               const std::string& name) const;
+    [[nodiscard]] bool isDefined(SymbolKind kind, const std::string& name) const;
+    [[nodiscard]] usize getUseCount(SymbolKind kind, const std::string& name) const;
+    [[nodiscard]] std::vector<std::string> getSymbols(SymbolKind kind) const;
+
+    /**
+     * @brief Symbols of a kind that are used but never defined
+     */
+    [[nodiscard]] std::vector<std::string> getUndefinedSymbols(SymbolKind kind) const;
+
+    [[nodiscard]] std::vector<std::string> getIndexedFiles() const;
+    [[nodiscard]] usize getSymbolCount() const;
+
+    // Persistence
+
+    Result<void> save(const std::string& path) const;
+    Result<void> load(const std::string& path);
+
+private:
+    struct Site
+    {
+        u32 file;
+        u32 line;
+        u32 column;
+        SymbolRole role;
+    };
+
+    struct Symbol
+    {
+        SymbolKind kind;
+        std::string name;
+        std::vector<Site> sites;
+    };
+
+    struct FileEntry
+    {
+        std::string path;
+        u64 size = 0;
+        i64 modifiedTime = 0;
+        u64 contentHash = 0;
+        std::vector<u32> symbols; // Symbols this file contributed sites to
+        bool live = false;
+    };
+
+    class Collector;
+
+    static std::string makeKey(SymbolKind kind, const std::string& name);
+    static u64 hashContent(const std::string& content);
+
+    u32 fileSlot(const std::string& filePath);
+    u32 symbolSlot(SymbolKind kind, const std::string& name);
+    void removeFileLocked(u32 file);
+    void addSite(u32 file, SymbolKind kind, const std::string& name, scripting::SourceLocation loc,
+                 SymbolRole role);
+    void indexProgramLocked(u32 file, const scripting::Program& program);
+    Result<void> indexSourceLocked(u32 file, const std::string& source);
+    [[nodiscard]] const Symbol* lookup(SymbolKind kind, const std::string& name) const;
+    [[nodiscard]] SymbolLocation toLocation(const Site& site) const;
+
+    std::vector<Symbol> m_symbols;
+    std::unordered_map<std::string, u32> m_symbolIds;
+    std::vector<FileEntry> m_files;
+    std::unordered_map<std::string, u32> m_fileIds;
+
+    mutable std::mutex m_mutex;
+};
+
+} // namespace NovelMind::editor
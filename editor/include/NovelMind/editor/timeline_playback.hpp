@@ -14,7 +14,9 @@
  * This enables the Timeline GUI to play animations and preview scenes.
  */
 
+#include "NovelMind/core/result.hpp"
 #include "NovelMind/core/types.hpp"
+#include "NovelMind/scene/compiled_timeline.hpp"
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -27,6 +29,8 @@ namespace NovelMind::editor {
 
 // Forward declarations
 class TimelinePlaybackEngine;
+class Timeline;
+class TimelineTrack;
 
 /**
  * @brief Playback state
@@ -376,6 +380,31 @@ public:
    */
   void clearAllSolo();
 
+  // =========================================================================
+  // Timeline Content
+  // =========================================================================
+
+  /**
+   * @brief Compile a timeline's property keyframes for playback
+   *
+   * Registers every track, sets the duration and replaces any previously
+   * loaded content. Evaluation then runs on the compiled form in engine_core,
+   * so preview matches in-game playback.
+   */
+  Result<void> loadTimeline(const Timeline &timeline,
+                            const scene::TimelineCompileOptions &options = {});
+
+  /**
+   * @brief Drop compiled timeline content
+   */
+  void unloadTimeline();
+
+  /**
+   * @brief Bind compiled channels to objects in a scene graph
+   * @return Number of channels bound
+   */
+  usize bindScene(scene::SceneGraph *graph);
+
   // =========================================================================
   // Event Scheduling
   // =========================================================================
@@ -429,7 +458,8 @@ public:
 
   /**
    * @brief Evaluate timeline at current time
-   * This triggers callbacks for all tracks and keyframes at current time
+   * Interpolates all enabled tracks and writes the bound scene objects.
+   * Called automatically on update, seek and scrub.
    */
   void evaluate();
 
@@ -482,6 +512,10 @@ private:
   void notifyTrackStateChanged(const std::string &trackId);
   void handleLoopBoundary();
   f64 clampTime(f64 time) const;
+  void evaluateLocked();
+  void refreshTrackActivation();
+  void collectTrack(const TimelineTrack &track,
+                    scene::TimelineCompiler &compiler);
 
   // State
   PlaybackState m_state = PlaybackState::Stopped;
@@ -501,6 +535,11 @@ private:
   // Tracks
   std::unordered_map<std::string, TrackPlaybackState> m_tracks;
 
+  // Compiled content (track id -> compiled track index)
+  scene::CompiledTimeline m_compiled;
+  std::unordered_map<std::string, u32> m_compiledTracks;
+  bool m_hasCompiled = false;
+
   // Scheduled events
   std::vector<ScheduledEvent> m_scheduledEvents;
   u64 m_nextEventId = 1;
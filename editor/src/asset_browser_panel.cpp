@@ -311,7 +311,7 @@ bool AssetBrowserPanel::isAssetSelected(const std::string& path) const
 // Metadata
 // =========================================================================
 
-const AssetMetadata* AssetBrowserPanel::getAssetMetadata(const std::string& path) const
+const AssetBrowserMetadata* AssetBrowserPanel::getAssetMetadata(const std::string& path) const
 {
     for (const auto& entry : m_entries)
     {
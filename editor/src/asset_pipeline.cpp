@@ -4,6 +4,12 @@
  */
 
 #include "NovelMind/editor/asset_pipeline.hpp"
+#include "NovelMind/editor/project_manifest.hpp"
+#include "NovelMind/renderer/image_decoder.hpp"
+#include "NovelMind/renderer/image_kernels.hpp"
+#include "NovelMind/renderer/raw_texture.hpp"
+#include "NovelMind/renderer/sdf_font_builder.hpp"
+#include "NovelMind/vfs/resource_variants.hpp"
 #include <filesystem>
 #include <fstream>
 #include <algorithm>
@@ -77,7 +83,7 @@ ImageImporter::ImageImporter()
 
 std::vector<std::string> ImageImporter::getSupportedExtensions() const
 {
-    return {".png", ".jpg", ".jpeg", ".bmp", ".gif", ".webp", ".tga"};
+    return {".png", ".qoi", ".jpg", ".jpeg", ".bmp", ".gif", ".webp", ".tga"};
 }
 
 AssetType ImageImporter::getAssetType() const
@@ -153,7 +159,9 @@ std::string ImageImporter::getDefaultSettingsJson() const
         "maxWidth": 4096,
         "maxHeight": 4096,
         "powerOfTwo": false,
-        "compressionQuality": 0.8
+        "compressionQuality": 0.8,
+        "generateVariants": true,
+        "variantMinSize": 256
     })";
 }
 
@@ -172,10 +180,54 @@ Result<void> ImageImporter::processImage(const std::string& sourcePath,
 {
     try
     {
-        // For now, just copy the file
-        // In production, would use stb_image/stb_image_write for processing
-        fs::copy(sourcePath, destPath, fs::copy_options::overwrite_existing);
-        return Result<void>::ok();
+        std::ifstream in(sourcePath, std::ios::binary);
+        std::vector<u8> encoded((std::istreambuf_iterator<char>(in)),
+                                std::istreambuf_iterator<char>());
+        const bool decodable = renderer::ImageDecoder::detectFormat(
+                                   encoded.data(), encoded.size()) != renderer::ImageFormat::Unknown;
+        const bool bakeOriginal = m_settings.compression == ImageCompression::None;
+
+        // Variants from an earlier import must not outlive a smaller source
+        for (u32 divisor : vfs::RESOURCE_VARIANT_DIVISORS)
+        {
+            fs::remove(vfs::ResourceVariants::variantId(destPath, divisor));
+        }
+
+        if (!decodable || (!bakeOriginal && !m_settings.generateVariants))
+        {
+            // Formats the engine cannot decode are copied as-is
+            fs::copy(sourcePath, destPath, fs::copy_options::overwrite_existing);
+            return Result<void>::ok();
+        }
+
+        renderer::ImageDecodeOptions decodeOptions;
+        decodeOptions.premultiplyAlpha = m_settings.premultiplyAlpha;
+        decodeOptions.maxWidth = static_cast<u32>(std::max(0, m_settings.maxWidth));
+        decodeOptions.maxHeight = static_cast<u32>(std::max(0, m_settings.maxHeight));
+        auto image = renderer::ImageDecoder::decode(encoded.data(), encoded.size(), decodeOptions);
+        if (image.isError())
+        {
+            return Result<void>::error("Failed to decode image: " + image.error());
+        }
+
+        // Uncompressed output is baked to an upload-ready raw texture; the
+        // runtime recognizes the payload by its header, so the imported path
+        // is unchanged
+        if (bakeOriginal)
+        {
+            auto written = writeRawTexture(image.value(), destPath);
+            if (written.isError())
+            {
+                return written;
+            }
+        }
+        else
+        {
+            fs::copy(sourcePath, destPath, fs::copy_options::overwrite_existing);
+        }
+
+        return m_settings.generateVariants ? writeVariants(image.value(), destPath)
+                                           : Result<void>::ok();
     }
     catch (const fs::filesystem_error& e)
     {
@@ -183,6 +235,73 @@ Result<void> ImageImporter::processImage(const std::string& sourcePath,
     }
 }
 
+Result<void> ImageImporter::writeVariants(const renderer::DecodedImage& original,
+                                          const std::string& destPath)
+{
+    // Each variant is resampled from the previous one; imported next to the
+    // original as "<file>@<divisor>" they pack under the variant ids the
+    // runtime looks up (see vfs/resource_variants.hpp)
+    auto halve = [](const renderer::DecodedImage& image) {
+        renderer::DecodedImage half;
+        half.width = std::max(1u, image.width / 2);
+        half.height = std::max(1u, image.height / 2);
+        half.premultiplied = image.premultiplied;
+        half.pixels.resize(static_cast<usize>(half.width) * half.height * 4);
+        renderer::ImageKernels::resampleHalf(image.pixels.data(), image.width, image.height,
+                                             image.width * 4, half.pixels.data());
+        return half;
+    };
+
+    const u32 minSize = static_cast<u32>(std::max(1, m_settings.variantMinSize));
+    renderer::DecodedImage variant;
+    const renderer::DecodedImage* source = &original;
+    u32 sourceDivisor = 1;
+    for (u32 divisor : vfs::RESOURCE_VARIANT_DIVISORS)
+    {
+        while (sourceDivisor < divisor)
+        {
+            variant = halve(*source);
+            source = &variant;
+            sourceDivisor *= 2;
+        }
+        if (std::min(variant.width, variant.height) < minSize)
+        {
+            break;
+        }
+
+        auto written = writeRawTexture(variant, vfs::ResourceVariants::variantId(destPath, divisor));
+        if (written.isError())
+        {
+            return written;
+        }
+    }
+    return Result<void>::ok();
+}
+
+Result<void> ImageImporter::writeRawTexture(const renderer::DecodedImage& image,
+                                            const std::string& path)
+{
+    renderer::RawTextureOptions rawOptions;
+    rawOptions.premultiplyAlpha = false;
+    rawOptions.sourcePremultiplied = image.premultiplied;
+    rawOptions.generateMipmaps = m_settings.generateMipmaps;
+    auto raw = renderer::RawTexture::encode(image.pixels.data(), image.width, image.height, 0,
+                                            rawOptions);
+    if (raw.isError())
+    {
+        return Result<void>::error("Failed to encode raw texture: " + raw.error());
+    }
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char*>(raw.value().data()),
+              static_cast<std::streamsize>(raw.value().size()));
+    if (!out)
+    {
+        return Result<void>::error("Failed to write raw texture: " + path);
+    }
+    return Result<void>::ok();
+}
+
 Result<void> ImageImporter::generateThumbnail(const std::string& /*sourcePath*/,
                                                const std::string& thumbnailPath)
 {
@@ -383,7 +502,10 @@ std::string FontImporter::getDefaultSettingsJson() const
         "charset": "ascii",
         "antialiased": true,
         "padding": 2,
-        "generateSDF": false
+        "generateSDF": true,
+        "sdfEmSize": 32,
+        "sdfDistanceRange": 6,
+        "atlasPageSize": 1024
     })";
 }
 
@@ -402,8 +524,25 @@ Result<void> FontImporter::processFont(const std::string& sourcePath,
 {
     try
     {
-        // For now, just copy the file
-        // In production, would use FreeType to generate font atlases
+        // Pages from an earlier import must not outlive a smaller atlas
+        for (u32 page = 0;; ++page)
+        {
+            if (!fs::remove(renderer::SdfFontFormat::pageResourceId(destPath, page)))
+            {
+                break;
+            }
+        }
+
+        std::ifstream in(sourcePath, std::ios::binary);
+        std::vector<u8> fontData((std::istreambuf_iterator<char>(in)),
+                                 std::istreambuf_iterator<char>());
+        if (m_settings.generateSDF &&
+            renderer::SdfFontBuilder::isTrueType(fontData.data(), fontData.size()))
+        {
+            return writeSdfFont(fontData, destPath);
+        }
+
+        // Containers the builder cannot read are copied as-is
         fs::copy(sourcePath, destPath, fs::copy_options::overwrite_existing);
         return Result<void>::ok();
     }
@@ -413,6 +552,82 @@ Result<void> FontImporter::processFont(const std::string& sourcePath,
     }
 }
 
+Result<void> FontImporter::writeSdfFont(const std::vector<u8>& fontData,
+                                        const std::string& destPath)
+{
+    renderer::SdfFontBuildOptions options;
+    options.emSize = m_settings.sdfEmSize;
+    options.distanceRange = m_settings.sdfDistanceRange;
+    options.pageSize = static_cast<u32>(std::max(64, m_settings.atlasPageSize));
+    if (m_settings.charset == "ascii")
+    {
+        for (u32 cp = 0x20; cp < 0x7F; ++cp)
+        {
+            options.codepoints.push_back(cp);
+        }
+    }
+    else if (m_settings.charset == "latin1")
+    {
+        for (u32 cp = 0x20; cp <= 0xFF; ++cp)
+        {
+            if (cp < 0x7F || cp >= 0xA0)
+            {
+                options.codepoints.push_back(cp);
+            }
+        }
+    }
+    // "unicode" leaves the list empty: every character the font maps
+
+    auto build = renderer::SdfFontBuilder::build(fontData.data(), fontData.size(), options);
+    if (build.isError())
+    {
+        return Result<void>::error("Failed to build SDF font: " + build.error());
+    }
+
+    // The metrics replace the font at the imported path; the runtime
+    // recognizes them by their header and streams the pages next to it
+    auto metrics = renderer::SdfFontFormat::encode(build.value().metrics);
+    if (metrics.isError())
+    {
+        return Result<void>::error("Failed to encode SDF font: " + metrics.error());
+    }
+    {
+        std::ofstream out(destPath, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(metrics.value().data()),
+                  static_cast<std::streamsize>(metrics.value().size()));
+        if (!out)
+        {
+            return Result<void>::error("Failed to write SDF font: " + destPath);
+        }
+    }
+
+    const auto& pages = build.value().pages;
+    for (usize page = 0; page < pages.size(); ++page)
+    {
+        // Distance values are not colors: never premultiplied
+        renderer::RawTextureOptions rawOptions;
+        rawOptions.premultiplyAlpha = false;
+        auto raw = renderer::RawTexture::encode(pages[page].data(),
+                                                build.value().metrics.pageWidth,
+                                                build.value().pageHeights[page], 0, rawOptions);
+        if (raw.isError())
+        {
+            return Result<void>::error("Failed to encode font page: " + raw.error());
+        }
+
+        const std::string pagePath =
+            renderer::SdfFontFormat::pageResourceId(destPath, static_cast<u32>(page));
+        std::ofstream out(pagePath, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(raw.value().data()),
+                  static_cast<std::streamsize>(raw.value().size()));
+        if (!out)
+        {
+            return Result<void>::error("Failed to write font page: " + pagePath);
+        }
+    }
+    return Result<void>::ok();
+}
+
 // ============================================================================
 // AssetDatabase
 // ============================================================================
@@ -684,6 +899,8 @@ Result<AssetMetadata> AssetDatabase::reimportAsset(const std::string& assetId)
     auto result = importer->reimport(*metadata, this);
     if (result.isOk())
     {
+        // Importers build fresh metadata; the asset keeps its identity
+        result.value().id = assetId;
         updateAsset(result.value());
         fireAssetChanged({AssetChangeType::Reimported, assetId, result.value().importedPath, ""});
     }
@@ -746,6 +963,54 @@ std::vector<std::string> AssetDatabase::getOutdatedAssets() const
     return outdated;
 }
 
+usize AssetDatabase::applyManifestChanges(const ManifestScanResult& changes,
+                                          const std::string& projectRoot)
+{
+    std::unordered_map<std::string, std::string> sourceToId;
+    for (const auto& [id, metadata] : m_assets)
+    {
+        sourceToId[fs::path(metadata.sourcePath).lexically_normal().generic_string()] = id;
+    }
+    const std::string outputPrefix =
+        fs::path(getAssetsPath()).lexically_normal().generic_string() + "/";
+
+    usize processed = 0;
+    auto importChanged = [&](const std::string& relativePath) {
+        const fs::path sourcePath = (fs::path(projectRoot) / relativePath).lexically_normal();
+        const std::string key = sourcePath.generic_string();
+        if (key.rfind(outputPrefix, 0) == 0 || !getImporterForFile(key))
+        {
+            return;
+        }
+        auto known = sourceToId.find(key);
+        const bool imported = known != sourceToId.end()
+                                  ? reimportAsset(known->second).isOk()
+                                  : importAsset(sourcePath.string()).isOk();
+        if (imported)
+        {
+            ++processed;
+        }
+    };
+    for (const auto& path : changes.added)
+    {
+        importChanged(path);
+    }
+    for (const auto& path : changes.modified)
+    {
+        importChanged(path);
+    }
+
+    for (const auto& path : changes.removed)
+    {
+        auto known = sourceToId.find((fs::path(projectRoot) / path).lexically_normal().generic_string());
+        if (known != sourceToId.end())
+        {
+            unregisterAsset(known->second);
+        }
+    }
+    return processed;
+}
+
 // ============================================================================
 // Dependency Tracking
 // ============================================================================
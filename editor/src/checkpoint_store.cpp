@@ -0,0 +1,858 @@
+/**
+ * @file checkpoint_store.cpp
+ * @brief CheckpointStore implementation
+ */
+
+#include "NovelMind/editor/checkpoint_store.hpp"
+#include "NovelMind/vfs/lz4_block.hpp"
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+#include <unordered_map>
+
+namespace NovelMind::editor
+{
+
+namespace
+{
+
+constexpr u32 CHECKPOINT_MAGIC = 0x4B434D4E; // "NMCK" in little-endian
+constexpr u16 CHECKPOINT_VERSION = 1;
+
+// Delta operations
+constexpr u8 DELTA_REUSE = 1; // Run of entries copied from the previous image
+constexpr u8 DELTA_ENTRY = 2; // One entry stored as bytes
+
+// Image layout is native-endian: checkpoints never leave the process
+class ImageWriter
+{
+public:
+    explicit ImageWriter(std::vector<u8>& out)
+        : m_out(out)
+    {
+    }
+
+    template <typename T>
+    void put(T value)
+    {
+        const auto* bytes = reinterpret_cast<const u8*>(&value);
+        m_out.insert(m_out.end(), bytes, bytes + sizeof(T));
+    }
+
+    void putString(std::string_view value)
+    {
+        put(static_cast<u32>(value.size()));
+        const auto* bytes = reinterpret_cast<const u8*>(value.data());
+        m_out.insert(m_out.end(), bytes, bytes + value.size());
+    }
+
+    void putStrings(const std::vector<std::string>& values)
+    {
+        put(static_cast<u32>(values.size()));
+        for (const auto& value : values)
+        {
+            putString(value);
+        }
+    }
+
+private:
+    std::vector<u8>& m_out;
+};
+
+class ImageReader
+{
+public:
+    ImageReader(const u8* data, usize size)
+        : m_data(data), m_size(size)
+    {
+    }
+
+    template <typename T>
+    bool get(T& value)
+    {
+        if (m_size - m_pos < sizeof(T))
+        {
+            return false;
+        }
+        std::memcpy(&value, m_data + m_pos, sizeof(T));
+        m_pos += sizeof(T);
+        return true;
+    }
+
+    bool getString(std::string& value)
+    {
+        u32 length = 0;
+        if (!get(length) || m_size - m_pos < length)
+        {
+            return false;
+        }
+        value.assign(reinterpret_cast<const char*>(m_data + m_pos), length);
+        m_pos += length;
+        return true;
+    }
+
+    bool getStrings(std::vector<std::string>& values)
+    {
+        u32 count = 0;
+        if (!getCount(count))
+        {
+            return false;
+        }
+        values.resize(count);
+        for (auto& value : values)
+        {
+            if (!getString(value))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool getBytes(usize length, const u8*& bytes)
+    {
+        if (m_size - m_pos < length)
+        {
+            return false;
+        }
+        bytes = m_data + m_pos;
+        m_pos += length;
+        return true;
+    }
+
+    // Every element takes at least four bytes, which bounds a corrupt count
+    bool getCount(u32& count) { return get(count) && count <= (m_size - m_pos) / 4; }
+
+    [[nodiscard]] bool atEnd() const { return m_pos == m_size; }
+    [[nodiscard]] usize remaining() const { return m_size - m_pos; }
+
+private:
+    const u8* m_data;
+    usize m_size;
+    usize m_pos = 0;
+};
+
+// Sorted so unchanged state serializes to identical bytes
+template <typename Map>
+std::vector<typename Map::const_pointer> sortedEntries(const Map& map)
+{
+    std::vector<typename Map::const_pointer> entries;
+    entries.reserve(map.size());
+    for (const auto& entry : map)
+    {
+        entries.push_back(&entry);
+    }
+    std::sort(entries.begin(), entries.end(),
+              [](const auto* a, const auto* b) { return a->first < b->first; });
+    return entries;
+}
+
+void putValue(ImageWriter& writer, const scripting::Value& value)
+{
+    writer.put(static_cast<u8>(value.index()));
+    if (const auto* i = std::get_if<i32>(&value))
+    {
+        writer.put(*i);
+    }
+    else if (const auto* f = std::get_if<f32>(&value))
+    {
+        writer.put(*f);
+    }
+    else if (const auto* b = std::get_if<bool>(&value))
+    {
+        writer.put(static_cast<u8>(*b));
+    }
+    else if (const auto* s = std::get_if<std::string>(&value))
+    {
+        writer.putString(*s);
+    }
+}
+
+bool getValue(ImageReader& reader, scripting::Value& value)
+{
+    u8 index = 0;
+    if (!reader.get(index))
+    {
+        return false;
+    }
+    switch (index)
+    {
+    case 0:
+        value = std::monostate{};
+        return true;
+    case 1:
+    {
+        i32 i = 0;
+        value = i;
+        return reader.get(std::get<i32>(value));
+    }
+    case 2:
+    {
+        f32 f = 0.0f;
+        value = f;
+        return reader.get(std::get<f32>(value));
+    }
+    case 3:
+    {
+        u8 b = 0;
+        if (!reader.get(b))
+        {
+            return false;
+        }
+        value = b != 0;
+        return true;
+    }
+    case 4:
+        value = std::string();
+        return reader.getString(std::get<std::string>(value));
+    default:
+        return false;
+    }
+}
+
+// Writes the image of @p snapshot, recording where each entry ends when
+// @p entryEnds is set
+void writeImage(const CheckpointSnapshot& snapshot, std::vector<u8>& out,
+                std::vector<u32>* entryEnds)
+{
+    ImageWriter writer(out);
+    auto endEntry = [&out, entryEnds]() {
+        if (entryEnds && (entryEnds->empty() || entryEnds->back() != out.size()))
+        {
+            entryEnds->push_back(static_cast<u32>(out.size()));
+        }
+    };
+
+    writer.put(CHECKPOINT_MAGIC);
+    writer.put(CHECKPOINT_VERSION);
+    writer.putString(snapshot.description);
+    writer.put(snapshot.timestamp);
+    writer.put(snapshot.runtimeTimeSeconds);
+
+    const auto& runtime = snapshot.runtime;
+    writer.putString(runtime.currentScene);
+    writer.put(runtime.instructionPointer);
+    writer.put(static_cast<u8>(runtime.inDialogue));
+    writer.putString(runtime.currentBackground);
+    writer.putStrings(runtime.visibleCharacters);
+    writer.put(static_cast<u32>(runtime.variables.size()));
+    endEntry();
+    for (const auto* entry : sortedEntries(runtime.variables))
+    {
+        writer.putString(entry->first);
+        putValue(writer, entry->second);
+        endEntry();
+    }
+    writer.put(static_cast<u32>(runtime.flags.size()));
+    for (const auto* entry : sortedEntries(runtime.flags))
+    {
+        writer.putString(entry->first);
+        writer.put(static_cast<u8>(entry->second));
+        endEntry();
+    }
+
+    const auto& scene = snapshot.scene;
+    writer.putString(scene.sceneId);
+    writer.putString(scene.activeBackground);
+    writer.putStrings(scene.visibleCharacters);
+    writer.put(static_cast<u32>(scene.objects.size()));
+    endEntry();
+    for (const auto& object : scene.objects)
+    {
+        writer.putString(object.id);
+        writer.put(static_cast<u8>(object.type));
+        writer.put(object.x);
+        writer.put(object.y);
+        writer.put(object.width);
+        writer.put(object.height);
+        writer.put(object.scaleX);
+        writer.put(object.scaleY);
+        writer.put(object.rotation);
+        writer.put(object.alpha);
+        writer.put(static_cast<u8>(object.visible));
+        writer.put(object.zOrder);
+        writer.put(static_cast<u32>(object.properties.size()));
+        for (const auto* entry : sortedEntries(object.properties))
+        {
+            writer.putString(entry->first);
+            writer.putString(entry->second);
+        }
+        endEntry();
+    }
+    endEntry();
+}
+
+std::string_view entryBytes(const std::vector<u8>& image, const std::vector<u32>& entryEnds,
+                            usize index)
+{
+    const u32 begin = index == 0 ? 0 : entryEnds[index - 1];
+    return {reinterpret_cast<const char*>(image.data()) + begin, entryEnds[index] - begin};
+}
+
+std::vector<u8> encodeKeyframe(const std::vector<u8>& image, const std::vector<u32>& entryEnds)
+{
+    std::vector<u8> payload;
+    payload.reserve(sizeof(u32) * (entryEnds.size() + 1) + image.size());
+    ImageWriter writer(payload);
+    writer.put(static_cast<u32>(entryEnds.size()));
+    for (const u32 end : entryEnds)
+    {
+        writer.put(end);
+    }
+    payload.insert(payload.end(), image.begin(), image.end());
+    return payload;
+}
+
+// Entries of @p next as runs reused from @p previous and new entries
+std::vector<u8> encodeDelta(const std::vector<u8>& previous, const std::vector<u32>& previousEnds,
+                            const std::vector<u8>& next, const std::vector<u32>& nextEnds)
+{
+    std::unordered_map<std::string_view, u32> previousEntries;
+    previousEntries.reserve(previousEnds.size());
+    for (usize i = 0; i < previousEnds.size(); ++i)
+    {
+        previousEntries.try_emplace(entryBytes(previous, previousEnds, i), static_cast<u32>(i));
+    }
+
+    std::vector<u8> delta;
+    ImageWriter writer(delta);
+    writer.put(static_cast<u32>(nextEnds.size()));
+
+    u32 runStart = 0;
+    u32 runLength = 0;
+    auto flushRun = [&]() {
+        if (runLength > 0)
+        {
+            writer.put(DELTA_REUSE);
+            writer.put(runStart);
+            writer.put(runLength);
+            runLength = 0;
+        }
+    };
+
+    for (usize i = 0; i < nextEnds.size(); ++i)
+    {
+        const std::string_view entry = entryBytes(next, nextEnds, i);
+        auto it = previousEntries.find(entry);
+        if (it == previousEntries.end())
+        {
+            flushRun();
+            writer.put(DELTA_ENTRY);
+            writer.putString(entry);
+        }
+        else if (runLength > 0 && it->second == runStart + runLength)
+        {
+            ++runLength;
+        }
+        else
+        {
+            flushRun();
+            runStart = it->second;
+            runLength = 1;
+        }
+    }
+    flushRun();
+    return delta;
+}
+
+} // namespace
+
+CheckpointStore::CheckpointStore(const CheckpointStoreConfig& config)
+    : m_config(config)
+{
+}
+
+CheckpointStore::~CheckpointStore()
+{
+    shutdown();
+}
+
+void CheckpointStore::setConfig(const CheckpointStoreConfig& config)
+{
+    std::lock_guard<std::mutex> lock(m_recordMutex);
+    m_config = config;
+    enforceBudget();
+}
+
+CheckpointStoreConfig CheckpointStore::getConfig() const
+{
+    std::lock_guard<std::mutex> lock(m_recordMutex);
+    return m_config;
+}
+
+u64 CheckpointStore::submit(CheckpointSnapshot snapshot)
+{
+    std::lock_guard<std::mutex> lock(m_jobMutex);
+    if (!m_worker.joinable())
+    {
+        m_stopWorker = false;
+        m_worker = std::thread([this]() { workerLoop(); });
+    }
+    const u64 id = m_nextId++;
+    ++m_inFlight;
+    m_jobs.push_back(Job{id, std::move(snapshot)});
+    m_work.notify_one();
+    return id;
+}
+
+std::vector<CheckpointInfo> CheckpointStore::getCheckpoints() const
+{
+    std::lock_guard<std::mutex> lock(m_recordMutex);
+    std::vector<CheckpointInfo> checkpoints;
+    checkpoints.reserve(m_records.size());
+    for (const auto& record : m_records)
+    {
+        checkpoints.push_back(record.info);
+    }
+    return checkpoints;
+}
+
+usize CheckpointStore::getCheckpointCount() const
+{
+    std::lock_guard<std::mutex> lock(m_recordMutex);
+    return m_records.size();
+}
+
+usize CheckpointStore::getStoredBytes() const
+{
+    std::lock_guard<std::mutex> lock(m_recordMutex);
+    return m_storedBytes;
+}
+
+Result<CheckpointSnapshot> CheckpointStore::restore(u64 id) const
+{
+    waitForAll();
+
+    std::vector<u8> image;
+    {
+        std::lock_guard<std::mutex> lock(m_recordMutex);
+        auto it = std::find_if(m_records.begin(), m_records.end(),
+                               [id](const Record& record) { return record.info.id == id; });
+        if (it == m_records.end())
+        {
+            return Result<CheckpointSnapshot>::error("Checkpoint " + std::to_string(id) +
+                                                     " is not stored");
+        }
+        if (std::next(it) == m_records.end())
+        {
+            image = m_lastImage.bytes;
+        }
+        else
+        {
+            auto rebuilt = rebuildImage(static_cast<usize>(it - m_records.begin()));
+            if (rebuilt.isError())
+            {
+                return Result<CheckpointSnapshot>::error(rebuilt.error());
+            }
+            image = std::move(rebuilt).value().bytes;
+        }
+    }
+    return deserialize(image.data(), image.size());
+}
+
+Result<CheckpointSnapshot> CheckpointStore::restoreLatest() const
+{
+    waitForAll();
+
+    std::vector<u8> image;
+    {
+        std::lock_guard<std::mutex> lock(m_recordMutex);
+        if (m_records.empty())
+        {
+            return Result<CheckpointSnapshot>::error("No checkpoints stored");
+        }
+        image = m_lastImage.bytes;
+    }
+    return deserialize(image.data(), image.size());
+}
+
+void CheckpointStore::clear()
+{
+    std::lock_guard<std::mutex> lock(m_recordMutex);
+    m_records.clear();
+    m_storedBytes = 0;
+    m_lastImage = {};
+    m_deltasSinceKeyframe = 0;
+}
+
+bool CheckpointStore::hasPending() const
+{
+    std::lock_guard<std::mutex> lock(m_jobMutex);
+    return m_inFlight > 0;
+}
+
+void CheckpointStore::waitForAll() const
+{
+    std::unique_lock<std::mutex> lock(m_jobMutex);
+    m_idle.wait(lock, [this]() { return m_inFlight == 0; });
+}
+
+void CheckpointStore::shutdown()
+{
+    std::thread worker;
+    {
+        std::lock_guard<std::mutex> lock(m_jobMutex);
+        m_stopWorker = true;
+        worker.swap(m_worker);
+    }
+    m_work.notify_all();
+    if (worker.joinable())
+    {
+        worker.join();
+    }
+}
+
+void CheckpointStore::workerLoop()
+{
+    for (;;)
+    {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(m_jobMutex);
+            m_work.wait(lock, [this]() { return m_stopWorker || !m_jobs.empty(); });
+            if (m_jobs.empty())
+            {
+                return;
+            }
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+        }
+
+        store(job.id, job.snapshot);
+
+        std::lock_guard<std::mutex> lock(m_jobMutex);
+        --m_inFlight;
+        m_idle.notify_all();
+    }
+}
+
+void CheckpointStore::store(u64 id, const CheckpointSnapshot& snapshot)
+{
+    Image image;
+    writeImage(snapshot, image.bytes, &image.entryEnds);
+
+    std::lock_guard<std::mutex> lock(m_recordMutex);
+
+    bool keyframe = m_records.empty() || m_deltasSinceKeyframe >= m_config.keyframeInterval;
+    std::vector<u8> payload;
+    if (!keyframe)
+    {
+        payload = encodeDelta(m_lastImage.bytes, m_lastImage.entryEnds, image.bytes,
+                              image.entryEnds);
+        // A delta replacing most entries costs more to restore than it saves
+        keyframe = payload.size() > image.bytes.size() / 2;
+    }
+    if (keyframe)
+    {
+        payload = encodeKeyframe(image.bytes, image.entryEnds);
+    }
+
+    Record record;
+    record.info.id = id;
+    record.info.timestamp = snapshot.timestamp;
+    record.info.description = snapshot.description;
+    record.info.sceneName = snapshot.runtime.currentScene;
+    record.info.runtimeTimeSeconds = snapshot.runtimeTimeSeconds;
+    record.info.stateBytes = image.bytes.size();
+    record.info.keyframe = keyframe;
+    record.payloadSize = payload.size();
+    record.data = vfs::LZ4Block::compress(payload.data(), payload.size());
+    record.info.storedBytes = record.data.size();
+
+    m_storedBytes += record.data.size();
+    m_records.push_back(std::move(record));
+    m_lastImage = std::move(image);
+    m_deltasSinceKeyframe = keyframe ? 0 : m_deltasSinceKeyframe + 1;
+
+    enforceBudget();
+}
+
+void CheckpointStore::enforceBudget()
+{
+    // The newest checkpoint is kept even when it alone exceeds the budget
+    while (m_storedBytes > m_config.byteBudget && m_records.size() > 1)
+    {
+        Record& next = m_records[1];
+        if (!next.info.keyframe)
+        {
+            auto image = rebuildImage(1);
+            if (image.isOk())
+            {
+                const auto payload = encodeKeyframe(image.value().bytes, image.value().entryEnds);
+                m_storedBytes -= next.data.size();
+                next.data = vfs::LZ4Block::compress(payload.data(), payload.size());
+                next.payloadSize = payload.size();
+                next.info.keyframe = true;
+                next.info.storedBytes = next.data.size();
+                m_storedBytes += next.data.size();
+            }
+        }
+
+        m_storedBytes -= m_records.front().data.size();
+        m_records.pop_front();
+
+        // A delta that could not be rebased is unusable, as is the rest of its chain
+        while (!m_records.empty() && !m_records.front().info.keyframe)
+        {
+            m_storedBytes -= m_records.front().data.size();
+            m_records.pop_front();
+        }
+    }
+
+    if (m_records.empty())
+    {
+        m_lastImage = {};
+    }
+    m_deltasSinceKeyframe = 0;
+    for (auto it = m_records.rbegin(); it != m_records.rend() && !it->info.keyframe; ++it)
+    {
+        ++m_deltasSinceKeyframe;
+    }
+}
+
+Result<CheckpointStore::Image> CheckpointStore::rebuildImage(usize index) const
+{
+    usize first = index;
+    while (first > 0 && !m_records[first].info.keyframe)
+    {
+        --first;
+    }
+    if (!m_records[first].info.keyframe)
+    {
+        return Result<Image>::error("Checkpoint has no keyframe to start from");
+    }
+
+    Image image;
+    for (usize i = first; i <= index; ++i)
+    {
+        if (!applyRecord(m_records[i], image))
+        {
+            return Result<Image>::error("Checkpoint record is corrupt");
+        }
+    }
+    return Result<Image>::ok(std::move(image));
+}
+
+bool CheckpointStore::applyRecord(const Record& record, Image& image)
+{
+    std::vector<u8> payload(record.payloadSize);
+    if (!vfs::LZ4Block::decompress(record.data.data(), record.data.size(), payload.data(),
+                                   payload.size()))
+    {
+        return false;
+    }
+
+    const usize imageSize = record.info.stateBytes;
+    ImageReader reader(payload.data(), payload.size());
+    Image next;
+    u32 count = 0;
+    if (record.info.keyframe)
+    {
+        if (!reader.getCount(count))
+        {
+            return false;
+        }
+        next.entryEnds.resize(count);
+        for (auto& end : next.entryEnds)
+        {
+            if (!reader.get(end))
+            {
+                return false;
+            }
+        }
+        const u8* bytes = nullptr;
+        const usize size = reader.remaining();
+        if (!reader.getBytes(size, bytes))
+        {
+            return false;
+        }
+        next.bytes.assign(bytes, bytes + size);
+    }
+    else
+    {
+        // Every entry holds at least one byte
+        if (!reader.get(count) || count > imageSize)
+        {
+            return false;
+        }
+        next.bytes.reserve(imageSize);
+        next.entryEnds.reserve(count);
+        auto append = [&next](const u8* bytes, usize length) {
+            next.bytes.insert(next.bytes.end(), bytes, bytes + length);
+            next.entryEnds.push_back(static_cast<u32>(next.bytes.size()));
+        };
+
+        while (!reader.atEnd())
+        {
+            u8 op = 0;
+            if (!reader.get(op))
+            {
+                return false;
+            }
+            if (op == DELTA_REUSE)
+            {
+                u32 first = 0;
+                u32 runLength = 0;
+                if (!reader.get(first) || !reader.get(runLength) ||
+                    first > image.entryEnds.size() || runLength > image.entryEnds.size() - first)
+                {
+                    return false;
+                }
+                for (u32 i = first; i < first + runLength; ++i)
+                {
+                    const u32 begin = i == 0 ? 0 : image.entryEnds[i - 1];
+                    append(image.bytes.data() + begin, image.entryEnds[i] - begin);
+                }
+            }
+            else if (op == DELTA_ENTRY)
+            {
+                u32 length = 0;
+                const u8* bytes = nullptr;
+                if (!reader.get(length) || !reader.getBytes(length, bytes))
+                {
+                    return false;
+                }
+                append(bytes, length);
+            }
+            else
+            {
+                return false;
+            }
+
+            if (next.bytes.size() > imageSize)
+            {
+                return false;
+            }
+        }
+    }
+
+    // Entries must tile the image in order
+    if (next.entryEnds.size() != count || next.bytes.size() != imageSize)
+    {
+        return false;
+    }
+    u32 previousEnd = 0;
+    for (const u32 end : next.entryEnds)
+    {
+        if (end < previousEnd)
+        {
+            return false;
+        }
+        previousEnd = end;
+    }
+    if (previousEnd != imageSize)
+    {
+        return false;
+    }
+
+    image = std::move(next);
+    return true;
+}
+
+std::vector<u8> CheckpointStore::serialize(const CheckpointSnapshot& snapshot)
+{
+    std::vector<u8> out;
+    writeImage(snapshot, out, nullptr);
+    return out;
+}
+
+Result<CheckpointSnapshot> CheckpointStore::deserialize(const u8* data, usize size)
+{
+    auto corrupt = []() { return Result<CheckpointSnapshot>::error("Corrupt checkpoint image"); };
+
+    ImageReader reader(data, size);
+    u32 magic = 0;
+    u16 version = 0;
+    if (!reader.get(magic) || magic != CHECKPOINT_MAGIC || !reader.get(version) ||
+        version != CHECKPOINT_VERSION)
+    {
+        return corrupt();
+    }
+
+    CheckpointSnapshot snapshot;
+    if (!reader.getString(snapshot.description) || !reader.get(snapshot.timestamp) ||
+        !reader.get(snapshot.runtimeTimeSeconds))
+    {
+        return corrupt();
+    }
+
+    auto& runtime = snapshot.runtime;
+    u8 inDialogue = 0;
+    u32 count = 0;
+    if (!reader.getString(runtime.currentScene) || !reader.get(runtime.instructionPointer) ||
+        !reader.get(inDialogue) || !reader.getString(runtime.currentBackground) ||
+        !reader.getStrings(runtime.visibleCharacters) || !reader.getCount(count))
+    {
+        return corrupt();
+    }
+    runtime.inDialogue = inDialogue != 0;
+    runtime.variables.reserve(count);
+    for (u32 i = 0; i < count; ++i)
+    {
+        std::string name;
+        scripting::Value value;
+        if (!reader.getString(name) || !getValue(reader, value))
+        {
+            return corrupt();
+        }
+        runtime.variables.emplace(std::move(name), std::move(value));
+    }
+    if (!reader.getCount(count))
+    {
+        return corrupt();
+    }
+    runtime.flags.reserve(count);
+    for (u32 i = 0; i < count; ++i)
+    {
+        std::string name;
+        u8 value = 0;
+        if (!reader.getString(name) || !reader.get(value))
+        {
+            return corrupt();
+        }
+        runtime.flags.emplace(std::move(name), value != 0);
+    }
+
+    auto& scene = snapshot.scene;
+    if (!reader.getString(scene.sceneId) || !reader.getString(scene.activeBackground) ||
+        !reader.getStrings(scene.visibleCharacters) || !reader.getCount(count))
+    {
+        return corrupt();
+    }
+    scene.objects.resize(count);
+    for (auto& object : scene.objects)
+    {
+        u8 type = 0;
+        u8 visible = 0;
+        u32 properties = 0;
+        if (!reader.getString(object.id) || !reader.get(type) ||
+            type > static_cast<u8>(scene::SceneObjectType::Custom) || !reader.get(object.x) ||
+            !reader.get(object.y) || !reader.get(object.width) || !reader.get(object.height) ||
+            !reader.get(object.scaleX) || !reader.get(object.scaleY) ||
+            !reader.get(object.rotation) || !reader.get(object.alpha) || !reader.get(visible) ||
+            !reader.get(object.zOrder) || !reader.getCount(properties))
+        {
+            return corrupt();
+        }
+        object.type = static_cast<scene::SceneObjectType>(type);
+        object.visible = visible != 0;
+        for (u32 i = 0; i < properties; ++i)
+        {
+            std::string key;
+            std::string value;
+            if (!reader.getString(key) || !reader.getString(value))
+            {
+                return corrupt();
+            }
+            object.properties.emplace(std::move(key), std::move(value));
+        }
+    }
+
+    if (!reader.atEnd())
+    {
+        return corrupt();
+    }
+    return Result<CheckpointSnapshot>::ok(std::move(snapshot));
+}
+
+} // namespace NovelMind::editor
@@ -0,0 +1,209 @@
+/**
+ * @file crash_safety.cpp
+ * @brief CrashSafetyManager checkpoint implementation
+ */
+
+#include "NovelMind/editor/crash_safety.hpp"
+#include "NovelMind/editor/editor_runtime_host.hpp"
+#include <algorithm>
+
+namespace NovelMind::editor
+{
+
+namespace
+{
+
+CheckpointStoreConfig checkpointStoreConfig(const CrashSafetyConfig& config)
+{
+    CheckpointStoreConfig storeConfig;
+    storeConfig.byteBudget = config.checkpointBudgetBytes;
+    storeConfig.keyframeInterval = config.checkpointKeyframeInterval;
+    return storeConfig;
+}
+
+u64 currentTimestamp()
+{
+    return static_cast<u64>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                                std::chrono::system_clock::now().time_since_epoch())
+                                .count());
+}
+
+} // namespace
+
+CrashSafetyManager::CrashSafetyManager()
+    : m_checkpointStore(checkpointStoreConfig(m_config))
+{
+}
+
+void CrashSafetyManager::initialize(EditorRuntimeHost* runtimeHost)
+{
+    m_runtimeHost = runtimeHost;
+    m_timeSinceLastCheckpoint = 0.0;
+    m_runtimeTimeSeconds = 0.0;
+}
+
+void CrashSafetyManager::setConfig(const CrashSafetyConfig& config)
+{
+    m_config = config;
+    m_checkpointStore.setConfig(checkpointStoreConfig(m_config));
+}
+
+void CrashSafetyManager::update(f64 deltaTime)
+{
+    if (!m_runtimeHost || m_runtimeHost->getState() != EditorRuntimeState::Running)
+    {
+        return;
+    }
+
+    m_runtimeTimeSeconds += deltaTime;
+    m_timeSinceLastCheckpoint += deltaTime;
+    if (m_config.enableAutoCheckpoints && !m_isIsolated &&
+        m_timeSinceLastCheckpoint >= m_config.checkpointIntervalSeconds)
+    {
+        createAutoCheckpoint();
+    }
+}
+
+// ============================================================================
+// Checkpoint Management
+// ============================================================================
+
+Result<void> CrashSafetyManager::createCheckpoint(const std::string& description)
+{
+    if (!m_runtimeHost || !m_runtimeHost->getScriptRuntime())
+    {
+        return Result<void>::error("No runtime to checkpoint");
+    }
+
+    CheckpointSnapshot snapshot = captureCurrentState();
+    snapshot.description = description.empty() ? "Checkpoint" : description;
+    const std::string checkpointDescription = snapshot.description;
+    m_checkpointStore.submit(std::move(snapshot));
+    m_timeSinceLastCheckpoint = 0.0;
+
+    notifyCheckpointCreated(checkpointDescription);
+    return Result<void>::ok();
+}
+
+Result<void> CrashSafetyManager::restoreCheckpoint(size_t checkpointIndex)
+{
+    m_checkpointStore.waitForAll();
+    const auto checkpoints = m_checkpointStore.getCheckpoints();
+    if (checkpointIndex >= checkpoints.size())
+    {
+        return Result<void>::error("Checkpoint index out of range");
+    }
+
+    auto snapshot = m_checkpointStore.restore(checkpoints[checkpointIndex].id);
+    if (snapshot.isError())
+    {
+        return Result<void>::error(snapshot.error());
+    }
+    return restoreState(snapshot.value());
+}
+
+Result<void> CrashSafetyManager::restoreLatestCheckpoint()
+{
+    auto snapshot = m_checkpointStore.restoreLatest();
+    if (snapshot.isError())
+    {
+        return Result<void>::error(snapshot.error());
+    }
+    return restoreState(snapshot.value());
+}
+
+std::vector<CheckpointInfo> CrashSafetyManager::getCheckpoints() const
+{
+    return m_checkpointStore.getCheckpoints();
+}
+
+void CrashSafetyManager::clearCheckpoints()
+{
+    m_checkpointStore.clear();
+    m_timeSinceLastCheckpoint = 0.0;
+}
+
+bool CrashSafetyManager::canRecover() const
+{
+    return m_recoveryAttempts < m_config.maxRecoveryAttempts &&
+           (m_checkpointStore.hasPending() || m_checkpointStore.getCheckpointCount() > 0);
+}
+
+// ============================================================================
+// Listeners
+// ============================================================================
+
+void CrashSafetyManager::addListener(ICrashSafetyListener* listener)
+{
+    if (listener && std::find(m_listeners.begin(), m_listeners.end(), listener) == m_listeners.end())
+    {
+        m_listeners.push_back(listener);
+    }
+}
+
+void CrashSafetyManager::removeListener(ICrashSafetyListener* listener)
+{
+    m_listeners.erase(std::remove(m_listeners.begin(), m_listeners.end(), listener),
+                      m_listeners.end());
+}
+
+void CrashSafetyManager::notifyCheckpointCreated(const std::string& description)
+{
+    for (auto* listener : m_listeners)
+    {
+        listener->onCheckpointCreated(description);
+    }
+}
+
+// ============================================================================
+// Private
+// ============================================================================
+
+void CrashSafetyManager::createAutoCheckpoint()
+{
+    if (createCheckpoint("Auto checkpoint").isError())
+    {
+        // Nothing to capture yet; try again after the next interval
+        m_timeSinceLastCheckpoint = 0.0;
+    }
+}
+
+CheckpointSnapshot CrashSafetyManager::captureCurrentState()
+{
+    CheckpointSnapshot snapshot;
+    snapshot.timestamp = currentTimestamp();
+    snapshot.runtimeTimeSeconds = m_runtimeTimeSeconds;
+
+    if (auto* runtime = m_runtimeHost->getScriptRuntime())
+    {
+        snapshot.runtime = runtime->saveState();
+    }
+    if (auto* sceneGraph = m_runtimeHost->getSceneGraph())
+    {
+        snapshot.scene = sceneGraph->saveState();
+    }
+    return snapshot;
+}
+
+Result<void> CrashSafetyManager::restoreState(const CheckpointSnapshot& snapshot)
+{
+    if (!m_runtimeHost || !m_runtimeHost->getScriptRuntime())
+    {
+        return Result<void>::error("No runtime to restore into");
+    }
+
+    // Entering the scene rebuilds the graph, so the saved graph goes on top
+    auto result = m_runtimeHost->getScriptRuntime()->loadState(snapshot.runtime);
+    if (result.isError())
+    {
+        return result;
+    }
+    if (auto* sceneGraph = m_runtimeHost->getSceneGraph())
+    {
+        sceneGraph->loadState(snapshot.scene);
+    }
+    m_runtimeTimeSeconds = snapshot.runtimeTimeSeconds;
+    return Result<void>::ok();
+}
+
+} // namespace NovelMind::editor
@@ -5,6 +5,7 @@
 
 #include "NovelMind/editor/curve_editor.hpp"
 #include "NovelMind/core/logger.hpp"
+#include "NovelMind/scene/bezier.hpp"
 #include <algorithm>
 #include <cmath>
 #include <sstream>
@@ -45,12 +46,32 @@ AnimationCurve::AnimationCurve(const std::string& name)
     m_points.push_back(end);
 }
 
+AnimationCurve::AnimationCurve(const AnimationCurve& other)
+    : m_id(other.m_id), m_name(other.m_name), m_points(other.m_points),
+      m_baked(std::atomic_load(&other.m_baked)), m_bakeTolerance(other.m_bakeTolerance)
+{
+}
+
+AnimationCurve& AnimationCurve::operator=(const AnimationCurve& other)
+{
+    if (this != &other)
+    {
+        m_id = other.m_id;
+        m_name = other.m_name;
+        m_points = other.m_points;
+        std::atomic_store(&m_baked, std::atomic_load(&other.m_baked));
+        m_bakeTolerance = other.m_bakeTolerance;
+    }
+    return *this;
+}
+
 void AnimationCurve::addPoint(const CurvePoint& point)
 {
     // Insert in sorted order by time
     auto it = std::lower_bound(m_points.begin(), m_points.end(), point,
         [](const CurvePoint& a, const CurvePoint& b) { return a.time < b.time; });
     m_points.insert(it, point);
+    invalidateBake();
 }
 
 void AnimationCurve::removePoint(size_t index)
@@ -58,6 +79,7 @@ void AnimationCurve::removePoint(size_t index)
     if (index < m_points.size() && m_points.size() > 2)
     {
         m_points.erase(m_points.begin() + static_cast<std::ptrdiff_t>(index));
+        invalidateBake();
     }
 }
 
@@ -69,10 +91,40 @@ void AnimationCurve::updatePoint(size_t index, const CurvePoint& point)
         // Re-sort if necessary
         std::sort(m_points.begin(), m_points.end(),
             [](const CurvePoint& a, const CurvePoint& b) { return a.time < b.time; });
+        invalidateBake();
     }
 }
 
 f32 AnimationCurve::evaluate(f32 t) const
+{
+    return getBakedCurve()->evaluate(t);
+}
+
+void AnimationCurve::evaluateBatch(const f32* times, f32* out, size_t count) const
+{
+    getBakedCurve()->evaluateBatch(times, out, count);
+}
+
+void AnimationCurve::setBakeTolerance(f32 tolerance)
+{
+    m_bakeTolerance = std::max(tolerance, 1e-6f);
+    invalidateBake();
+}
+
+std::shared_ptr<const scene::EasingCurve> AnimationCurve::getBakedCurve() const
+{
+    auto baked = std::atomic_load(&m_baked);
+    if (!baked)
+    {
+        // Threads racing here bake identical tables; whichever is stored last is kept
+        baked = std::make_shared<const scene::EasingCurve>(scene::EasingCurve::bake(
+            [this](f32 t) { return evaluateExact(t); }, m_bakeTolerance));
+        std::atomic_store(&m_baked, baked);
+    }
+    return baked;
+}
+
+f32 AnimationCurve::evaluateExact(f32 t) const
 {
     if (m_points.empty()) return 0.0f;
     if (m_points.size() == 1) return m_points[0].value;
@@ -101,25 +153,51 @@ f32 AnimationCurve::evaluate(f32 t) const
 
 f32 AnimationCurve::evaluateDerivative(f32 t) const
 {
-    // Numerical derivative
-    const f32 epsilon = 0.0001f;
-    f32 t0 = std::max(0.0f, t - epsilon);
-    f32 t1 = std::min(1.0f, t + epsilon);
-    return (evaluate(t1) - evaluate(t0)) / (t1 - t0);
+    if (m_points.size() < 2) return 0.0f;
+
+    t = std::clamp(t, 0.0f, 1.0f);
+    i32 segIndex = findSegment(t);
+    const auto& p0 = m_points[static_cast<size_t>(segIndex)];
+    const auto& p1 = m_points[static_cast<size_t>(segIndex + 1)];
+
+    f32 segmentLength = p1.time - p0.time;
+    if (segmentLength < 0.0001f) return 0.0f;
+
+    // d/dt = dB/ds * ds/dt, with s = (t - t0) / segmentLength
+    f32 localT = (t - p0.time) / segmentLength;
+    return scene::cubicBezierDerivative(p0.value, p0.value + p0.outHandleY,
+                                        p1.value + p1.inHandleY, p1.value, localT) /
+           segmentLength;
 }
 
 std::vector<renderer::Vec2> AnimationCurve::sample(i32 numSamples) const
 {
     std::vector<renderer::Vec2> samples;
-    samples.reserve(static_cast<size_t>(numSamples));
+    sample(numSamples, samples);
+    return samples;
+}
 
-    for (i32 i = 0; i < numSamples; ++i)
+void AnimationCurve::sample(i32 numSamples, std::vector<renderer::Vec2>& out) const
+{
+    out.clear();
+    if (numSamples <= 0) return;
+
+    const size_t count = static_cast<size_t>(numSamples);
+    const f32 step = numSamples > 1 ? 1.0f / static_cast<f32>(numSamples - 1) : 0.0f;
+
+    std::vector<f32> times(count);
+    for (size_t i = 0; i < count; ++i)
     {
-        f32 t = static_cast<f32>(i) / static_cast<f32>(numSamples - 1);
-        samples.push_back({t, evaluate(t)});
+        times[i] = static_cast<f32>(i) * step;
     }
+    std::vector<f32> values(count);
+    evaluateBatch(times.data(), values.data(), count);
 
-    return samples;
+    out.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        out.push_back({times[i], values[i]});
+    }
 }
 
 AnimationCurve AnimationCurve::createLinear()
@@ -658,6 +736,7 @@ void AnimationCurve::normalize()
     {
         point.time = std::clamp(point.time, 0.0f, 1.0f);
     }
+    invalidateBake();
 }
 
 Result<void> AnimationCurve::save(const std::string& path) const
@@ -712,14 +791,11 @@ f32 AnimationCurve::evaluateBezierSegment(const CurvePoint& p0, const CurvePoint
 
 i32 AnimationCurve::findSegment(f32 t) const
 {
-    for (size_t i = 0; i < m_points.size() - 1; ++i)
-    {
-        if (t >= m_points[i].time && t <= m_points[i + 1].time)
-        {
-            return static_cast<i32>(i);
-        }
-    }
-    return static_cast<i32>(m_points.size()) - 2;
+    // Points are kept sorted by time
+    auto it = std::upper_bound(m_points.begin(), m_points.end(), t,
+        [](f32 value, const CurvePoint& p) { return value < p.time; });
+    i32 index = static_cast<i32>(it - m_points.begin()) - 1;
+    return std::clamp(index, 0, static_cast<i32>(m_points.size()) - 2);
 }
 
 // =============================================================================
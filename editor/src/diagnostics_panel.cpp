@@ -40,6 +40,11 @@ void DiagnosticsPanel::render()
     renderToolbar();
     renderSummaryBar();
     renderDiagnosticList();
+
+    if (m_showScriptProfile && m_hasScriptProfile)
+    {
+        renderScriptProfile();
+    }
 }
 
 void DiagnosticsPanel::onResize(i32 width, i32 height)
@@ -325,6 +330,53 @@ void DiagnosticsPanel::setOnDiagnosticDoubleClicked(OnDiagnosticDoubleClicked ca
     m_onDoubleClicked = std::move(callback);
 }
 
+// ============================================================================
+// Script Profile
+// ============================================================================
+
+void DiagnosticsPanel::setScriptProfile(const scripting::ScriptProfileReport& report,
+                                        std::vector<ScriptHotspot> hotspots)
+{
+    m_scriptProfile = report;
+    m_scriptHotspots = std::move(hotspots);
+    m_hasScriptProfile = true;
+}
+
+void DiagnosticsPanel::clearScriptProfile()
+{
+    m_scriptProfile = {};
+    m_scriptHotspots.clear();
+    m_hasScriptProfile = false;
+}
+
+bool DiagnosticsPanel::hasScriptProfile() const
+{
+    return m_hasScriptProfile;
+}
+
+const scripting::ScriptProfileReport& DiagnosticsPanel::getScriptProfile() const
+{
+    return m_scriptProfile;
+}
+
+const std::vector<ScriptHotspot>& DiagnosticsPanel::getScriptHotspots() const
+{
+    return m_scriptHotspots;
+}
+
+void DiagnosticsPanel::openScriptHotspot(size_t index)
+{
+    if (index >= m_scriptHotspots.size() || !m_onDoubleClicked)
+    {
+        return;
+    }
+    const ScriptHotspot& hotspot = m_scriptHotspots[index];
+    if (!hotspot.scriptPath.empty())
+    {
+        m_onDoubleClicked(hotspot.scriptPath, hotspot.line, 1);
+    }
+}
+
 // ============================================================================
 // Display Options
 // ============================================================================
@@ -349,6 +401,11 @@ void DiagnosticsPanel::setAutoScrollToErrors(bool autoScroll)
     m_autoScrollToErrors = autoScroll;
 }
 
+void DiagnosticsPanel::setShowScriptProfile(bool show)
+{
+    m_showScriptProfile = show;
+}
+
 // ============================================================================
 // Rendering Helpers
 // ============================================================================
@@ -432,6 +489,34 @@ void DiagnosticsPanel::renderSummaryBar()
     // "5 errors, 3 warnings, 2 hints"
 }
 
+void DiagnosticsPanel::renderScriptProfile()
+{
+    // Collapsible "Script Profile" section below the diagnostics
+    // "12,345 instructions, 8.2 ms in callbacks"
+    //
+    // Scenes:    [name] [instructions] [callback ms]
+    // Callbacks: [SHOW_BACKGROUND] [calls] [total ms] [max ms]
+    // Hot lines: [file:line] [scene] [instructions] [callback ms]
+    //   Double-click opens the line via openScriptHotspot()
+    for (const auto& scene : m_scriptProfile.scenes)
+    {
+        // Would render scene.name, scene.instructions, scene.callbackNanos / 1e6
+        (void)scene;
+    }
+
+    for (const auto& callback : m_scriptProfile.callbacks)
+    {
+        // Would render ScriptProfiler::getOpCodeName(callback.opcode) and timings
+        (void)callback;
+    }
+
+    for (size_t i = 0; i < m_scriptHotspots.size(); ++i)
+    {
+        // Would render a row per hot line, abbreviated path when m_showFilePaths
+        (void)m_scriptHotspots[i];
+    }
+}
+
 // ============================================================================
 // Filtering Helpers
 // ============================================================================
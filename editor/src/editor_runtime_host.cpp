@@ -4,6 +4,7 @@
  */
 
 #include "NovelMind/editor/editor_runtime_host.hpp"
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
 #include <chrono>
@@ -111,6 +112,8 @@ void EditorRuntimeHost::unloadProject()
 
     m_sceneNames.clear();
     m_fileTimestamps.clear();
+    m_scriptFiles.clear();
+    m_breakpointSites.clear();
 
     m_project = ProjectDescriptor();
     m_projectLoaded = false;
@@ -193,6 +196,7 @@ Result<void> EditorRuntimeHost::playFromScene(const std::string& sceneId)
     }
 
     m_state = EditorRuntimeState::Running;
+    syncBreakpoints();
     fireStateChanged(m_state);
 
     if (m_onSceneChanged)
@@ -502,7 +506,13 @@ ScriptCallStack EditorRuntimeHost::getScriptCallStack() const
     CallStackEntry entry;
     entry.sceneName = m_scriptRuntime->getCurrentScene();
     entry.instructionPointer = vm.getIP();
-    // Source location would be mapped from IP to source
+    if (m_compiledScript)
+    {
+        if (auto location = m_compiledScript->lineTable.getLocation(vm.getIP()))
+        {
+            entry.sourceLocation = toScriptLocation(*location, entry.scriptPath);
+        }
+    }
 
     stack.frames.push_back(entry);
     stack.currentDepth = 1;
@@ -595,10 +605,12 @@ void EditorRuntimeHost::addBreakpoint(const Breakpoint& breakpoint)
         if (bp.scriptPath == breakpoint.scriptPath && bp.line == breakpoint.line)
         {
             bp = breakpoint;
+            syncBreakpoints();
             return;
         }
     }
     m_breakpoints.push_back(breakpoint);
+    syncBreakpoints();
 }
 
 void EditorRuntimeHost::removeBreakpoint(const std::string& scriptPath, u32 line)
@@ -610,6 +622,7 @@ void EditorRuntimeHost::removeBreakpoint(const std::string& scriptPath, u32 line
                 return bp.scriptPath == scriptPath && bp.line == line;
             }),
         m_breakpoints.end());
+    syncBreakpoints();
 }
 
 void EditorRuntimeHost::setBreakpointEnabled(const std::string& scriptPath, u32 line, bool enabled)
@@ -619,6 +632,7 @@ void EditorRuntimeHost::setBreakpointEnabled(const std::string& scriptPath, u32
         if (bp.scriptPath == scriptPath && bp.line == line)
         {
             bp.enabled = enabled;
+            syncBreakpoints();
             return;
         }
     }
@@ -632,6 +646,7 @@ const std::vector<Breakpoint>& EditorRuntimeHost::getBreakpoints() const
 void EditorRuntimeHost::clearBreakpoints()
 {
     m_breakpoints.clear();
+    syncBreakpoints();
 }
 
 // ============================================================================
@@ -663,6 +678,98 @@ void EditorRuntimeHost::setOnRuntimeError(OnRuntimeError callback)
     m_onRuntimeError = std::move(callback);
 }
 
+// ============================================================================
+// Script Profiling
+// ============================================================================
+
+void EditorRuntimeHost::setScriptProfilingEnabled(bool enabled)
+{
+    m_scriptProfiling = enabled;
+    if (m_scriptRuntime)
+    {
+        m_scriptRuntime->setProfiler(enabled ? &m_scriptProfiler : nullptr);
+    }
+}
+
+bool EditorRuntimeHost::isScriptProfilingEnabled() const
+{
+    return m_scriptProfiling;
+}
+
+void EditorRuntimeHost::resetScriptProfile()
+{
+    m_scriptProfiler.reset();
+}
+
+scripting::ScriptProfileReport EditorRuntimeHost::getScriptProfile() const
+{
+    if (!m_compiledScript)
+    {
+        return {};
+    }
+    return m_scriptProfiler.buildReport(*m_compiledScript);
+}
+
+std::vector<ScriptHotspot> EditorRuntimeHost::getScriptHotspots(usize maxCount) const
+{
+    std::vector<ScriptHotspot> hotspots;
+    for (const auto& scene : getScriptProfile().scenes)
+    {
+        for (const auto& line : scene.lines)
+        {
+            ScriptHotspot hotspot;
+            hotspot.sceneName = scene.name;
+            hotspot.line = toScriptLocation(scripting::SourceLocation(line.line, 1),
+                                            hotspot.scriptPath).line;
+            hotspot.instructions = line.instructions;
+            hotspot.callbackCalls = line.callbackCalls;
+            hotspot.callbackNanos = line.callbackNanos;
+            hotspots.push_back(std::move(hotspot));
+        }
+    }
+
+    std::sort(hotspots.begin(), hotspots.end(),
+              [](const ScriptHotspot& a, const ScriptHotspot& b)
+              {
+                  if (a.callbackNanos != b.callbackNanos)
+                  {
+                      return a.callbackNanos > b.callbackNanos;
+                  }
+                  return a.instructions > b.instructions;
+              });
+    if (hotspots.size() > maxCount)
+    {
+        hotspots.resize(maxCount);
+    }
+    return hotspots;
+}
+
+Result<void> EditorRuntimeHost::exportScriptProfile(const std::string& path,
+                                                    scripting::ScriptProfileMetric metric) const
+{
+    if (!m_compiledScript)
+    {
+        return Result<void>::error("No compiled script to profile");
+    }
+
+    auto labeler = [this](u32 line)
+    {
+        for (const auto& file : m_scriptFiles)
+        {
+            if (line >= file.firstLine && line < file.firstLine + file.lineCount)
+            {
+                return file.relativePath + ":" + std::to_string(line - file.firstLine + 1);
+            }
+        }
+        return "line " + std::to_string(line);
+    };
+    if (!m_scriptProfiler.exportToFoldedStacks(path, *m_compiledScript, metric, labeler))
+    {
+        return Result<void>::error("Failed to write script profile: " + path);
+    }
+    return Result<void>::ok();
+}
+
 // ============================================================================
 // Scene Graph Access
 // ============================================================================
@@ -705,6 +812,7 @@ Result<void> EditorRuntimeHost::reloadScripts()
         {
             return loadResult;
         }
+        syncBreakpoints();
 
         // Try to restore state
         auto restoreResult = m_scriptRuntime->loadState(savedState);
@@ -810,7 +918,9 @@ Result<void> EditorRuntimeHost::compileProject()
 
         // Collect all script files
         std::string allScripts;
+        u32 lineCount = 1;
         m_sceneNames.clear();
+        m_scriptFiles.clear();
 
         for (const auto& entry : fs::recursive_directory_iterator(scriptsPath))
         {
@@ -830,6 +940,17 @@ Result<void> EditorRuntimeHost::compileProject()
                         allScripts += "\n// File: " + entry.path().string() + "\n";
                         allScripts += content;
 
+                        // Map breakpoint lines between the file and the program
+                        ScriptFileSpan span;
+                        span.path = entry.path().string();
+                        span.relativePath = entry.path().lexically_relative(scriptsPath).generic_string();
+                        const auto newlines = static_cast<u32>(
+                            std::count(content.begin(), content.end(), '\n'));
+                        span.firstLine = lineCount + 2;
+                        span.lineCount = newlines + 1;
+                        lineCount = span.firstLine + newlines;
+                        m_scriptFiles.push_back(std::move(span));
+
                         // Track file timestamps for hot reload
                         u64 modTime = static_cast<u64>(std::chrono::duration_cast<std::chrono::seconds>(
                             entry.last_write_time().time_since_epoch()).count());
@@ -896,6 +1017,9 @@ Result<void> EditorRuntimeHost::compileProject()
         m_compiledScript = std::make_unique<scripting::CompiledScript>(
             std::move(compileResult.value()));
 
+        // Counts are per instruction and do not carry over to a new program
+        m_scriptProfiler.reset();
+
         return Result<void>::ok();
     }
     catch (const std::exception& e)
@@ -925,6 +1049,11 @@ Result<void> EditorRuntimeHost::initializeRuntime()
     // - ChoiceMenu
     // - AudioManager
 
+    if (m_scriptProfiling)
+    {
+        m_scriptRuntime->setProfiler(&m_scriptProfiler);
+    }
+
     // Set up event callback
     m_scriptRuntime->setEventCallback(
         [this](const scripting::ScriptEvent& event)
@@ -951,22 +1080,123 @@ void EditorRuntimeHost::resetRuntime()
     m_targetInstructionPointer = 0;
 }
 
-bool EditorRuntimeHost::checkBreakpoint(const scripting::SourceLocation& location)
+void EditorRuntimeHost::syncBreakpoints()
 {
-    for (const auto& bp : m_breakpoints)
+    // Play patches the program it loads; until then there is nothing to trap
+    m_breakpointSites.clear();
+    if (!m_scriptRuntime || !m_compiledScript || m_state == EditorRuntimeState::Stopped ||
+        m_state == EditorRuntimeState::Error)
+    {
+        return;
+    }
+
+    // Each breakpoint becomes a BREAK trap at the first instruction of every
+    // statement on its line; untrapped code runs without any checks
+    auto& vm = m_scriptRuntime->getVM();
+    vm.clearBreakpoints();
+    vm.setBreakHandler([this](u32 ip) { return onBreakpointTrap(ip); });
+
+    for (usize i = 0; i < m_breakpoints.size(); ++i)
     {
-        if (bp.enabled && bp.line == location.line)
+        const Breakpoint& bp = m_breakpoints[i];
+        if (!bp.enabled)
+        {
+            continue;
+        }
+        auto line = toProgramLine(bp.scriptPath, bp.line);
+        if (!line)
+        {
+            continue;
+        }
+
+        BreakpointSite site;
+        site.breakpointIndex = i;
+        if (!bp.condition.empty())
+        {
+            scripting::Lexer lexer;
+            auto tokens = lexer.tokenize(bp.condition);
+            scripting::Parser parser;
+            auto expr = tokens.isOk() ? parser.parseStandaloneExpression(tokens.value())
+                                      : Result<scripting::ExprPtr>::error(tokens.error());
+            scripting::Compiler compiler;
+            auto compiled = expr.isOk() ? compiler.compileStandaloneExpression(*expr.value())
+                                        : Result<scripting::CompiledExpression>::error(expr.error());
+            if (compiled.isOk())
+            {
+                site.conditional = true;
+                site.condition = std::move(compiled.value());
+            }
+            else if (m_onRuntimeError)
+            {
+                // Stopping unconditionally makes the bad condition visible
+                m_onRuntimeError("Invalid breakpoint condition '" + bp.condition +
+                                 "': " + compiled.error());
+            }
+        }
+
+        for (u32 ip : m_compiledScript->lineTable.getInstructions(*line))
         {
-            // Check file match (simplified)
-            if (bp.condition.empty())
+            if (vm.setBreakpoint(ip).isOk())
             {
-                fireBreakpointHit(bp);
-                return true;
+                m_breakpointSites[ip] = site;
             }
-            // Would evaluate conditional breakpoint here
         }
     }
-    return false;
+}
+
+bool EditorRuntimeHost::onBreakpointTrap(u32 ip)
+{
+    auto it = m_breakpointSites.find(ip);
+    if (it == m_breakpointSites.end())
+    {
+        return false;
+    }
+
+    const BreakpointSite& site = it->second;
+    if (site.conditional)
+    {
+        auto value = m_scriptRuntime->getVM().evaluate(site.condition.instructions,
+                                                       site.condition.stringTable);
+        if (value.isOk() && !scripting::asBool(value.value()))
+        {
+            return false;
+        }
+    }
+
+    // Copied: the hit callback may edit the breakpoint list
+    const Breakpoint bp = m_breakpoints[site.breakpointIndex];
+    fireBreakpointHit(bp);
+    return true;
+}
+
+std::optional<u32> EditorRuntimeHost::toProgramLine(const std::string& scriptPath, u32 line) const
+{
+    for (const auto& file : m_scriptFiles)
+    {
+        if (file.path == scriptPath || file.relativePath == scriptPath)
+        {
+            if (line == 0 || line > file.lineCount)
+            {
+                return std::nullopt;
+            }
+            return file.firstLine + line - 1;
+        }
+    }
+    return std::nullopt;
+}
+
+scripting::SourceLocation EditorRuntimeHost::toScriptLocation(
+    const scripting::SourceLocation& location, std::string& scriptPath) const
+{
+    for (const auto& file : m_scriptFiles)
+    {
+        if (location.line >= file.firstLine && location.line < file.firstLine + file.lineCount)
+        {
+            scriptPath = file.path;
+            return scripting::SourceLocation(location.line - file.firstLine + 1, location.column);
+        }
+    }
+    return location;
 }
 
 void EditorRuntimeHost::fireStateChanged(EditorRuntimeState newState)
@@ -979,9 +1209,11 @@ void EditorRuntimeHost::fireStateChanged(EditorRuntimeState newState)
 
 void EditorRuntimeHost::fireBreakpointHit(const Breakpoint& bp)
 {
+    m_state = EditorRuntimeState::Paused;
+    fireStateChanged(m_state);
+
     if (m_onBreakpointHit)
     {
-        m_state = EditorRuntimeState::Paused;
         auto stack = getScriptCallStack();
         m_onBreakpointHit(bp, stack);
     }
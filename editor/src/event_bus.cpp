@@ -1,14 +1,22 @@
 #include "NovelMind/editor/event_bus.hpp"
 #include <algorithm>
+#include <cstdint>
 
 namespace NovelMind::editor {
 
 // Static instance
 std::unique_ptr<EventBus> EventBus::s_instance = nullptr;
 
-EventBus::EventBus() = default;
+EventBus::EventBus()
+    : m_dispatchTable(std::make_shared<DispatchTable>()),
+      m_dispatchThread(std::this_thread::get_id()) {}
 
-EventBus::~EventBus() = default;
+EventBus::~EventBus() {
+  drainCrossThreadEvents();
+  for (auto &frame : m_frames) {
+    releaseFrame(frame);
+  }
+}
 
 EventBus &EventBus::instance() {
   if (!s_instance) {
@@ -17,6 +25,37 @@ EventBus &EventBus::instance() {
   return *s_instance;
 }
 
+// ============================================================================
+// Event Arena
+// ============================================================================
+
+void *EventBus::EventArena::allocate(size_t size, size_t alignment) {
+  for (;;) {
+    if (m_block < m_blocks.size()) {
+      auto base = reinterpret_cast<std::uintptr_t>(m_blocks[m_block].get());
+      std::uintptr_t address = (base + m_offset + alignment - 1) &
+                               ~static_cast<std::uintptr_t>(alignment - 1);
+      size_t aligned = static_cast<size_t>(address - base);
+      if (aligned + size <= m_blockSizes[m_block]) {
+        m_offset = aligned + size;
+        return m_blocks[m_block].get() + aligned;
+      }
+      ++m_block;
+      m_offset = 0;
+      continue;
+    }
+
+    size_t blockSize = std::max(BLOCK_SIZE, size + alignment);
+    m_blocks.push_back(std::make_unique<std::byte[]>(blockSize));
+    m_blockSizes.push_back(blockSize);
+  }
+}
+
+void EventBus::EventArena::reset() {
+  m_block = 0;
+  m_offset = 0;
+}
+
 // ============================================================================
 // Publishing
 // ============================================================================
@@ -24,10 +63,12 @@ EventBus &EventBus::instance() {
 void EventBus::publish(const EditorEvent &event) {
   if (m_synchronous) {
     dispatchEvent(event);
-  } else {
+  } else if (isDispatchThread()) {
     // Create a copy for queuing
-    auto eventCopy = std::make_unique<EditorEvent>(event);
-    queueEvent(std::move(eventCopy));
+    enqueueLocal(m_frames[m_writeFrame].arena.create<EditorEvent>(event),
+                 false);
+  } else {
+    queueEvent(std::make_unique<EditorEvent>(event));
   }
 }
 
@@ -48,26 +89,106 @@ void EventBus::queueEvent(std::unique_ptr<EditorEvent> event) {
     return;
   }
 
+  if (isDispatchThread()) {
+    enqueueLocal(event.release(), true);
+    return;
+  }
+
+  EditorEvent *raw = event.get();
+  if (m_crossThreadRing.push(raw)) {
+    event.release();
+    return;
+  }
+
+  // Ring is full; fall back to the locked overflow list
   std::lock_guard<std::mutex> lock(m_mutex);
-  m_eventQueue.push(std::move(event));
+  m_overflow.push_back(std::move(event));
+  m_hasOverflow.store(true, std::memory_order_release);
 }
 
-void EventBus::processQueuedEvents() {
-  std::queue<std::unique_ptr<EditorEvent>> eventsToProcess;
+void EventBus::enqueueLocal(EditorEvent *event, bool heapOwned) {
+  FrameQueue &frame = m_frames[m_writeFrame];
+
+  if (m_coalescing) {
+    std::string key = event->getCoalesceKey();
+    if (!key.empty()) {
+      key = std::to_string(static_cast<u32>(event->type)) + ':' + key;
+      auto [it, inserted] =
+          frame.coalesceIndex.try_emplace(std::move(key), frame.events.size());
+      if (!inserted) {
+        // The merged event takes the newest slot so it still follows
+        // everything queued before the latest occurrence
+        QueuedEvent merged = frame.events[it->second];
+        frame.events[it->second] = {};
+        merged.event->coalesce(*event);
+        it->second = frame.events.size();
+        frame.events.push_back(merged);
+        ++m_coalescedCount;
+        if (heapOwned) {
+          delete event;
+        } else {
+          event->~EditorEvent();
+        }
+        return;
+      }
+    }
+  }
 
-  {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    std::swap(eventsToProcess, m_eventQueue);
+  frame.events.push_back({event, heapOwned});
+}
+
+void EventBus::drainCrossThreadEvents() {
+  EditorEvent *event = nullptr;
+  while (m_crossThreadRing.pop(event)) {
+    enqueueLocal(event, true);
   }
 
-  while (!eventsToProcess.empty()) {
-    auto event = std::move(eventsToProcess.front());
-    eventsToProcess.pop();
+  if (m_hasOverflow.exchange(false, std::memory_order_acquire)) {
+    std::vector<std::unique_ptr<EditorEvent>> overflow;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      std::swap(overflow, m_overflow);
+    }
+    for (auto &pending : overflow) {
+      enqueueLocal(pending.release(), true);
+    }
+  }
+}
+
+void EventBus::releaseFrame(FrameQueue &frame) {
+  for (auto &queued : frame.events) {
+    if (queued.heapOwned) {
+      delete queued.event;
+    } else if (queued.event) {
+      queued.event->~EditorEvent();
+    }
+  }
+  frame.events.clear();
+  frame.coalesceIndex.clear();
+  frame.arena.reset();
+}
+
+void EventBus::processQueuedEvents() {
+  // Handlers calling back in would swap the frame being iterated
+  if (m_processing) {
+    return;
+  }
+  m_processing = true;
+
+  m_dispatchThread.store(std::this_thread::get_id(), std::memory_order_relaxed);
+  drainCrossThreadEvents();
 
-    if (event) {
-      dispatchEvent(*event);
+  FrameQueue &frame = m_frames[m_writeFrame];
+  m_writeFrame ^= 1;
+
+  for (auto &queued : frame.events) {
+    if (queued.event) {
+      dispatchEvent(*queued.event);
     }
   }
+
+  releaseFrame(frame);
+  m_processing = false;
 }
 
 void EventBus::dispatchEvent(const EditorEvent &event) {
@@ -76,39 +197,55 @@ void EventBus::dispatchEvent(const EditorEvent &event) {
     std::lock_guard<std::mutex> lock(m_mutex);
     m_eventHistory.push_back(event.getDescription());
     if (m_eventHistory.size() > MAX_HISTORY_SIZE) {
-      m_eventHistory.erase(m_eventHistory.begin());
+      m_eventHistory.pop_front();
     }
   }
 
-  // Copy subscribers to avoid issues if handlers modify subscriptions
-  std::vector<Subscriber> subscribersCopy;
+  // Hold the current snapshot so handlers may modify subscriptions
+  std::shared_ptr<const DispatchTable> table;
   {
     std::lock_guard<std::mutex> lock(m_mutex);
-    subscribersCopy = m_subscribers;
+    table = m_dispatchTable;
   }
 
-  // Dispatch to all matching subscribers
-  for (const auto &subscriber : subscribersCopy) {
-    bool shouldHandle = true;
+  const std::vector<Subscriber> *typed = nullptr;
+  const auto typeIndex = static_cast<u32>(event.type);
+  if (typeIndex < BUILTIN_EDITOR_EVENT_TYPE_COUNT) {
+    typed = &table->builtin[typeIndex];
+  } else if (auto it = table->custom.find(typeIndex);
+             it != table->custom.end()) {
+    typed = &it->second;
+  }
 
-    // Check type filter
-    if (subscriber.typeFilter.has_value() &&
-        subscriber.typeFilter.value() != event.type) {
-      shouldHandle = false;
+  // Merge the typed bucket with wildcard subscribers in subscription order
+  const auto &wildcard = table->wildcard;
+  size_t w = 0;
+  if (typed) {
+    for (const auto &subscriber : *typed) {
+      for (; w < wildcard.size() && wildcard[w].id < subscriber.id; ++w) {
+        invokeSubscriber(wildcard[w], event);
+      }
+      invokeSubscriber(subscriber, event);
     }
+  }
+  for (; w < wildcard.size(); ++w) {
+    invokeSubscriber(wildcard[w], event);
+  }
+}
 
-    // Check custom filter
-    if (shouldHandle && subscriber.customFilter.has_value() &&
-        !subscriber.customFilter.value()(event)) {
-      shouldHandle = false;
-    }
+void EventBus::invokeSubscriber(const Subscriber &subscriber,
+                                const EditorEvent &event) {
+  // Check custom filter
+  if (subscriber.customFilter.has_value() &&
+      !subscriber.customFilter.value()(event)) {
+    return;
+  }
 
-    if (shouldHandle && subscriber.handler) {
-      try {
-        subscriber.handler(event);
-      } catch (...) {
-        // Log error but continue dispatching
-      }
+  if (subscriber.handler) {
+    try {
+      subscriber.handler(event);
+    } catch (...) {
+      // Log error but continue dispatching
     }
   }
 }
@@ -117,6 +254,23 @@ void EventBus::dispatchEvent(const EditorEvent &event) {
 // Subscription
 // ============================================================================
 
+void EventBus::rebuildDispatchTable() {
+  auto table = std::make_shared<DispatchTable>();
+  for (const auto &sub : m_subscribers) {
+    if (!sub.typeFilter.has_value()) {
+      table->wildcard.push_back(sub);
+      continue;
+    }
+    const auto typeIndex = static_cast<u32>(sub.typeFilter.value());
+    if (typeIndex < BUILTIN_EDITOR_EVENT_TYPE_COUNT) {
+      table->builtin[typeIndex].push_back(sub);
+    } else {
+      table->custom[typeIndex].push_back(sub);
+    }
+  }
+  m_dispatchTable = std::move(table);
+}
+
 EventSubscription EventBus::subscribe(EventHandler handler) {
   std::lock_guard<std::mutex> lock(m_mutex);
 
@@ -125,6 +279,7 @@ EventSubscription EventBus::subscribe(EventHandler handler) {
   sub.handler = std::move(handler);
 
   m_subscribers.push_back(std::move(sub));
+  rebuildDispatchTable();
 
   return EventSubscription(m_subscribers.back().id);
 }
@@ -139,6 +294,7 @@ EventSubscription EventBus::subscribe(EditorEventType type,
   sub.typeFilter = type;
 
   m_subscribers.push_back(std::move(sub));
+  rebuildDispatchTable();
 
   return EventSubscription(m_subscribers.back().id);
 }
@@ -153,6 +309,7 @@ EventSubscription EventBus::subscribe(EventFilter filter,
   sub.customFilter = std::move(filter);
 
   m_subscribers.push_back(std::move(sub));
+  rebuildDispatchTable();
 
   return EventSubscription(m_subscribers.back().id);
 }
@@ -169,6 +326,7 @@ void EventBus::unsubscribe(const EventSubscription &subscription) {
                                        return sub.id == subscription.getId();
                                      }),
                       m_subscribers.end());
+  rebuildDispatchTable();
 }
 
 void EventBus::unsubscribeAll(EditorEventType type) {
@@ -180,11 +338,13 @@ void EventBus::unsubscribeAll(EditorEventType type) {
                                               sub.typeFilter.value() == type;
                                      }),
                       m_subscribers.end());
+  rebuildDispatchTable();
 }
 
 void EventBus::unsubscribeAll() {
   std::lock_guard<std::mutex> lock(m_mutex);
   m_subscribers.clear();
+  rebuildDispatchTable();
 }
 
 // ============================================================================
@@ -199,10 +359,7 @@ void EventBus::setHistoryEnabled(bool enabled) {
 std::vector<std::string> EventBus::getRecentEvents(size_t count) const {
   std::lock_guard<std::mutex> lock(m_mutex);
 
-  if (count >= m_eventHistory.size()) {
-    return m_eventHistory;
-  }
-
+  count = std::min(count, m_eventHistory.size());
   return std::vector<std::string>(m_eventHistory.end() -
                                       static_cast<std::ptrdiff_t>(count),
                                   m_eventHistory.end());
@@ -221,4 +378,10 @@ void EventBus::setSynchronous(bool sync) { m_synchronous = sync; }
 
 bool EventBus::isSynchronous() const { return m_synchronous; }
 
+void EventBus::setCoalescingEnabled(bool enabled) { m_coalescing = enabled; }
+
+bool EventBus::isCoalescingEnabled() const { return m_coalescing; }
+
+u64 EventBus::getCoalescedEventCount() const { return m_coalescedCount; }
+
 } // namespace NovelMind::editor
@@ -235,7 +235,7 @@ InspectorBindingManager::setPropertyValue(const std::string &name,
 
   // Validate
   std::string error;
-  if (!validatePropertyChange(context, error)) {
+  if (!validatePropertyChange(context, meta, error)) {
     return error;
   }
 
@@ -275,7 +275,7 @@ InspectorBindingManager::setPropertyValue(const std::string &name,
   refreshDependentProperties(name);
 
   // Publish event
-  publishPropertyChangedEvent(context);
+  publishPropertyChangedEvent(context, context.target.id);
 
   return std::nullopt;
 }
@@ -327,6 +327,41 @@ void InspectorBindingManager::endPropertyBatch() {
 
 bool InspectorBindingManager::isInBatch() const { return m_inBatch; }
 
+// ============================================================================
+// Multi-Object Editing
+// ============================================================================
+
+std::optional<std::string> InspectorBindingManager::setPropertyValueOnTargets(
+    const std::vector<InspectorTarget> &targets, const std::string &name,
+    const PropertyValue &value) {
+  if (targets.empty()) {
+    return "No targets selected";
+  }
+
+  const TypeInfo *typeInfo = getTypeInfoFor(targets.front().typeIndex);
+  if (!typeInfo) {
+    return "No type information for target";
+  }
+
+  // One dispatch on the value type for the whole set
+  return std::visit(
+      [&](const auto &typed) -> std::optional<std::string> {
+        using ValueType = std::decay_t<decltype(typed)>;
+        if constexpr (std::is_same_v<ValueType, std::nullptr_t>) {
+          return "Cannot set an empty value";
+        } else {
+          auto handle = typeInfo->findHandle<ValueType>(name);
+          if (!handle) {
+            return typeInfo->findProperty(name)
+                       ? "Value type does not match property: " + name
+                       : "Property not found: " + name;
+          }
+          return setPropertyValueOnTargets(targets, handle, typed);
+        }
+      },
+      value);
+}
+
 // ============================================================================
 // Property Binding Configuration
 // ============================================================================
@@ -434,27 +469,26 @@ const TypeInfo *InspectorBindingManager::getTypeInfoForTarget() const {
   if (!m_target.isValid()) {
     return nullptr;
   }
+  return getTypeInfoFor(m_target.typeIndex);
+}
 
+const TypeInfo *
+InspectorBindingManager::getTypeInfoFor(const std::type_index &type) const {
   // Check local type info first
-  auto it = m_typeInfoMap.find(m_target.typeIndex);
+  auto it = m_typeInfoMap.find(type);
   if (it != m_typeInfoMap.end()) {
     return it->second.get();
   }
 
   // Check global registry
-  return PropertyRegistry::instance().getTypeInfo(m_target.typeIndex);
+  return PropertyRegistry::instance().getTypeInfo(type);
 }
 
 bool InspectorBindingManager::validatePropertyChange(
-    const PropertyChangeContext &context, std::string &error) const {
+    const PropertyChangeContext &context, const PropertyMeta &meta,
+    std::string &error) const {
   // Check property meta validation
-  const auto *prop = getProperty(context.propertyName);
-  if (!prop) {
-    error = "Property not found";
-    return false;
-  }
-
-  if (!PropertyUtils::validate(context.newValue, prop->getMeta(), &error)) {
+  if (!PropertyUtils::validate(context.newValue, meta, &error)) {
     return false;
   }
 
@@ -471,6 +505,90 @@ bool InspectorBindingManager::validatePropertyChange(
   return true;
 }
 
+std::optional<std::string> InspectorBindingManager::prepareTargetsChange(
+    const std::vector<InspectorTarget> &targets,
+    const IPropertyAccessor &property, const PropertyValue &value,
+    PropertyChangeContext &context) {
+  if (targets.empty()) {
+    return "No targets selected";
+  }
+  for (const auto &target : targets) {
+    if (!target.isValid() || target.typeIndex != targets.front().typeIndex) {
+      return "Targets must be valid objects of the same type";
+    }
+  }
+
+  const auto &meta = property.getMeta();
+  if (hasFlag(meta.flags, PropertyFlags::ReadOnly)) {
+    return "Property is read-only";
+  }
+
+  context.target = targets.front();
+  context.propertyName = meta.name;
+  context.oldValue = property.getValue(targets.front().object);
+  context.newValue = value;
+
+  std::string error;
+  if (!validatePropertyChange(context, meta, error)) {
+    return error;
+  }
+
+  notifyPropertyWillChange(context);
+
+  auto bindingIt = m_bindings.find(meta.name);
+  if (bindingIt != m_bindings.end() && bindingIt->second.beforeChange) {
+    if (!bindingIt->second.beforeChange(context)) {
+      return "Change rejected by handler";
+    }
+  }
+
+  return std::nullopt;
+}
+
+void InspectorBindingManager::commitTargetsChange(
+    const PropertyChangeContext &context, const PropertyMeta &meta,
+    const std::vector<InspectorTarget> &targets,
+    std::unique_ptr<IEditorCommand> command) {
+  auto bindingIt = m_bindings.find(meta.name);
+  const bool recordUndo =
+      m_undoManager && !hasFlag(meta.flags, PropertyFlags::NoUndo) &&
+      (bindingIt == m_bindings.end() || bindingIt->second.recordUndo);
+
+  // Executing the command applies the value to every target
+  if (recordUndo) {
+    m_undoManager->executeCommand(std::move(command));
+  } else {
+    command->execute();
+  }
+
+  std::string objectIds;
+  bool includesCurrentTarget = false;
+  for (const auto &target : targets) {
+    if (!objectIds.empty()) {
+      objectIds += ',';
+    }
+    objectIds += target.id;
+    includesCurrentTarget =
+        includesCurrentTarget || target.object == m_target.object;
+  }
+  if (includesCurrentTarget) {
+    m_cachedValues[meta.name] = context.newValue;
+  }
+
+  if (m_inBatch) {
+    m_batchChanges.push_back(context);
+  }
+
+  notifyPropertyDidChange(context);
+
+  if (bindingIt != m_bindings.end() && bindingIt->second.afterChange) {
+    bindingIt->second.afterChange(context);
+  }
+
+  refreshDependentProperties(meta.name);
+  publishPropertyChangedEvent(context, objectIds);
+}
+
 void InspectorBindingManager::notifyTargetChanged() {
   for (auto *listener : m_listeners) {
     listener->onTargetChanged(m_target);
@@ -521,7 +639,7 @@ void InspectorBindingManager::refreshDependentProperties(
 }
 
 void InspectorBindingManager::publishPropertyChangedEvent(
-    const PropertyChangeContext &context) {
+    const PropertyChangeContext &context, const std::string &objectId) {
   if (!m_eventBus) {
     return;
   }
@@ -532,7 +650,7 @@ void InspectorBindingManager::publishPropertyChangedEvent(
   }
 
   PropertyChangedEvent event;
-  event.objectId = context.target.id;
+  event.objectId = objectId;
   event.propertyName = context.propertyName;
   event.oldValue = PropertyUtils::toString(context.oldValue);
   event.newValue = PropertyUtils::toString(context.newValue);
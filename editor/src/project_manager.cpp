@@ -1,4 +1,5 @@
 #include "NovelMind/editor/project_manager.hpp"
+#include "NovelMind/core/logger.hpp"
 #include <algorithm>
 #include <chrono>
 #include <ctime>
@@ -139,10 +140,24 @@ Result<void> ProjectManager::openProject(const std::string &path) {
     }
   }
 
+  // A missing or stale cache only costs a fuller scan
+  m_manifest.clear();
+  m_lastManifestScan = ManifestScanResult();
+  if (m_manifest.load(getManifestPath()).isError()) {
+    m_manifest.clear();
+  }
+
   m_state = ProjectState::Open;
   m_modified = false;
   m_timeSinceLastSave = 0.0;
 
+  // The project still opens; file listings fall back to the cached manifest
+  auto manifestResult = refreshManifest();
+  if (manifestResult.isError()) {
+    NOVELMIND_LOG_WARN("Failed to refresh project manifest: " +
+                       manifestResult.error());
+  }
+
   addToRecentProjects(m_projectPath);
   notifyProjectOpened();
 
@@ -221,6 +236,8 @@ Result<void> ProjectManager::closeProject(bool force) {
   // Clear project state
   m_projectPath.clear();
   m_metadata = ProjectMetadata();
+  m_manifest.clear();
+  m_lastManifestScan = ManifestScanResult();
   m_modified = false;
   m_timeSinceLastSave = 0.0;
 
@@ -312,6 +329,13 @@ ProjectManager::getProjectFiles(const std::string &extension) const {
     return files;
   }
 
+  if (!m_manifest.empty()) {
+    for (const auto &relativePath : m_manifest.getFiles(extension)) {
+      files.push_back((fs::path(m_projectPath) / relativePath).string());
+    }
+    return files;
+  }
+
   for (const auto &entry : fs::recursive_directory_iterator(m_projectPath)) {
     if (entry.is_regular_file() && entry.path().extension() == extension) {
       files.push_back(entry.path().string());
@@ -321,6 +345,51 @@ ProjectManager::getProjectFiles(const std::string &extension) const {
   return files;
 }
 
+// ============================================================================
+// Project Manifest
+// ============================================================================
+
+Result<ManifestScanResult> ProjectManager::refreshManifest() {
+  if (m_state != ProjectState::Open) {
+    return Result<ManifestScanResult>::error("No project is open");
+  }
+
+  auto scan = m_manifest.scan(m_projectPath);
+  if (scan.isError()) {
+    return scan;
+  }
+  m_lastManifestScan = scan.value();
+
+  // Nothing was re-read, so the cached file is still current
+  if (scan.value().hasChanges() || scan.value().hashedCount > 0 ||
+      !std::filesystem::exists(getManifestPath())) {
+    std::error_code ec;
+    std::filesystem::create_directories(getFolderPath(ProjectFolder::Temp), ec);
+    auto saveResult = m_manifest.save(getManifestPath());
+    if (saveResult.isError()) {
+      return Result<ManifestScanResult>::error(saveResult.error());
+    }
+  }
+  return scan;
+}
+
+const ProjectManifest &ProjectManager::getManifest() const {
+  return m_manifest;
+}
+
+const ManifestScanResult &ProjectManager::getLastManifestScan() const {
+  return m_lastManifestScan;
+}
+
+std::string ProjectManager::getManifestPath() const {
+  if (m_projectPath.empty()) {
+    return "";
+  }
+  return (std::filesystem::path(getFolderPath(ProjectFolder::Temp)) /
+          "project.manifest")
+      .string();
+}
+
 // ============================================================================
 // Folder Structure
 // ============================================================================
@@ -0,0 +1,430 @@
+/**
+ * @file project_manifest.cpp
+ * @brief ProjectManifest implementation
+ */
+
+#include "NovelMind/editor/project_manifest.hpp"
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+namespace NovelMind::editor
+{
+
+namespace fs = std::filesystem;
+
+namespace
+{
+
+constexpr u32 MAX_SCAN_THREADS = 16;
+constexpr usize MAX_PATH_BYTES = 0xFFFF;
+constexpr u64 FNV_OFFSET = 14695981039346656037ull;
+constexpr u64 FNV_PRIME = 1099511628211ull;
+
+u64 fnv1a(u64 hash, const u8* data, usize size)
+{
+    for (usize i = 0; i < size; ++i)
+    {
+        hash ^= data[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+template <typename T>
+void put(std::vector<u8>& out, T value)
+{
+    const auto* bytes = reinterpret_cast<const u8*>(&value);
+    out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+template <typename T>
+bool get(const u8* data, usize size, usize& pos, T& value)
+{
+    if (size - pos < sizeof(T))
+    {
+        return false;
+    }
+    std::memcpy(&value, data + pos, sizeof(T));
+    pos += sizeof(T);
+    return true;
+}
+
+// Directories still to be listed; a worker finishing the last one ends the walk
+struct DirectoryWalk
+{
+    std::mutex mutex;
+    std::condition_variable work;
+    std::vector<std::string> directories;
+    usize pending = 0; // Queued plus being listed
+};
+
+struct WalkOutput
+{
+    std::vector<ManifestEntry> files;
+    usize hashedCount = 0;
+    usize directoryCount = 0;
+};
+
+} // namespace
+
+Result<ManifestScanResult> ProjectManifest::scan(const std::string& root,
+                                                 const ManifestScanOptions& options)
+{
+    std::error_code ec;
+    if (!fs::is_directory(root, ec))
+    {
+        return Result<ManifestScanResult>::error("Not a directory: " + root);
+    }
+
+    const fs::path rootPath(root);
+    auto isExcluded = [&options](const std::string& relativePath) {
+        return std::find(options.excludedDirectories.begin(), options.excludedDirectories.end(),
+                         relativePath) != options.excludedDirectories.end();
+    };
+
+    // Lists one directory; m_entries is only read until every worker is done
+    auto listDirectory = [&](const std::string& directory, WalkOutput& output,
+                             std::vector<std::string>& subdirectories) {
+        std::error_code listEc;
+        fs::directory_iterator it(rootPath / directory,
+                                  fs::directory_options::skip_permission_denied, listEc);
+        if (listEc)
+        {
+            return;
+        }
+        ++output.directoryCount;
+
+        for (; it != fs::directory_iterator(); it.increment(listEc))
+        {
+            if (listEc)
+            {
+                break;
+            }
+            const auto& entry = *it;
+            const std::string name = entry.path().filename().string();
+            std::string relativePath = directory.empty() ? name : directory + "/" + name;
+
+            std::error_code statEc;
+            if (entry.is_directory(statEc))
+            {
+                if (!entry.is_symlink(statEc) && !isExcluded(relativePath))
+                {
+                    subdirectories.push_back(std::move(relativePath));
+                }
+                continue;
+            }
+            if (!entry.is_regular_file(statEc) || relativePath.size() > MAX_PATH_BYTES)
+            {
+                continue;
+            }
+
+            ManifestEntry file;
+            file.size = static_cast<u64>(entry.file_size(statEc));
+            if (statEc)
+            {
+                continue;
+            }
+            file.modifiedTime = static_cast<i64>(entry.last_write_time(statEc).time_since_epoch().count());
+            if (statEc)
+            {
+                continue;
+            }
+
+            const ManifestEntry* previous = find(relativePath);
+            if (previous && previous->size == file.size && previous->modifiedTime == file.modifiedTime)
+            {
+                file.hash = previous->hash;
+            }
+            else
+            {
+                auto hash = hashFile(entry.path().string());
+                if (hash.isError())
+                {
+                    continue; // Removed or unreadable since it was listed
+                }
+                file.hash = hash.value();
+                ++output.hashedCount;
+            }
+            file.path = std::move(relativePath);
+            output.files.push_back(std::move(file));
+        }
+    };
+
+    DirectoryWalk walk;
+    walk.directories.push_back(std::string());
+    walk.pending = 1;
+
+    auto worker = [&](WalkOutput& output) {
+        for (;;)
+        {
+            std::string directory;
+            {
+                std::unique_lock<std::mutex> lock(walk.mutex);
+                walk.work.wait(lock, [&walk]() { return !walk.directories.empty() || walk.pending == 0; });
+                if (walk.directories.empty())
+                {
+                    return;
+                }
+                directory = std::move(walk.directories.back());
+                walk.directories.pop_back();
+            }
+
+            std::vector<std::string> subdirectories;
+            listDirectory(directory, output, subdirectories);
+
+            std::lock_guard<std::mutex> lock(walk.mutex);
+            walk.pending += subdirectories.size();
+            --walk.pending;
+            for (auto& subdirectory : subdirectories)
+            {
+                walk.directories.push_back(std::move(subdirectory));
+            }
+            if (walk.pending == 0 || !subdirectories.empty())
+            {
+                walk.work.notify_all();
+            }
+        }
+    };
+
+    u32 threadCount = options.threadCount > 0 ? options.threadCount
+                                              : std::max(1u, std::thread::hardware_concurrency());
+    threadCount = std::min(threadCount, MAX_SCAN_THREADS);
+    std::vector<WalkOutput> outputs(threadCount);
+    std::vector<std::thread> threads;
+    for (u32 t = 1; t < threadCount; ++t)
+    {
+        threads.emplace_back(worker, std::ref(outputs[t]));
+    }
+    worker(outputs[0]);
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ManifestScanResult result;
+    std::vector<ManifestEntry> entries;
+    for (auto& output : outputs)
+    {
+        result.hashedCount += output.hashedCount;
+        result.directoryCount += output.directoryCount;
+        std::move(output.files.begin(), output.files.end(), std::back_inserter(entries));
+    }
+    std::sort(entries.begin(), entries.end(),
+              [](const ManifestEntry& a, const ManifestEntry& b) { return a.path < b.path; });
+
+    // Both lists are sorted by path, so one pass classifies every file
+    usize oldIndex = 0;
+    usize newIndex = 0;
+    while (oldIndex < m_entries.size() || newIndex < entries.size())
+    {
+        if (newIndex == entries.size() ||
+            (oldIndex < m_entries.size() && m_entries[oldIndex].path < entries[newIndex].path))
+        {
+            result.removed.push_back(m_entries[oldIndex++].path);
+        }
+        else if (oldIndex == m_entries.size() || entries[newIndex].path < m_entries[oldIndex].path)
+        {
+            result.added.push_back(entries[newIndex++].path);
+        }
+        else
+        {
+            const ManifestEntry& before = m_entries[oldIndex++];
+            const ManifestEntry& after = entries[newIndex++];
+            if (before.size != after.size || before.hash != after.hash)
+            {
+                result.modified.push_back(after.path);
+            }
+            else
+            {
+                ++result.unchangedCount;
+            }
+        }
+    }
+
+    m_entries = std::move(entries);
+    return Result<ManifestScanResult>::ok(std::move(result));
+}
+
+Result<void> ProjectManifest::load(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        return Result<void>::error("Failed to open manifest: " + path);
+    }
+    std::vector<u8> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    return decode(data.data(), data.size());
+}
+
+Result<void> ProjectManifest::save(const std::string& path) const
+{
+    const std::vector<u8> data = encode();
+
+    const std::string tempPath = path + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        if (!file)
+        {
+            return Result<void>::error("Failed to write manifest: " + tempPath);
+        }
+    }
+    std::error_code ec;
+    fs::rename(tempPath, path, ec);
+    if (ec)
+    {
+        fs::remove(tempPath, ec);
+        return Result<void>::error("Failed to replace manifest: " + path);
+    }
+    return Result<void>::ok();
+}
+
+std::vector<u8> ProjectManifest::encode() const
+{
+    std::vector<u8> out(sizeof(ProjectManifestHeader));
+    const std::string* previous = nullptr;
+    u32 entryCount = 0;
+    for (const auto& entry : m_entries)
+    {
+        if (entry.path.size() > MAX_PATH_BYTES)
+        {
+            continue;
+        }
+        usize prefix = 0;
+        if (previous)
+        {
+            const usize limit = std::min(previous->size(), entry.path.size());
+            while (prefix < limit && (*previous)[prefix] == entry.path[prefix])
+            {
+                ++prefix;
+            }
+        }
+        put(out, static_cast<u16>(prefix));
+        put(out, static_cast<u16>(entry.path.size() - prefix));
+        out.insert(out.end(), entry.path.begin() + static_cast<std::ptrdiff_t>(prefix), entry.path.end());
+        put(out, entry.size);
+        put(out, entry.modifiedTime);
+        put(out, entry.hash);
+        previous = &entry.path;
+        ++entryCount;
+    }
+
+    ProjectManifestHeader header{};
+    header.magic = PROJECT_MANIFEST_MAGIC;
+    header.version = PROJECT_MANIFEST_VERSION;
+    header.entryCount = entryCount;
+    header.payloadSize = static_cast<u32>(out.size() - sizeof(header));
+    header.payloadHash = fnv1a(FNV_OFFSET, out.data() + sizeof(header), header.payloadSize);
+    std::memcpy(out.data(), &header, sizeof(header));
+    return out;
+}
+
+Result<void> ProjectManifest::decode(const u8* data, usize size)
+{
+    ProjectManifestHeader header{};
+    if (size < sizeof(header))
+    {
+        return Result<void>::error("Manifest is truncated");
+    }
+    std::memcpy(&header, data, sizeof(header));
+    if (header.magic != PROJECT_MANIFEST_MAGIC || header.version != PROJECT_MANIFEST_VERSION)
+    {
+        return Result<void>::error("Not a supported manifest");
+    }
+    if (header.payloadSize != size - sizeof(header) ||
+        header.payloadHash != fnv1a(FNV_OFFSET, data + sizeof(header), header.payloadSize))
+    {
+        return Result<void>::error("Manifest is corrupt");
+    }
+
+    std::vector<ManifestEntry> entries;
+    entries.reserve(std::min<usize>(header.entryCount, header.payloadSize / 28));
+    usize pos = sizeof(header);
+    for (u32 i = 0; i < header.entryCount; ++i)
+    {
+        u16 prefix = 0;
+        u16 suffix = 0;
+        if (!get(data, size, pos, prefix) || !get(data, size, pos, suffix) || size - pos < suffix)
+        {
+            return Result<void>::error("Manifest is corrupt");
+        }
+        if (!entries.empty() ? prefix > entries.back().path.size() : prefix != 0)
+        {
+            return Result<void>::error("Manifest is corrupt");
+        }
+
+        ManifestEntry entry;
+        if (!entries.empty())
+        {
+            entry.path.assign(entries.back().path, 0, prefix);
+        }
+        entry.path.append(reinterpret_cast<const char*>(data + pos), suffix);
+        pos += suffix;
+        if (!get(data, size, pos, entry.size) || !get(data, size, pos, entry.modifiedTime) ||
+            !get(data, size, pos, entry.hash) ||
+            (!entries.empty() && !(entries.back().path < entry.path)))
+        {
+            return Result<void>::error("Manifest is corrupt");
+        }
+        entries.push_back(std::move(entry));
+    }
+    if (pos != size)
+    {
+        return Result<void>::error("Manifest is corrupt");
+    }
+
+    m_entries = std::move(entries);
+    return Result<void>::ok();
+}
+
+const ManifestEntry* ProjectManifest::find(const std::string& path) const
+{
+    auto it = std::lower_bound(m_entries.begin(), m_entries.end(), path,
+                               [](const ManifestEntry& entry, const std::string& key) {
+                                   return entry.path < key;
+                               });
+    return it != m_entries.end() && it->path == path ? &*it : nullptr;
+}
+
+std::vector<std::string> ProjectManifest::getFiles(const std::string& extension) const
+{
+    std::vector<std::string> files;
+    for (const auto& entry : m_entries)
+    {
+        if (entry.path.size() >= extension.size() &&
+            entry.path.compare(entry.path.size() - extension.size(), extension.size(), extension) == 0)
+        {
+            files.push_back(entry.path);
+        }
+    }
+    return files;
+}
+
+Result<u64> ProjectManifest::hashFile(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        return Result<u64>::error("Failed to open file: " + path);
+    }
+
+    u64 hash = FNV_OFFSET;
+    std::vector<char> buffer(64 * 1024);
+    while (file)
+    {
+        file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        hash = fnv1a(hash, reinterpret_cast<const u8*>(buffer.data()), static_cast<usize>(file.gcount()));
+    }
+    if (file.bad())
+    {
+        return Result<u64>::error("Failed to read file: " + path);
+    }
+    return Result<u64>::ok(hash);
+}
+
+} // namespace NovelMind::editor
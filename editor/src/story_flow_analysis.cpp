@@ -0,0 +1,555 @@
+#include "NovelMind/editor/story_flow_analysis.hpp"
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+namespace NovelMind::editor
+{
+
+namespace
+{
+
+constexpr u32 UNSET = std::numeric_limits<u32>::max();
+
+u64 saturatingAdd(u64 a, u64 b, bool& saturated)
+{
+    if (a > std::numeric_limits<u64>::max() - b)
+    {
+        saturated = true;
+        return std::numeric_limits<u64>::max();
+    }
+    return a + b;
+}
+
+/**
+ * @brief Compressed adjacency list
+ */
+struct Csr
+{
+    std::vector<u32> offsets;
+    std::vector<u32> targets;
+
+    [[nodiscard]] u32 begin(u32 v) const { return offsets[v]; }
+    [[nodiscard]] u32 end(u32 v) const { return offsets[v + 1]; }
+};
+
+Csr buildCsr(usize nodeCount, const std::vector<std::pair<u32, u32>>& edges, bool reverse)
+{
+    Csr g;
+    g.offsets.assign(nodeCount + 1, 0);
+    for (const auto& [from, to] : edges)
+    {
+        ++g.offsets[(reverse ? to : from) + 1];
+    }
+    for (usize i = 0; i < nodeCount; ++i)
+    {
+        g.offsets[i + 1] += g.offsets[i];
+    }
+    g.targets.resize(edges.size());
+    std::vector<u32> cursor(g.offsets.begin(), g.offsets.end() - 1);
+    for (const auto& [from, to] : edges)
+    {
+        u32 source = reverse ? to : from;
+        g.targets[cursor[source]++] = reverse ? from : to;
+    }
+    return g;
+}
+
+/**
+ * @brief Iterative Tarjan; component ids come out in reverse topological order
+ */
+u32 computeComponents(const Csr& g, usize n, std::vector<u32>& componentOf)
+{
+    struct Frame
+    {
+        u32 node;
+        u32 edge;
+    };
+
+    std::vector<u32> index(n, UNSET);
+    std::vector<u32> low(n, 0);
+    std::vector<bool> onStack(n, false);
+    std::vector<u32> stack;
+    std::vector<Frame> calls;
+    componentOf.assign(n, UNSET);
+    u32 counter = 0;
+    u32 components = 0;
+
+    for (u32 root = 0; root < n; ++root)
+    {
+        if (index[root] != UNSET) continue;
+
+        index[root] = low[root] = counter++;
+        stack.push_back(root);
+        onStack[root] = true;
+        calls.push_back({root, g.begin(root)});
+
+        while (!calls.empty())
+        {
+            Frame& frame = calls.back();
+            const u32 v = frame.node;
+            if (frame.edge < g.end(v))
+            {
+                const u32 w = g.targets[frame.edge++];
+                if (index[w] == UNSET)
+                {
+                    index[w] = low[w] = counter++;
+                    stack.push_back(w);
+                    onStack[w] = true;
+                    calls.push_back({w, g.begin(w)});
+                }
+                else if (onStack[w])
+                {
+                    low[v] = std::min(low[v], index[w]);
+                }
+                continue;
+            }
+
+            if (low[v] == index[v])
+            {
+                u32 w = UNSET;
+                do
+                {
+                    w = stack.back();
+                    stack.pop_back();
+                    onStack[w] = false;
+                    componentOf[w] = components;
+                } while (w != v);
+                ++components;
+            }
+            calls.pop_back();
+            if (!calls.empty())
+            {
+                const u32 parent = calls.back().node;
+                low[parent] = std::min(low[parent], low[v]);
+            }
+        }
+    }
+    return components;
+}
+
+/**
+ * @brief Cooper-Harvey-Kennedy dominators with a virtual root over the entries
+ */
+std::vector<i32> computeDominators(const Csr& succ, const Csr& pred, usize n,
+                                   const std::vector<u32>& entries)
+{
+    const u32 root = static_cast<u32>(n);
+    std::vector<u32> postorder(n + 1, UNSET);
+    std::vector<u32> order; // reverse postorder, built backwards
+    order.reserve(n + 1);
+
+    // Iterative DFS from the virtual root
+    struct Frame
+    {
+        u32 node;
+        u32 edge;
+    };
+    std::vector<bool> visited(n + 1, false);
+    std::vector<Frame> calls;
+    u32 counter = 0;
+    visited[root] = true;
+    calls.push_back({root, 0});
+    while (!calls.empty())
+    {
+        Frame& frame = calls.back();
+        u32 next = UNSET;
+        if (frame.node == root)
+        {
+            if (frame.edge < entries.size()) next = entries[frame.edge++];
+        }
+        else if (frame.edge < succ.end(frame.node) - succ.begin(frame.node))
+        {
+            next = succ.targets[succ.begin(frame.node) + frame.edge++];
+        }
+        else
+        {
+            postorder[frame.node] = counter++;
+            order.push_back(frame.node);
+            calls.pop_back();
+            continue;
+        }
+
+        if (next == UNSET)
+        {
+            postorder[frame.node] = counter++;
+            order.push_back(frame.node);
+            calls.pop_back();
+        }
+        else if (!visited[next])
+        {
+            visited[next] = true;
+            calls.push_back({next, 0});
+        }
+    }
+    std::reverse(order.begin(), order.end());
+
+    std::vector<bool> isEntry(n, false);
+    for (u32 entry : entries) isEntry[entry] = true;
+
+    std::vector<u32> idom(n + 1, UNSET);
+    idom[root] = root;
+
+    auto intersect = [&](u32 a, u32 b) {
+        while (a != b)
+        {
+            while (postorder[a] < postorder[b]) a = idom[a];
+            while (postorder[b] < postorder[a]) b = idom[b];
+        }
+        return a;
+    };
+
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (u32 v : order)
+        {
+            if (v == root) continue;
+
+            u32 newIdom = isEntry[v] ? root : UNSET;
+            for (u32 e = pred.begin(v); e < pred.end(v); ++e)
+            {
+                const u32 p = pred.targets[e];
+                if (idom[p] == UNSET) continue;
+                newIdom = newIdom == UNSET ? p : intersect(p, newIdom);
+            }
+            if (newIdom != UNSET && idom[v] != newIdom)
+            {
+                idom[v] = newIdom;
+                changed = true;
+            }
+        }
+    }
+
+    std::vector<i32> result(n, StoryFlowResult::NO_NODE);
+    for (u32 v = 0; v < n; ++v)
+    {
+        if (idom[v] != UNSET && idom[v] != root)
+        {
+            result[v] = static_cast<i32>(idom[v]);
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+// ============================================================================
+// StoryFlowResult
+// ============================================================================
+
+i32 StoryFlowResult::find(const std::string& id) const
+{
+    auto it = nodeIndex.find(id);
+    return it != nodeIndex.end() ? static_cast<i32>(it->second) : NO_NODE;
+}
+
+bool StoryFlowResult::isReachable(const std::string& id) const
+{
+    i32 v = find(id);
+    return v != NO_NODE && reachable[static_cast<usize>(v)];
+}
+
+bool StoryFlowResult::dominates(const std::string& dominator, const std::string& node) const
+{
+    i32 d = find(dominator);
+    i32 v = find(node);
+    if (d == NO_NODE || v == NO_NODE || !reachable[static_cast<usize>(v)]) return false;
+
+    for (; v != NO_NODE; v = immediateDominator[static_cast<usize>(v)])
+    {
+        if (v == d) return true;
+    }
+    return false;
+}
+
+std::vector<std::string> StoryFlowResult::getDominators(const std::string& id) const
+{
+    std::vector<std::string> result;
+    i32 v = find(id);
+    if (v == NO_NODE) return result;
+
+    for (v = immediateDominator[static_cast<usize>(v)]; v != NO_NODE;
+         v = immediateDominator[static_cast<usize>(v)])
+    {
+        result.push_back(nodes[static_cast<usize>(v)]);
+    }
+    return result;
+}
+
+// ============================================================================
+// StoryFlowAnalyzer
+// ============================================================================
+
+StoryFlowAnalyzer::StoryFlowAnalyzer() = default;
+
+StoryFlowAnalyzer::~StoryFlowAnalyzer()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+    if (m_worker && m_worker->joinable())
+    {
+        m_worker->join();
+    }
+}
+
+void StoryFlowAnalyzer::setFileGraph(const std::string& filePath, std::vector<std::string> nodes,
+                                     std::vector<StoryFlowEdge> edges)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto& file = m_files[filePath];
+    file.nodes = std::move(nodes);
+    file.edges = std::move(edges);
+    ++m_revision;
+}
+
+void StoryFlowAnalyzer::removeFile(const std::string& filePath)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_files.erase(filePath) > 0)
+    {
+        ++m_revision;
+    }
+}
+
+void StoryFlowAnalyzer::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_files.clear();
+    m_entryPoints.clear();
+    ++m_revision;
+}
+
+void StoryFlowAnalyzer::setEntryPoints(std::vector<std::string> entryPoints)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entryPoints = std::move(entryPoints);
+    ++m_revision;
+}
+
+u64 StoryFlowAnalyzer::getRevision() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_revision;
+}
+
+StoryFlowAnalyzer::Snapshot StoryFlowAnalyzer::takeSnapshot() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return Snapshot{m_files, m_entryPoints, m_revision};
+}
+
+StoryFlowResult StoryFlowAnalyzer::analyze() const
+{
+    return analyzeSnapshot(takeSnapshot());
+}
+
+StoryFlowResult StoryFlowAnalyzer::analyzeSnapshot(const Snapshot& snapshot)
+{
+    auto startTime = std::chrono::steady_clock::now();
+
+    StoryFlowResult result;
+    result.revision = snapshot.revision;
+
+    auto intern = [&result](const std::string& id) {
+        auto [it, inserted] =
+            result.nodeIndex.try_emplace(id, static_cast<u32>(result.nodes.size()));
+        if (inserted) result.nodes.push_back(id);
+        return it->second;
+    };
+
+    std::vector<std::pair<u32, u32>> edges;
+    for (const auto& [path, file] : snapshot.files)
+    {
+        for (const auto& node : file.nodes) intern(node);
+        for (const auto& edge : file.edges)
+        {
+            edges.emplace_back(intern(edge.from), intern(edge.to));
+        }
+    }
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+    const usize n = result.nodes.size();
+    const Csr succ = buildCsr(n, edges, false);
+    const Csr pred = buildCsr(n, edges, true);
+
+    // Entry points and endpoints
+    for (const auto& id : snapshot.entryPoints)
+    {
+        auto it = result.nodeIndex.find(id);
+        if (it != result.nodeIndex.end()) result.entryPoints.push_back(it->second);
+    }
+    if (result.entryPoints.empty())
+    {
+        for (u32 v = 0; v < n; ++v)
+        {
+            if (pred.begin(v) == pred.end(v)) result.entryPoints.push_back(v);
+        }
+        if (result.entryPoints.empty() && n > 0) result.entryPoints.push_back(0);
+    }
+    for (u32 v = 0; v < n; ++v)
+    {
+        if (succ.begin(v) == succ.end(v)) result.endpoints.push_back(v);
+    }
+
+    // Cycles
+    result.componentCount = computeComponents(succ, n, result.componentOf);
+    std::vector<u32> componentSize(result.componentCount, 0);
+    for (u32 v = 0; v < n; ++v) ++componentSize[result.componentOf[v]];
+    std::vector<bool> cyclic(result.componentCount, false);
+    for (u32 c = 0; c < result.componentCount; ++c) cyclic[c] = componentSize[c] > 1;
+    for (const auto& [from, to] : edges)
+    {
+        if (from == to) cyclic[result.componentOf[from]] = true;
+    }
+    result.inCycle.resize(n);
+    for (u32 v = 0; v < n; ++v) result.inCycle[v] = cyclic[result.componentOf[v]];
+    result.cycleCount = static_cast<u32>(std::count(cyclic.begin(), cyclic.end(), true));
+
+    // Reachability and depth
+    result.reachable.assign(n, false);
+    result.depth.assign(n, -1);
+    std::vector<u32> queue;
+    queue.reserve(n);
+    for (u32 entry : result.entryPoints)
+    {
+        if (result.reachable[entry]) continue;
+        result.reachable[entry] = true;
+        result.depth[entry] = 0;
+        queue.push_back(entry);
+    }
+    for (usize head = 0; head < queue.size(); ++head)
+    {
+        const u32 v = queue[head];
+        for (u32 e = succ.begin(v); e < succ.end(v); ++e)
+        {
+            const u32 w = succ.targets[e];
+            if (result.reachable[w]) continue;
+            result.reachable[w] = true;
+            result.depth[w] = result.depth[v] + 1;
+            queue.push_back(w);
+        }
+    }
+
+    // Path counts over the condensation; higher component ids come first
+    std::vector<std::pair<u32, u32>> dagEdges;
+    for (const auto& [from, to] : edges)
+    {
+        const u32 a = result.componentOf[from];
+        const u32 b = result.componentOf[to];
+        if (a != b) dagEdges.emplace_back(a, b);
+    }
+    std::sort(dagEdges.begin(), dagEdges.end());
+    dagEdges.erase(std::unique(dagEdges.begin(), dagEdges.end()), dagEdges.end());
+    const Csr dag = buildCsr(result.componentCount, dagEdges, false);
+
+    bool saturated = false;
+    std::vector<u64> fromEntry(result.componentCount, 0);
+    for (u32 entry : result.entryPoints) fromEntry[result.componentOf[entry]] = 1;
+    for (u32 c = result.componentCount; c-- > 0;)
+    {
+        for (u32 e = dag.begin(c); e < dag.end(c); ++e)
+        {
+            u64& target = fromEntry[dag.targets[e]];
+            target = saturatingAdd(target, fromEntry[c], saturated);
+        }
+    }
+
+    std::vector<u64> toEnding(result.componentCount, 0);
+    for (u32 endpoint : result.endpoints) toEnding[result.componentOf[endpoint]] = 1;
+    for (u32 c = 0; c < result.componentCount; ++c)
+    {
+        for (u32 e = dag.begin(c); e < dag.end(c); ++e)
+        {
+            toEnding[c] = saturatingAdd(toEnding[c], toEnding[dag.targets[e]], saturated);
+        }
+    }
+
+    result.pathsFromEntry.resize(n);
+    result.pathsToEnding.resize(n);
+    for (u32 v = 0; v < n; ++v)
+    {
+        result.pathsFromEntry[v] = result.reachable[v] ? fromEntry[result.componentOf[v]] : 0;
+        result.pathsToEnding[v] = toEnding[result.componentOf[v]];
+    }
+    for (u32 endpoint : result.endpoints)
+    {
+        result.totalPaths =
+            saturatingAdd(result.totalPaths, result.pathsFromEntry[endpoint], saturated);
+    }
+    result.pathCountSaturated = saturated;
+
+    result.immediateDominator = computeDominators(succ, pred, n, result.entryPoints);
+
+    auto endTime = std::chrono::steady_clock::now();
+    result.analysisTimeMs =
+        std::chrono::duration<f64, std::milli>(endTime - startTime).count();
+    return result;
+}
+
+void StoryFlowAnalyzer::requestAnalysis()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pending = true;
+        if (!m_worker)
+        {
+            m_worker = std::make_unique<std::thread>(&StoryFlowAnalyzer::workerLoop, this);
+        }
+    }
+    m_wake.notify_one();
+}
+
+void StoryFlowAnalyzer::waitForIdle()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_idle.wait(lock, [this] { return !m_pending && !m_running; });
+}
+
+std::shared_ptr<const StoryFlowResult> StoryFlowAnalyzer::getResult() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_result;
+}
+
+void StoryFlowAnalyzer::setOnAnalysisCompleted(CompletionCallback callback)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_onCompleted = std::move(callback);
+}
+
+void StoryFlowAnalyzer::workerLoop()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;)
+    {
+        m_wake.wait(lock, [this] { return m_pending || m_stop; });
+        if (m_stop) break;
+
+        m_pending = false;
+        m_running = true;
+        Snapshot snapshot{m_files, m_entryPoints, m_revision};
+        lock.unlock();
+
+        auto result = std::make_shared<const StoryFlowResult>(analyzeSnapshot(snapshot));
+
+        lock.lock();
+        m_result = result;
+        CompletionCallback callback = m_onCompleted;
+        lock.unlock();
+        if (callback) callback(result);
+        lock.lock();
+
+        m_running = false;
+        if (!m_pending) m_idle.notify_all();
+    }
+    m_running = false;
+    m_idle.notify_all();
+}
+
+} // namespace NovelMind::editor
@@ -0,0 +1,711 @@
+#include "NovelMind/editor/symbol_index.hpp"
+#include "NovelMind/scripting/lexer.hpp"
+#include "NovelMind/scripting/parser.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <unordered_set>
+
+namespace fs = std::filesystem;
+
+namespace NovelMind::editor
+{
+
+using namespace scripting;
+
+namespace
+{
+
+bool isBoolLiteral(const ExprPtr& expr)
+{
+    if (!expr) return false;
+    auto* literal = std::get_if<LiteralExpr>(&expr->data);
+    return literal && std::holds_alternative<bool>(literal->value);
+}
+
+i64 fileTimestamp(const fs::path& path)
+{
+    std::error_code ec;
+    auto time = fs::last_write_time(path, ec);
+    return ec ? 0 : static_cast<i64>(time.time_since_epoch().count());
+}
+
+} // namespace
+
+// ============================================================================
+// AST walker
+// ============================================================================
+
+class SymbolIndex::Collector
+{
+public:
+    Collector(SymbolIndex& index, u32 file)
+        : m_index(index)
+        , m_file(file)
+    {}
+
+    void visitProgram(const Program& program)
+    {
+        for (const auto& character : program.characters)
+        {
+            def(SymbolKind::Character, character.id, character.location);
+            if (character.defaultSprite)
+            {
+                use(SymbolKind::Asset, *character.defaultSprite, character.location);
+            }
+        }
+        for (const auto& scene : program.scenes)
+        {
+            def(SymbolKind::Scene, scene.name, scene.location);
+            visitBlock(scene.body);
+        }
+        visitBlock(program.globalStatements);
+    }
+
+private:
+    void def(SymbolKind kind, const std::string& name, SourceLocation loc)
+    {
+        m_index.addSite(m_file, kind, name, loc, SymbolRole::Definition);
+    }
+
+    void use(SymbolKind kind, const std::string& name, SourceLocation loc)
+    {
+        m_index.addSite(m_file, kind, name, loc, SymbolRole::Use);
+    }
+
+    void visitBlock(const std::vector<StmtPtr>& statements)
+    {
+        for (const auto& stmt : statements)
+        {
+            if (stmt) visitStatement(*stmt);
+        }
+    }
+
+    void visitStatement(const Statement& stmt)
+    {
+        const SourceLocation loc = stmt.location;
+        std::visit(
+            [this, loc](const auto& s) {
+                using T = std::decay_t<decltype(s)>;
+                if constexpr (std::is_same_v<T, ShowStmt>)
+                {
+                    if (s.target == ShowStmt::Target::Character)
+                    {
+                        use(SymbolKind::Character, s.identifier, loc);
+                    }
+                    if (s.resource) use(SymbolKind::Asset, *s.resource, loc);
+                }
+                else if constexpr (std::is_same_v<T, HideStmt>)
+                {
+                    use(SymbolKind::Character, s.identifier, loc);
+                }
+                else if constexpr (std::is_same_v<T, SayStmt>)
+                {
+                    if (s.speaker) use(SymbolKind::Character, *s.speaker, loc);
+                }
+                else if constexpr (std::is_same_v<T, ChoiceStmt>)
+                {
+                    for (const auto& option : s.options)
+                    {
+                        if (option.condition) visitExpression(*option.condition);
+                        if (option.gotoTarget) use(SymbolKind::Scene, *option.gotoTarget, loc);
+                        visitBlock(option.body);
+                    }
+                }
+                else if constexpr (std::is_same_v<T, IfStmt>)
+                {
+                    visitExpression(s.condition);
+                    visitBlock(s.thenBranch);
+                    visitBlock(s.elseBranch);
+                }
+                else if constexpr (std::is_same_v<T, GotoStmt>)
+                {
+                    use(SymbolKind::Scene, s.target, loc);
+                }
+                else if constexpr (std::is_same_v<T, PlayStmt>)
+                {
+                    use(SymbolKind::Asset, s.resource, loc);
+                }
+                else if constexpr (std::is_same_v<T, SetStmt>)
+                {
+                    def(isBoolLiteral(s.value) ? SymbolKind::Flag : SymbolKind::Variable,
+                        s.variable, loc);
+                    visitExpression(s.value);
+                }
+                else if constexpr (std::is_same_v<T, ExpressionStmt>)
+                {
+                    visitExpression(s.expression);
+                }
+                else if constexpr (std::is_same_v<T, BlockStmt>)
+                {
+                    visitBlock(s.statements);
+                }
+                else if constexpr (std::is_same_v<T, SceneDecl>)
+                {
+                    def(SymbolKind::Scene, s.name, s.location);
+                    visitBlock(s.body);
+                }
+                else if constexpr (std::is_same_v<T, CharacterDecl>)
+                {
+                    def(SymbolKind::Character, s.id, s.location);
+                }
+            },
+            stmt.data);
+    }
+
+    void visitExpression(const ExprPtr& expr)
+    {
+        if (!expr) return;
+
+        const SourceLocation loc = expr->location;
+        std::visit(
+            [this, loc](const auto& e) {
+                using T = std::decay_t<decltype(e)>;
+                if constexpr (std::is_same_v<T, IdentifierExpr>)
+                {
+                    use(SymbolKind::Variable, e.name, loc);
+                }
+                else if constexpr (std::is_same_v<T, BinaryExpr>)
+                {
+                    visitExpression(e.left);
+                    visitExpression(e.right);
+                }
+                else if constexpr (std::is_same_v<T, UnaryExpr>)
+                {
+                    visitExpression(e.operand);
+                }
+                else if constexpr (std::is_same_v<T, CallExpr>)
+                {
+                    if ((e.callee == "tr" || e.callee == "loc") && !e.arguments.empty() &&
+                        e.arguments[0])
+                    {
+                        auto* literal = std::get_if<LiteralExpr>(&e.arguments[0]->data);
+                        if (literal && std::holds_alternative<std::string>(literal->value))
+                        {
+                            use(SymbolKind::LocalizationKey, std::get<std::string>(literal->value),
+                                loc);
+                        }
+                    }
+                    for (const auto& argument : e.arguments)
+                    {
+                        visitExpression(argument);
+                    }
+                }
+                else if constexpr (std::is_same_v<T, PropertyExpr>)
+                {
+                    visitExpression(e.object);
+                }
+            },
+            expr->data);
+    }
+
+    SymbolIndex& m_index;
+    u32 m_file;
+};
+
+// ============================================================================
+// Updates
+// ============================================================================
+
+std::string SymbolIndex::makeKey(SymbolKind kind, const std::string& name)
+{
+    std::string key;
+    key.reserve(name.size() + 1);
+    key.push_back(static_cast<char>('0' + static_cast<u8>(kind)));
+    key += name;
+    return key;
+}
+
+u64 SymbolIndex::hashContent(const std::string& content)
+{
+    // FNV-1a
+    u64 hash = 14695981039346656037ull;
+    for (char c : content)
+    {
+        hash ^= static_cast<u8>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+u32 SymbolIndex::fileSlot(const std::string& filePath)
+{
+    auto [it, inserted] = m_fileIds.try_emplace(filePath, static_cast<u32>(m_files.size()));
+    if (inserted)
+    {
+        FileEntry entry;
+        entry.path = filePath;
+        m_files.push_back(std::move(entry));
+    }
+    m_files[it->second].live = true;
+    return it->second;
+}
+
+u32 SymbolIndex::symbolSlot(SymbolKind kind, const std::string& name)
+{
+    auto [it, inserted] =
+        m_symbolIds.try_emplace(makeKey(kind, name), static_cast<u32>(m_symbols.size()));
+    if (inserted)
+    {
+        m_symbols.push_back({kind, name, {}});
+    }
+    return it->second;
+}
+
+void SymbolIndex::addSite(u32 file, SymbolKind kind, const std::string& name,
+                          SourceLocation loc, SymbolRole role)
+{
+    if (name.empty()) return;
+
+    const u32 symbol = symbolSlot(kind, name);
+    auto& sites = m_symbols[symbol].sites;
+    if (sites.empty() || sites.back().file != file)
+    {
+        m_files[file].symbols.push_back(symbol);
+    }
+    sites.push_back({file, loc.line, loc.column, role});
+}
+
+void SymbolIndex::removeFileLocked(u32 file)
+{
+    auto& entry = m_files[file];
+    std::sort(entry.symbols.begin(), entry.symbols.end());
+    entry.symbols.erase(std::unique(entry.symbols.begin(), entry.symbols.end()),
+                        entry.symbols.end());
+    for (u32 symbol : entry.symbols)
+    {
+        auto& sites = m_symbols[symbol].sites;
+        sites.erase(std::remove_if(sites.begin(), sites.end(),
+                                   [file](const Site& site) { return site.file == file; }),
+                    sites.end());
+    }
+    entry.symbols.clear();
+}
+
+void SymbolIndex::indexProgramLocked(u32 file, const Program& program)
+{
+    removeFileLocked(file);
+    Collector collector(*this, file);
+    collector.visitProgram(program);
+}
+
+void SymbolIndex::indexProgram(const std::string& filePath, const Program& program)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    indexProgramLocked(fileSlot(filePath), program);
+}
+
+Result<void> SymbolIndex::indexSourceLocked(u32 file, const std::string& source)
+{
+    Lexer lexer;
+    auto tokens = lexer.tokenize(source);
+    if (tokens.isError())
+    {
+        return Result<void>::error(tokens.error());
+    }
+
+    Parser parser;
+    auto program = parser.parse(tokens.value());
+    if (program.isError())
+    {
+        // Keep the previous sites so panels don't lose data mid-edit
+        return Result<void>::error(program.error());
+    }
+
+    indexProgramLocked(file, program.value());
+    m_files[file].contentHash = hashContent(source);
+    return Result<void>::ok();
+}
+
+Result<void> SymbolIndex::indexSource(const std::string& filePath, const std::string& source)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return indexSourceLocked(fileSlot(filePath), source);
+}
+
+Result<bool> SymbolIndex::indexFile(const std::string& filePath)
+{
+    std::error_code ec;
+    const u64 size = static_cast<u64>(fs::file_size(filePath, ec));
+    if (ec)
+    {
+        return Result<bool>::error("Cannot stat script file: " + filePath);
+    }
+    const i64 modified = fileTimestamp(filePath);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const u32 file = fileSlot(filePath);
+    auto& entry = m_files[file];
+    if (entry.contentHash != 0 && entry.size == size && entry.modifiedTime == modified)
+    {
+        return Result<bool>::ok(false);
+    }
+
+    std::ifstream stream(filePath, std::ios::binary);
+    if (!stream)
+    {
+        return Result<bool>::error("Cannot open script file: " + filePath);
+    }
+    std::ostringstream buffer;
+    buffer << stream.rdbuf();
+    const std::string source = buffer.str();
+
+    // Touched but unchanged: refresh the stamp without reparsing
+    const u64 hash = hashContent(source);
+    if (entry.contentHash == hash)
+    {
+        entry.size = size;
+        entry.modifiedTime = modified;
+        return Result<bool>::ok(false);
+    }
+
+    auto result = indexSourceLocked(file, source);
+    if (result.isError())
+    {
+        return Result<bool>::error(result.error());
+    }
+    m_files[file].size = size;
+    m_files[file].modifiedTime = modified;
+    return Result<bool>::ok(true);
+}
+
+void SymbolIndex::removeFile(const std::string& filePath)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_fileIds.find(filePath);
+    if (it == m_fileIds.end()) return;
+
+    removeFileLocked(it->second);
+    auto& entry = m_files[it->second];
+    entry.live = false;
+    entry.contentHash = 0;
+    entry.size = 0;
+    entry.modifiedTime = 0;
+}
+
+void SymbolIndex::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_symbols.clear();
+    m_symbolIds.clear();
+    m_files.clear();
+    m_fileIds.clear();
+}
+
+Result<usize> SymbolIndex::refresh(const std::vector<std::string>& filePaths)
+{
+    std::unordered_set<std::string> wanted(filePaths.begin(), filePaths.end());
+    for (const auto& path : getIndexedFiles())
+    {
+        if (wanted.find(path) == wanted.end()) removeFile(path);
+    }
+
+    usize reparsed = 0;
+    std::string firstError;
+    for (const auto& path : filePaths)
+    {
+        auto result = indexFile(path);
+        if (result.isError())
+        {
+            if (firstError.empty()) firstError = result.error();
+        }
+        else if (result.value())
+        {
+            ++reparsed;
+        }
+    }
+
+    if (!firstError.empty())
+    {
+        return Result<usize>::error(firstError);
+    }
+    return Result<usize>::ok(reparsed);
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+const SymbolIndex::Symbol* SymbolIndex::lookup(SymbolKind kind, const std::string& name) const
+{
+    auto it = m_symbolIds.find(makeKey(kind, name));
+    return it != m_symbolIds.end() ? &m_symbols[it->second] : nullptr;
+}
+
+SymbolLocation SymbolIndex::toLocation(const Site& site) const
+{
+    return {m_files[site.file].path, site.line, site.column, site.role};
+}
+
+std::vector<SymbolLocation> SymbolIndex::findReferences(SymbolKind kind,
+                                                        const std::string& name) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<SymbolLocation> result;
+
+    auto append = [this, &result](const Symbol* symbol) {
+        if (!symbol) return;
+        for (const auto& site : symbol->sites) result.push_back(toLocation(site));
+    };
+
+    append(lookup(kind, name));
+    // Flags are variables; reads of either show up as variable uses
+    if (kind == SymbolKind::Flag) append(lookup(SymbolKind::Variable, name));
+    if (kind == SymbolKind::Variable) append(lookup(SymbolKind::Flag, name));
+    return result;
+}
+
+std::optional<SymbolLocation> SymbolIndex::findDefinition(SymbolKind kind,
+                                                          const std::string& name) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (const Symbol* symbol = lookup(kind, name))
+    {
+        for (const auto& site : symbol->sites)
+        {
+            if (site.role == SymbolRole::Definition) return toLocation(site);
+        }
+    }
+    return std::nullopt;
+}
+
+bool SymbolIndex::isDefined(SymbolKind kind, const std::string& name) const
+{
+    return findDefinition(kind, name).has_value();
+}
+
+usize SymbolIndex::getUseCount(SymbolKind kind, const std::string& name) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const Symbol* symbol = lookup(kind, name);
+    if (!symbol) return 0;
+    return static_cast<usize>(std::count_if(symbol->sites.begin(), symbol->sites.end(),
+                                            [](const Site& site) {
+                                                return site.role == SymbolRole::Use;
+                                            }));
+}
+
+std::vector<std::string> SymbolIndex::getSymbols(SymbolKind kind) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<std::string> result;
+    for (const auto& symbol : m_symbols)
+    {
+        if (symbol.kind == kind && !symbol.sites.empty()) result.push_back(symbol.name);
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+std::vector<std::string> SymbolIndex::getUndefinedSymbols(SymbolKind kind) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<std::string> result;
+    for (const auto& symbol : m_symbols)
+    {
+        if (symbol.kind != kind || symbol.sites.empty()) continue;
+        bool defined = std::any_of(symbol.sites.begin(), symbol.sites.end(),
+                                   [](const Site& site) {
+                                       return site.role == SymbolRole::Definition;
+                                   });
+        if (!defined) result.push_back(symbol.name);
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+std::vector<std::string> SymbolIndex::getIndexedFiles() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<std::string> result;
+    for (const auto& entry : m_files)
+    {
+        if (entry.live) result.push_back(entry.path);
+    }
+    return result;
+}
+
+usize SymbolIndex::getSymbolCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return static_cast<usize>(std::count_if(m_symbols.begin(), m_symbols.end(),
+                                            [](const Symbol& s) { return !s.sites.empty(); }));
+}
+
+// ============================================================================
+// Persistence
+// ============================================================================
+
+Result<void> SymbolIndex::save(const std::string& path) const
+{
+    std::ofstream file(path, std::ios::binary);
+    if (!file)
+    {
+        return Result<void>::error("Failed to open symbol index for writing: " + path);
+    }
+
+    auto writeU32 = [&file](u32 value) {
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+    auto writeU64 = [&file](u64 value) {
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+    auto writeString = [&file, &writeU32](const std::string& str) {
+        writeU32(static_cast<u32>(str.size()));
+        file.write(str.data(), static_cast<std::streamsize>(str.size()));
+    };
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    writeU32(FILE_MAGIC);
+    writeU32(FILE_VERSION);
+
+    // File table (dead slots are kept so site file ids stay valid)
+    writeU32(static_cast<u32>(m_files.size()));
+    for (const auto& entry : m_files)
+    {
+        writeString(entry.path);
+        writeU64(entry.size);
+        writeU64(static_cast<u64>(entry.modifiedTime));
+        writeU64(entry.contentHash);
+        file.put(entry.live ? 1 : 0);
+    }
+
+    // Symbols with their sites
+    u32 symbolCount = 0;
+    for (const auto& symbol : m_symbols)
+    {
+        if (!symbol.sites.empty()) ++symbolCount;
+    }
+    writeU32(symbolCount);
+    for (const auto& symbol : m_symbols)
+    {
+        if (symbol.sites.empty()) continue;
+        file.put(static_cast<char>(symbol.kind));
+        writeString(symbol.name);
+        writeU32(static_cast<u32>(symbol.sites.size()));
+        for (const auto& site : symbol.sites)
+        {
+            writeU32(site.file);
+            writeU32(site.line);
+            writeU32(site.column);
+            file.put(static_cast<char>(site.role));
+        }
+    }
+
+    if (!file)
+    {
+        return Result<void>::error("Failed to write symbol index: " + path);
+    }
+    return Result<void>::ok();
+}
+
+Result<void> SymbolIndex::load(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file)
+    {
+        return Result<void>::error("Failed to open symbol index: " + path);
+    }
+    const auto fileSize = static_cast<u64>(file.tellg());
+    file.seekg(0);
+
+    auto readU32 = [&file]() {
+        u32 value = 0;
+        file.read(reinterpret_cast<char*>(&value), sizeof(value));
+        return value;
+    };
+    auto readU64 = [&file]() {
+        u64 value = 0;
+        file.read(reinterpret_cast<char*>(&value), sizeof(value));
+        return value;
+    };
+    auto readString = [&file, &readU32]() {
+        u32 len = readU32();
+        std::string str;
+        if (file && len < (1u << 20))
+        {
+            str.resize(len);
+            file.read(str.data(), static_cast<std::streamsize>(len));
+        }
+        else
+        {
+            file.setstate(std::ios::failbit);
+        }
+        return str;
+    };
+
+    // Every element takes at least @p minBytes, which bounds a corrupt count
+    auto readCount = [&file, &readU32, fileSize](u64 minBytes) -> u32 {
+        const u32 count = readU32();
+        const auto pos = file.tellg();
+        if (!file || pos < 0 || count > (fileSize - static_cast<u64>(pos)) / minBytes)
+        {
+            file.setstate(std::ios::failbit);
+            return 0;
+        }
+        return count;
+    };
+
+    if (readU32() != FILE_MAGIC || readU32() != FILE_VERSION)
+    {
+        return Result<void>::error("Not a compatible symbol index: " + path);
+    }
+
+    constexpr u64 MIN_FILE_BYTES = 29;   // Path length, size, time, hash, live
+    constexpr u64 MIN_SYMBOL_BYTES = 9;  // Kind, name length, site count
+    constexpr u64 SITE_BYTES = 13;       // File, line, column, role
+    std::vector<FileEntry> files(readCount(MIN_FILE_BYTES));
+    std::unordered_map<std::string, u32> fileIds;
+    for (u32 i = 0; i < files.size() && file; ++i)
+    {
+        auto& entry = files[i];
+        entry.path = readString();
+        entry.size = readU64();
+        entry.modifiedTime = static_cast<i64>(readU64());
+        entry.contentHash = readU64();
+        entry.live = file.get() == 1;
+        fileIds[entry.path] = i;
+    }
+
+    std::vector<Symbol> symbols(file ? readCount(MIN_SYMBOL_BYTES) : 0);
+    std::unordered_map<std::string, u32> symbolIds;
+    for (u32 i = 0; i < symbols.size() && file; ++i)
+    {
+        auto& symbol = symbols[i];
+        symbol.kind = static_cast<SymbolKind>(file.get());
+        symbol.name = readString();
+        symbol.sites.resize(readCount(SITE_BYTES));
+        for (auto& site : symbol.sites)
+        {
+            site.file = readU32();
+            site.line = readU32();
+            site.column = readU32();
+            site.role = static_cast<SymbolRole>(file.get());
+            if (site.file >= files.size())
+            {
+                return Result<void>::error("Corrupt symbol index: " + path);
+            }
+            if (files[site.file].symbols.empty() || files[site.file].symbols.back() != i)
+            {
+                files[site.file].symbols.push_back(i);
+            }
+        }
+        symbolIds[makeKey(symbol.kind, symbol.name)] = i;
+    }
+
+    if (!file)
+    {
+        return Result<void>::error("Truncated symbol index: " + path);
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_files = std::move(files);
+    m_fileIds = std::move(fileIds);
+    m_symbols = std::move(symbols);
+    m_symbolIds = std::move(symbolIds);
+    return Result<void>::ok();
+}
+
+} // namespace NovelMind::editor
@@ -1,4 +1,5 @@
 #include "NovelMind/editor/timeline_playback.hpp"
+#include "NovelMind/editor/timeline_editor.hpp"
 #include <algorithm>
 #include <chrono>
 #include <cmath>
@@ -92,6 +93,7 @@ void TimelinePlaybackEngine::stop() {
   m_loopCount = 0;
   m_direction = PlaybackDirection::Forward;
 
+  evaluateLocked();
   notifyStateChanged();
   notifyTimeChanged();
 
@@ -119,6 +121,7 @@ void TimelinePlaybackEngine::seekTo(f64 time) {
   [[maybe_unused]] f64 oldTime = m_currentTime;
   m_currentTime = clampTime(time);
 
+  evaluateLocked();
   notifyTimeChanged();
 
   TimelineEvent event;
@@ -163,6 +166,7 @@ void TimelinePlaybackEngine::scrubTo(f64 time) {
   }
 
   m_currentTime = clampTime(time);
+  evaluateLocked();
   notifyTimeChanged();
 }
 
@@ -297,6 +301,7 @@ void TimelinePlaybackEngine::registerTrack(const std::string &trackId) {
 void TimelinePlaybackEngine::unregisterTrack(const std::string &trackId) {
   std::lock_guard<std::mutex> lock(m_mutex);
   m_tracks.erase(trackId);
+  refreshTrackActivation();
 }
 
 std::optional<TrackPlaybackState>
@@ -317,6 +322,7 @@ void TimelinePlaybackEngine::setTrackEnabled(const std::string &trackId,
   auto it = m_tracks.find(trackId);
   if (it != m_tracks.end()) {
     it->second.enabled = enabled;
+    refreshTrackActivation();
     notifyTrackStateChanged(trackId);
   }
 }
@@ -328,6 +334,7 @@ void TimelinePlaybackEngine::setTrackSolo(const std::string &trackId,
   auto it = m_tracks.find(trackId);
   if (it != m_tracks.end()) {
     it->second.solo = solo;
+    refreshTrackActivation();
     notifyTrackStateChanged(trackId);
   }
 }
@@ -339,6 +346,7 @@ void TimelinePlaybackEngine::setTrackMuted(const std::string &trackId,
   auto it = m_tracks.find(trackId);
   if (it != m_tracks.end()) {
     it->second.muted = muted;
+    refreshTrackActivation();
     notifyTrackStateChanged(trackId);
   }
 }
@@ -349,6 +357,57 @@ void TimelinePlaybackEngine::clearAllSolo() {
   for (auto &pair : m_tracks) {
     pair.second.solo = false;
   }
+  refreshTrackActivation();
+}
+
+// ============================================================================
+// Timeline Content
+// ============================================================================
+
+Result<void>
+TimelinePlaybackEngine::loadTimeline(const Timeline &timeline,
+                                     const scene::TimelineCompileOptions &options) {
+  scene::TimelineCompiler compiler(options);
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  m_compiledTracks.clear();
+  for (const auto &track : timeline.getTracks()) {
+    if (track) {
+      collectTrack(*track, compiler);
+    }
+  }
+
+  auto result = compiler.compile();
+  if (result.isError()) {
+    return Result<void>::error(result.error());
+  }
+
+  m_compiled = std::move(result).value();
+  m_hasCompiled = true;
+  m_duration = std::max(timeline.getDuration(), m_compiled.getDuration());
+  m_frameRate = std::max(1.0, timeline.getFrameRate());
+  m_currentTime = clampTime(m_currentTime);
+  refreshTrackActivation();
+
+  return Result<void>::ok();
+}
+
+void TimelinePlaybackEngine::unloadTimeline() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_compiled = scene::CompiledTimeline();
+  m_compiledTracks.clear();
+  m_hasCompiled = false;
+}
+
+usize TimelinePlaybackEngine::bindScene(scene::SceneGraph *graph) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  if (!graph) {
+    m_compiled.unbind();
+    return 0;
+  }
+  return m_compiled.bind(*graph);
 }
 
 // ============================================================================
@@ -433,6 +492,7 @@ void TimelinePlaybackEngine::jumpToMarker(const std::string &markerId) {
   auto it = m_markers.find(markerId);
   if (it != m_markers.end()) {
     m_currentTime = it->second;
+    evaluateLocked();
     notifyTimeChanged();
   }
 }
@@ -483,37 +543,13 @@ void TimelinePlaybackEngine::update(f64 deltaTime) {
     }
   }
 
+  evaluateLocked();
   notifyTimeChanged();
 }
 
 void TimelinePlaybackEngine::evaluate() {
   std::lock_guard<std::mutex> lock(m_mutex);
-
-  // Evaluate all tracks at current time
-  for (const auto &trackPair : m_tracks) {
-    const auto &track = trackPair.second;
-
-    // Skip disabled, muted tracks (unless solo is active elsewhere)
-    if (!track.enabled || track.muted) {
-      continue;
-    }
-
-    // Check for solo
-    bool hasSolo = false;
-    for (const auto &t : m_tracks) {
-      if (t.second.solo) {
-        hasSolo = true;
-        break;
-      }
-    }
-
-    if (hasSolo && !track.solo) {
-      continue;
-    }
-
-    // Track evaluation would happen here
-    // This would trigger keyframe interpolation and property updates
-  }
+  evaluateLocked();
 }
 
 // ============================================================================
@@ -569,6 +605,8 @@ void TimelinePlaybackEngine::restoreFromSnapshot(
   m_speed = snapshot.speed;
   m_loopMode = snapshot.loopMode;
   m_tracks = snapshot.trackStates;
+  refreshTrackActivation();
+  evaluateLocked();
 
   notifyStateChanged();
   notifyTimeChanged();
@@ -719,4 +757,186 @@ f64 TimelinePlaybackEngine::clampTime(f64 time) const {
   return std::max(0.0, std::min(m_duration, time));
 }
 
+void TimelinePlaybackEngine::evaluateLocked() {
+  if (m_hasCompiled) {
+    m_compiled.evaluate(m_currentTime);
+  }
+}
+
+void TimelinePlaybackEngine::refreshTrackActivation() {
+  // Solo state is resolved once here instead of on every evaluation
+  bool hasSolo = false;
+  for (const auto &pair : m_tracks) {
+    if (pair.second.solo) {
+      hasSolo = true;
+      break;
+    }
+  }
+
+  for (const auto &[trackId, index] : m_compiledTracks) {
+    auto it = m_tracks.find(trackId);
+    bool active = it != m_tracks.end() && it->second.enabled &&
+                  !it->second.muted && (!hasSolo || it->second.solo);
+    m_compiled.setTrackActive(index, active);
+  }
+}
+
+namespace {
+
+scene::TimelineInterpolation toCompiled(KeyframeInterpolation interpolation) {
+  switch (interpolation) {
+  case KeyframeInterpolation::Constant:
+    return scene::TimelineInterpolation::Constant;
+  case KeyframeInterpolation::Linear:
+    return scene::TimelineInterpolation::Linear;
+  case KeyframeInterpolation::EaseIn:
+    return scene::TimelineInterpolation::EaseIn;
+  case KeyframeInterpolation::EaseOut:
+    return scene::TimelineInterpolation::EaseOut;
+  case KeyframeInterpolation::EaseInOut:
+    return scene::TimelineInterpolation::EaseInOut;
+  case KeyframeInterpolation::Bezier:
+    return scene::TimelineInterpolation::Bezier;
+  case KeyframeInterpolation::Custom:
+    // Custom curve references are resolved by the curve library, not here
+    return scene::TimelineInterpolation::Linear;
+  }
+  return scene::TimelineInterpolation::Linear;
+}
+
+} // namespace
+
+void TimelinePlaybackEngine::collectTrack(const TimelineTrack &track,
+                                          scene::TimelineCompiler &compiler) {
+  const u32 index = compiler.addTrack();
+  m_compiledTracks[track.getId()] = index;
+  if (m_tracks.find(track.getId()) == m_tracks.end()) {
+    TrackPlaybackState state;
+    state.trackId = track.getId();
+    state.muted = track.isMuted();
+    state.solo = track.isSolo();
+    m_tracks[track.getId()] = state;
+  }
+
+  // Clips animating the same property share one channel, so one clip's keys
+  // cannot hold their value over another clip's time range
+  struct MergedChannel {
+    std::string targetId;
+    scene::AnimatableProperty property;
+    std::vector<std::vector<scene::TimelineKey>> clipKeys;
+  };
+  std::vector<MergedChannel> merged;
+
+  for (const auto &clip : track.getClips()) {
+    if (!clip || clip->isMuted()) {
+      continue;
+    }
+
+    std::string targetId = track.getTargetId();
+    if (targetId.empty()) {
+      if (const auto *character = dynamic_cast<const CharacterClip *>(clip.get())) {
+        targetId = character->getCharacterId();
+      }
+    }
+    if (targetId.empty()) {
+      continue;
+    }
+
+    // Keyframe times are clip-local; map them onto the global timeline
+    const f64 timeScale = clip->getTimeScale() > 0.0 ? clip->getTimeScale() : 1.0;
+    auto toGlobal = [&clip, timeScale](f64 localTime) {
+      return clip->getStartTime() + (localTime - clip->getClipIn()) / timeScale;
+    };
+
+    for (const auto &propertyTrack : clip->getPropertyTracks()) {
+      if (propertyTrack.muted || propertyTrack.keyframes.empty()) {
+        continue;
+      }
+
+      // Vec2 keyframes on "position"/"scale" and uniform "zoom" fan out to
+      // one channel per component
+      const std::string &name = propertyTrack.propertyName;
+      std::vector<scene::AnimatableProperty> properties;
+      if (auto property = scene::TimelineCompiler::parseProperty(name)) {
+        properties.push_back(*property);
+      } else if (name == "position") {
+        properties = {scene::AnimatableProperty::PositionX,
+                      scene::AnimatableProperty::PositionY};
+      } else if (name == "scale" || name == "zoom") {
+        properties = {scene::AnimatableProperty::ScaleX,
+                      scene::AnimatableProperty::ScaleY};
+      } else {
+        continue;
+      }
+
+      for (usize component = 0; component < properties.size(); ++component) {
+        std::vector<scene::TimelineKey> keys;
+        keys.reserve(propertyTrack.keyframes.size());
+
+        for (const auto &keyframe : propertyTrack.keyframes) {
+          f32 value = 0.0f;
+          if (const auto *scalar = std::get_if<f32>(&keyframe.value)) {
+            value = *scalar;
+          } else if (const auto *vec = std::get_if<renderer::Vec2>(&keyframe.value)) {
+            value = component == 0 ? vec->x : vec->y;
+          } else {
+            continue;
+          }
+
+          scene::TimelineKey key;
+          key.time = toGlobal(keyframe.time);
+          key.value = value;
+          key.interpolation = toCompiled(keyframe.interpolation);
+          key.inTangent = keyframe.inTangent * static_cast<f32>(timeScale);
+          key.outTangent = keyframe.outTangent * static_cast<f32>(timeScale);
+          key.inWeight = keyframe.inWeight;
+          key.outWeight = keyframe.outWeight;
+          keys.push_back(key);
+        }
+
+        if (keys.empty()) {
+          continue;
+        }
+        std::stable_sort(keys.begin(), keys.end(),
+                         [](const scene::TimelineKey &a, const scene::TimelineKey &b) {
+                           return a.time < b.time;
+                         });
+
+        auto channel = std::find_if(merged.begin(), merged.end(),
+                                    [&](const MergedChannel &candidate) {
+                                      return candidate.targetId == targetId &&
+                                             candidate.property == properties[component];
+                                    });
+        if (channel == merged.end()) {
+          merged.push_back({targetId, properties[component], {}});
+          channel = merged.end() - 1;
+        }
+        channel->clipKeys.push_back(std::move(keys));
+      }
+    }
+  }
+
+  for (auto &channel : merged) {
+    auto &clipKeys = channel.clipKeys;
+    std::stable_sort(clipKeys.begin(), clipKeys.end(),
+                     [](const auto &a, const auto &b) { return a.front().time < b.front().time; });
+
+    std::vector<scene::TimelineKey> keys;
+    for (usize i = 0; i < clipKeys.size(); ++i) {
+      if (i + 1 < clipKeys.size()) {
+        // Between clips the property holds the earlier clip's last value
+        clipKeys[i].back().interpolation = scene::TimelineInterpolation::Constant;
+      }
+      keys.insert(keys.end(), clipKeys[i].begin(), clipKeys[i].end());
+    }
+    compiler.addChannel(index, channel.targetId, channel.property, std::move(keys));
+  }
+
+  for (const auto &child : track.getChildTracks()) {
+    if (child) {
+      collectTrack(*child, compiler);
+    }
+  }
+}
+
 } // namespace NovelMind::editor
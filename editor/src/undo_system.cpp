@@ -0,0 +1,362 @@
+/**
+ * @file undo_system.cpp
+ * @brief UndoManager and CompositeCommand implementation
+ */
+
+#include "NovelMind/editor/undo_system.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace NovelMind::editor
+{
+
+namespace
+{
+
+// Saved state that can no longer be reached by undo/redo
+constexpr size_t UNREACHABLE_SAVE = std::numeric_limits<size_t>::max();
+
+} // namespace
+
+// ============================================================================
+// CompositeCommand
+// ============================================================================
+
+CompositeCommand::CompositeCommand(const std::string& description)
+    : m_description(description)
+{
+}
+
+void CompositeCommand::addCommand(std::unique_ptr<IEditorCommand> command)
+{
+    if (command)
+    {
+        m_commands.push_back(std::move(command));
+    }
+}
+
+void CompositeCommand::execute()
+{
+    for (auto& command : m_commands)
+    {
+        command->execute();
+    }
+}
+
+void CompositeCommand::undo()
+{
+    for (auto it = m_commands.rbegin(); it != m_commands.rend(); ++it)
+    {
+        (*it)->undo();
+    }
+}
+
+std::string CompositeCommand::getDescription() const
+{
+    return m_description;
+}
+
+// ============================================================================
+// UndoManager
+// ============================================================================
+
+UndoManager::UndoManager(size_t maxHistorySize)
+    : m_maxHistorySize(maxHistorySize)
+{
+}
+
+void UndoManager::executeCommand(std::unique_ptr<IEditorCommand> command)
+{
+    if (!command)
+    {
+        return;
+    }
+
+    command->execute();
+    const std::string description = command->getDescription();
+
+    if (m_transactionInProgress)
+    {
+        m_currentTransaction->addCommand(std::move(command));
+        return;
+    }
+
+    // A save point in the discarded redo history is lost
+    if (m_savedAtIndex > m_undoStack.size())
+    {
+        m_savedAtIndex = UNREACHABLE_SAVE;
+    }
+
+    if (!m_undoStack.empty() && m_undoStack.back()->canMergeWith(command.get()))
+    {
+        if (m_savedAtIndex == m_undoStack.size())
+        {
+            m_savedAtIndex = UNREACHABLE_SAVE;
+        }
+        m_undoStack.back()->mergeWith(command.get());
+    }
+    else
+    {
+        m_undoStack.push_back(std::move(command));
+    }
+    m_redoStack.clear();
+    trimHistory();
+
+    notifyCommandExecuted(description);
+    notifyListeners();
+}
+
+bool UndoManager::undo()
+{
+    if (m_undoStack.empty() || m_transactionInProgress)
+    {
+        return false;
+    }
+
+    auto command = std::move(m_undoStack.back());
+    m_undoStack.pop_back();
+    command->undo();
+    const std::string description = command->getDescription();
+    m_redoStack.push_back(std::move(command));
+
+    notifyUndoPerformed(description);
+    notifyListeners();
+    return true;
+}
+
+bool UndoManager::redo()
+{
+    if (m_redoStack.empty() || m_transactionInProgress)
+    {
+        return false;
+    }
+
+    auto command = std::move(m_redoStack.back());
+    m_redoStack.pop_back();
+    command->execute();
+    const std::string description = command->getDescription();
+    m_undoStack.push_back(std::move(command));
+
+    notifyRedoPerformed(description);
+    notifyListeners();
+    return true;
+}
+
+bool UndoManager::canUndo() const
+{
+    return !m_undoStack.empty() && !m_transactionInProgress;
+}
+
+bool UndoManager::canRedo() const
+{
+    return !m_redoStack.empty() && !m_transactionInProgress;
+}
+
+void UndoManager::clearHistory()
+{
+    m_savedAtIndex = hasUnsavedChanges() ? UNREACHABLE_SAVE : 0;
+    m_undoStack.clear();
+    m_redoStack.clear();
+    notifyListeners();
+}
+
+std::vector<std::string> UndoManager::getUndoHistory() const
+{
+    std::vector<std::string> history;
+    history.reserve(m_undoStack.size());
+    for (auto it = m_undoStack.rbegin(); it != m_undoStack.rend(); ++it)
+    {
+        history.push_back((*it)->getDescription());
+    }
+    return history;
+}
+
+std::vector<std::string> UndoManager::getRedoHistory() const
+{
+    std::vector<std::string> history;
+    history.reserve(m_redoStack.size());
+    for (auto it = m_redoStack.rbegin(); it != m_redoStack.rend(); ++it)
+    {
+        history.push_back((*it)->getDescription());
+    }
+    return history;
+}
+
+std::string UndoManager::getNextUndoDescription() const
+{
+    return m_undoStack.empty() ? std::string() : m_undoStack.back()->getDescription();
+}
+
+std::string UndoManager::getNextRedoDescription() const
+{
+    return m_redoStack.empty() ? std::string() : m_redoStack.back()->getDescription();
+}
+
+void UndoManager::beginTransaction(const std::string& description)
+{
+    if (m_transactionInProgress)
+    {
+        commitTransaction();
+    }
+    m_transactionInProgress = true;
+    m_currentTransaction = std::make_unique<CompositeCommand>(description);
+}
+
+void UndoManager::commitTransaction()
+{
+    if (!m_transactionInProgress)
+    {
+        return;
+    }
+    m_transactionInProgress = false;
+    auto transaction = std::move(m_currentTransaction);
+    if (transaction->isEmpty())
+    {
+        return;
+    }
+
+    // Already executed command by command; record without running again
+    const std::string description = transaction->getDescription();
+    if (m_savedAtIndex > m_undoStack.size())
+    {
+        m_savedAtIndex = UNREACHABLE_SAVE;
+    }
+    m_undoStack.push_back(std::move(transaction));
+    m_redoStack.clear();
+    trimHistory();
+
+    notifyCommandExecuted(description);
+    notifyListeners();
+}
+
+void UndoManager::rollbackTransaction()
+{
+    if (!m_transactionInProgress)
+    {
+        return;
+    }
+    m_transactionInProgress = false;
+    m_currentTransaction->undo();
+    m_currentTransaction.reset();
+}
+
+void UndoManager::setMaxHistorySize(size_t size)
+{
+    m_maxHistorySize = size;
+    trimHistory();
+}
+
+size_t UndoManager::getHistorySize() const
+{
+    return m_undoStack.size();
+}
+
+void UndoManager::markSaved()
+{
+    m_savedAtIndex = m_undoStack.size();
+}
+
+bool UndoManager::hasUnsavedChanges() const
+{
+    return m_savedAtIndex != m_undoStack.size();
+}
+
+void UndoManager::addListener(IUndoListener* listener)
+{
+    if (listener && std::find(m_listeners.begin(), m_listeners.end(), listener) == m_listeners.end())
+    {
+        m_listeners.push_back(listener);
+    }
+}
+
+void UndoManager::removeListener(IUndoListener* listener)
+{
+    m_listeners.erase(std::remove(m_listeners.begin(), m_listeners.end(), listener),
+                      m_listeners.end());
+}
+
+void UndoManager::notifyListeners()
+{
+    for (auto* listener : m_listeners)
+    {
+        listener->onUndoStackChanged(canUndo(), canRedo());
+    }
+}
+
+void UndoManager::notifyCommandExecuted(const std::string& description)
+{
+    for (auto* listener : m_listeners)
+    {
+        listener->onCommandExecuted(description);
+    }
+}
+
+void UndoManager::notifyUndoPerformed(const std::string& description)
+{
+    for (auto* listener : m_listeners)
+    {
+        listener->onUndoPerformed(description);
+    }
+}
+
+void UndoManager::notifyRedoPerformed(const std::string& description)
+{
+    for (auto* listener : m_listeners)
+    {
+        listener->onRedoPerformed(description);
+    }
+}
+
+void UndoManager::trimHistory()
+{
+    if (m_undoStack.size() <= m_maxHistorySize)
+    {
+        return;
+    }
+    const size_t excess = m_undoStack.size() - m_maxHistorySize;
+    m_undoStack.erase(m_undoStack.begin(), m_undoStack.begin() + static_cast<std::ptrdiff_t>(excess));
+    m_savedAtIndex = m_savedAtIndex >= excess && m_savedAtIndex != UNREACHABLE_SAVE
+                         ? m_savedAtIndex - excess
+                         : UNREACHABLE_SAVE;
+}
+
+// ============================================================================
+// UndoTransaction
+// ============================================================================
+
+UndoTransaction::UndoTransaction(UndoManager* manager, const std::string& description)
+    : m_manager(manager)
+{
+    if (m_manager)
+    {
+        m_manager->beginTransaction(description);
+    }
+}
+
+UndoTransaction::~UndoTransaction()
+{
+    if (!m_completed)
+    {
+        commit();
+    }
+}
+
+void UndoTransaction::commit()
+{
+    if (m_manager && !m_completed)
+    {
+        m_manager->commitTransaction();
+    }
+    m_completed = true;
+}
+
+void UndoTransaction::rollback()
+{
+    if (m_manager && !m_completed)
+    {
+        m_manager->rollbackTransaction();
+    }
+    m_completed = true;
+}
+
+} // namespace NovelMind::editor
@@ -29,6 +29,8 @@ namespace NovelMind::audio
 // Forward declarations
 class AudioSource;
 class AudioBuffer;
+class VoicePreloader;
+struct VoiceClipHead;
 
 /**
  * @brief Audio channel types for volume control
@@ -173,6 +175,10 @@ public:
     AudioChannel channel = AudioChannel::Sound;
     i32 priority = 0;
 
+    // Decoded start of a voice clip taken from the preloader. Sources only
+    // track state for now; no output backend reads samples from it yet.
+    std::shared_ptr<const VoiceClipHead> preloadedHead;
+
 private:
     PlaybackState m_state = PlaybackState::Stopped;
     f32 m_volume = 1.0f;
@@ -294,9 +300,16 @@ public:
 
     /**
      * @brief Play voice line (auto-ducks music)
+     *
+     * Attaches the preloader's decoded head to the source when it has one.
      */
     AudioHandle playVoice(const std::string& id, const VoiceConfig& config = {});
 
+    /**
+     * @brief Set the pool voice lines are started from; may be null
+     */
+    void setVoicePreloader(VoicePreloader* preloader);
+
     /**
      * @brief Stop voice playback
      */
@@ -460,6 +473,7 @@ private:
     // Voice state
     AudioHandle m_currentVoiceHandle;
     bool m_voicePlaying = false;
+    VoicePreloader* m_voicePreloader = nullptr;
 
     // Ducking state
     bool m_autoDuckingEnabled = true;
@@ -0,0 +1,233 @@
+#pragma once
+
+/**
+ * @file voice_preloader.hpp
+ * @brief Loads the start of upcoming voice lines before they are shown
+ *
+ * From the current instruction, the preloader walks the script's control
+ * flow ahead, following both sides of every branch and into scene jumps,
+ * and collects the next few SAY instructions on each path. The voice ids
+ * of those lines are handed to a worker thread that decodes the first
+ * fraction of a second of each clip into a small LRU pool, nearest lines
+ * first. AudioManager::playVoice() takes the decoded head from the pool and
+ * attaches it to the voice source for a backend to start from.
+ *
+ * By default a line's voice id is "<scene>_<speaker>_<NNN>", NNN counting
+ * the scene's spoken lines from 000; narration without a speaker is not
+ * voiced. This is only a line id: it matches the editor VoiceManager's ids
+ * when each script file holds one scene named after the file, and it is not
+ * a resource path. Loaders that open the id as a file, such as wavLoader(),
+ * need a resolver that maps lines to clip paths, e.g. bindingResolver() over
+ * the voice table exported by VoiceManager.
+ *
+ * Example:
+ * @code
+ * VoicePreloader preloader;
+ * preloader.setResolver(VoicePreloader::bindingResolver(voiceTable));
+ * preloader.setLoader(VoicePreloader::wavLoader(vfs));
+ * audioManager.setVoicePreloader(&preloader);
+ * runtime.setVoicePreloader(&preloader); // Plays and preloads on each SAY
+ * @endcode
+ */
+
+#include "NovelMind/core/types.hpp"
+#include "NovelMind/core/result.hpp"
+#include "NovelMind/scripting/compiler.hpp"
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace NovelMind::vfs
+{
+class IVirtualFileSystem;
+}
+
+namespace NovelMind::audio
+{
+
+/**
+ * @brief Decoded start of a voice clip
+ */
+struct VoiceClipHead
+{
+    std::string voiceId;
+    std::vector<i16> samples;   // Interleaved PCM
+    u32 sampleRate = 0;
+    u16 channels = 0;
+    f32 clipDuration = 0.0f;    // Whole clip in seconds, 0 if unknown
+
+    [[nodiscard]] f32 getDuration() const
+    {
+        return sampleRate && channels
+                   ? static_cast<f32>(samples.size() / channels) / static_cast<f32>(sampleRate)
+                   : 0.0f;
+    }
+};
+
+/**
+ * @brief A SAY instruction as seen by the voice id resolver
+ */
+struct VoiceLineRef
+{
+    std::string_view scene;
+    std::string_view speaker;   // Empty for narration
+    std::string_view text;
+    u32 sceneLineIndex;         // Spoken lines before this one in the scene
+    u32 ip;
+};
+
+using VoiceIdResolver = std::function<std::string(const VoiceLineRef& line)>;
+
+/**
+ * @brief Decodes at least the first @p seconds of a voice clip
+ *
+ * Called on the preloader's worker thread.
+ */
+using VoiceHeadLoader =
+    std::function<Result<VoiceClipHead>(const std::string& voiceId, f32 seconds)>;
+
+struct VoicePreloadConfig
+{
+    u32 lookahead = 3;              // SAY instructions ahead on each path
+    usize poolSize = 8;             // Decoded heads kept
+    f32 headSeconds = 0.3f;         // Audio decoded per clip
+    u32 maxScanInstructions = 4096; // Bound on the control-flow walk
+};
+
+class VoicePreloader
+{
+public:
+    VoicePreloader();
+    ~VoicePreloader();
+
+    VoicePreloader(const VoicePreloader&) = delete;
+    VoicePreloader& operator=(const VoicePreloader&) = delete;
+
+    void setConfig(const VoicePreloadConfig& config);
+    [[nodiscard]] const VoicePreloadConfig& getConfig() const { return m_config; }
+
+    void setLoader(VoiceHeadLoader loader);
+
+    /**
+     * @brief Replace the voice id rule; takes effect on the next setScript()
+     */
+    void setResolver(VoiceIdResolver resolver);
+
+    /**
+     * @brief Line id "<scene>_<speaker>_<NNN>", empty for narration
+     */
+    [[nodiscard]] static std::string defaultVoiceId(const VoiceLineRef& line);
+
+    /**
+     * @brief Resolver mapping line ids to bound clip paths
+     *
+     * @param bindings Clip path by line id; lines without a binding are not voiced
+     * @param lineId Rule producing the line ids used as keys
+     */
+    [[nodiscard]] static VoiceIdResolver
+    bindingResolver(std::unordered_map<std::string, std::string> bindings,
+                    VoiceIdResolver lineId = &VoicePreloader::defaultVoiceId);
+
+    /**
+     * @brief Loader decoding PCM WAV resources from a file system
+     *
+     * The voice id is opened as the resource path, so pair it with a
+     * resolver returning paths. The file system must outlive the
+     * preloader and be safe to read from its worker thread.
+     */
+    [[nodiscard]] static VoiceHeadLoader wavLoader(const vfs::IVirtualFileSystem& fileSystem);
+
+    /**
+     * @brief Decode the first @p seconds of a PCM WAV file to 16-bit samples
+     *
+     * Accepts 8, 16, 24 and 32-bit integer and 32-bit float PCM.
+     */
+    [[nodiscard]] static Result<VoiceClipHead> decodeWavHead(const u8* data, usize size,
+                                                             f32 seconds);
+
+    /**
+     * @brief Resolve the voice id of every line in a script; clears the pool
+     */
+    void setScript(const scripting::CompiledScript& script);
+
+    /**
+     * @brief Voice id of the SAY at @p ip, empty if it is not voiced
+     */
+    [[nodiscard]] const std::string& getVoiceId(u32 ip) const;
+
+    /**
+     * @brief SAY instructions reachable from @p ip, nearest first
+     *
+     * Each path stops after `lookahead` lines, at HALT or RETURN, or when
+     * the walk has visited maxScanInstructions instructions.
+     */
+    [[nodiscard]] std::vector<u32> findUpcomingLines(u32 ip) const;
+
+    /**
+     * @brief Queue the voices reachable from @p ip for loading
+     *
+     * Replaces loads queued by earlier calls that have not started.
+     */
+    void preloadFrom(u32 ip);
+
+    /**
+     * @brief Take a decoded head from the pool
+     * @return nullptr if the clip is not loaded (yet)
+     */
+    [[nodiscard]] std::shared_ptr<const VoiceClipHead> acquire(const std::string& voiceId);
+
+    [[nodiscard]] bool isLoaded(const std::string& voiceId) const;
+    [[nodiscard]] bool hasPending() const;
+    void waitForAll();
+
+    /**
+     * @brief Drop queued loads and the pool
+     */
+    void clear();
+
+    /**
+     * @brief Stop the worker; loads resume on the next preloadFrom()
+     */
+    void shutdown();
+
+    [[nodiscard]] u64 getHitCount() const;
+    [[nodiscard]] u64 getMissCount() const;
+
+private:
+    using PoolList = std::list<std::shared_ptr<const VoiceClipHead>>;
+
+    void workerLoop();
+    void insertLocked(std::shared_ptr<const VoiceClipHead> head);
+
+    VoicePreloadConfig m_config;
+    VoiceIdResolver m_resolver;
+    VoiceHeadLoader m_loader;
+
+    std::vector<scripting::Instruction> m_program;
+    std::vector<std::string> m_voiceIds; // Per instruction, empty unless a voiced SAY
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_work;
+    std::condition_variable m_idle;
+    std::deque<std::string> m_queue;
+    std::unordered_set<std::string> m_loading;  // Queued or running
+    std::unordered_set<std::string> m_failed;   // Not retried until setScript()/clear()
+    PoolList m_pool;                            // Most recently used first
+    std::unordered_map<std::string, PoolList::iterator> m_poolIndex;
+    u64 m_generation = 0;                       // Bumped by clear() to drop running loads
+    u64 m_hits = 0;
+    u64 m_misses = 0;
+    std::thread m_worker;
+    bool m_stopWorker = false;
+};
+
+} // namespace NovelMind::audio
@@ -16,6 +16,7 @@
 #include "NovelMind/core/result.hpp"
 #include "NovelMind/scene/animation.hpp"
 #include "NovelMind/renderer/renderer.hpp"
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <memory>
@@ -163,6 +164,18 @@ public:
     void setZoom(f32 zoom);
     [[nodiscard]] f32 getZoom() const { return m_zoom; }
 
+    /**
+     * @brief Largest zoom of the current shot: the target of a zoom-in
+     *        transition, otherwise the current zoom
+     *
+     * Used to load images at the resolution the shot will need before the
+     * zoom reaches it.
+     */
+    [[nodiscard]] f32 getShotZoom() const
+    {
+        return m_isTransitioning ? std::max(m_zoom, m_targetZoom) : m_zoom;
+    }
+
     void zoomTo(f32 zoom, f32 duration, scene::EasingType easing = scene::EasingType::EaseInOut);
     void zoomAt(f32 zoom, f32 x, f32 y, f32 duration, scene::EasingType easing = scene::EasingType::EaseInOut);
 
@@ -2,15 +2,29 @@
 
 #include "NovelMind/core/types.hpp"
 #include "NovelMind/core/result.hpp"
+#include "NovelMind/renderer/sdf_font.hpp"
+#include "NovelMind/renderer/texture.hpp"
+#include <functional>
+#include <memory>
 #include <vector>
 #include <string>
 
 namespace NovelMind::renderer
 {
 
+/**
+ * @brief A font face for layout and rendering
+ *
+ * Fonts imported as SDF atlases (see sdf_font.hpp) load their metrics
+ * tables up front; atlas pages are fetched through the page loader the
+ * first time a glyph on them is drawn. One loaded font serves every text
+ * size, so @p size passed to loadFromMemory() is only the default size.
+ */
 class Font
 {
 public:
+    using PageLoader = std::function<Result<std::vector<u8>>(u32 page)>;
+
     Font();
     ~Font();
 
@@ -26,9 +40,47 @@ public:
     [[nodiscard]] i32 getSize() const;
     [[nodiscard]] void* getNativeHandle() const;
 
+    /**
+     * @brief Whether glyph metrics are available (SDF fonts)
+     */
+    [[nodiscard]] bool hasMetrics() const;
+    [[nodiscard]] const SdfFontMetrics& getMetrics() const;
+
+    /**
+     * @brief Glyph for a codepoint, falling back to '?' when missing
+     */
+    [[nodiscard]] const SdfGlyph* findGlyph(u32 codepoint) const;
+
+    [[nodiscard]] f32 getAdvance(u32 codepoint, f32 size) const;
+    [[nodiscard]] f32 getKerning(u32 left, u32 right, f32 size) const;
+    [[nodiscard]] f32 getAscender(f32 size) const;
+    [[nodiscard]] f32 getDescender(f32 size) const;
+    [[nodiscard]] f32 getLineHeight(f32 size) const;
+
+    /**
+     * @brief Set how atlas pages are fetched, usually from the VFS with
+     *        SdfFontFormat::pageResourceId()
+     */
+    void setPageLoader(PageLoader loader);
+
+    /**
+     * @brief Atlas page texture, loading it on first use
+     * @return nullptr if the page cannot be loaded
+     */
+    [[nodiscard]] const Texture* getPage(u32 page);
+    [[nodiscard]] bool isPageLoaded(u32 page) const;
+
+    /**
+     * @brief Drop loaded pages; they are fetched again when next needed
+     */
+    void releasePages();
+
 private:
     void* m_handle;
     i32 m_size;
+    SdfFontMetrics m_metrics;
+    PageLoader m_pageLoader;
+    std::vector<std::unique_ptr<Texture>> m_pages;
 };
 
 } // namespace NovelMind::renderer
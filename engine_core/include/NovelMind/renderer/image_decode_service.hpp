@@ -0,0 +1,117 @@
+#pragma once
+
+/**
+ * @file image_decode_service.hpp
+ * @brief Background image decoding for textures
+ *
+ * Decoding and post-processing run on a small pool of worker threads; the
+ * finished images are handed back on the owner thread from
+ * processCompleted(), which is where uploads to the GPU happen.
+ *
+ * Example:
+ * @code
+ * ImageDecodeService decoder;
+ * decoder.submit(std::move(pngBytes), {}, [&](Result<DecodedImage> image) {
+ *     if (image.isOk())
+ *     {
+ *         ImageDecodeService::upload(image.value(), texture);
+ *     }
+ * });
+ * // Once per frame
+ * decoder.processCompleted();
+ * @endcode
+ */
+
+#include "NovelMind/core/types.hpp"
+#include "NovelMind/core/result.hpp"
+#include "NovelMind/renderer/image_decoder.hpp"
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace NovelMind::renderer
+{
+
+class Texture;
+
+using ImageDecodeCallback = std::function<void(Result<DecodedImage>)>;
+
+class ImageDecodeService
+{
+public:
+    ImageDecodeService() = default;
+    ~ImageDecodeService();
+
+    ImageDecodeService(const ImageDecodeService&) = delete;
+    ImageDecodeService& operator=(const ImageDecodeService&) = delete;
+
+    /**
+     * @brief Queue an encoded image for decoding on a worker thread
+     * @return Ticket identifying the request
+     */
+    u64 submit(std::vector<u8> encoded, const ImageDecodeOptions& options,
+               ImageDecodeCallback callback);
+
+    /**
+     * @brief Invoke callbacks for finished decodes on the calling thread
+     * @param maxCount Maximum number of callbacks to run, 0 for all
+     * @return Number of callbacks run
+     */
+    usize processCompleted(usize maxCount = 0);
+
+    /**
+     * @brief Whether decodes are queued, running or waiting for processCompleted()
+     */
+    [[nodiscard]] bool hasPending() const;
+
+    /**
+     * @brief Block until every queued decode has finished (callbacks still
+     *        run from processCompleted())
+     */
+    void waitForAll();
+
+    /**
+     * @brief Stop the workers, dropping queued and unprocessed decodes
+     */
+    void shutdown();
+
+    /**
+     * @brief Upload a decoded RGBA image to a texture
+     */
+    static Result<void> upload(const DecodedImage& image, Texture& texture);
+
+private:
+    static constexpr u32 MAX_WORKERS = 4;
+
+    struct Job
+    {
+        u64 ticket;
+        std::vector<u8> encoded;
+        ImageDecodeOptions options;
+        ImageDecodeCallback callback;
+    };
+
+    struct Completed
+    {
+        u64 ticket;
+        Result<DecodedImage> result;
+        ImageDecodeCallback callback;
+    };
+
+    void workerLoop();
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_work;
+    std::condition_variable m_idle;
+    std::deque<Job> m_jobs;
+    std::deque<Completed> m_completed;
+    usize m_inFlight = 0; // Queued or running jobs
+    std::vector<std::thread> m_workers;
+    bool m_stopWorkers = false;
+    u64 m_nextTicket = 1;
+};
+
+} // namespace NovelMind::renderer
@@ -0,0 +1,82 @@
+#pragma once
+
+/**
+ * @file image_decoder.hpp
+ * @brief PNG and QOI decoding to RGBA8
+ *
+ * PNG support covers the non-interlaced images asset pipelines produce:
+ * grayscale, RGB, palette, gray+alpha and RGBA at 8 or 16 bits, palette and
+ * grayscale also at 1, 2 and 4 bits, with tRNS transparency. Adam7
+ * interlaced files are rejected. QOI is supported in full.
+ *
+ * Post-processing runs through ImageKernels on the decoded buffer, on the
+ * decoding thread: sRGB to linear first (on straight color), then
+ * premultiplication, then downscaling (so filtering sees premultiplied
+ * color and does not bleed transparent pixels), then channel order.
+ */
+
+#include "NovelMind/core/types.hpp"
+#include "NovelMind/core/result.hpp"
+#include <vector>
+
+namespace NovelMind::renderer
+{
+
+enum class ImageFormat : u8
+{
+    Unknown,
+    PNG,
+    QOI
+};
+
+enum class PixelOrder : u8
+{
+    RGBA,
+    BGRA
+};
+
+struct ImageDecodeOptions
+{
+    bool premultiplyAlpha = true;
+    bool convertToLinear = false;   // sRGB -> linear color channels
+    PixelOrder pixelOrder = PixelOrder::RGBA;
+
+    // Halve the image until it fits; 0 means no limit
+    u32 maxWidth = 0;
+    u32 maxHeight = 0;
+};
+
+struct DecodedImage
+{
+    std::vector<u8> pixels;   // Tightly packed, 4 bytes per pixel
+    u32 width = 0;
+    u32 height = 0;
+    bool premultiplied = false;
+    bool linear = false;
+    PixelOrder pixelOrder = PixelOrder::RGBA;
+};
+
+class ImageDecoder
+{
+public:
+    [[nodiscard]] static ImageFormat detectFormat(const u8* data, usize size);
+
+    /**
+     * @brief Decode and post-process an image of any supported format
+     */
+    [[nodiscard]] static Result<DecodedImage> decode(const u8* data, usize size,
+                                                     const ImageDecodeOptions& options = {});
+
+    /**
+     * @brief Decode to straight RGBA8 without post-processing
+     */
+    [[nodiscard]] static Result<DecodedImage> decodePNG(const u8* data, usize size);
+    [[nodiscard]] static Result<DecodedImage> decodeQOI(const u8* data, usize size);
+
+    /**
+     * @brief Apply the post-processing steps of @p options to a decoded image
+     */
+    static void process(DecodedImage& image, const ImageDecodeOptions& options);
+};
+
+} // namespace NovelMind::renderer
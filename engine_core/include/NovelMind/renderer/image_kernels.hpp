@@ -0,0 +1,60 @@
+#pragma once
+
+/**
+ * @file image_kernels.hpp
+ * @brief Per-pixel RGBA8 kernels used by image decoding and texture baking
+ *
+ * Kernels run with AVX2, SSE2 or NEON when the build enables them and fall
+ * back to scalar code otherwise; every path produces bit-identical output.
+ * Premultiplication rounds to nearest, i.e. c' = round(c * a / 255).
+ */
+
+#include "NovelMind/core/types.hpp"
+
+namespace NovelMind::renderer
+{
+
+class ImageKernels
+{
+public:
+    /**
+     * @brief Multiply color channels by alpha in place
+     */
+    static void premultiplyAlpha(u8* rgba, usize pixelCount);
+
+    /**
+     * @brief Swap the red and blue channels in place (RGBA <-> BGRA)
+     */
+    static void swapRedBlue(u8* rgba, usize pixelCount);
+
+    /**
+     * @brief Convert sRGB-encoded color channels to linear in place; alpha is kept
+     */
+    static void srgbToLinear(u8* rgba, usize pixelCount);
+
+    /**
+     * @brief Halve an image with a 2x2 box filter
+     *
+     * The destination is max(1, width / 2) x max(1, height / 2) and tightly
+     * packed. As in a mip chain, a trailing odd row or column is dropped and
+     * a dimension of 1 is clamped rather than halved.
+     */
+    static void downsampleHalf(const u8* src, u32 width, u32 height, u32 srcStride, u8* dst);
+
+    /**
+     * @brief Halve an image with a separable 4-tap [1 3 3 1] tent filter
+     *
+     * Same output size as downsampleHalf, but each output pixel also draws
+     * on the neighbouring source rows and columns (edges are clamped), which
+     * suppresses the aliasing a box filter leaves on fine detail. Used for
+     * display-size variants; mip chains keep the cheaper box filter.
+     */
+    static void resampleHalf(const u8* src, u32 width, u32 height, u32 srcStride, u8* dst);
+
+    /**
+     * @brief Name of the instruction set the kernels were built for
+     */
+    [[nodiscard]] static const char* getInstructionSet();
+};
+
+} // namespace NovelMind::renderer
@@ -0,0 +1,114 @@
+#pragma once
+
+/**
+ * @file raw_texture.hpp
+ * @brief Pre-decoded texture payloads that upload without image decoding
+ *
+ * A raw texture is a RawTextureHeader followed by the pixel payload, stored
+ * either as-is or as a single LZ4 block. The payload holds RGBA8 levels back
+ * to back: level 0 with rows `stride` bytes apart, then each smaller mip
+ * level tightly packed. Stored payloads can be uploaded straight from a
+ * pack mapping; LZ4 payloads cost one fast decompression into a reusable
+ * buffer. Either way no PNG/JPEG decode happens at load time.
+ *
+ * Layout (little-endian):
+ *   RawTextureHeader (40 bytes), payload (payloadSize bytes)
+ */
+
+#include "NovelMind/core/types.hpp"
+#include "NovelMind/core/result.hpp"
+#include <vector>
+
+namespace NovelMind::renderer
+{
+
+constexpr u32 RAW_TEXTURE_MAGIC = 0x58544D4E; // "NMTX" in little-endian
+constexpr u16 RAW_TEXTURE_VERSION = 1;
+
+enum class RawTextureEncoding : u8
+{
+    Stored = 0,
+    LZ4 = 1
+};
+
+enum RawTextureFlags : u8
+{
+    RawTexturePremultiplied = 1 << 0
+};
+
+struct RawTextureHeader
+{
+    u32 magic;
+    u16 version;
+    u8 encoding;      // RawTextureEncoding
+    u8 flags;         // RawTextureFlags
+    u32 width;
+    u32 height;
+    u32 stride;       // Bytes between level-0 rows, >= width * 4
+    u32 mipCount;     // Levels in the payload, at least 1
+    u64 rawSize;      // Decompressed payload size
+    u64 payloadSize;  // Stored payload size
+};
+static_assert(sizeof(RawTextureHeader) == 40, "RawTextureHeader layout is part of the pack format");
+
+struct RawTextureOptions
+{
+    bool premultiplyAlpha = true;     // Premultiply while encoding
+    bool sourcePremultiplied = false; // Input is already premultiplied; only flag it
+    bool compress = true;             // LZ4 the payload; kept stored if it does not shrink
+    bool generateMipmaps = false;     // Box-filtered chain down to 1x1
+    u32 rowAlignment = 4;             // Level-0 stride alignment, a power of two
+};
+
+/**
+ * @brief A decoded raw texture; pixel pointers may alias the source buffer
+ */
+struct RawTextureView
+{
+    RawTextureHeader header{};
+    const u8* pixels = nullptr;   // Level 0, then the mip chain
+
+    [[nodiscard]] bool isPremultiplied() const
+    {
+        return (header.flags & RawTexturePremultiplied) != 0;
+    }
+};
+
+class RawTexture
+{
+public:
+    /**
+     * @brief Whether a buffer starts with a raw texture header
+     */
+    [[nodiscard]] static bool isRawTexture(const u8* data, usize size);
+
+    /**
+     * @brief Encode straight (non-premultiplied) RGBA8 pixels
+     * @param stride Bytes between source rows; 0 means width * 4
+     */
+    [[nodiscard]] static Result<std::vector<u8>> encode(const u8* rgba, u32 width, u32 height,
+                                                        u32 stride = 0,
+                                                        const RawTextureOptions& options = {});
+
+    /**
+     * @brief Validate and read the header
+     */
+    [[nodiscard]] static Result<RawTextureHeader> readHeader(const u8* data, usize size);
+
+    /**
+     * @brief Decode a payload
+     *
+     * Stored payloads are returned in place, pointing into @p data, so the
+     * caller can upload directly from a pack mapping. LZ4 payloads are
+     * decompressed into @p scratch, which is reused between calls.
+     */
+    [[nodiscard]] static Result<RawTextureView> decode(const u8* data, usize size,
+                                                       std::vector<u8>& scratch);
+
+    /**
+     * @brief Size of the whole payload for a texture and mip count
+     */
+    [[nodiscard]] static u64 payloadSizeFor(u32 width, u32 height, u32 stride, u32 mipCount);
+};
+
+} // namespace NovelMind::renderer
@@ -5,8 +5,10 @@
 #include "NovelMind/renderer/color.hpp"
 #include "NovelMind/renderer/transform.hpp"
 #include "NovelMind/renderer/texture.hpp"
+#include "NovelMind/renderer/sdf_font.hpp"
 #include "NovelMind/platform/window.hpp"
 #include <memory>
+#include <vector>
 
 namespace NovelMind::renderer
 {
@@ -50,6 +52,59 @@ public:
     virtual void drawRect(const Rect& rect, const Color& color) = 0;
     virtual void fillRect(const Rect& rect, const Color& color) = 0;
 
+    /**
+     * @brief Fill many rectangles in one submission
+     *
+     * Backends should upload all quads as a single batch; the default
+     * falls back to one fillRect() per quad.
+     */
+    virtual void fillRects(const Rect* rects, const Color* colors, usize count)
+    {
+        for (usize i = 0; i < count; ++i)
+        {
+            fillRect(rects[i], colors[i]);
+        }
+    }
+
+    /**
+     * @brief Draw glyph quads that use one SDF font atlas page
+     *
+     * Quads are placed through @p transform, whose scale is the zoom.
+     * Backends evaluate the field in their text shader (see SdfShading),
+     * scaling each quad's pxRange by the zoom, and draw shadows before
+     * fills. The default draws the page texels as plain sprites.
+     */
+    virtual void drawSdfGlyphs(const Texture& page, const SdfGlyphQuad* quads, usize count,
+                               const Transform2D& transform)
+    {
+        for (usize i = 0; i < count; ++i)
+        {
+            const SdfGlyphQuad& quad = quads[i];
+            if (quad.atlas.width <= 0.0f || quad.atlas.height <= 0.0f)
+            {
+                continue;
+            }
+            Transform2D glyph;
+            glyph.x = transform.x + quad.screen.x * transform.scaleX;
+            glyph.y = transform.y + quad.screen.y * transform.scaleY;
+            glyph.scaleX = quad.screen.width / quad.atlas.width * transform.scaleX;
+            glyph.scaleY = quad.screen.height / quad.atlas.height * transform.scaleY;
+            drawSprite(page, quad.atlas, glyph, quad.color);
+        }
+    }
+
+    /**
+     * @brief Copy the last presented frame as tightly packed RGBA8, top row first
+     *
+     * Used for save thumbnails. Backends should serve this from a readback
+     * of the frame finished by endFrame() rather than stalling on the one in
+     * flight. The default reports that capture is unsupported.
+     */
+    virtual Result<void> captureFrame(std::vector<u8>& /*rgba*/, u32& /*width*/, u32& /*height*/)
+    {
+        return Result<void>::error("Frame capture is not supported by this renderer");
+    }
+
     // Screen effects
     virtual void setFade(f32 alpha, const Color& color = Color::Black) = 0;
 
@@ -0,0 +1,180 @@
+#pragma once
+
+/**
+ * @file sdf_font.hpp
+ * @brief Signed distance field font atlases and their metrics tables
+ *
+ * A font is imported once at build time into a metrics file and a set of
+ * atlas pages. Each page is a raw texture (see raw_texture.hpp) holding
+ * multi-channel signed distance fields: RGB carry the multi-channel field,
+ * whose median keeps glyph corners sharp at any magnification, and alpha
+ * carries the true distance, used for outlines and soft shadows. One atlas
+ * therefore serves every text size and zoom level.
+ *
+ * Glyphs are packed in codepoint order, so a page covers a contiguous
+ * range of the font (Latin on the first page, kana and kanji after) and
+ * pages can be streamed in as text needs them.
+ *
+ * Metrics file layout (little-endian):
+ *   SdfFontHeader (48 bytes)
+ *   SdfGlyph[glyphCount] (36 bytes each, sorted by codepoint)
+ *   SdfKerningPair[kerningCount] (12 bytes each, sorted by left, right)
+ *
+ * Page N of font resource "fonts/ui.ttf" is stored as "fonts/ui.ttf.page<N>".
+ */
+
+#include "NovelMind/core/types.hpp"
+#include "NovelMind/core/result.hpp"
+#include "NovelMind/renderer/color.hpp"
+#include "NovelMind/renderer/transform.hpp"
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace NovelMind::renderer
+{
+
+constexpr u32 SDF_FONT_MAGIC = 0x46534D4E; // "NMSF" in little-endian
+constexpr u16 SDF_FONT_VERSION = 1;
+constexpr u32 SDF_FONT_MAX_PAGES = 256; // Far beyond any real font; bounds what a file can ask for
+
+struct SdfFontHeader
+{
+    u32 magic;
+    u16 version;
+    u16 reserved;
+    f32 emSize;          // Atlas texels per em
+    f32 distanceRange;   // Atlas texels spanned by field values 0..1
+    f32 ascender;        // Em units, positive up
+    f32 descender;       // Em units, negative below the baseline
+    f32 lineGap;         // Em units
+    u32 pageWidth;       // Largest page size; pages may be shorter
+    u32 pageHeight;
+    u32 pageCount;
+    u32 glyphCount;
+    u32 kerningCount;
+};
+static_assert(sizeof(SdfFontHeader) == 48, "SdfFontHeader layout is part of the font format");
+
+/**
+ * @brief Metrics and atlas placement of one glyph
+ *
+ * Plane bounds are the quad to draw, in em units relative to the pen
+ * position on the baseline (y up); they include the field padding.
+ * Glyphs without an outline (space) have an empty atlas rectangle.
+ */
+struct SdfGlyph
+{
+    u32 codepoint;
+    u32 page;
+    u16 atlasX;
+    u16 atlasY;
+    u16 atlasWidth;
+    u16 atlasHeight;
+    f32 advance;
+    f32 planeLeft;
+    f32 planeBottom;
+    f32 planeRight;
+    f32 planeTop;
+};
+static_assert(sizeof(SdfGlyph) == 36, "SdfGlyph layout is part of the font format");
+
+struct SdfKerningPair
+{
+    u32 left;
+    u32 right;
+    f32 adjust;   // Em units added to the left glyph's advance
+};
+static_assert(sizeof(SdfKerningPair) == 12, "SdfKerningPair layout is part of the font format");
+
+struct SdfFontMetrics
+{
+    f32 emSize = 0.0f;
+    f32 distanceRange = 0.0f;
+    f32 ascender = 0.0f;
+    f32 descender = 0.0f;
+    f32 lineGap = 0.0f;
+    u32 pageWidth = 0;
+    u32 pageHeight = 0;
+    u32 pageCount = 0;
+    std::vector<SdfGlyph> glyphs;            // Sorted by codepoint
+    std::vector<SdfKerningPair> kerning;     // Sorted by (left, right)
+
+    [[nodiscard]] const SdfGlyph* findGlyph(u32 codepoint) const;
+    [[nodiscard]] f32 getKerning(u32 left, u32 right) const;
+
+    [[nodiscard]] f32 getLineHeight() const
+    {
+        return ascender - descender + lineGap;
+    }
+};
+
+class SdfFontFormat
+{
+public:
+    /**
+     * @brief Whether a buffer starts with an SDF font header
+     */
+    [[nodiscard]] static bool isSdfFont(const u8* data, usize size);
+
+    [[nodiscard]] static Result<std::vector<u8>> encode(const SdfFontMetrics& metrics);
+    [[nodiscard]] static Result<SdfFontMetrics> decode(const u8* data, usize size);
+
+    /**
+     * @brief Resource id of an atlas page of @p fontId
+     */
+    [[nodiscard]] static std::string pageResourceId(std::string_view fontId, u32 page);
+};
+
+/**
+ * @brief One glyph to draw from an atlas page
+ *
+ * Screen coordinates are layout pixels with y down. The effect fields come
+ * from the segment's TextStyle; outlines and shadows are evaluated from the
+ * same field texels, so they need no extra glyph rasterization.
+ */
+struct SdfGlyphQuad
+{
+    Rect screen;
+    Rect atlas;               // Page texels
+    u32 page = 0;
+    u32 charIndex = 0;        // Position in the layout's character stream
+    f32 pxRange = 1.0f;       // Screen pixels spanned by the distance range at zoom 1
+    Color color;
+    Color outlineColor;
+    f32 outlineWidth = 0.0f;  // Screen pixels at zoom 1
+    Color shadowColor;
+    f32 shadowOffsetX = 0.0f;
+    f32 shadowOffsetY = 0.0f;
+};
+
+/**
+ * @brief Reference evaluation of the SDF text shader
+ *
+ * Backends implement the same math in their text shader:
+ * @code
+ * vec4 s = texture(page, uv);
+ * float range = pxRange * zoom;
+ * float fill = clamp((median(s.r, s.g, s.b) - 0.5) * range + 0.5, 0.0, 1.0);
+ * float outline = clamp((s.a - 0.5) * range + outlineWidth * zoom + 0.5, 0.0, 1.0);
+ * // Shadow: the outline term sampled at uv - shadowOffset, drawn first
+ * @endcode
+ */
+class SdfShading
+{
+public:
+    [[nodiscard]] static f32 median(f32 a, f32 b, f32 c);
+
+    /**
+     * @brief Coverage of the glyph body at an RGBA8 field texel
+     */
+    [[nodiscard]] static f32 fillCoverage(const u8* texel, f32 screenPxRange);
+
+    /**
+     * @brief Coverage of the glyph grown by @p outlineWidth screen pixels
+     */
+    [[nodiscard]] static f32 outlineCoverage(const u8* texel, f32 screenPxRange,
+                                             f32 outlineWidth);
+};
+
+} // namespace NovelMind::renderer
@@ -0,0 +1,57 @@
+#pragma once
+
+/**
+ * @file sdf_font_builder.hpp
+ * @brief Build-time generation of SDF font atlases from TrueType fonts
+ *
+ * Reads glyph outlines straight from the font's glyf table (simple and
+ * composite glyphs), cmap formats 4 and 12, hmtx metrics and kern format 0
+ * pairs. CFF-flavoured OpenType, collections and WOFF containers are not
+ * supported; GPOS kerning is ignored.
+ *
+ * Each glyph gets a multi-channel field computed analytically from its
+ * outline with colored edges, so the median of RGB reproduces sharp
+ * corners; alpha holds the true signed distance. Texels whose channel
+ * median disagrees with the outline's winding are replaced by the true
+ * distance, which removes artifacts from overlapping contours. Glyphs are
+ * generated on worker threads.
+ */
+
+#include "NovelMind/core/types.hpp"
+#include "NovelMind/core/result.hpp"
+#include "NovelMind/renderer/sdf_font.hpp"
+#include <vector>
+
+namespace NovelMind::renderer
+{
+
+struct SdfFontBuildOptions
+{
+    f32 emSize = 48.0f;          // Atlas texels per em
+    f32 distanceRange = 8.0f;    // Texels; half of it bounds outline width at emSize
+    u32 pageSize = 1024;         // Page width and maximum height
+    u32 glyphSpacing = 1;        // Empty texels between packed glyphs
+    std::vector<u32> codepoints; // Codepoints to include; empty for every mapped one
+    u32 threadCount = 0;         // 0 uses the hardware concurrency
+};
+
+struct SdfFontBuild
+{
+    SdfFontMetrics metrics;
+    std::vector<std::vector<u8>> pages; // Straight RGBA8, tightly packed
+    std::vector<u32> pageHeights;       // Pages are metrics.pageWidth wide
+};
+
+class SdfFontBuilder
+{
+public:
+    /**
+     * @brief Whether a buffer looks like a TrueType (glyf) font
+     */
+    [[nodiscard]] static bool isTrueType(const u8* data, usize size);
+
+    [[nodiscard]] static Result<SdfFontBuild> build(const u8* fontData, usize size,
+                                                    const SdfFontBuildOptions& options = {});
+};
+
+} // namespace NovelMind::renderer
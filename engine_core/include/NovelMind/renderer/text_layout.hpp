@@ -16,6 +16,7 @@
 #include "NovelMind/core/types.hpp"
 #include "NovelMind/renderer/color.hpp"
 #include "NovelMind/renderer/font.hpp"
+#include "NovelMind/renderer/sdf_font.hpp"
 #include <string>
 #include <vector>
 #include <variant>
@@ -49,6 +50,9 @@ struct TextStyle
     f32 size = 16.0f;
     f32 outlineWidth = 0.0f;
     Color outlineColor = Color::black();
+    Color shadowColor = Color::transparent(); // No shadow while fully transparent
+    f32 shadowOffsetX = 0.0f;
+    f32 shadowOffsetY = 0.0f;
 
     bool operator==(const TextStyle& other) const
     {
@@ -57,7 +61,10 @@ struct TextStyle
                italic == other.italic &&
                size == other.size &&
                outlineWidth == other.outlineWidth &&
-               outlineColor == other.outlineColor;
+               outlineColor == other.outlineColor &&
+               shadowColor == other.shadowColor &&
+               shadowOffsetX == other.shadowOffsetX &&
+               shadowOffsetY == other.shadowOffsetY;
     }
 };
 
@@ -133,7 +140,7 @@ struct TextLine
     std::vector<TextSegment> segments;
     f32 width = 0.0f;
     f32 height = 0.0f;
-    f32 baseline = 0.0f;
+    f32 baseline = 0.0f; // Distance from the line top, set when the font has metrics
 };
 
 /**
@@ -273,6 +280,15 @@ public:
      */
     [[nodiscard]] std::pair<f32, f32> getCharacterPosition(const TextLayout& layout, i32 charIndex) const;
 
+    /**
+     * @brief Build the glyph quads that draw a layout from the font's SDF atlas
+     *
+     * Quads are positioned relative to the layout origin and carry each
+     * segment's color, outline and shadow. Requires a font with metrics.
+     * @param quads Receives the quads, in reading order
+     */
+    void buildGlyphQuads(const TextLayout& layout, std::vector<SdfGlyphQuad>& quads) const;
+
 private:
     /**
      * @brief Break text into words for wrapping
@@ -282,7 +298,7 @@ private:
     /**
      * @brief Measure a single character
      */
-    [[nodiscard]] f32 measureChar(char c, const TextStyle& style) const;
+    [[nodiscard]] f32 measureChar(u32 codepoint, const TextStyle& style) const;
 
     /**
      * @brief Measure a word
@@ -18,19 +18,36 @@ public:
     Texture(Texture&& other) noexcept;
     Texture& operator=(Texture&& other) noexcept;
 
+    /**
+     * @brief Load an encoded image or a raw texture payload (see raw_texture.hpp)
+     */
     Result<void> loadFromMemory(const std::vector<u8>& data);
-    Result<void> loadFromRGBA(const u8* pixels, i32 width, i32 height);
+
+    /**
+     * @brief Upload a raw texture payload, e.g. directly from a pack mapping
+     *
+     * Stored payloads are uploaded from @p data without copying; LZ4
+     * payloads are decompressed into a per-thread buffer first.
+     */
+    Result<void> loadFromRaw(const u8* data, usize size);
+
+    Result<void> loadFromRGBA(const u8* pixels, i32 width, i32 height,
+                              bool premultiplied = false);
     void destroy();
 
     [[nodiscard]] bool isValid() const;
     [[nodiscard]] i32 getWidth() const;
     [[nodiscard]] i32 getHeight() const;
+    [[nodiscard]] bool isPremultiplied() const;
+    [[nodiscard]] u32 getMipLevelCount() const;
     [[nodiscard]] void* getNativeHandle() const;
 
 private:
     void* m_handle;
     i32 m_width;
     i32 m_height;
+    bool m_premultiplied;
+    u32 m_mipLevels;
 };
 
 } // namespace NovelMind::renderer
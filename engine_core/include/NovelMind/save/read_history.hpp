@@ -0,0 +1,99 @@
+#pragma once
+
+/**
+ * @file read_history.hpp
+ * @brief Global record of dialogue lines the player has already seen
+ *
+ * Read state is shared by every playthrough, so it lives in its own file
+ * next to the save slots rather than inside them. The file is a small header
+ * followed by a fixed-size bitset and is memory-mapped, so marking a line is
+ * a two-bit store into the page cache and the OS writes it back.
+ *
+ * Lines are keyed by lineId(), a 64-bit hash of the scene name and the line
+ * text. The id does not depend on instruction offsets, so read state survives
+ * recompiles and edits elsewhere in the script; changing a line's text makes
+ * it unread again, and identical lines within a scene share one id.
+ *
+ * The bitset is a Bloom filter with two probes. With the default 2^23 bits
+ * (1 MiB) the false positive rate stays below 0.1% up to roughly 90,000
+ * distinct lines; a false positive only means skip mode passes an unread
+ * line.
+ */
+
+#include "NovelMind/core/types.hpp"
+#include "NovelMind/core/result.hpp"
+#include <string>
+#include <string_view>
+
+namespace NovelMind::save
+{
+
+class ReadHistory
+{
+public:
+    static constexpr u32 DEFAULT_BIT_COUNT = 1u << 23;
+
+    ReadHistory();
+    ~ReadHistory();
+
+    ReadHistory(const ReadHistory&) = delete;
+    ReadHistory& operator=(const ReadHistory&) = delete;
+
+    /**
+     * @brief Map the history file, creating it if it does not exist
+     *
+     * @param bitCount Bitset size for a new file, rounded up to a power of
+     *        two; an existing file keeps the size it was created with
+     */
+    Result<void> open(const std::string& path, u32 bitCount = DEFAULT_BIT_COUNT);
+
+    /**
+     * @brief Flush and unmap; the history is inert until reopened
+     */
+    void close();
+
+    [[nodiscard]] bool isOpen() const { return m_bits != nullptr; }
+    [[nodiscard]] const std::string& getPath() const { return m_path; }
+    [[nodiscard]] u32 getBitCount() const { return isOpen() ? m_bitMask + 1 : 0; }
+
+    /**
+     * @brief Stable id for a line of dialogue
+     */
+    [[nodiscard]] static u64 lineId(std::string_view scene, std::string_view text);
+
+    /**
+     * @brief Record a line as read; no-op when closed
+     */
+    void markRead(u64 lineId);
+
+    /**
+     * @brief Whether a line has been read; always false when closed
+     */
+    [[nodiscard]] bool isRead(u64 lineId) const;
+
+    /**
+     * @brief Forget every line
+     */
+    void clear();
+
+    /**
+     * @brief Write dirty pages back to disk
+     */
+    Result<void> flush();
+
+private:
+    std::string m_path;
+    u8* m_mapping = nullptr;   // Whole file, header included
+    u64* m_bits = nullptr;     // Bitset words inside the mapping
+    usize m_mappingSize = 0;
+    u32 m_bitMask = 0;
+
+#if defined(_WIN32)
+    void* m_file = nullptr;
+    void* m_fileMapping = nullptr;
+#else
+    int m_fd = -1;
+#endif
+};
+
+} // namespace NovelMind::save
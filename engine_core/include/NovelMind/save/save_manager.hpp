@@ -2,6 +2,7 @@
 
 #include "NovelMind/core/types.hpp"
 #include "NovelMind/core/result.hpp"
+#include "NovelMind/save/save_thumbnail.hpp"
 #include <string>
 #include <map>
 #include <optional>
@@ -26,6 +27,9 @@ public:
     SaveManager();
     ~SaveManager();
 
+    SaveManager(const SaveManager&) = delete;
+    SaveManager& operator=(const SaveManager&) = delete;
+
     Result<void> save(i32 slot, const SaveData& data);
     Result<SaveData> load(i32 slot);
     Result<void> deleteSave(i32 slot);
@@ -35,14 +39,49 @@ public:
 
     [[nodiscard]] i32 getMaxSlots() const;
 
+    /**
+     * @brief Queue a thumbnail for a slot from a copy of the last frame
+     *
+     * Takes ownership of @p frame (RGBA8, rows @p stride bytes apart, 0 for
+     * tightly packed); downscaling, encoding and writing happen on a worker
+     * thread, so this only costs the move. Call after save().
+     */
+    Result<void> captureThumbnail(i32 slot, std::vector<u8> frame, u32 width, u32 height,
+                                  u32 stride = 0);
+
+    /**
+     * @brief Bounds captured thumbnails are fitted into (default 320x180)
+     */
+    void setThumbnailSize(u32 maxWidth, u32 maxHeight);
+
+    /**
+     * @brief Header of a slot's thumbnail, read without decoding the image
+     */
+    [[nodiscard]] Result<SaveThumbnailHeader> getThumbnailHeader(i32 slot) const;
+
+    /**
+     * @brief Decoded thumbnail of a slot, cached between calls
+     * @return nullptr if the slot has no thumbnail (yet)
+     */
+    [[nodiscard]] const SaveThumbnail* getThumbnail(i32 slot);
+
+    /**
+     * @brief Block until queued thumbnails are on disk
+     */
+    void flushThumbnails();
+
     void setSavePath(const std::string& path);
     [[nodiscard]] const std::string& getSavePath() const;
 
 private:
     [[nodiscard]] std::string getSlotFilename(i32 slot) const;
+    [[nodiscard]] std::string getThumbnailFilename(i32 slot) const;
+    void applyFinishedThumbnails();
     [[nodiscard]] static u32 calculateChecksum(const SaveData& data);
 
     std::string m_savePath;
+    SaveThumbnailWriter m_thumbnailWriter;
+    SaveThumbnailCache m_thumbnailCache;
     static constexpr i32 MAX_SLOTS = 100;
 };
 
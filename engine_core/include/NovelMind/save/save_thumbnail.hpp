@@ -0,0 +1,207 @@
+#pragma once
+
+/**
+ * @file save_thumbnail.hpp
+ * @brief Save-slot thumbnails: capture, background encoding and cached reads
+ *
+ * A thumbnail lives next to its save slot as a small file: a fixed-size
+ * SaveThumbnailHeader followed by the image as QOI. Load menus list slots
+ * from the headers alone and decode only the thumbnails they show, through
+ * SaveThumbnailCache.
+ *
+ * Capturing costs the main thread one frame copy. SaveThumbnailWriter
+ * downscales the copy on a worker thread (2x2 box halving through
+ * ImageKernels, then one exact area-average pass), encodes it and replaces
+ * the file atomically, so a menu never sees a half-written thumbnail.
+ *
+ * Layout (little-endian):
+ *   SaveThumbnailHeader (32 bytes), QOI image (payloadSize bytes)
+ */
+
+#include "NovelMind/core/types.hpp"
+#include "NovelMind/core/result.hpp"
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace NovelMind::save
+{
+
+constexpr u32 SAVE_THUMBNAIL_MAGIC = 0x42544D4E; // "NMTB" in little-endian
+constexpr u16 SAVE_THUMBNAIL_VERSION = 1;
+
+struct SaveThumbnailHeader
+{
+    u32 magic;
+    u16 version;
+    u16 flags;        // Reserved, 0
+    u32 width;
+    u32 height;
+    u64 timestamp;    // Capture time, system clock ticks
+    u32 payloadSize;  // QOI image bytes after the header
+    u32 payloadHash;  // FNV-1a of the payload
+};
+static_assert(sizeof(SaveThumbnailHeader) == 32, "SaveThumbnailHeader layout is part of the file format");
+
+struct SaveThumbnail
+{
+    u32 width = 0;
+    u32 height = 0;
+    u64 timestamp = 0;
+    std::vector<u8> pixels; // Straight RGBA8, tightly packed
+};
+
+class SaveThumbnailFormat
+{
+public:
+    /**
+     * @brief Largest size with the source's aspect ratio that fits the bounds
+     *
+     * Sources already inside the bounds keep their size.
+     */
+    static void fitWithin(u32 width, u32 height, u32 maxWidth, u32 maxHeight,
+                          u32& outWidth, u32& outHeight);
+
+    /**
+     * @brief Box-filter an RGBA8 image down to an exact size
+     *
+     * Halves with ImageKernels::downsampleHalf while the source is at least
+     * twice the target, then averages the covered source area per pixel.
+     */
+    [[nodiscard]] static std::vector<u8> downscale(const u8* rgba, u32 width, u32 height,
+                                                   u32 stride, u32 targetWidth,
+                                                   u32 targetHeight);
+
+    [[nodiscard]] static Result<std::vector<u8>> encode(const u8* rgba, u32 width, u32 height,
+                                                        u64 timestamp);
+    [[nodiscard]] static Result<SaveThumbnail> decode(const u8* data, usize size);
+
+    /**
+     * @brief Read and validate only the header of a thumbnail file
+     */
+    [[nodiscard]] static Result<SaveThumbnailHeader> readHeader(const std::string& path);
+    [[nodiscard]] static Result<SaveThumbnail> load(const std::string& path);
+};
+
+struct SaveThumbnailWrite
+{
+    std::string path;
+    std::string error; // Empty on success
+};
+
+/**
+ * @brief Downscales, encodes and writes thumbnails on a worker thread
+ *
+ * Writes are applied in submission order, so the last capture for a path
+ * wins. The worker starts with the first submission.
+ */
+class SaveThumbnailWriter
+{
+public:
+    SaveThumbnailWriter() = default;
+    ~SaveThumbnailWriter();
+
+    SaveThumbnailWriter(const SaveThumbnailWriter&) = delete;
+    SaveThumbnailWriter& operator=(const SaveThumbnailWriter&) = delete;
+
+    /**
+     * @brief Bounds thumbnails are fitted into
+     */
+    void setMaxSize(u32 maxWidth, u32 maxHeight);
+
+    /**
+     * @brief Queue a captured frame
+     *
+     * @param frame RGBA8 rows @p stride bytes apart (0 for tightly packed)
+     * @param timestamp Stored in the header to tell captures apart
+     */
+    Result<void> submit(std::string path, std::vector<u8> frame, u32 width, u32 height,
+                        u32 stride, u64 timestamp);
+
+    /**
+     * @brief Writes finished since the last call
+     */
+    [[nodiscard]] std::vector<SaveThumbnailWrite> takeCompleted();
+
+    [[nodiscard]] bool hasPending() const;
+    void waitForAll();
+
+    /**
+     * @brief Finish queued writes and stop the worker
+     */
+    void shutdown();
+
+private:
+    struct Job
+    {
+        std::string path;
+        std::vector<u8> frame;
+        u32 width;
+        u32 height;
+        u32 stride;
+        u32 maxWidth;
+        u32 maxHeight;
+        u64 timestamp;
+    };
+
+    void workerLoop();
+    static std::string process(const Job& job);
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_work;
+    std::condition_variable m_idle;
+    std::deque<Job> m_jobs;
+    std::vector<SaveThumbnailWrite> m_completed;
+    usize m_inFlight = 0;
+    std::thread m_worker;
+    bool m_stopWorker = false;
+    u32 m_maxWidth = 320;
+    u32 m_maxHeight = 180;
+};
+
+/**
+ * @brief Decoded thumbnails, least recently used evicted first
+ *
+ * Missing or invalid files are cached as misses, so a menu polling empty
+ * slots does not retry the disk every frame; invalidate() a path after
+ * writing it.
+ */
+class SaveThumbnailCache
+{
+public:
+    explicit SaveThumbnailCache(usize capacity = 16);
+
+    /**
+     * @brief Decoded thumbnail for a file, loading it on a miss
+     * @return nullptr if the file is missing or invalid
+     */
+    [[nodiscard]] const SaveThumbnail* get(const std::string& path);
+
+    void invalidate(const std::string& path);
+    void clear();
+
+    void setCapacity(usize capacity);
+    [[nodiscard]] usize getCapacity() const { return m_capacity; }
+    [[nodiscard]] usize size() const { return m_entries.size(); }
+
+private:
+    struct Entry
+    {
+        std::string path;
+        bool valid;
+        SaveThumbnail thumbnail;
+    };
+
+    void evict();
+
+    usize m_capacity;
+    std::list<Entry> m_entries; // Most recently used first
+    std::unordered_map<std::string, std::list<Entry>::iterator> m_index;
+};
+
+} // namespace NovelMind::save
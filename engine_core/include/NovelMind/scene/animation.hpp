@@ -9,6 +9,7 @@
  *
  * Features:
  * - Easing functions (linear, ease-in, ease-out, ease-in-out, etc.)
+ * - Custom baked easing curves (EasingCurve) in place of EaseType
  * - Tween types (position, scale, rotation, alpha, color)
  * - Animation timeline for chaining/parallel animations
  * - Callbacks for completion events
@@ -16,6 +17,7 @@
 
 #include "NovelMind/core/types.hpp"
 #include "NovelMind/renderer/color.hpp"
+#include "NovelMind/scene/easing_curve.hpp"
 #include <functional>
 #include <memory>
 #include <vector>
@@ -304,7 +306,8 @@ public:
             if (m_loops > 0 && m_currentLoop >= m_loops)
             {
                 // Animation complete
-                applyProgress(m_forward ? 1.0f : 0.0f);
+                f32 endProgress = m_forward ? 1.0f : 0.0f;
+                applyProgress(m_curve ? m_curve->evaluate(endProgress) : endProgress);
                 m_state = AnimationState::Completed;
 
                 if (m_onComplete)
@@ -318,7 +321,7 @@ public:
 
         // Apply easing and update
         f32 progress = m_forward ? t : (1.0f - t);
-        f32 easedProgress = ease(m_easing, progress);
+        f32 easedProgress = m_curve ? m_curve->evaluate(progress) : ease(m_easing, progress);
         applyProgress(easedProgress);
 
         return true;
@@ -342,6 +345,15 @@ public:
         return *this;
     }
 
+    /**
+     * @brief Use a baked curve instead of the EaseType (nullptr restores it)
+     */
+    Tween& setEasingCurve(std::shared_ptr<const EasingCurve> curve)
+    {
+        m_curve = std::move(curve);
+        return *this;
+    }
+
     /**
      * @brief Set completion callback
      */
@@ -398,6 +410,7 @@ protected:
     i32 m_currentLoop;
     bool m_yoyo;
     bool m_forward;
+    std::shared_ptr<const EasingCurve> m_curve;
     CompletionCallback m_onComplete;
 };
 
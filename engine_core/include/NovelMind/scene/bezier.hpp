@@ -0,0 +1,105 @@
+#pragma once
+
+/**
+ * @file bezier.hpp
+ * @brief Cubic Bezier helpers shared by timelines and easing curves
+ *
+ * Animation curves are authored as 1D cubic Bezier segments in
+ * (time, value) space. Evaluating them at a given time requires inverting
+ * the time polynomial first, which these helpers do with a few Newton steps
+ * and a bisection fallback.
+ */
+
+#include "NovelMind/core/types.hpp"
+#include <cmath>
+
+namespace NovelMind::scene
+{
+
+/**
+ * @brief Evaluate a 1D cubic Bezier at parameter s
+ */
+[[nodiscard]] inline f32 cubicBezier(f32 p0, f32 p1, f32 p2, f32 p3, f32 s)
+{
+    const f32 u = 1.0f - s;
+    return u * u * u * p0 + 3.0f * u * u * s * p1 + 3.0f * u * s * s * p2 + s * s * s * p3;
+}
+
+/**
+ * @brief First derivative of a 1D cubic Bezier with respect to s
+ */
+[[nodiscard]] inline f32 cubicBezierDerivative(f32 p0, f32 p1, f32 p2, f32 p3, f32 s)
+{
+    const f32 u = 1.0f - s;
+    return 3.0f * u * u * (p1 - p0) + 6.0f * u * s * (p2 - p1) + 3.0f * s * s * (p3 - p2);
+}
+
+/**
+ * @brief Find the Bezier parameter whose x equals the given x
+ *
+ * The x polynomial runs from 0 to 1 with inner control points x1 and x2.
+ * Control points inside [0, 1] keep it monotonic, which is what the editors
+ * enforce; out-of-range handles still converge through the bisection path.
+ *
+ * @param x1 First inner control point (normalized)
+ * @param x2 Second inner control point (normalized)
+ * @param x Target x in [0, 1]
+ */
+[[nodiscard]] inline f32 solveCubicBezierParameter(f32 x1, f32 x2, f32 x)
+{
+    if (x <= 0.0f)
+    {
+        return 0.0f;
+    }
+    if (x >= 1.0f)
+    {
+        return 1.0f;
+    }
+
+    // Newton-Raphson from the linear guess converges in 2-4 steps for
+    // typical easing handles.
+    f32 s = x;
+    for (i32 i = 0; i < 6; ++i)
+    {
+        const f32 err = cubicBezier(0.0f, x1, x2, 1.0f, s) - x;
+        if (std::fabs(err) < 1e-6f)
+        {
+            return s;
+        }
+        const f32 slope = cubicBezierDerivative(0.0f, x1, x2, 1.0f, s);
+        if (std::fabs(slope) < 1e-6f)
+        {
+            break;
+        }
+        s -= err / slope;
+        if (s < 0.0f || s > 1.0f)
+        {
+            break;
+        }
+    }
+
+    // Bisection fallback for flat or badly conditioned segments
+    f32 lo = 0.0f;
+    f32 hi = 1.0f;
+    s = x;
+    for (i32 i = 0; i < 32; ++i)
+    {
+        const f32 value = cubicBezier(0.0f, x1, x2, 1.0f, s);
+        if (std::fabs(value - x) < 1e-6f)
+        {
+            break;
+        }
+        if (value < x)
+        {
+            lo = s;
+        }
+        else
+        {
+            hi = s;
+        }
+        s = 0.5f * (lo + hi);
+    }
+    return s;
+}
+
+} // namespace NovelMind::scene
@@ -0,0 +1,210 @@
+#pragma once
+
+/**
+ * @file compiled_timeline.hpp
+ * @brief Runtime keyframe evaluation for cutscene timelines
+ *
+ * Authoring-side timelines (tracks, clips, property tracks) are flattened by
+ * TimelineCompiler into one CompiledTimeline per cutscene:
+ * - One channel per animated property, keyframes stored as parallel arrays
+ * - A per-channel cursor so sequential playback finds its segment in O(1)
+ * - Optional baked lookup tables for Bezier segments
+ * - Channels bound to scene objects write straight into their properties
+ *
+ * The compiled form has no editor dependencies so cutscenes run in the
+ * shipped game exactly as they preview in the editor.
+ */
+
+#include "NovelMind/core/types.hpp"
+#include "NovelMind/core/result.hpp"
+#include "NovelMind/scene/scene_graph.hpp"
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace NovelMind::scene
+{
+
+/**
+ * @brief Interpolation used from a keyframe to the next one
+ */
+enum class TimelineInterpolation : u8
+{
+    Constant,   // Hold value until next key
+    Linear,
+    EaseIn,
+    EaseOut,
+    EaseInOut,
+    Bezier      // Weighted tangents, see TimelineKey
+};
+
+/**
+ * @brief Source keyframe for the compiler
+ *
+ * Bezier tangents are slopes in value-per-second; weights are fractions of
+ * the segment duration, matching the editor's keyframe model.
+ */
+struct TimelineKey
+{
+    f64 time = 0.0;
+    f32 value = 0.0f;
+    TimelineInterpolation interpolation = TimelineInterpolation::Linear;
+    f32 inTangent = 0.0f;
+    f32 outTangent = 0.0f;
+    f32 inWeight = 0.33f;
+    f32 outWeight = 0.33f;
+};
+
+/**
+ * @brief Options controlling compilation
+ */
+struct TimelineCompileOptions
+{
+    bool bakeBezier = true;     // Sample Bezier segments into lookup tables
+    u32 bezierLutSize = 32;     // Samples per baked segment (>= 2)
+};
+
+/**
+ * @brief Compiled, evaluation-ready timeline
+ */
+class CompiledTimeline
+{
+public:
+    /**
+     * @brief One animated property of one target
+     *
+     * Keyframe data is stored as parallel arrays so the segment search only
+     * touches the times array.
+     */
+    struct Channel
+    {
+        std::string targetId;
+        AnimatableProperty property = AnimatableProperty::PositionX;
+        u32 track = 0;
+
+        std::vector<f32> times;
+        std::vector<f32> values;
+        std::vector<TimelineInterpolation> interpolation;
+        // Bezier control values (value space) for the segment starting at key i
+        std::vector<f32> control1;
+        std::vector<f32> control2;
+        // Bezier control times, normalized to the segment
+        std::vector<f32> controlX1;
+        std::vector<f32> controlX2;
+        // Offset of the baked table for segment i, or NO_LUT
+        std::vector<u32> lutOffset;
+
+        // Playback state
+        usize cursor = 0;
+        f32* target = nullptr;
+    };
+
+    static constexpr u32 NO_LUT = 0xFFFFFFFFu;
+
+    CompiledTimeline() = default;
+
+    [[nodiscard]] f64 getDuration() const { return m_duration; }
+    [[nodiscard]] usize getChannelCount() const { return m_channels.size(); }
+    [[nodiscard]] const Channel& getChannel(usize index) const { return m_channels[index]; }
+    [[nodiscard]] usize getBakedSampleCount() const { return m_lut.size(); }
+
+    /**
+     * @brief Resolve channel targets against a scene graph
+     * @return Number of channels that found their target
+     */
+    usize bind(SceneGraph& graph);
+
+    /**
+     * @brief Bind all channels of one target id to a specific object
+     */
+    void bindTarget(const std::string& targetId, SceneObjectBase* object);
+
+    /**
+     * @brief Drop all target bindings
+     */
+    void unbind();
+
+    /**
+     * @brief Enable or disable every channel of a track (mute/solo)
+     */
+    void setTrackActive(u32 track, bool active);
+    [[nodiscard]] bool isTrackActive(u32 track) const;
+    [[nodiscard]] u32 getTrackCount() const { return static_cast<u32>(m_trackActive.size()); }
+
+    /**
+     * @brief Evaluate all active, bound channels and write their targets
+     */
+    void evaluate(f64 time);
+
+    /**
+     * @brief Evaluate one channel without writing anything
+     *
+     * Uses and advances the channel cursor like evaluate().
+     */
+    [[nodiscard]] f32 sample(usize channelIndex, f64 time);
+
+    /**
+     * @brief Reset all cursors to the start of their channels
+     */
+    void rewind();
+
+private:
+    friend class TimelineCompiler;
+
+    [[nodiscard]] f32 evaluateChannel(Channel& channel, f32 time) const;
+    [[nodiscard]] static usize seekSegment(Channel& channel, f32 time);
+
+    std::vector<Channel> m_channels;
+    std::vector<f32> m_lut;
+    std::vector<u8> m_trackActive;
+    u32 m_lutSize = 0;
+    f64 m_duration = 0.0;
+};
+
+/**
+ * @brief Builds a CompiledTimeline from property keyframes
+ */
+class TimelineCompiler
+{
+public:
+    explicit TimelineCompiler(TimelineCompileOptions options = {});
+
+    /**
+     * @brief Map an authoring property name onto an animatable property
+     *
+     * Accepts "position.x", "position.y", "scale.x", "scale.y", "rotation",
+     * "opacity" and "alpha".
+     */
+    [[nodiscard]] static std::optional<AnimatableProperty> parseProperty(const std::string& name);
+
+    /**
+     * @brief Allocate a track index; channels of a track are muted together
+     */
+    u32 addTrack();
+
+    /**
+     * @brief Add a channel; keys may be unsorted
+     */
+    void addChannel(u32 track, const std::string& targetId, AnimatableProperty property,
+                    std::vector<TimelineKey> keys);
+
+    /**
+     * @brief Produce the compiled timeline and reset the compiler
+     */
+    Result<CompiledTimeline> compile();
+
+private:
+    struct PendingChannel
+    {
+        u32 track;
+        std::string targetId;
+        AnimatableProperty property;
+        std::vector<TimelineKey> keys;
+    };
+
+    TimelineCompileOptions m_options;
+    std::vector<PendingChannel> m_pending;
+    u32 m_trackCount = 0;
+};
+
+} // namespace NovelMind::scene
@@ -0,0 +1,195 @@
+#pragma once
+
+/**
+ * @file dialogue_backlog.hpp
+ * @brief History of shown dialogue lines for the backlog screen
+ *
+ * Each line is stored as a fixed 24-byte record: the string-table indices of
+ * its text and speaker, an interned voice id and the hash of the variables it
+ * was shown with. Records live in a ring of fixed capacity, so a long route
+ * costs no more memory than the last N lines. Voice ids and variable
+ * snapshots are reference counted and dropped with the last line using them.
+ *
+ * Text is resolved only when the backlog screen asks for it, through the
+ * current locale, so switching language re-localizes the whole history.
+ * Layouts are built only for the entries the screen draws and kept in a
+ * small LRU cache. Voice replay goes through AudioManager::playVoice(),
+ * which opens the clip on demand; the backlog never holds audio data.
+ */
+
+#include "NovelMind/core/types.hpp"
+#include "NovelMind/audio/audio_manager.hpp"
+#include "NovelMind/localization/localization_manager.hpp"
+#include "NovelMind/renderer/text_layout.hpp"
+#include <functional>
+#include <list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace NovelMind::scene
+{
+
+class DialogueBacklog
+{
+public:
+    static constexpr usize DEFAULT_CAPACITY = 4096;
+    static constexpr usize DEFAULT_LAYOUT_CACHE_SIZE = 32;
+    static constexpr u32 NONE = 0xFFFFFFFFu;
+
+    using VariableMap = std::unordered_map<std::string, std::string>;
+
+    /**
+     * @brief Turns a string-table index into display text
+     */
+    using TextResolver = std::function<std::string(u32 stringIndex, const VariableMap& variables)>;
+
+    /**
+     * @brief Called for each entry drawn by forEachVisible()
+     */
+    using VisibleCallback = std::function<void(usize index, const renderer::TextLayout& layout)>;
+
+    struct Entry
+    {
+        u32 textIndex = NONE;     // String-table index of the line
+        u32 speakerIndex = NONE;  // String-table index of the speaker, NONE for narration
+        u32 voiceSlot = NONE;     // Interned voice id, NONE when unvoiced
+        u32 reserved = 0;
+        u64 variableHash = 0;     // Snapshot of interpolated variables, 0 when none
+    };
+
+    explicit DialogueBacklog(usize capacity = DEFAULT_CAPACITY);
+
+    /**
+     * @brief Record a shown line, evicting the oldest when full
+     */
+    void push(u32 textIndex, u32 speakerIndex = NONE, std::string_view voiceId = {},
+              const VariableMap& variables = {});
+
+    void clear();
+
+    [[nodiscard]] usize size() const { return m_count; }
+    [[nodiscard]] usize capacity() const { return m_capacity; }
+    [[nodiscard]] bool empty() const { return m_count == 0; }
+
+    /**
+     * @brief Entry by position, 0 being the oldest line kept
+     */
+    [[nodiscard]] const Entry& getEntry(usize index) const;
+
+    // =========================================================================
+    // Text
+    // =========================================================================
+
+    /**
+     * @brief Resolve entries through a compiled string table
+     *
+     * With a localization manager, the source text is used as the string id
+     * and looked up in the current locale; lines without a translation show
+     * the source text. Both pointers must outlive the backlog.
+     */
+    void setStringTable(const std::vector<std::string>* stringTable,
+                        const localization::LocalizationManager* localization = nullptr);
+
+    /**
+     * @brief Use a custom resolver instead of a string table
+     */
+    void setTextResolver(TextResolver resolver);
+
+    [[nodiscard]] std::string getText(usize index) const;
+    [[nodiscard]] std::string getSpeaker(usize index) const;
+
+    /**
+     * @brief Voice id of an entry, empty when unvoiced
+     */
+    [[nodiscard]] const std::string& getVoiceId(usize index) const;
+
+    // =========================================================================
+    // Layout
+    // =========================================================================
+
+    /**
+     * @brief Set the engine used to lay out entries; drops cached layouts
+     */
+    void setLayoutEngine(const renderer::TextLayoutEngine* engine);
+
+    void setLayoutCacheSize(usize size);
+
+    /**
+     * @brief Layout of an entry, built on first use
+     *
+     * The reference stays valid until the entry is evicted from the cache by
+     * later layout() calls.
+     */
+    [[nodiscard]] const renderer::TextLayout& layout(usize index);
+
+    /**
+     * @brief Lay out entries from @p first until @p viewportHeight is filled
+     * @return Number of entries visited
+     */
+    usize forEachVisible(usize first, f32 viewportHeight, const VisibleCallback& callback);
+
+    /**
+     * @brief Drop cached layouts, e.g. after a locale or font change
+     */
+    void invalidateLayouts();
+
+    [[nodiscard]] usize getCachedLayoutCount() const { return m_layoutCache.size(); }
+
+    // =========================================================================
+    // Voice
+    // =========================================================================
+
+    /**
+     * @brief Replay an entry's voice line; returns an invalid handle when unvoiced
+     */
+    audio::AudioHandle replayVoice(usize index, audio::AudioManager& audio,
+                                   const audio::VoiceConfig& config = {}) const;
+
+private:
+    struct VoiceSlot
+    {
+        std::string id;
+        u32 refs = 0;
+    };
+
+    struct Snapshot
+    {
+        VariableMap variables;
+        u32 refs = 0;
+    };
+
+    [[nodiscard]] usize slotOf(usize index) const;
+    [[nodiscard]] u64 sequenceOf(usize index) const;
+    [[nodiscard]] std::string resolve(u32 stringIndex, u64 variableHash) const;
+
+    u32 internVoice(std::string_view voiceId);
+    void releaseEntry(const Entry& entry);
+    [[nodiscard]] static u64 hashVariables(const VariableMap& variables);
+
+    // Ring of entries; m_head is the slot of the oldest
+    std::vector<Entry> m_entries;
+    usize m_capacity = 0;
+    usize m_head = 0;
+    usize m_count = 0;
+    u64 m_totalPushed = 0;
+
+    std::vector<VoiceSlot> m_voices;
+    std::unordered_map<std::string, u32> m_voiceLookup;
+    std::vector<u32> m_freeVoiceSlots;
+    std::unordered_map<u64, Snapshot> m_snapshots;
+
+    const std::vector<std::string>* m_stringTable = nullptr;
+    const localization::LocalizationManager* m_localization = nullptr;
+    TextResolver m_resolver;
+
+    // LRU of layouts keyed by entry sequence number, most recent first
+    const renderer::TextLayoutEngine* m_layoutEngine = nullptr;
+    usize m_layoutCacheSize = DEFAULT_LAYOUT_CACHE_SIZE;
+    std::list<std::pair<u64, renderer::TextLayout>> m_layoutCache;
+    std::unordered_map<u64, std::list<std::pair<u64, renderer::TextLayout>>::iterator>
+        m_layoutLookup;
+};
+
+} // namespace NovelMind::scene
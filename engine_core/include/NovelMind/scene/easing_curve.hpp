@@ -0,0 +1,79 @@
+#pragma once
+
+/**
+ * @file easing_curve.hpp
+ * @brief Baked easing curves usable in place of EaseType
+ *
+ * An EasingCurve is an immutable lookup table over t in [0, 1]. Tables are
+ * built from an exact evaluation function with the smallest power-of-two
+ * resolution that keeps the interpolation error under a tolerance, so
+ * simple curves stay tiny and sharp ones get the samples they need.
+ *
+ * Lookups are O(1) and branch-free, and evaluateBatch() processes many
+ * time values at once with SSE2/NEON where available.
+ */
+
+#include "NovelMind/core/types.hpp"
+#include <functional>
+#include <vector>
+
+namespace NovelMind::scene
+{
+
+class EasingCurve
+{
+public:
+    using ExactFunction = std::function<f32(f32)>;
+
+    static constexpr u32 MIN_SAMPLES = 17;      // 16 intervals
+    static constexpr u32 MAX_SAMPLES = 4097;    // 4096 intervals
+    static constexpr f32 DEFAULT_TOLERANCE = 1e-4f;
+
+    EasingCurve();
+
+    /**
+     * @brief Bake a curve from an exact evaluation function
+     *
+     * Doubles the table resolution until the error at every interval
+     * midpoint is below the tolerance or MAX_SAMPLES is reached.
+     */
+    [[nodiscard]] static EasingCurve bake(const ExactFunction& exact,
+                                          f32 tolerance = DEFAULT_TOLERANCE);
+
+    /**
+     * @brief Wrap precomputed, uniformly spaced samples (at least two)
+     */
+    [[nodiscard]] static EasingCurve fromSamples(std::vector<f32> samples);
+
+    /**
+     * @brief Evaluate at t (clamped to [0, 1])
+     */
+    [[nodiscard]] f32 evaluate(f32 t) const;
+
+    /**
+     * @brief Slope of the baked curve at t
+     */
+    [[nodiscard]] f32 evaluateDerivative(f32 t) const;
+
+    /**
+     * @brief Evaluate many time values in one pass
+     * @param times Input values, clamped to [0, 1]
+     * @param out Output buffer with room for count values
+     */
+    void evaluateBatch(const f32* times, f32* out, usize count) const;
+
+    [[nodiscard]] usize getSampleCount() const { return m_samples.size(); }
+    [[nodiscard]] const std::vector<f32>& getSamples() const { return m_samples; }
+
+    /**
+     * @brief Largest midpoint error measured while baking (0 if not baked)
+     */
+    [[nodiscard]] f32 getMaxError() const { return m_maxError; }
+
+private:
+    std::vector<f32> m_samples;
+    f32 m_scale = 1.0f;     // samples - 1, as float
+    f32 m_maxError = 0.0f;
+};
+
+} // namespace NovelMind::scene
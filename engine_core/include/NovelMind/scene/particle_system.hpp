@@ -0,0 +1,154 @@
+#pragma once
+
+/**
+ * @file particle_system.hpp
+ * @brief Pooled particles for weather and ambient screen effects
+ *
+ * Particles are stored as structure-of-arrays in a pool sized once from the
+ * emitter definition. Integration walks the position, velocity and life
+ * arrays with SSE2/NEON where available; dead particles are recycled by
+ * swapping the last live particle into their slot, so steady-state updates
+ * never allocate. Rendering builds quads into preallocated arrays and hands
+ * them to IRenderer::fillRects() as one batch.
+ */
+
+#include "NovelMind/core/types.hpp"
+#include "NovelMind/core/result.hpp"
+#include "NovelMind/renderer/color.hpp"
+#include "NovelMind/renderer/renderer.hpp"
+#include "NovelMind/renderer/transform.hpp"
+#include <string>
+#include <vector>
+
+namespace NovelMind::scene
+{
+
+/**
+ * @brief Describes how an emitter spawns and moves its particles
+ *
+ * Definitions can be loaded from a flat JSON object whose keys match the
+ * field names (spawnArea is given as spawnX, spawnY, spawnWidth and
+ * spawnHeight; colors as "#RRGGBB" or "#RRGGBBAA"), e.g.
+ * @code
+ * { "emissionRate": 40, "maxParticles": 300, "lifetimeMin": 6, "lifetimeMax": 9,
+ *   "velocityMinY": 40, "velocityMaxY": 70, "swayAmplitude": 30,
+ *   "startColor": "#FFC0D8FF", "endColor": "#FFC0D800" }
+ * @endcode
+ */
+struct ParticleEmitterDef
+{
+    f32 emissionRate = 100.0f;  // Particles per second at intensity 1
+    u32 maxParticles = 1000;    // Pool capacity
+
+    f32 lifetimeMin = 1.0f;
+    f32 lifetimeMax = 2.0f;
+
+    // Particles spawn uniformly inside this area
+    renderer::Rect spawnArea{0.0f, -20.0f, 1920.0f, 10.0f};
+
+    f32 velocityMinX = 0.0f;
+    f32 velocityMaxX = 0.0f;
+    f32 velocityMinY = 100.0f;
+    f32 velocityMaxY = 200.0f;
+    f32 gravityX = 0.0f;
+    f32 gravityY = 0.0f;
+
+    f32 width = 4.0f;
+    f32 height = 4.0f;
+    f32 sizeVariance = 0.0f;    // Random scale in [1 - v, 1 + v]
+
+    // Horizontal drift added at render time, for snow and petals
+    f32 swayAmplitude = 0.0f;
+    f32 swayFrequency = 1.0f;   // Radians per second
+
+    renderer::Color startColor{255, 255, 255, 255};
+    renderer::Color endColor{255, 255, 255, 0};
+
+    [[nodiscard]] static ParticleEmitterDef rain();
+    [[nodiscard]] static ParticleEmitterDef snow();
+    [[nodiscard]] static ParticleEmitterDef petals();
+
+    /**
+     * @brief Parse a definition; unknown keys are ignored, missing ones keep their defaults
+     */
+    [[nodiscard]] static Result<ParticleEmitterDef> parse(const std::string& json);
+    [[nodiscard]] static Result<ParticleEmitterDef> loadFromFile(const std::string& path);
+};
+
+class ParticleSystem
+{
+public:
+    ParticleSystem();
+
+    /**
+     * @brief Replace the emitter; resizes the pool and drops live particles
+     */
+    void setEmitter(const ParticleEmitterDef& def);
+    [[nodiscard]] const ParticleEmitterDef& getEmitter() const { return m_def; }
+
+    void setSeed(u32 seed);
+
+    void setEmitting(bool emitting) { m_emitting = emitting; }
+    [[nodiscard]] bool isEmitting() const { return m_emitting; }
+
+    /**
+     * @brief Scales the emission rate
+     */
+    void setIntensity(f32 intensity) { m_intensity = intensity; }
+
+    /**
+     * @brief Spawn up to @p count particles immediately
+     */
+    void burst(u32 count);
+
+    /**
+     * @brief Spawn, integrate and recycle particles
+     */
+    void update(f32 deltaTime);
+
+    /**
+     * @brief Submit all live particles as one batch of quads
+     */
+    void render(renderer::IRenderer& renderer, f32 alpha = 1.0f);
+
+    void clear();
+
+    [[nodiscard]] usize getAliveCount() const { return m_alive; }
+    [[nodiscard]] usize getCapacity() const { return m_posX.size(); }
+
+    // Read access for tooling and tests
+    [[nodiscard]] const f32* getPositionsX() const { return m_posX.data(); }
+    [[nodiscard]] const f32* getPositionsY() const { return m_posY.data(); }
+
+private:
+    void spawn(u32 count);
+    void integrate(f32 deltaTime);
+    void recycle();
+
+    [[nodiscard]] f32 random01();
+    [[nodiscard]] f32 randomRange(f32 min, f32 max);
+
+    ParticleEmitterDef m_def;
+
+    // Structure-of-arrays pool; [0, m_alive) are live
+    std::vector<f32> m_posX;
+    std::vector<f32> m_posY;
+    std::vector<f32> m_velX;
+    std::vector<f32> m_velY;
+    std::vector<f32> m_life;         // Seconds remaining
+    std::vector<f32> m_invLifetime;  // 1 / initial lifetime
+    std::vector<f32> m_scale;
+    std::vector<f32> m_phase;        // Sway phase
+    usize m_alive = 0;
+
+    // Render scratch, sized with the pool
+    std::vector<renderer::Rect> m_rects;
+    std::vector<renderer::Color> m_colors;
+
+    bool m_emitting = false;
+    f32 m_intensity = 1.0f;
+    f32 m_emitAccumulator = 0.0f;
+    u32 m_rng = 0x9E3779B9u;
+};
+
+} // namespace NovelMind::scene
@@ -17,6 +17,7 @@
 #include "NovelMind/renderer/renderer.hpp"
 #include "NovelMind/renderer/color.hpp"
 #include "NovelMind/scene/animation.hpp"
+#include "NovelMind/scene/particle_system.hpp"
 #include "NovelMind/scene/scene_manager.hpp"  // For LayerType enum
 #include <string>
 #include <memory>
@@ -49,6 +50,23 @@ enum class SceneObjectType : u8
     Custom
 };
 
+/**
+ * @brief Numeric properties that animation systems may write directly
+ *
+ * Timelines resolve these once at bind time and then write through the
+ * returned pointer every frame, bypassing the string-based change
+ * notifications used by the editor-facing setters.
+ */
+enum class AnimatableProperty : u8
+{
+    PositionX,
+    PositionY,
+    ScaleX,
+    ScaleY,
+    Rotation,
+    Alpha
+};
+
 /**
  * @brief Serializable state for a scene object
  */
@@ -178,6 +196,14 @@ public:
     void animateAlpha(f32 toAlpha, f32 duration, EaseType easing = EaseType::Linear);
     void animateScale(f32 toScaleX, f32 toScaleY, f32 duration, EaseType easing = EaseType::Linear);
 
+    /**
+     * @brief Get a raw pointer to an animatable property
+     *
+     * The pointer stays valid for the lifetime of the object. Writes through
+     * it do not notify observers.
+     */
+    [[nodiscard]] f32* getAnimatableProperty(AnimatableProperty property);
+
 protected:
     // Notify observers of property changes
     void notifyPropertyChanged(const std::string& property, const std::string& oldValue, const std::string& newValue);
@@ -404,18 +430,38 @@ public:
     void stopEffect();
     [[nodiscard]] bool isEffectActive() const { return m_effectActive; }
 
+    /**
+     * @brief Emitter used by EffectType::Custom (e.g. ParticleEmitterDef::petals())
+     */
+    void setParticleEmitter(const ParticleEmitterDef& def);
+
+    /**
+     * @brief Load the Custom emitter from a definition file; the path is saved with the state
+     */
+    Result<void> loadParticleEmitter(const std::string& path);
+
+    [[nodiscard]] const ParticleSystem& getParticles() const { return m_particles; }
+
     void update(f64 deltaTime) override;
     void render(renderer::IRenderer& renderer) override;
     [[nodiscard]] SceneObjectState saveState() const override;
     void loadState(const SceneObjectState& state) override;
 
 private:
+    [[nodiscard]] bool isParticleEffect() const;
+    void configureParticles();
+
     EffectType m_effectType = EffectType::None;
     renderer::Color m_color{0, 0, 0, 255};
     f32 m_intensity = 1.0f;
     bool m_effectActive = false;
     f32 m_effectTimer = 0.0f;
     f32 m_effectDuration = 0.0f;
+
+    // Rain, Snow and Custom; particles outlive the effect until they expire
+    ParticleSystem m_particles;
+    std::optional<ParticleEmitterDef> m_customEmitter;
+    std::string m_customEmitterPath;
 };
 
 // LayerType is defined in scene_manager.hpp
@@ -111,6 +111,7 @@ struct CharacterDecl
     std::string displayName;
     std::string color;
     std::optional<std::string> defaultSprite;
+    SourceLocation location;
 };
 
 /**
@@ -120,6 +121,7 @@ struct SceneDecl
 {
     std::string name;
     std::vector<StmtPtr> body;
+    SourceLocation location;
 };
 
 /**
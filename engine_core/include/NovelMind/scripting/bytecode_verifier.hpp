@@ -0,0 +1,64 @@
+#pragma once
+
+/**
+ * @file bytecode_verifier.hpp
+ * @brief Load-time checks that let the VM skip per-instruction safety checks
+ *
+ * Structural checks reject programs outright: unknown opcodes, jump targets
+ * past the end of the program, string operands outside the string table and
+ * out-of-range immediate operands.
+ *
+ * The stack check is an abstract interpretation over basic blocks. Starting
+ * from depth zero at the entry, every reachable block is walked once with the
+ * stack effect of each instruction; a program is stack-verified when no
+ * instruction can underflow, every block is entered with the same depth on
+ * all paths and the maximum depth fits the stack limit. Programs that load
+ * but are not stack-verified still run, on the VM's checked path.
+ */
+
+#include "NovelMind/core/types.hpp"
+#include "NovelMind/core/result.hpp"
+#include "NovelMind/scripting/opcode.hpp"
+#include "NovelMind/scripting/vm_security.hpp"
+#include <string>
+#include <vector>
+
+namespace NovelMind::scripting
+{
+
+struct BytecodeVerification
+{
+    bool stackVerified = false;
+    std::string stackFailure;   // Why the stack check failed, if it did
+    u32 maxStackDepth = 0;      // Valid when stackVerified
+
+    // Instruction count of the basic block starting at each index; zero for
+    // instructions that do not start a block. Used as the fuel charge.
+    std::vector<u32> blockCost;
+};
+
+class BytecodeVerifier
+{
+public:
+    [[nodiscard]] static Result<BytecodeVerification> verify(
+        const std::vector<Instruction>& program, const std::vector<std::string>& stringTable,
+        const VMSecurityLimits& limits = {});
+
+    /**
+     * @brief Values popped and pushed by an instruction as the VM executes it
+     */
+    struct StackEffect
+    {
+        u32 pops = 0;
+        u32 pushes = 0;
+    };
+
+    [[nodiscard]] static StackEffect stackEffect(OpCode op);
+
+    /**
+     * @brief Whether an instruction ends its basic block (jumps, halts or suspends the VM)
+     */
+    [[nodiscard]] static bool endsBlock(OpCode op);
+};
+
+} // namespace NovelMind::scripting
@@ -11,6 +11,7 @@
 #include "NovelMind/core/types.hpp"
 #include "NovelMind/core/result.hpp"
 #include "NovelMind/scripting/ast.hpp"
+#include "NovelMind/scripting/line_table.hpp"
 #include "NovelMind/scripting/opcode.hpp"
 #include "NovelMind/scripting/value.hpp"
 #include <vector>
@@ -36,6 +37,21 @@ struct CompiledScript
 
     // Variable declarations (for type checking)
     std::unordered_map<std::string, ValueType> variables;
+
+    // Source location of each statement's first instruction
+    LineTable lineTable;
+};
+
+/**
+ * @brief A single expression compiled on its own, ending in HALT
+ *
+ * Used for debugger conditions and watches, evaluated with
+ * VirtualMachine::evaluate() against the running script's variables.
+ */
+struct CompiledExpression
+{
+    std::vector<Instruction> instructions;
+    std::vector<std::string> stringTable;
 };
 
 /**
@@ -82,6 +98,11 @@ public:
      */
     [[nodiscard]] Result<CompiledScript> compile(const Program& program);
 
+    /**
+     * @brief Compile one expression with its own string table
+     */
+    [[nodiscard]] Result<CompiledExpression> compileStandaloneExpression(const Expression& expr);
+
     /**
      * @brief Get all errors encountered during compilation
      */
@@ -0,0 +1,67 @@
+#pragma once
+
+/**
+ * @file line_table.hpp
+ * @brief Compact map from bytecode instructions back to script source
+ *
+ * The compiler records where each statement's code starts. Entries are
+ * stored as LEB128 varints of the instruction delta, the zigzagged line
+ * delta and the column, so a typical statement costs three bytes. Lookups
+ * decode sequentially; they serve the debugger, not the interpreter loop.
+ */
+
+#include "NovelMind/core/types.hpp"
+#include "NovelMind/scripting/token.hpp"
+#include <optional>
+#include <vector>
+
+namespace NovelMind::scripting
+{
+
+struct LineTableEntry
+{
+    u32 ip;
+    SourceLocation location;
+};
+
+class LineTable
+{
+public:
+    /**
+     * @brief Record the location of the statement whose code starts at @p ip
+     *
+     * Instruction indices must not decrease. A statement that emitted no code
+     * is replaced by the next one at the same index; repeats of the previous
+     * location are dropped.
+     */
+    void add(u32 ip, SourceLocation location);
+
+    /**
+     * @brief Location of the statement that contains @p ip
+     */
+    [[nodiscard]] std::optional<SourceLocation> getLocation(u32 ip) const;
+
+    /**
+     * @brief First instruction of every statement that starts on @p line
+     */
+    [[nodiscard]] std::vector<u32> getInstructions(u32 line) const;
+
+    [[nodiscard]] std::vector<LineTableEntry> decode() const;
+
+    [[nodiscard]] bool empty() const { return m_count == 0; }
+    [[nodiscard]] u32 getEntryCount() const { return m_count; }
+    [[nodiscard]] const std::vector<u8>& getData() const { return m_data; }
+
+private:
+    void append(u32 ip, SourceLocation location);
+
+    std::vector<u8> m_data;
+    u32 m_count = 0;
+
+    // Decoder state after the last entry, and before it for replacing it
+    LineTableEntry m_last{0, SourceLocation(0, 0)};
+    LineTableEntry m_beforeLast{0, SourceLocation(0, 0)};
+    usize m_lastOffset = 0;
+};
+
+} // namespace NovelMind::scripting
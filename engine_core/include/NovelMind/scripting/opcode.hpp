@@ -15,6 +15,7 @@ enum class OpCode : u8
     JUMP_IF_NOT = 0x04,
     CALL = 0x05,
     RETURN = 0x06,
+    BREAK = 0x07, // Debugger trap patched over an instruction; never emitted
 
     // Stack operations
     PUSH_INT = 0x10,
@@ -62,6 +62,13 @@ public:
      */
     [[nodiscard]] Result<Program> parse(const std::vector<Token>& tokens);
 
+    /**
+     * @brief Parse tokens holding exactly one expression
+     *
+     * Used for debugger conditions typed in the editor.
+     */
+    [[nodiscard]] Result<ExprPtr> parseStandaloneExpression(const std::vector<Token>& tokens);
+
     /**
      * @brief Get all errors encountered during parsing
      */
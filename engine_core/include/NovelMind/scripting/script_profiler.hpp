@@ -0,0 +1,124 @@
+#pragma once
+
+/**
+ * @file script_profiler.hpp
+ * @brief Per-instruction execution counts and host callback timings for scripts
+ *
+ * Attached to a VirtualMachine, the profiler counts every executed
+ * instruction by index and times each host command callback (SAY,
+ * SHOW_CHARACTER, ...). Counting is one increment per instruction; without
+ * a profiler the VM runs its unprofiled loop. Reports attribute the counts
+ * to source lines through the script's line table and to scenes through
+ * their entry points, and export as folded stacks ("scene;line;OPCODE
+ * weight") for flamegraph.pl, speedscope or inferno.
+ *
+ * Example:
+ * @code
+ * ScriptProfiler profiler;
+ * runtime.setProfiler(&profiler);
+ * // ... play ...
+ * auto report = profiler.buildReport(script);
+ * profiler.exportToFoldedStacks("script.folded", script, ScriptProfileMetric::CallbackTime);
+ * @endcode
+ */
+
+#include "NovelMind/core/types.hpp"
+#include "NovelMind/scripting/compiler.hpp"
+#include "NovelMind/scripting/opcode.hpp"
+#include <array>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace NovelMind::scripting
+{
+
+struct ScriptProfileLine
+{
+    u32 line = 0;               // Line in the compiled source
+    u64 instructions = 0;
+    u64 callbackCalls = 0;
+    u64 callbackNanos = 0;
+};
+
+struct ScriptProfileCallback
+{
+    OpCode opcode = OpCode::NOP;
+    u64 calls = 0;
+    u64 totalNanos = 0;
+    u64 maxNanos = 0;
+};
+
+struct ScriptProfileScene
+{
+    std::string name;
+    u64 instructions = 0;
+    u64 callbackNanos = 0;
+    std::vector<ScriptProfileLine> lines; // Most callback time, then instructions, first
+};
+
+struct ScriptProfileReport
+{
+    u64 totalInstructions = 0;
+    u64 totalCallbackNanos = 0;
+    std::vector<ScriptProfileScene> scenes;        // Hottest first
+    std::vector<ScriptProfileCallback> callbacks;  // Most time first
+};
+
+enum class ScriptProfileMetric : u8
+{
+    Instructions,   // Executed instructions per line
+    CallbackTime    // Nanoseconds inside host callbacks per line and opcode
+};
+
+class ScriptProfiler
+{
+public:
+    /**
+     * @brief Names a compiled source line in reports; defaults to "line N"
+     */
+    using LineLabeler = std::function<std::string(u32 line)>;
+
+    /**
+     * @brief Size the counters for a program; keeps counts when it does not shrink
+     */
+    void attach(usize programSize);
+    void reset();
+
+    void countInstruction(u32 ip)
+    {
+        if (ip < m_instructionCounts.size())
+        {
+            ++m_instructionCounts[ip];
+        }
+    }
+
+    void recordCallback(u32 ip, OpCode op, u64 nanos);
+
+    [[nodiscard]] u64 getInstructionCount(u32 ip) const;
+    [[nodiscard]] u64 getTotalInstructions() const;
+    [[nodiscard]] const ScriptProfileCallback& getCallbackStats(OpCode op) const;
+
+    [[nodiscard]] ScriptProfileReport buildReport(const CompiledScript& script) const;
+
+    /**
+     * @brief Folded stack lines, one per scene, line and (for time) opcode
+     */
+    [[nodiscard]] std::string toFoldedStacks(const CompiledScript& script,
+                                             ScriptProfileMetric metric,
+                                             const LineLabeler& labeler = {}) const;
+
+    bool exportToFoldedStacks(const std::string& filename, const CompiledScript& script,
+                              ScriptProfileMetric metric,
+                              const LineLabeler& labeler = {}) const;
+
+    [[nodiscard]] static const char* getOpCodeName(OpCode op);
+
+private:
+    std::vector<u64> m_instructionCounts;
+    std::vector<u64> m_callbackNanos;   // Per instruction
+    std::vector<u64> m_callbackCalls;   // Per instruction
+    std::array<ScriptProfileCallback, 256> m_callbacks{};
+};
+
+} // namespace NovelMind::scripting
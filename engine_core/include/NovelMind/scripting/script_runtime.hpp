@@ -16,13 +16,17 @@
 #include "NovelMind/core/result.hpp"
 #include "NovelMind/scripting/vm.hpp"
 #include "NovelMind/scripting/compiler.hpp"
+#include "NovelMind/scripting/script_profiler.hpp"
 #include "NovelMind/scene/scene_manager.hpp"
 #include "NovelMind/scene/character_sprite.hpp"
 #include "NovelMind/scene/dialogue_box.hpp"
 #include "NovelMind/scene/choice_menu.hpp"
 #include "NovelMind/scene/transition.hpp"
 #include "NovelMind/scene/animation.hpp"
+#include "NovelMind/scene/dialogue_backlog.hpp"
 #include "NovelMind/audio/audio_manager.hpp"
+#include "NovelMind/audio/voice_preloader.hpp"
+#include "NovelMind/save/read_history.hpp"
 #include <functional>
 #include <queue>
 #include <memory>
@@ -47,7 +51,7 @@ enum class RuntimeState : u8
     WaitingTimer,   // Waiting for a timed delay
     WaitingTransition, // Waiting for transition to complete
     WaitingAnimation,  // Waiting for animation to complete
-    Paused,         // Manually paused
+    Paused,         // Manually paused or stopped at a breakpoint
     Halted          // Execution complete
 };
 
@@ -94,6 +98,7 @@ struct RuntimeConfig
     f32 autoAdvanceDelay = 2.0f;        // Seconds after text complete
     bool skipModeEnabled = false;
     f32 skipModeSpeed = 100.0f;         // Text speed in skip mode
+    bool skipUnreadText = false;        // Skip mode also passes lines not yet read
 };
 
 /**
@@ -285,6 +290,60 @@ public:
      */
     [[nodiscard]] bool isSkipMode() const;
 
+    /**
+     * @brief Set the global read history; may be null
+     *
+     * Every line shown is marked read. In skip mode, lines already read are
+     * passed without waiting for input, and skip mode ends at the first
+     * unread line unless RuntimeConfig::skipUnreadText is set. Without a
+     * history, skip mode passes every line.
+     */
+    void setReadHistory(save::ReadHistory* history);
+
+    /**
+     * @brief Get the read history, if one is set
+     */
+    [[nodiscard]] save::ReadHistory* getReadHistory() const;
+
+    /**
+     * @brief Whether the line being shown had been read before
+     */
+    [[nodiscard]] bool isCurrentLineRead() const;
+
+    /**
+     * @brief Set the backlog that records shown lines; may be null
+     *
+     * The backlog resolves text through this runtime's string table and is
+     * cleared when a new script is loaded.
+     */
+    void setBacklog(scene::DialogueBacklog* backlog);
+
+    /**
+     * @brief Get the backlog, if one is set
+     */
+    [[nodiscard]] scene::DialogueBacklog* getBacklog() const;
+
+    /**
+     * @brief Set the voice preloader; may be null
+     *
+     * Each line shown plays its voice through the audio manager (unless
+     * skipped) and queues the voices of the lines reachable after it.
+     */
+    void setVoicePreloader(audio::VoicePreloader* preloader);
+
+    /**
+     * @brief Get the voice preloader, if one is set
+     */
+    [[nodiscard]] audio::VoicePreloader* getVoicePreloader() const;
+
+    /**
+     * @brief Profile script execution into @p profiler; null disables profiling
+     *
+     * Counts survive scene changes; call ScriptProfiler::reset() to start over.
+     */
+    void setProfiler(ScriptProfiler* profiler);
+    [[nodiscard]] ScriptProfiler* getProfiler() const;
+
     /**
      * @brief Save current state
      */
@@ -321,6 +380,10 @@ private:
 
     // Internal helpers
     void registerCallbacks();
+    void buildLineIds();
+    void trackLineRead();
+    void recordBacklogLine();
+    void playLineVoice();
     void fireEvent(ScriptEventType type, const std::string& name = "",
                    const Value& value = Value{});
 
@@ -342,6 +405,9 @@ private:
     Scene::ChoiceMenu* m_choiceMenu = nullptr;
     audio::AudioManager* m_audioManager = nullptr;
     scene::AnimationManager* m_animationManager = nullptr;
+    save::ReadHistory* m_readHistory = nullptr;
+    scene::DialogueBacklog* m_backlog = nullptr;
+    audio::VoicePreloader* m_voicePreloader = nullptr;
 
     // State
     RuntimeState m_state = RuntimeState::Idle;
@@ -361,6 +427,11 @@ private:
 
     // Skip mode
     bool m_skipMode = false;
+    bool m_skipCurrentLine = false;   // Pass the line just shown without input
+
+    // Read tracking: history id of each SAY instruction, 0 elsewhere
+    std::vector<u64> m_lineIds;
+    bool m_currentLineRead = false;
 
     // Event callback
     EventCallback m_eventCallback;
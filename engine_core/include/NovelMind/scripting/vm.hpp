@@ -2,6 +2,7 @@
 
 #include "NovelMind/core/types.hpp"
 #include "NovelMind/core/result.hpp"
+#include "NovelMind/scripting/bytecode_verifier.hpp"
 #include "NovelMind/scripting/opcode.hpp"
 #include "NovelMind/scripting/value.hpp"
 #include <vector>
@@ -12,19 +13,42 @@
 namespace NovelMind::scripting
 {
 
+class ScriptProfiler;
+
 class VirtualMachine
 {
 public:
     using NativeCallback = std::function<void(const std::vector<Value>&)>;
 
+    /**
+     * @brief Called when execution reaches a breakpoint trap
+     * @return true to pause before the instruction, false to run on
+     */
+    using BreakHandler = std::function<bool(u32 ip)>;
+
     VirtualMachine();
     ~VirtualMachine();
 
+    /**
+     * @brief Verify and load a program
+     *
+     * Programs that fail BytecodeVerifier's structural checks are rejected.
+     * Stack-verified programs run without per-instruction bounds checks.
+     */
     Result<void> load(const std::vector<Instruction>& program,
                       const std::vector<std::string>& stringTable);
     void reset();
 
     bool step();
+
+    /**
+     * @brief Run until halted, waiting or paused, or until the instruction budget is spent
+     *
+     * Each call may execute up to VMSecurityLimits::maxInstructionsPerStep
+     * instructions, charged per basic block for verified programs. When the
+     * budget runs out, run() returns with isFuelExhausted() set; calling it
+     * again continues where it stopped.
+     */
     void run();
     void pause();
     void resume();
@@ -33,8 +57,21 @@ public:
     [[nodiscard]] bool isPaused() const;
     [[nodiscard]] bool isWaiting() const;
     [[nodiscard]] bool isHalted() const;
+    [[nodiscard]] bool isFuelExhausted() const { return m_fuelExhausted; }
     [[nodiscard]] u32 getIP() const { return m_ip; }
 
+    /**
+     * @brief Limits applied by the verifier at load() and to the run() budget
+     */
+    void setSecurityLimits(const VMSecurityLimits& limits) { m_limits = limits; }
+    [[nodiscard]] const VMSecurityLimits& getSecurityLimits() const { return m_limits; }
+
+    /**
+     * @brief Whether the loaded program passed the stack check and uses the unchecked path
+     */
+    [[nodiscard]] bool isVerified() const { return m_verification.stackVerified; }
+    [[nodiscard]] const BytecodeVerification& getVerification() const { return m_verification; }
+
     void setVariable(const std::string& name, Value value);
     [[nodiscard]] Value getVariable(const std::string& name) const;
     [[nodiscard]] bool hasVariable(const std::string& name) const;
@@ -42,13 +79,71 @@ public:
     void setFlag(const std::string& name, bool value);
     [[nodiscard]] bool getFlag(const std::string& name) const;
 
+    [[nodiscard]] const std::unordered_map<std::string, Value>& getVariables() const
+    {
+        return m_variables;
+    }
+    [[nodiscard]] const std::unordered_map<std::string, bool>& getFlags() const { return m_flags; }
+
     void registerCallback(OpCode op, NativeCallback callback);
 
+    /**
+     * @brief Count executed instructions and time host callbacks; nullptr disables
+     *
+     * The profiler must outlive the VM or be detached first.
+     */
+    void setProfiler(ScriptProfiler* profiler);
+    [[nodiscard]] ScriptProfiler* getProfiler() const { return m_profiler; }
+
+    /**
+     * @brief Patch a BREAK trap over the instruction at @p ip
+     *
+     * The original instruction is kept aside and runs when the trap declines
+     * or execution resumes from it, so unpatched code runs at full speed.
+     * Traps stay at their indices across load(); clear them before loading
+     * a different program.
+     */
+    Result<void> setBreakpoint(u32 ip);
+    void clearBreakpoint(u32 ip);
+    void clearBreakpoints();
+    [[nodiscard]] bool hasBreakpoint(u32 ip) const;
+    [[nodiscard]] usize getBreakpointCount() const { return m_breakOriginals.size(); }
+
+    /**
+     * @brief Decide at each trap whether to pause; without a handler every trap pauses
+     */
+    void setBreakHandler(BreakHandler handler);
+
+    /**
+     * @brief Instruction at @p ip as compiled, looking through breakpoint traps
+     */
+    [[nodiscard]] Instruction getInstruction(u32 ip) const;
+
+    /**
+     * @brief Run a standalone expression against the current variables and flags
+     *
+     * The code runs on the checked path with its own stack and may only hold
+     * expression opcodes; the script's position and stack are untouched.
+     */
+    Result<Value> evaluate(const std::vector<Instruction>& code,
+                           const std::vector<std::string>& stringTable);
+
     void signalContinue();
     void signalChoice(i32 choice);
 
 private:
+    // Checked == false relies on the program having been stack-verified
+    template <bool Checked>
     void executeInstruction(const Instruction& instr);
+    template <bool Checked>
+    Value take();
+    template <bool Checked>
+    [[nodiscard]] const std::string& stringOperand(u32 index) const;
+
+    void runChecked(usize fuel);
+    template <bool Profiled>
+    void runVerified(usize fuel);
+
     void push(Value value);
     Value pop();
     [[nodiscard]] const std::string& getString(u32 index) const;
@@ -59,13 +154,22 @@ private:
     std::unordered_map<std::string, Value> m_variables;
     std::unordered_map<std::string, bool> m_flags;
     std::unordered_map<OpCode, NativeCallback> m_callbacks;
+    std::unordered_map<u32, Instruction> m_breakOriginals;
+    BreakHandler m_breakHandler;
+    ScriptProfiler* m_profiler = nullptr;
+    VMSecurityLimits m_limits;
+    BytecodeVerification m_verification;
 
     u32 m_ip;
     bool m_running;
     bool m_paused;
     bool m_waiting;
     bool m_halted;
+    bool m_fuelExhausted = false;
     i32 m_choiceResult;
+
+    static constexpr u32 NO_BREAK = 0xFFFFFFFFu;
+    u32 m_resumeBreakIp = NO_BREAK; // Trap paused at; runs its original next
 };
 
 } // namespace NovelMind::scripting
@@ -0,0 +1,63 @@
+#pragma once
+
+/**
+ * @file binary_delta.hpp
+ * @brief Binary deltas between two versions of a resource
+ *
+ * A delta is a VCDIFF-style list of COPY (range of the base) and ADD
+ * (literal bytes) instructions. It records the 128-bit digest of the base it
+ * was made against, so applying it to any other content fails instead of
+ * producing garbage.
+ *
+ * Layout: DeltaHeader, then instructions
+ *   ADD:  0x00, varint length, bytes
+ *   COPY: 0x01, varint length, varint base offset
+ */
+
+#include "NovelMind/core/types.hpp"
+#include "NovelMind/core/result.hpp"
+#include "NovelMind/vfs/content_chunker.hpp"
+#include <vector>
+
+namespace NovelMind::vfs
+{
+
+constexpr u32 DELTA_MAGIC = 0x4C444D4E; // "NMDL" in little-endian
+
+struct DeltaHeader
+{
+    u32 magic;
+    u32 reserved;
+    u64 baseSize;
+    u64 targetSize;
+    ChunkDigest baseDigest;
+    ChunkDigest targetDigest;
+};
+
+class BinaryDelta
+{
+public:
+    /**
+     * @brief Matches shorter than this are emitted as literals
+     */
+    static constexpr usize MIN_MATCH = 16;
+
+    /**
+     * @brief Build a delta that turns @p base into @p target
+     */
+    [[nodiscard]] static std::vector<u8> create(const std::vector<u8>& base,
+                                                const std::vector<u8>& target);
+
+    /**
+     * @brief Apply a delta to the base it was created against
+     */
+    [[nodiscard]] static Result<std::vector<u8>> apply(const std::vector<u8>& base,
+                                                       const std::vector<u8>& delta);
+
+    /**
+     * @brief Read the header of a delta payload
+     */
+    [[nodiscard]] static Result<DeltaHeader> readHeader(const std::vector<u8>& delta);
+};
+
+} // namespace NovelMind::vfs
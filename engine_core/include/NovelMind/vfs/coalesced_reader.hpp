@@ -0,0 +1,69 @@
+#pragma once
+
+/**
+ * @file coalesced_reader.hpp
+ * @brief Batched positional reads with nearby ranges merged into one request
+ *
+ * A batch of (offset, size, destination) segments from one file is sorted by
+ * offset and grouped into spans: segments separated by no more than maxGap
+ * bytes share a span, so the device sees a few long sequential reads instead
+ * of one seek per resource. On Linux a span is a single preadv() scattering
+ * directly into the destinations (gap bytes land in a scratch buffer); other
+ * POSIX systems pread() the span and copy out, and the portable fallback uses
+ * std::ifstream.
+ */
+
+#include "NovelMind/core/types.hpp"
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace NovelMind::vfs
+{
+
+struct ReadSegment
+{
+    u64 offset = 0;     // Absolute file offset
+    u64 size = 0;
+    u8* dest = nullptr; // Receives exactly size bytes
+    u32 tag = 0;        // Caller data, e.g. the index of the owning request
+};
+
+struct CoalesceOptions
+{
+    u64 maxGap = 64 * 1024;         // Largest hole read through to join two segments
+    u64 maxSpan = 8 * 1024 * 1024;  // Upper bound on a single merged read
+    usize maxSegments = 512;        // Per span; keeps the iovec list under IOV_MAX
+};
+
+struct ReadSpan
+{
+    u64 offset = 0;
+    u64 size = 0;
+    usize firstSegment = 0;
+    usize segmentCount = 0;
+};
+
+class CoalescedReader
+{
+public:
+    /**
+     * @brief Sort @p segments by offset and group them into spans
+     *
+     * Spans reference contiguous ranges of the reordered segment list.
+     */
+    static std::vector<ReadSpan> plan(std::vector<ReadSegment>& segments,
+                                      const CoalesceOptions& options = {});
+
+    /**
+     * @brief Read every segment of @p path, in ascending offset order
+     *
+     * @p onSegment runs once per segment as soon as the span containing it has
+     * been read, with ok == false if the file could not be read.
+     */
+    static void read(const std::string& path, std::vector<ReadSegment>& segments,
+                     const CoalesceOptions& options,
+                     const std::function<void(const ReadSegment& segment, bool ok)>& onSegment);
+};
+
+} // namespace NovelMind::vfs
@@ -0,0 +1,78 @@
+#pragma once
+
+/**
+ * @file content_chunker.hpp
+ * @brief Content-defined chunking for resource packs
+ *
+ * Splits data at positions chosen by a rolling gear hash (FastCDC with
+ * normalized chunking), so an insertion or edit only changes the chunks
+ * around it. Chunks are identified by a 128-bit digest, which lets packs
+ * store shared byte ranges once and patch packs carry only changed chunks.
+ */
+
+#include "NovelMind/core/types.hpp"
+#include <vector>
+
+namespace NovelMind::vfs
+{
+
+/**
+ * @brief 128-bit content digest of a chunk
+ */
+struct ChunkDigest
+{
+    u64 lo = 0;
+    u64 hi = 0;
+
+    bool operator==(const ChunkDigest& other) const
+    {
+        return lo == other.lo && hi == other.hi;
+    }
+    bool operator!=(const ChunkDigest& other) const { return !(*this == other); }
+};
+
+struct ChunkDigestHash
+{
+    usize operator()(const ChunkDigest& digest) const
+    {
+        return static_cast<usize>(digest.lo ^ (digest.hi * 0x9E3779B97F4A7C15ull));
+    }
+};
+
+/**
+ * @brief Chunk size targets; sizes must satisfy min <= avg <= max
+ */
+struct ChunkerParams
+{
+    u32 minSize = 2 * 1024;
+    u32 avgSize = 8 * 1024;
+    u32 maxSize = 64 * 1024;
+};
+
+/**
+ * @brief A chunk within the input buffer
+ */
+struct ChunkSpan
+{
+    usize offset;
+    u32 size;
+};
+
+class ContentChunker
+{
+public:
+    /**
+     * @brief Split data into content-defined chunks
+     *
+     * Inputs no larger than minSize produce a single chunk.
+     */
+    [[nodiscard]] static std::vector<ChunkSpan> split(const u8* data, usize size,
+                                                      const ChunkerParams& params = {});
+
+    /**
+     * @brief Compute the digest identifying a chunk's content
+     */
+    [[nodiscard]] static ChunkDigest digest(const u8* data, usize size);
+};
+
+} // namespace NovelMind::vfs
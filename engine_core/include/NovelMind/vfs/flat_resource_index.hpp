@@ -0,0 +1,195 @@
+#pragma once
+
+/**
+ * @file flat_resource_index.hpp
+ * @brief Open-addressing hash table keyed by precomputed resource id hashes
+ *
+ * Slots live in one contiguous array and are probed linearly, so a lookup is
+ * a multiply, a shift and usually one cache line. Keys are the 64-bit
+ * ResourceId hash plus a pointer to an id string owned elsewhere; the string
+ * is only compared once a slot with the same hash is found. Erase uses
+ * backward shifting, so there are no tombstones and no periodic rebuilds.
+ */
+
+#include "NovelMind/core/types.hpp"
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace NovelMind::vfs
+{
+
+template <typename T>
+class FlatResourceIndex
+{
+public:
+    FlatResourceIndex() { rehash(16); }
+
+    /**
+     * @brief Find the value for an id; @p hash must be ResourceId::hashOf(id)
+     */
+    [[nodiscard]] const T* find(u64 hash, std::string_view id) const
+    {
+        for (usize i = home(hash);; i = (i + 1) & m_mask)
+        {
+            const Slot& slot = m_slots[i];
+            if (!slot.id)
+            {
+                return nullptr;
+            }
+            if (slot.hash == hash && *slot.id == id)
+            {
+                return &slot.value;
+            }
+        }
+    }
+
+    [[nodiscard]] T* find(u64 hash, std::string_view id)
+    {
+        return const_cast<T*>(std::as_const(*this).find(hash, id));
+    }
+
+    /**
+     * @brief Insert or replace the entry for an id
+     * @param id Key string; must outlive the entry and replaces any stored key pointer
+     */
+    void assign(u64 hash, const std::string* id, T value)
+    {
+        if ((m_size + 1) * 4 > m_slots.size() * 3)
+        {
+            rehash(m_slots.size() * 2);
+        }
+
+        for (usize i = home(hash);; i = (i + 1) & m_mask)
+        {
+            Slot& slot = m_slots[i];
+            if (!slot.id)
+            {
+                ++m_size;
+                slot.hash = hash;
+            }
+            else if (slot.hash != hash || *slot.id != *id)
+            {
+                continue;
+            }
+            slot.id = id;
+            slot.value = std::move(value);
+            return;
+        }
+    }
+
+    bool erase(u64 hash, std::string_view id)
+    {
+        usize i = home(hash);
+        for (;; i = (i + 1) & m_mask)
+        {
+            if (!m_slots[i].id)
+            {
+                return false;
+            }
+            if (m_slots[i].hash == hash && *m_slots[i].id == id)
+            {
+                break;
+            }
+        }
+
+        // Shift later members of the probe run back into the hole
+        usize hole = i;
+        for (usize j = (i + 1) & m_mask; m_slots[j].id; j = (j + 1) & m_mask)
+        {
+            const usize want = home(m_slots[j].hash);
+            if (((j - want) & m_mask) >= ((j - hole) & m_mask))
+            {
+                m_slots[hole] = std::move(m_slots[j]);
+                hole = j;
+            }
+        }
+        m_slots[hole] = Slot{};
+        --m_size;
+        return true;
+    }
+
+    void clear()
+    {
+        for (auto& slot : m_slots)
+        {
+            slot = Slot{};
+        }
+        m_size = 0;
+    }
+
+    void reserve(usize count)
+    {
+        usize capacity = m_slots.size();
+        while (count * 4 > capacity * 3)
+        {
+            capacity *= 2;
+        }
+        if (capacity != m_slots.size())
+        {
+            rehash(capacity);
+        }
+    }
+
+    [[nodiscard]] usize size() const { return m_size; }
+    [[nodiscard]] bool empty() const { return m_size == 0; }
+
+    template <typename Fn>
+    void forEach(Fn&& fn) const
+    {
+        for (const auto& slot : m_slots)
+        {
+            if (slot.id)
+            {
+                fn(*slot.id, slot.value);
+            }
+        }
+    }
+
+private:
+    struct Slot
+    {
+        u64 hash = 0;
+        const std::string* id = nullptr;
+        T value{};
+    };
+
+    [[nodiscard]] usize home(u64 hash) const
+    {
+        return static_cast<usize>((hash * 0x9E3779B97F4A7C15ull) >> m_shift);
+    }
+
+    void rehash(usize capacity)
+    {
+        std::vector<Slot> old = std::move(m_slots);
+        m_slots.assign(capacity, Slot{});
+        m_mask = capacity - 1;
+        m_shift = 64;
+        for (usize c = capacity; c > 1; c >>= 1)
+        {
+            --m_shift;
+        }
+
+        for (auto& slot : old)
+        {
+            if (!slot.id)
+            {
+                continue;
+            }
+            usize i = home(slot.hash);
+            while (m_slots[i].id)
+            {
+                i = (i + 1) & m_mask;
+            }
+            m_slots[i] = std::move(slot);
+        }
+    }
+
+    std::vector<Slot> m_slots;
+    usize m_mask = 0;
+    u32 m_shift = 64;
+    usize m_size = 0;
+};
+
+} // namespace NovelMind::vfs
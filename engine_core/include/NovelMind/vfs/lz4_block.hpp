@@ -0,0 +1,41 @@
+#pragma once
+
+/**
+ * @file lz4_block.hpp
+ * @brief LZ4 block format compression for resource payloads
+ *
+ * Produces and reads standard LZ4 blocks (no frame header), so payloads can
+ * also be inspected with stock LZ4 tools. The compressor is a single-pass
+ * greedy matcher tuned for speed rather than ratio; decompression is bounds
+ * checked and fails cleanly on corrupt input.
+ */
+
+#include "NovelMind/core/types.hpp"
+#include <vector>
+
+namespace NovelMind::vfs
+{
+
+class LZ4Block
+{
+public:
+    /**
+     * @brief Worst-case compressed size for @p inputSize bytes
+     */
+    [[nodiscard]] static usize compressBound(usize inputSize);
+
+    /**
+     * @brief Compress @p size bytes into a new block
+     */
+    [[nodiscard]] static std::vector<u8> compress(const u8* data, usize size);
+
+    /**
+     * @brief Decompress a block whose decompressed size is known
+     * @return false if the block is malformed or does not decode to exactly
+     *         @p outputSize bytes
+     */
+    [[nodiscard]] static bool decompress(const u8* block, usize blockSize, u8* output,
+                                         usize outputSize);
+};
+
+} // namespace NovelMind::vfs
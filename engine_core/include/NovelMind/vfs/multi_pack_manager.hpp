@@ -6,7 +6,7 @@
  *
  * Provides a hierarchical pack mounting system:
  * - Base pack: Core game content
- * - Patch packs: Bug fixes and updates
+ * - Patch packs: Bug fixes and updates, optionally as binary deltas
  * - DLC packs: Additional content
  * - Mod packs: User-created content
  * - Language packs: Localization resources
@@ -19,12 +19,19 @@
 #include "NovelMind/core/result.hpp"
 #include "NovelMind/vfs/virtual_fs.hpp"
 #include "NovelMind/vfs/pack_reader.hpp"
+#include "NovelMind/vfs/flat_resource_index.hpp"
+#include "NovelMind/vfs/resource_cache.hpp"
 #include <string>
 #include <memory>
 #include <vector>
 #include <functional>
 #include <unordered_map>
 #include <set>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
 
 namespace NovelMind::vfs
 {
@@ -110,6 +117,7 @@ struct DiscoveredPack
 using OnPackLoaded = std::function<void(const PackInfo&)>;
 using OnPackUnloaded = std::function<void(const std::string& packId)>;
 using OnResourceOverridden = std::function<void(const ResourceOverride&)>;
+using OnAsyncLoadCompleted = std::function<void(const PackLoadResult&)>;
 
 /**
  * @brief Multi-Pack Manager - Layered pack file management
@@ -235,6 +243,39 @@ public:
      */
     void setPackEnabled(const std::string& packId, bool enabled);
 
+    // =========================================================================
+    // Asynchronous Loading
+    // =========================================================================
+
+    /**
+     * @brief Open and parse a pack on a worker thread
+     *
+     * The pack goes live in the next processAsyncLoads() after it is ready, so
+     * the resource index only ever changes on the owning thread.
+     */
+    void loadPackAsync(const std::string& path, PackType type, i32 priority = 0);
+
+    /**
+     * @brief Discover the mods directory on a worker thread and load every mod found
+     *
+     * Mods keep their position in the current mod load order; new ones follow
+     * in path order.
+     */
+    void loadModsAsync();
+
+    /**
+     * @brief Publish packs that finished loading; call once per frame
+     * @return Results of the loads that completed since the last call
+     */
+    std::vector<PackLoadResult> processAsyncLoads();
+
+    [[nodiscard]] bool hasPendingAsyncLoads() const;
+
+    /**
+     * @brief Block until all queued async work is ready to publish
+     */
+    void waitForAsyncLoads();
+
     // =========================================================================
     // Pack Discovery
     // =========================================================================
@@ -306,10 +347,36 @@ public:
      */
     Result<std::vector<u8>> readResource(const std::string& resourceId);
 
+    /**
+     * @brief Read a resource using the id's precomputed hash
+     */
+    Result<std::vector<u8>> readResource(const VFS::ResourceId& resourceId);
+
+    /**
+     * @brief Read an image for a shot zoomed in by @p zoom
+     *
+     * With zoom upgrades enabled, the variant is chosen for the output scale
+     * times @p zoom, so a close-up loads a larger variant than the wide shot
+     * (pass Camera2D::getShotZoom()). Zoom below 1 never downgrades.
+     */
+    Result<std::vector<u8>> readResource(const std::string& resourceId, f32 zoom);
+
+    /**
+     * @brief Read a batch of resources (respecting priority)
+     *
+     * Ids are grouped by the pack that provides them and each group goes
+     * through PackReader::readFiles, so resources stored close together are
+     * fetched with one sequential read. Results arrive through @p onRead as
+     * they complete, in no particular order.
+     */
+    void readResources(const std::vector<std::string>& resourceIds,
+                       const BatchReadCallback& onRead);
+
     /**
      * @brief Check if a resource exists in any loaded pack
      */
     [[nodiscard]] bool exists(const std::string& resourceId) const;
+    [[nodiscard]] bool exists(const VFS::ResourceId& resourceId) const;
 
     /**
      * @brief Get resource info
@@ -331,11 +398,50 @@ public:
      */
     [[nodiscard]] std::vector<ResourceOverride> getActiveOverrides() const;
 
+    // =========================================================================
+    // Resolution Variants
+    // =========================================================================
+
+    /**
+     * @brief Set the output resolution relative to the authored resolution
+     *
+     * Texture reads then use the smallest variant (see resource_variants.hpp)
+     * that still covers the output: a 3840x2160 CG shown at 1920x1080 reads
+     * its "@2" variant. Only variants stored in the same pack as the winning
+     * original are used, so an override of the original is never replaced
+     * by a variant of what it overrides.
+     */
+    void setOutputResolution(u32 outputWidth, u32 outputHeight, u32 authoredWidth,
+                             u32 authoredHeight);
+    [[nodiscard]] f32 getOutputScale() const { return m_outputScale; }
+
+    /**
+     * @brief Whether readResource(id, zoom) may pick larger variants for zoomed-in shots
+     */
+    void setUpgradeOnZoom(bool enabled) { m_upgradeOnZoom = enabled; }
+    [[nodiscard]] bool isUpgradeOnZoomEnabled() const { return m_upgradeOnZoom; }
+
+    /**
+     * @brief The id actually read for @p resourceId at @p zoom
+     *
+     * A missing variant falls back to the next larger one and finally to
+     * the original.
+     */
+    [[nodiscard]] std::string resolveVariant(const std::string& resourceId, f32 zoom = 1.0f) const;
+
     /**
      * @brief Read resource from a specific pack (bypassing priority)
+     *
+     * Delta resources are still applied against the packs below it.
      */
     Result<std::vector<u8>> readResourceFromPack(const std::string& packId, const std::string& resourceId);
 
+    /**
+     * @brief Byte budget for cached results of applied delta resources
+     */
+    void setDeltaCacheSize(usize bytes);
+    [[nodiscard]] usize getDeltaCacheUsage() const;
+
     // =========================================================================
     // Mod Support
     // =========================================================================
@@ -396,17 +502,53 @@ public:
     void setOnPackLoaded(OnPackLoaded callback);
     void setOnPackUnloaded(OnPackUnloaded callback);
     void setOnResourceOverridden(OnResourceOverridden callback);
+    void setOnAsyncLoadCompleted(OnAsyncLoadCompleted callback);
 
 private:
     // Internal helpers
     PackLoadResult loadPackInternal(const std::string& path, PackType type, i32 priority);
     PackInfo readPackManifest(const std::string& path);
+    std::vector<DiscoveredPack> scanPackDirectory(const std::string& directory);
     void rebuildResourceIndex();
     i32 calculateEffectivePriority(PackType type, i32 basePriority) const;
     void firePackLoaded(const PackInfo& info);
     void firePackUnloaded(const std::string& packId);
     void fireResourceOverridden(const ResourceOverride& override);
 
+    struct LoadedPack;
+
+    // Thread-safe: touches no manager state, so it can run on mount workers
+    std::unique_ptr<LoadedPack> preparePack(const std::string& path, PackType type,
+                                            i32 priority, u64 loadSequence,
+                                            PackLoadResult& result);
+    void publishPack(std::unique_ptr<LoadedPack> pack, PackLoadResult& result);
+
+    void enqueueAsyncLoad(const std::string& path, PackType type, i32 priority);
+    void enqueueAsyncJob(std::function<void()> job);
+    void mountWorkerLoop();
+    void stopAsyncLoads();
+
+    // Winning provider of a resource id
+    struct IndexedResource
+    {
+        const LoadedPack* pack = nullptr;
+        PackReader::ResourceHandle handle;
+    };
+
+    bool outranks(const LoadedPack& a, const LoadedPack& b) const;
+    void updatePriorityOrder();
+    void indexPack(const LoadedPack& pack);
+    void unindexPack(const LoadedPack& pack);
+    Result<std::vector<u8>> readLookup(u64 hash, const std::string& resourceId, f32 zoom = 1.0f);
+    const IndexedResource* findVariant(const IndexedResource& original,
+                                       const std::string& resourceId, f32 zoom,
+                                       std::string& variantId) const;
+    Result<std::vector<u8>> readIndexed(const IndexedResource& resource,
+                                        const std::string& resourceId);
+    const LoadedPack* findDeltaBase(const LoadedPack* pack, const std::string& resourceId) const;
+    bool resolveExternalChunk(const LoadedPack* requester, const ChunkDigest& digest,
+                              u8* out, u32 size) const;
+
     // State
     bool m_initialized = false;
     std::string m_packDirectory;
@@ -418,14 +560,53 @@ private:
         PackInfo info;
         std::unique_ptr<PackReader> reader;
         i32 effectivePriority = 0;
+        u64 loadSequence = 0;   // Breaks priority ties: earlier loads win
         std::set<std::string> providedResources;
+
+        struct Resource
+        {
+            u64 hash;                // VFS::ResourceId::hashOf(*id)
+            const std::string* id;   // Points into providedResources
+            PackReader::ResourceHandle handle;
+        };
+        std::vector<Resource> resources;
     };
 
     std::vector<std::unique_ptr<LoadedPack>> m_packs;
     std::unordered_map<std::string, size_t> m_packIdToIndex;
 
-    // Resource index: resource ID -> pack index
-    std::unordered_map<std::string, size_t> m_resourceIndex;
+    // Resolution variants: output / authored size, and zoom-in upgrades
+    f32 m_outputScale = 1.0f;
+    bool m_upgradeOnZoom = true;
+
+    // Resource index: resource ID hash -> winning (pack, entry), updated
+    // incrementally as packs are loaded, unloaded, enabled or disabled
+    FlatResourceIndex<IndexedResource> m_resourceIndex;
+    std::atomic<u64> m_nextLoadSequence{0};
+
+    // Asynchronous loading: workers prepare packs, the owner publishes them
+    static constexpr u32 MAX_MOUNT_WORKERS = 4;
+
+    struct AsyncLoad
+    {
+        std::unique_ptr<LoadedPack> pack;
+        PackLoadResult result;
+    };
+
+    mutable std::mutex m_asyncMutex;
+    std::condition_variable m_asyncWork;
+    std::condition_variable m_asyncIdle;
+    std::deque<std::function<void()>> m_asyncJobs;
+    std::vector<AsyncLoad> m_asyncReady;
+    usize m_asyncInFlight = 0;  // Queued or running jobs
+    std::vector<std::thread> m_mountWorkers;
+    bool m_stopWorkers = false;
+
+    // Enabled packs by descending priority, searched for external chunks and delta bases
+    std::vector<const LoadedPack*> m_priorityOrder;
+
+    // Applied delta resources, keyed by "<pack id>:<resource id>"
+    VFS::ResourceCache m_deltaCache;
 
     // Mod load order
     std::vector<std::string> m_modLoadOrder;
@@ -434,6 +615,7 @@ private:
     OnPackLoaded m_onPackLoaded;
     OnPackUnloaded m_onPackUnloaded;
     OnResourceOverridden m_onResourceOverridden;
+    OnAsyncLoadCompleted m_onAsyncLoadCompleted;
 };
 
 } // namespace NovelMind::vfs
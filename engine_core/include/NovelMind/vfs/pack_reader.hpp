@@ -1,8 +1,11 @@
 #pragma once
 
 #include "NovelMind/vfs/virtual_fs.hpp"
+#include "NovelMind/vfs/coalesced_reader.hpp"
+#include "NovelMind/vfs/content_chunker.hpp"
 #include <unordered_map>
 #include <fstream>
+#include <functional>
 #include <mutex>
 
 namespace NovelMind::vfs
@@ -10,7 +13,7 @@ namespace NovelMind::vfs
 
 constexpr u32 PACK_MAGIC = 0x53524D4E;  // "NMRS" in little-endian
 constexpr u16 PACK_VERSION_MAJOR = 1;
-constexpr u16 PACK_VERSION_MINOR = 0;
+constexpr u16 PACK_VERSION_MINOR = 1;  // 1.1: optional chunk table
 
 struct PackHeader
 {
@@ -43,7 +46,48 @@ enum class PackFlags : u32
     None = 0,
     Encrypted = 1 << 0,
     Compressed = 1 << 1,
-    Signed = 1 << 2
+    Signed = 1 << 2,
+    Chunked = 1 << 3    // PackChunkTableHeader follows the PackHeader
+};
+
+/**
+ * @brief Per-resource flags (PackResourceEntry::flags)
+ *
+ * For a Chunked resource, dataOffset is the index of its first entry in the
+ * chunk reference table and compressedSize is the number of references.
+ * A Delta resource's data is a BinaryDelta payload against the same resource
+ * in a lower-priority pack; MultiPackManager applies it on read.
+ */
+enum class PackResourceFlags : u32
+{
+    None = 0,
+    Chunked = 1 << 0,
+    Delta = 1 << 1
+};
+
+/**
+ * @brief Chunk table location, stored right after PackHeader in chunked packs
+ */
+struct PackChunkTableHeader
+{
+    u32 chunkCount;
+    u32 refCount;
+    u64 chunkTableOffset;   // PackChunkEntry[chunkCount]
+    u64 refTableOffset;     // u32 chunk index[refCount]
+};
+
+enum class PackChunkFlags : u32
+{
+    None = 0,
+    External = 1 << 0   // Stored in another pack of the stack, found by digest
+};
+
+struct PackChunkEntry
+{
+    ChunkDigest digest;
+    u64 dataOffset;     // Relative to PackHeader::dataOffset
+    u32 size;
+    u32 flags;
 };
 
 class PackReader : public IVirtualFileSystem
@@ -59,6 +103,18 @@ public:
     [[nodiscard]] Result<std::vector<u8>> readFile(
         const std::string& resourceId) const override;
 
+    /**
+     * @brief Read a batch with nearby resources merged into sequential reads
+     *
+     * Requests are grouped by pack, ordered by file offset and read through
+     * CoalescedReader. Each result is delivered as soon as its last segment
+     * has arrived; callbacks run on the calling thread without the lock held.
+     */
+    void readFiles(const std::vector<std::string>& resourceIds,
+                   const BatchReadCallback& onRead) const override;
+
+    void setCoalesceOptions(const CoalesceOptions& options);
+
     [[nodiscard]] bool exists(const std::string& resourceId) const override;
 
     [[nodiscard]] std::optional<ResourceInfo> getInfo(
@@ -67,23 +123,103 @@ public:
     [[nodiscard]] std::vector<std::string> listResources(
         ResourceType type = ResourceType::Unknown) const override;
 
+    /**
+     * @brief Reference to a mounted resource entry, valid until its pack is unmounted
+     */
+    struct ResourceHandle
+    {
+        const void* pack = nullptr;
+        const PackResourceEntry* entry = nullptr;
+
+        explicit operator bool() const { return entry != nullptr; }
+        [[nodiscard]] bool isDelta() const
+        {
+            return entry && (entry->flags & static_cast<u32>(PackResourceFlags::Delta)) != 0;
+        }
+    };
+
+    [[nodiscard]] ResourceHandle findResource(const std::string& resourceId) const;
+
+    /**
+     * @brief Visit every mounted resource with its handle
+     */
+    void forEachResource(
+        const std::function<void(const std::string& resourceId, ResourceHandle handle)>& fn) const;
+
+    /**
+     * @brief Read a resource by handle, skipping the id lookup
+     */
+    [[nodiscard]] Result<std::vector<u8>> readResource(ResourceHandle handle) const;
+
+    /**
+     * @brief Whether the resource is stored as a delta (readFile returns the delta payload)
+     */
+    [[nodiscard]] bool isDeltaResource(const std::string& resourceId) const;
+
+    /**
+     * @brief Resolves chunks marked External; returns false if not found
+     */
+    using ChunkResolver = std::function<bool(const ChunkDigest& digest, u8* out, u32 size)>;
+
+    void setExternalChunkResolver(ChunkResolver resolver);
+
+    /**
+     * @brief Copy a locally stored chunk into @p out
+     */
+    [[nodiscard]] bool readChunk(const ChunkDigest& digest, u8* out, u32 size) const;
+
+    /**
+     * @brief Digests of all chunks stored in the mounted packs
+     */
+    [[nodiscard]] std::vector<ChunkDigest> getChunkDigests() const;
+
 private:
     struct MountedPack
     {
         std::string path;
+        u64 fileSize = 0;
         PackHeader header;
         std::unordered_map<std::string, PackResourceEntry> entries;
         std::vector<std::string> stringTable;
+
+        // Chunked packs only
+        PackChunkTableHeader chunkTable{};
+        std::vector<PackChunkEntry> chunks;
+        std::vector<u32> chunkRefs;
+        std::unordered_map<ChunkDigest, u32, ChunkDigestHash> localChunks;
+        mutable std::ifstream chunkStream; // Opened by the first readChunk
+    };
+
+    /**
+     * @brief Everything needed to read one resource, copied out under the lock
+     */
+    struct ResourceRead
+    {
+        std::string path;
+        u64 dataOffset = 0; // Absolute offset of the resource, or of the data section if chunked
+        PackResourceEntry entry{};
+        std::vector<PackChunkEntry> chunks; // Chunked resources only, in order
+        ChunkResolver resolver;
     };
 
     Result<void> readPackHeader(std::ifstream& file, PackHeader& header);
-    Result<void> readResourceTable(std::ifstream& file, MountedPack& pack);
-    Result<void> readStringTable(std::ifstream& file, MountedPack& pack);
+    Result<void> readResourceTable(std::ifstream& file, const PackHeader& header,
+                                   std::vector<PackResourceEntry>& entries, u64 fileSize);
+    Result<void> readStringTable(std::ifstream& file, MountedPack& pack, u64 fileSize);
+    Result<void> readChunkTable(std::ifstream& file, MountedPack& pack, u64 fileSize);
 
-    [[nodiscard]] Result<std::vector<u8>> readResourceData(
-        const std::string& packPath,
+    [[nodiscard]] Result<ResourceRead> planResourceRead(
+        const MountedPack& pack,
         const PackResourceEntry& entry) const;
 
+    [[nodiscard]] static Result<std::vector<u8>> readResourceData(const ResourceRead& read);
+
+    [[nodiscard]] static Result<std::vector<u8>> readChunkedResource(
+        std::ifstream& file, const ResourceRead& read);
+
+    ChunkResolver m_chunkResolver;
+    CoalesceOptions m_coalesceOptions;
+
     mutable std::mutex m_mutex;
     std::unordered_map<std::string, MountedPack> m_packs;
 };
@@ -0,0 +1,88 @@
+#pragma once
+
+/**
+ * @file pack_writer.hpp
+ * @brief Writes NMRS resource packs readable by PackReader
+ *
+ * With chunking enabled, resources are split by ContentChunker and every
+ * distinct chunk is stored once; resources become lists of chunk references.
+ * Chunks already present in a base pack can be recorded as External, so a
+ * patch or DLC pack only stores the chunks the base does not have.
+ */
+
+#include "NovelMind/core/types.hpp"
+#include "NovelMind/core/result.hpp"
+#include "NovelMind/vfs/content_chunker.hpp"
+#include "NovelMind/vfs/virtual_fs.hpp"
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace NovelMind::vfs
+{
+
+struct PackWriteStats
+{
+    usize resourceCount = 0;
+    usize chunkCount = 0;          // Distinct chunks in the chunk table
+    usize externalChunkCount = 0;  // Of which stored in a base pack
+    u64 inputBytes = 0;            // Sum of resource sizes
+    u64 storedBytes = 0;           // Bytes in the data section
+    u64 dedupedBytes = 0;          // Input bytes satisfied by an existing chunk
+};
+
+class PackWriter
+{
+public:
+    PackWriter() = default;
+
+    void setChunkingEnabled(bool enabled) { m_chunking = enabled; }
+    [[nodiscard]] bool isChunkingEnabled() const { return m_chunking; }
+
+    void setChunkerParams(const ChunkerParams& params) { m_params = params; }
+    [[nodiscard]] const ChunkerParams& getChunkerParams() const { return m_params; }
+
+    /**
+     * @brief Declare chunks available from a base pack (see PackReader::getChunkDigests)
+     *
+     * Matching chunks are written as External references instead of data.
+     */
+    void addBaseChunks(const std::vector<ChunkDigest>& digests);
+
+    /**
+     * @brief Add or replace a resource
+     */
+    void addResource(const std::string& id, ResourceType type, std::vector<u8> data);
+
+    /**
+     * @brief Add a resource stored as a BinaryDelta payload against a lower pack
+     */
+    void addDeltaResource(const std::string& id, ResourceType type, std::vector<u8> delta);
+
+    [[nodiscard]] usize getResourceCount() const { return m_resources.size(); }
+
+    void clear();
+
+    /**
+     * @brief Write the pack file
+     */
+    Result<PackWriteStats> write(const std::string& path) const;
+
+private:
+    struct PendingResource
+    {
+        std::string id;
+        ResourceType type;
+        std::vector<u8> data;
+        u32 flags = 0;
+    };
+
+    bool m_chunking = true;
+    ChunkerParams m_params;
+    std::vector<PendingResource> m_resources;
+    std::unordered_map<std::string, usize> m_resourceIndex;
+    std::unordered_set<ChunkDigest, ChunkDigestHash> m_baseChunks;
+};
+
+} // namespace NovelMind::vfs
@@ -0,0 +1,52 @@
+#pragma once
+
+/**
+ * @file patch_pack_builder.hpp
+ * @brief Builds minimal patch packs from two build outputs
+ *
+ * Compares an old and a new pack resource by resource:
+ * - Unchanged resources are left out
+ * - New resources are stored in full (sharing chunks with the old pack)
+ * - Changed resources are stored as a BinaryDelta against the old version
+ *   when the delta is small enough, otherwise in full
+ *
+ * Load the result as PackType::Patch above the old pack.
+ */
+
+#include "NovelMind/core/types.hpp"
+#include "NovelMind/core/result.hpp"
+#include <string>
+#include <vector>
+
+namespace NovelMind::vfs
+{
+
+struct PatchBuildOptions
+{
+    /// Use a delta only when it is at most this fraction of the new resource
+    f32 maxDeltaRatio = 0.5f;
+    /// Chunk full replacements and reference chunks already in the old pack
+    bool chunking = true;
+};
+
+struct PatchBuildStats
+{
+    usize unchangedCount = 0;
+    usize addedCount = 0;
+    usize deltaCount = 0;
+    usize replacedCount = 0;
+    u64 newBytes = 0;    // Total size of changed and added resources
+    u64 patchBytes = 0;  // Bytes stored in the patch data section
+    std::vector<std::string> removedResources; // Only in the old pack; not expressible
+};
+
+class PatchPackBuilder
+{
+public:
+    [[nodiscard]] static Result<PatchBuildStats> build(const std::string& oldPackPath,
+                                                       const std::string& newPackPath,
+                                                       const std::string& outputPath,
+                                                       const PatchBuildOptions& options = {});
+};
+
+} // namespace NovelMind::vfs
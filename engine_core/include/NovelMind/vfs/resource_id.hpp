@@ -2,6 +2,7 @@
 
 #include "NovelMind/core/types.hpp"
 #include <string>
+#include <string_view>
 #include <functional>
 
 namespace NovelMind::VFS
@@ -42,6 +43,11 @@ public:
 
     static ResourceType typeFromExtension(const std::string& path);
 
+    /**
+     * @brief The hash a ResourceId with this id would have
+     */
+    [[nodiscard]] static u64 hashOf(std::string_view id);
+
 private:
     void computeHash();
 
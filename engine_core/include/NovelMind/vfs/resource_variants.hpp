@@ -0,0 +1,48 @@
+#pragma once
+
+/**
+ * @file resource_variants.hpp
+ * @brief Naming and selection of downscaled resource variants
+ *
+ * An image may ship with half- and quarter-size variants next to its full
+ * resolution original. Variants are ordinary pack resources whose ids are
+ * the logical id followed by "@<divisor>" ("bg/park.png@2"); callers keep
+ * using the logical id and MultiPackManager substitutes the variant that
+ * matches the output resolution.
+ */
+
+#include "NovelMind/core/types.hpp"
+#include <string>
+#include <string_view>
+
+namespace NovelMind::vfs
+{
+
+/**
+ * @brief Divisors variants are generated for, smallest first
+ */
+inline constexpr u32 RESOURCE_VARIANT_DIVISORS[] = {2, 4};
+
+class ResourceVariants
+{
+public:
+    /**
+     * @brief Id of the 1/@p divisor variant of @p logicalId; divisor 1 is the id itself
+     */
+    [[nodiscard]] static std::string variantId(std::string_view logicalId, u32 divisor);
+
+    /**
+     * @brief Split a variant id into its logical id and divisor
+     * @return false if @p id does not name a variant
+     */
+    static bool parseVariantId(std::string_view id, std::string_view& logicalId,
+                               u32& divisor);
+
+    /**
+     * @brief Largest variant divisor that still provides @p requiredScale of
+     *        the original resolution (1 when only the original will do)
+     */
+    [[nodiscard]] static u32 divisorForScale(f32 requiredScale);
+};
+
+} // namespace NovelMind::vfs
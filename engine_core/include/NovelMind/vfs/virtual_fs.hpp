@@ -2,6 +2,7 @@
 
 #include "NovelMind/core/types.hpp"
 #include "NovelMind/core/result.hpp"
+#include <functional>
 #include <string>
 #include <vector>
 #include <optional>
@@ -30,6 +31,12 @@ struct ResourceInfo
     u32 checksum;
 };
 
+/**
+ * @brief Receives one result of a batched read
+ */
+using BatchReadCallback =
+    std::function<void(const std::string& resourceId, Result<std::vector<u8>> data)>;
+
 class IVirtualFileSystem
 {
 public:
@@ -42,6 +49,15 @@ public:
     [[nodiscard]] virtual Result<std::vector<u8>> readFile(
         const std::string& resourceId) const = 0;
 
+    /**
+     * @brief Read several resources, delivering each result as it completes
+     *
+     * Implementations may reorder and merge the underlying reads, so results
+     * can arrive in any order. The default reads one resource at a time.
+     */
+    virtual void readFiles(const std::vector<std::string>& resourceIds,
+                           const BatchReadCallback& onRead) const;
+
     [[nodiscard]] virtual bool exists(const std::string& resourceId) const = 0;
 
     [[nodiscard]] virtual std::optional<ResourceInfo> getInfo(
@@ -1,4 +1,5 @@
 #include "NovelMind/audio/audio_manager.hpp"
+#include "NovelMind/audio/voice_preloader.hpp"
 #include <algorithm>
 #include <cmath>
 
@@ -528,6 +529,10 @@ AudioHandle AudioManager::playVoice(const std::string& id, const VoiceConfig& co
         return {};
     }
 
+    if (m_voicePreloader)
+    {
+        source->preloadedHead = m_voicePreloader->acquire(id);
+    }
     source->setVolume(config.volume);
     source->setLoop(false);
     source->play();
@@ -547,6 +552,11 @@ AudioHandle AudioManager::playVoice(const std::string& id, const VoiceConfig& co
     return handle;
 }
 
+void AudioManager::setVoicePreloader(VoicePreloader* preloader)
+{
+    m_voicePreloader = preloader;
+}
+
 void AudioManager::stopVoice(f32 fadeDuration)
 {
     if (!m_currentVoiceHandle.isValid())
@@ -0,0 +1,542 @@
+#include "NovelMind/audio/voice_preloader.hpp"
+#include "NovelMind/core/logger.hpp"
+#include "NovelMind/vfs/virtual_fs.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+namespace NovelMind::audio
+{
+
+namespace
+{
+
+using scripting::Instruction;
+using scripting::OpCode;
+
+constexpr u16 WAVE_FORMAT_PCM = 1;
+constexpr u16 WAVE_FORMAT_IEEE_FLOAT = 3;
+constexpr u16 WAVE_FORMAT_EXTENSIBLE = 0xFFFE;
+
+u16 readLE16(const u8* p)
+{
+    return static_cast<u16>(p[0] | (p[1] << 8));
+}
+
+u32 readLE32(const u8* p)
+{
+    return static_cast<u32>(p[0]) | (static_cast<u32>(p[1]) << 8) |
+           (static_cast<u32>(p[2]) << 16) | (static_cast<u32>(p[3]) << 24);
+}
+
+i16 sampleToI16(const u8* p, u16 bits, bool isFloat)
+{
+    if (isFloat)
+    {
+        f32 value;
+        std::memcpy(&value, p, sizeof(value));
+        return static_cast<i16>(std::lround(std::clamp(value, -1.0f, 1.0f) * 32767.0f));
+    }
+    switch (bits)
+    {
+        case 8:
+            return static_cast<i16>((p[0] - 128) * 256);
+        case 16:
+            return static_cast<i16>(readLE16(p));
+        case 24:
+            return static_cast<i16>(readLE16(p + 1));
+        default:
+            return static_cast<i16>(readLE16(p + 2));
+    }
+}
+
+} // namespace
+
+VoicePreloader::VoicePreloader()
+    : m_resolver(&VoicePreloader::defaultVoiceId)
+{
+}
+
+VoicePreloader::~VoicePreloader()
+{
+    shutdown();
+}
+
+void VoicePreloader::setConfig(const VoicePreloadConfig& config)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_config = config;
+    m_config.poolSize = std::max<usize>(1, m_config.poolSize);
+    while (m_pool.size() > m_config.poolSize)
+    {
+        m_poolIndex.erase(m_pool.back()->voiceId);
+        m_pool.pop_back();
+    }
+}
+
+void VoicePreloader::setLoader(VoiceHeadLoader loader)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_loader = std::move(loader);
+}
+
+void VoicePreloader::setResolver(VoiceIdResolver resolver)
+{
+    m_resolver = resolver ? std::move(resolver) : VoiceIdResolver(&VoicePreloader::defaultVoiceId);
+}
+
+std::string VoicePreloader::defaultVoiceId(const VoiceLineRef& line)
+{
+    if (line.speaker.empty())
+    {
+        return {};
+    }
+    std::ostringstream id;
+    id << line.scene << "_" << line.speaker << "_" << std::setfill('0') << std::setw(3)
+       << line.sceneLineIndex;
+    return id.str();
+}
+
+VoiceIdResolver VoicePreloader::bindingResolver(std::unordered_map<std::string, std::string> bindings,
+                                                VoiceIdResolver lineId)
+{
+    if (!lineId)
+    {
+        lineId = &VoicePreloader::defaultVoiceId;
+    }
+    return [bindings = std::move(bindings), lineId = std::move(lineId)](const VoiceLineRef& line) {
+        auto it = bindings.find(lineId(line));
+        return it != bindings.end() ? it->second : std::string();
+    };
+}
+
+VoiceHeadLoader VoicePreloader::wavLoader(const vfs::IVirtualFileSystem& fileSystem)
+{
+    return [&fileSystem](const std::string& voiceId, f32 seconds) -> Result<VoiceClipHead> {
+        auto data = fileSystem.readFile(voiceId);
+        if (data.isError())
+        {
+            return Result<VoiceClipHead>::error(data.error());
+        }
+        auto head = decodeWavHead(data.value().data(), data.value().size(), seconds);
+        if (head.isOk())
+        {
+            head.value().voiceId = voiceId;
+        }
+        return head;
+    };
+}
+
+Result<VoiceClipHead> VoicePreloader::decodeWavHead(const u8* data, usize size, f32 seconds)
+{
+    if (!data || size < 12 || std::memcmp(data, "RIFF", 4) != 0 ||
+        std::memcmp(data + 8, "WAVE", 4) != 0)
+    {
+        return Result<VoiceClipHead>::error("Not a WAV file");
+    }
+
+    u16 format = 0;
+    u16 channels = 0;
+    u32 sampleRate = 0;
+    u16 bits = 0;
+    const u8* samples = nullptr;
+    usize dataSize = 0;
+
+    usize pos = 12;
+    while (size - pos >= 8)
+    {
+        const u32 chunkSize = readLE32(data + pos + 4);
+        const u8* chunk = data + pos + 8;
+        const usize available = size - pos - 8;
+        if (std::memcmp(data + pos, "fmt ", 4) == 0)
+        {
+            if (chunkSize < 16 || available < 16)
+            {
+                return Result<VoiceClipHead>::error("Invalid WAV format chunk");
+            }
+            format = readLE16(chunk);
+            channels = readLE16(chunk + 2);
+            sampleRate = readLE32(chunk + 4);
+            bits = readLE16(chunk + 14);
+            if (format == WAVE_FORMAT_EXTENSIBLE && chunkSize >= 26 && available >= 26)
+            {
+                format = readLE16(chunk + 24);
+            }
+        }
+        else if (std::memcmp(data + pos, "data", 4) == 0)
+        {
+            samples = chunk;
+            // Streams cut short (or written with a placeholder size) keep what is there
+            dataSize = std::min<usize>(chunkSize, available);
+            break;
+        }
+        // An odd-sized chunk is followed by a pad byte, which may itself be missing
+        if (available < chunkSize || available - chunkSize < (chunkSize & 1u))
+        {
+            break;
+        }
+        pos += 8 + chunkSize + (chunkSize & 1);
+    }
+
+    const bool isFloat = format == WAVE_FORMAT_IEEE_FLOAT && bits == 32;
+    if (!(format == WAVE_FORMAT_PCM && (bits == 8 || bits == 16 || bits == 24 || bits == 32)) &&
+        !isFloat)
+    {
+        return Result<VoiceClipHead>::error("Unsupported WAV encoding");
+    }
+    if (channels == 0 || sampleRate == 0 || !samples)
+    {
+        return Result<VoiceClipHead>::error("Invalid WAV file");
+    }
+
+    const usize frameBytes = static_cast<usize>(channels) * (bits / 8);
+    const usize frameCount = dataSize / frameBytes;
+    const usize wanted =
+        static_cast<usize>(std::lround(std::max(0.0, static_cast<f64>(seconds) * sampleRate)));
+    const usize headFrames = std::min(frameCount, wanted);
+
+    VoiceClipHead head;
+    head.sampleRate = sampleRate;
+    head.channels = channels;
+    head.clipDuration = static_cast<f32>(frameCount) / static_cast<f32>(sampleRate);
+    head.samples.resize(headFrames * channels);
+    const usize sampleBytes = bits / 8;
+    for (usize i = 0; i < head.samples.size(); ++i)
+    {
+        head.samples[i] = sampleToI16(samples + i * sampleBytes, bits, isFloat);
+    }
+    return Result<VoiceClipHead>::ok(std::move(head));
+}
+
+void VoicePreloader::setScript(const scripting::CompiledScript& script)
+{
+    clear();
+    m_program = script.instructions;
+    m_voiceIds.assign(m_program.size(), std::string{});
+
+    std::vector<std::pair<u32, const std::string*>> scenes;
+    scenes.reserve(script.sceneEntryPoints.size());
+    for (const auto& [name, entry] : script.sceneEntryPoints)
+    {
+        scenes.emplace_back(entry, &name);
+    }
+    std::sort(scenes.begin(), scenes.end());
+
+    // Scenes are assigned as for read tracking: by the closest entry point
+    usize nextScene = 0;
+    std::string_view scene;
+    u32 sceneLineIndex = 0;
+    for (u32 ip = 0; ip < m_program.size(); ++ip)
+    {
+        while (nextScene < scenes.size() && scenes[nextScene].first <= ip)
+        {
+            scene = *scenes[nextScene].second;
+            sceneLineIndex = 0;
+            ++nextScene;
+        }
+
+        const Instruction& instr = m_program[ip];
+        if (instr.opcode != OpCode::SAY || instr.operand >= script.stringTable.size())
+        {
+            continue;
+        }
+
+        // The compiler pushes the speaker name right before SAY
+        std::string_view speaker;
+        if (ip > 0 && m_program[ip - 1].opcode == OpCode::PUSH_STRING &&
+            m_program[ip - 1].operand < script.stringTable.size())
+        {
+            speaker = script.stringTable[m_program[ip - 1].operand];
+        }
+
+        const VoiceLineRef line{scene, speaker, script.stringTable[instr.operand],
+                                sceneLineIndex, ip};
+        m_voiceIds[ip] = m_resolver(line);
+        if (!speaker.empty())
+        {
+            ++sceneLineIndex;
+        }
+    }
+}
+
+const std::string& VoicePreloader::getVoiceId(u32 ip) const
+{
+    static const std::string none;
+    return ip < m_voiceIds.size() ? m_voiceIds[ip] : none;
+}
+
+std::vector<u32> VoicePreloader::findUpcomingLines(u32 ip) const
+{
+    struct Visit
+    {
+        u32 ip;
+        u32 lines; // SAYs passed on the way here
+    };
+
+    const u32 size = static_cast<u32>(m_program.size());
+    const u32 lookahead = m_config.lookahead;
+    std::vector<u32> found;
+    if (ip >= size || lookahead == 0)
+    {
+        return found;
+    }
+
+    // Breadth-first, so lines come out nearest first; an instruction is
+    // revisited only when reached past fewer lines than before
+    std::vector<u32> fewestLines(size, lookahead);
+    std::vector<bool> listed(size, false);
+    std::deque<Visit> queue{{ip, 0}};
+    u32 scanned = 0;
+    while (!queue.empty() && scanned < m_config.maxScanInstructions)
+    {
+        Visit visit = queue.front();
+        queue.pop_front();
+        if (visit.ip >= size || fewestLines[visit.ip] <= visit.lines)
+        {
+            continue;
+        }
+        fewestLines[visit.ip] = visit.lines;
+        ++scanned;
+
+        const Instruction& instr = m_program[visit.ip];
+        if (instr.opcode == OpCode::SAY)
+        {
+            if (!listed[visit.ip])
+            {
+                listed[visit.ip] = true;
+                found.push_back(visit.ip);
+            }
+            if (++visit.lines >= lookahead)
+            {
+                continue;
+            }
+        }
+
+        switch (instr.opcode)
+        {
+            case OpCode::HALT:
+            case OpCode::RETURN:
+                break;
+            case OpCode::JUMP:
+                queue.push_back({instr.operand, visit.lines});
+                break;
+            case OpCode::JUMP_IF:
+            case OpCode::JUMP_IF_NOT:
+                queue.push_back({visit.ip + 1, visit.lines});
+                queue.push_back({instr.operand, visit.lines});
+                break;
+            case OpCode::GOTO_SCENE:
+                // Operand is the target scene's entry; the VM itself
+                // currently falls through, so both are followed
+                queue.push_back({instr.operand, visit.lines});
+                queue.push_back({visit.ip + 1, visit.lines});
+                break;
+            default:
+                queue.push_back({visit.ip + 1, visit.lines});
+                break;
+        }
+    }
+    return found;
+}
+
+void VoicePreloader::preloadFrom(u32 ip)
+{
+    std::vector<std::string> wanted;
+    for (u32 line : findUpcomingLines(ip))
+    {
+        const std::string& id = m_voiceIds[line];
+        if (!id.empty() && std::find(wanted.begin(), wanted.end(), id) == wanted.end())
+        {
+            wanted.push_back(id);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // More lines than the pool holds would evict each other
+    if (wanted.size() > m_config.poolSize)
+    {
+        wanted.resize(m_config.poolSize);
+    }
+
+    for (const auto& id : m_queue)
+    {
+        m_loading.erase(id);
+    }
+    m_queue.clear();
+
+    // Keep loaded upcoming clips at the front of the pool, nearest first
+    for (auto it = wanted.rbegin(); it != wanted.rend(); ++it)
+    {
+        auto pooled = m_poolIndex.find(*it);
+        if (pooled != m_poolIndex.end())
+        {
+            m_pool.splice(m_pool.begin(), m_pool, pooled->second);
+        }
+    }
+
+    for (auto& id : wanted)
+    {
+        if (!m_poolIndex.count(id) && !m_loading.count(id) && !m_failed.count(id))
+        {
+            m_loading.insert(id);
+            m_queue.push_back(std::move(id));
+        }
+    }
+
+    if (!m_queue.empty())
+    {
+        if (!m_worker.joinable())
+        {
+            m_stopWorker = false;
+            m_worker = std::thread([this]() { workerLoop(); });
+        }
+        m_work.notify_one();
+    }
+}
+
+std::shared_ptr<const VoiceClipHead> VoicePreloader::acquire(const std::string& voiceId)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_poolIndex.find(voiceId);
+    if (it == m_poolIndex.end())
+    {
+        ++m_misses;
+        return nullptr;
+    }
+    ++m_hits;
+    m_pool.splice(m_pool.begin(), m_pool, it->second);
+    return *it->second;
+}
+
+bool VoicePreloader::isLoaded(const std::string& voiceId) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_poolIndex.count(voiceId) != 0;
+}
+
+bool VoicePreloader::hasPending() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return !m_loading.empty();
+}
+
+void VoicePreloader::waitForAll()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_idle.wait(lock, [this]() { return m_loading.empty() || !m_worker.joinable(); });
+}
+
+void VoicePreloader::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& id : m_queue)
+    {
+        m_loading.erase(id);
+    }
+    m_queue.clear();
+    m_failed.clear();
+    m_pool.clear();
+    m_poolIndex.clear();
+    ++m_generation;
+}
+
+void VoicePreloader::shutdown()
+{
+    std::thread worker;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopWorker = true;
+        worker.swap(m_worker);
+    }
+    m_work.notify_all();
+    if (worker.joinable())
+    {
+        worker.join();
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_queue.clear();
+    m_loading.clear();
+    m_idle.notify_all();
+}
+
+u64 VoicePreloader::getHitCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_hits;
+}
+
+u64 VoicePreloader::getMissCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_misses;
+}
+
+void VoicePreloader::workerLoop()
+{
+    for (;;)
+    {
+        std::string voiceId;
+        VoiceHeadLoader loader;
+        f32 seconds;
+        u64 generation;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_work.wait(lock, [this]() { return m_stopWorker || !m_queue.empty(); });
+            if (m_stopWorker)
+            {
+                return;
+            }
+            voiceId = std::move(m_queue.front());
+            m_queue.pop_front();
+            loader = m_loader;
+            seconds = m_config.headSeconds;
+            generation = m_generation;
+        }
+
+        Result<VoiceClipHead> head = loader
+                                         ? loader(voiceId, seconds)
+                                         : Result<VoiceClipHead>::error("No voice loader set");
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (generation == m_generation)
+        {
+            if (head.isOk())
+            {
+                VoiceClipHead clip = std::move(head).value();
+                clip.voiceId = voiceId;
+                insertLocked(std::make_shared<const VoiceClipHead>(std::move(clip)));
+            }
+            else
+            {
+                NOVELMIND_LOG_WARN("Failed to preload voice " + voiceId + ": " + head.error());
+                m_failed.insert(voiceId);
+            }
+        }
+        m_loading.erase(voiceId);
+        m_idle.notify_all();
+    }
+}
+
+void VoicePreloader::insertLocked(std::shared_ptr<const VoiceClipHead> head)
+{
+    const std::string id = head->voiceId;
+    auto existing = m_poolIndex.find(id);
+    if (existing != m_poolIndex.end())
+    {
+        m_pool.erase(existing->second);
+    }
+    // At most poolSize clips are upcoming and they sit at the front, so
+    // eviction only drops clips that are no longer ahead
+    m_pool.push_front(std::move(head));
+    m_poolIndex[id] = m_pool.begin();
+    while (m_pool.size() > m_config.poolSize)
+    {
+        m_poolIndex.erase(m_pool.back()->voiceId);
+        m_pool.pop_back();
+    }
+}
+
+} // namespace NovelMind::audio
@@ -4,6 +4,14 @@
 namespace NovelMind::renderer
 {
 
+namespace
+{
+
+// Advance of characters the font lacks, in em units
+constexpr f32 MISSING_GLYPH_ADVANCE = 0.5f;
+
+} // namespace
+
 Font::Font()
     : m_handle(nullptr)
     , m_size(0)
@@ -18,9 +26,13 @@ Font::~Font()
 Font::Font(Font&& other) noexcept
     : m_handle(other.m_handle)
     , m_size(other.m_size)
+    , m_metrics(std::move(other.m_metrics))
+    , m_pageLoader(std::move(other.m_pageLoader))
+    , m_pages(std::move(other.m_pages))
 {
     other.m_handle = nullptr;
     other.m_size = 0;
+    other.m_metrics = SdfFontMetrics{};
 }
 
 Font& Font::operator=(Font&& other) noexcept
@@ -30,8 +42,12 @@ Font& Font::operator=(Font&& other) noexcept
         destroy();
         m_handle = other.m_handle;
         m_size = other.m_size;
+        m_metrics = std::move(other.m_metrics);
+        m_pageLoader = std::move(other.m_pageLoader);
+        m_pages = std::move(other.m_pages);
         other.m_handle = nullptr;
         other.m_size = 0;
+        other.m_metrics = SdfFontMetrics{};
     }
     return *this;
 }
@@ -43,6 +59,20 @@ Result<void> Font::loadFromMemory(const std::vector<u8>& data, i32 size)
         return Result<void>::error("Invalid font data or size");
     }
 
+    if (SdfFontFormat::isSdfFont(data.data(), data.size()))
+    {
+        auto metrics = SdfFontFormat::decode(data.data(), data.size());
+        if (metrics.isError())
+        {
+            return Result<void>::error(metrics.error());
+        }
+        destroy();
+        m_metrics = std::move(metrics).value();
+        m_pages.resize(m_metrics.pageCount);
+        m_size = size;
+        return Result<void>::ok();
+    }
+
     // Font loading via FreeType is configured through the build system.
     // This placeholder stores the size for metric calculations.
     m_size = size;
@@ -59,6 +89,8 @@ void Font::destroy()
         m_handle = nullptr;
     }
     m_size = 0;
+    m_metrics = SdfFontMetrics{};
+    m_pages.clear();
 }
 
 bool Font::isValid() const
@@ -76,4 +108,99 @@ void* Font::getNativeHandle() const
     return m_handle;
 }
 
+bool Font::hasMetrics() const
+{
+    return !m_metrics.glyphs.empty();
+}
+
+const SdfFontMetrics& Font::getMetrics() const
+{
+    return m_metrics;
+}
+
+const SdfGlyph* Font::findGlyph(u32 codepoint) const
+{
+    const SdfGlyph* glyph = m_metrics.findGlyph(codepoint);
+    return glyph ? glyph : m_metrics.findGlyph('?');
+}
+
+f32 Font::getAdvance(u32 codepoint, f32 size) const
+{
+    const SdfGlyph* glyph = findGlyph(codepoint);
+    return (glyph ? glyph->advance : MISSING_GLYPH_ADVANCE) * size;
+}
+
+f32 Font::getKerning(u32 left, u32 right, f32 size) const
+{
+    return m_metrics.getKerning(left, right) * size;
+}
+
+f32 Font::getAscender(f32 size) const
+{
+    return m_metrics.ascender * size;
+}
+
+f32 Font::getDescender(f32 size) const
+{
+    return m_metrics.descender * size;
+}
+
+f32 Font::getLineHeight(f32 size) const
+{
+    return m_metrics.getLineHeight() * size;
+}
+
+void Font::setPageLoader(PageLoader loader)
+{
+    m_pageLoader = std::move(loader);
+}
+
+const Texture* Font::getPage(u32 page)
+{
+    if (page >= m_pages.size())
+    {
+        return nullptr;
+    }
+    if (m_pages[page])
+    {
+        return m_pages[page].get();
+    }
+    if (!m_pageLoader)
+    {
+        return nullptr;
+    }
+
+    auto data = m_pageLoader(page);
+    if (data.isError())
+    {
+        NOVELMIND_LOG_ERROR("Failed to load font page " + std::to_string(page) + ": " +
+                            data.error());
+        return nullptr;
+    }
+
+    auto texture = std::make_unique<Texture>();
+    auto loaded = texture->loadFromMemory(data.value());
+    if (loaded.isError())
+    {
+        NOVELMIND_LOG_ERROR("Failed to upload font page " + std::to_string(page) + ": " +
+                            loaded.error());
+        return nullptr;
+    }
+    m_pages[page] = std::move(texture);
+    return m_pages[page].get();
+}
+
+bool Font::isPageLoaded(u32 page) const
+{
+    return page < m_pages.size() && m_pages[page] != nullptr;
+}
+
+void Font::releasePages()
+{
+    for (auto& page : m_pages)
+    {
+        page.reset();
+    }
+}
+
 } // namespace NovelMind::renderer
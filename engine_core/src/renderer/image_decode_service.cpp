@@ -0,0 +1,133 @@
+#include "NovelMind/renderer/image_decode_service.hpp"
+#include "NovelMind/renderer/texture.hpp"
+#include <algorithm>
+
+namespace NovelMind::renderer
+{
+
+ImageDecodeService::~ImageDecodeService()
+{
+    shutdown();
+}
+
+u64 ImageDecodeService::submit(std::vector<u8> encoded, const ImageDecodeOptions& options,
+                               ImageDecodeCallback callback)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_workers.empty())
+    {
+        const u32 cores = std::max(1u, std::thread::hardware_concurrency());
+        const u32 workerCount = std::min(cores, MAX_WORKERS);
+        for (u32 i = 0; i < workerCount; ++i)
+        {
+            m_workers.emplace_back([this]() { workerLoop(); });
+        }
+    }
+
+    const u64 ticket = m_nextTicket++;
+    ++m_inFlight;
+    m_jobs.push_back(Job{ticket, std::move(encoded), options, std::move(callback)});
+    m_work.notify_one();
+    return ticket;
+}
+
+usize ImageDecodeService::processCompleted(usize maxCount)
+{
+    std::deque<Completed> ready;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (maxCount == 0 || maxCount >= m_completed.size())
+        {
+            ready.swap(m_completed);
+        }
+        else
+        {
+            for (usize i = 0; i < maxCount; ++i)
+            {
+                ready.push_back(std::move(m_completed.front()));
+                m_completed.pop_front();
+            }
+        }
+    }
+
+    for (auto& done : ready)
+    {
+        if (done.callback)
+        {
+            done.callback(std::move(done.result));
+        }
+    }
+    return ready.size();
+}
+
+bool ImageDecodeService::hasPending() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_inFlight > 0 || !m_completed.empty();
+}
+
+void ImageDecodeService::waitForAll()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_idle.wait(lock, [this]() { return m_inFlight == 0; });
+}
+
+void ImageDecodeService::shutdown()
+{
+    std::vector<std::thread> workers;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopWorkers = true;
+        workers.swap(m_workers);
+    }
+    m_work.notify_all();
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_jobs.clear();
+    m_completed.clear();
+    m_inFlight = 0;
+    m_stopWorkers = false;
+    m_idle.notify_all();
+}
+
+Result<void> ImageDecodeService::upload(const DecodedImage& image, Texture& texture)
+{
+    if (image.pixelOrder != PixelOrder::RGBA)
+    {
+        return Result<void>::error("Texture uploads expect RGBA pixel order");
+    }
+    return texture.loadFromRGBA(image.pixels.data(), static_cast<i32>(image.width),
+                                static_cast<i32>(image.height), image.premultiplied);
+}
+
+void ImageDecodeService::workerLoop()
+{
+    for (;;)
+    {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_work.wait(lock, [this]() { return m_stopWorkers || !m_jobs.empty(); });
+            if (m_stopWorkers)
+            {
+                return;
+            }
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+        }
+
+        auto result = ImageDecoder::decode(job.encoded.data(), job.encoded.size(), job.options);
+        job.encoded = {};
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_completed.push_back(Completed{job.ticket, std::move(result), std::move(job.callback)});
+        --m_inFlight;
+        m_idle.notify_all();
+    }
+}
+
+} // namespace NovelMind::renderer
@@ -0,0 +1,994 @@
+#include "NovelMind/renderer/image_decoder.hpp"
+#include "NovelMind/renderer/image_kernels.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <cstring>
+
+namespace NovelMind::renderer
+{
+
+namespace
+{
+
+constexpr u8 PNG_SIGNATURE[8] = {137, 80, 78, 71, 13, 10, 26, 10};
+constexpr u8 QOI_MAGIC[4] = {'q', 'o', 'i', 'f'};
+
+// Refuse dimensions that could not be a real asset before allocating
+constexpr u64 MAX_PIXELS = u64{1} << 28;
+
+u32 readBE32(const u8* p)
+{
+    return (static_cast<u32>(p[0]) << 24) | (static_cast<u32>(p[1]) << 16) |
+           (static_cast<u32>(p[2]) << 8) | static_cast<u32>(p[3]);
+}
+
+// ---------------------------------------------------------------------------
+// Inflate (RFC 1950/1951)
+// ---------------------------------------------------------------------------
+
+class BitReader
+{
+public:
+    BitReader(const u8* data, usize size) : m_data(data), m_size(size) {}
+
+    void refill()
+    {
+        while (m_count <= 56)
+        {
+            const u64 byte = m_pos < m_size ? m_data[m_pos] : 0;
+            m_buffer |= byte << m_count;
+            ++m_pos;
+            m_count += 8;
+        }
+    }
+
+    u32 peek() const { return static_cast<u32>(m_buffer); }
+
+    void consume(u32 count)
+    {
+        m_buffer >>= count;
+        m_count -= count;
+    }
+
+    u32 bits(u32 count)
+    {
+        if (m_count < count)
+        {
+            refill();
+        }
+        const u32 value = static_cast<u32>(m_buffer & ((u64{1} << count) - 1));
+        consume(count);
+        return value;
+    }
+
+    void ensure(u32 count)
+    {
+        if (m_count < count)
+        {
+            refill();
+        }
+    }
+
+    // Drop buffered bits up to the next byte boundary and rewind the byte
+    // position to the first unconsumed byte, for stored blocks
+    void alignToByte()
+    {
+        consume(m_count % 8);
+        m_pos -= m_count / 8;
+        m_buffer = 0;
+        m_count = 0;
+    }
+
+    [[nodiscard]] usize position() const { return m_pos; }
+    void skip(usize bytes) { m_pos += bytes; }
+    [[nodiscard]] const u8* data() const { return m_data; }
+    [[nodiscard]] usize size() const { return m_size; }
+
+    // True once more bits were consumed than the input holds
+    [[nodiscard]] bool overrun() const
+    {
+        return static_cast<u64>(m_pos) * 8 - m_count > static_cast<u64>(m_size) * 8;
+    }
+
+private:
+    const u8* m_data;
+    usize m_size;
+    usize m_pos = 0;
+    u64 m_buffer = 0;
+    u32 m_count = 0;
+};
+
+constexpr u32 FAST_BITS = 9;
+constexpr u32 FAST_MASK = (1u << FAST_BITS) - 1;
+
+struct Huffman
+{
+    u16 fast[1u << FAST_BITS];
+    u16 firstCode[16];
+    u32 maxCode[17];
+    u16 firstSymbol[16];
+    u8 size[288];
+    u16 value[288];
+};
+
+u32 reverseBits(u32 value, u32 count)
+{
+    u32 result = 0;
+    for (u32 i = 0; i < count; ++i)
+    {
+        result = (result << 1) | (value & 1);
+        value >>= 1;
+    }
+    return result;
+}
+
+bool buildHuffman(Huffman& h, const u8* lengths, u32 count)
+{
+    u32 lengthCounts[17] = {};
+    std::memset(h.fast, 0, sizeof(h.fast));
+    for (u32 i = 0; i < count; ++i)
+    {
+        ++lengthCounts[lengths[i]];
+    }
+    lengthCounts[0] = 0;
+    for (u32 i = 1; i < 16; ++i)
+    {
+        if (lengthCounts[i] > (1u << i))
+        {
+            return false;
+        }
+    }
+
+    u32 nextCode[16] = {};
+    u32 code = 0;
+    u32 symbol = 0;
+    for (u32 i = 1; i < 16; ++i)
+    {
+        nextCode[i] = code;
+        h.firstCode[i] = static_cast<u16>(code);
+        h.firstSymbol[i] = static_cast<u16>(symbol);
+        code += lengthCounts[i];
+        if (lengthCounts[i] != 0 && code - 1 >= (1u << i))
+        {
+            return false;
+        }
+        h.maxCode[i] = code << (16 - i);
+        code <<= 1;
+        symbol += lengthCounts[i];
+    }
+    h.maxCode[16] = 0x10000;
+
+    for (u32 i = 0; i < count; ++i)
+    {
+        const u32 length = lengths[i];
+        if (length == 0)
+        {
+            continue;
+        }
+        const u32 slot = nextCode[length] - h.firstCode[length] + h.firstSymbol[length];
+        h.size[slot] = static_cast<u8>(length);
+        h.value[slot] = static_cast<u16>(i);
+        if (length <= FAST_BITS)
+        {
+            const u16 entry = static_cast<u16>((length << 9) | i);
+            for (u32 j = reverseBits(nextCode[length], length); j < (1u << FAST_BITS);
+                 j += 1u << length)
+            {
+                h.fast[j] = entry;
+            }
+        }
+        ++nextCode[length];
+    }
+    return true;
+}
+
+// Returns the decoded symbol, or -1 for an invalid code
+i32 decodeSymbol(BitReader& reader, const Huffman& h)
+{
+    reader.ensure(16);
+    const u32 bits = reader.peek();
+    const u32 fast = h.fast[bits & FAST_MASK];
+    if (fast != 0)
+    {
+        reader.consume(fast >> 9);
+        return static_cast<i32>(fast & 511);
+    }
+
+    // Canonical codes compare in bit-reversed order
+    const u32 reversed = reverseBits(bits & 0xFFFF, 16);
+    u32 length = FAST_BITS + 1;
+    while (length < 16 && reversed >= h.maxCode[length])
+    {
+        ++length;
+    }
+    if (length >= 16)
+    {
+        return -1;
+    }
+    const u32 slot = (reversed >> (16 - length)) - h.firstCode[length] + h.firstSymbol[length];
+    if (slot >= 288 || h.size[slot] != length)
+    {
+        return -1;
+    }
+    reader.consume(length);
+    return h.value[slot];
+}
+
+constexpr u16 LENGTH_BASE[29] = {3,  4,  5,  6,  7,  8,  9,  10, 11,  13,  15,  17,  19,  23, 27,
+                                 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+constexpr u8 LENGTH_EXTRA[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2,
+                                 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+constexpr u16 DIST_BASE[30] = {1,    2,    3,    4,    5,    7,     9,     13,    17,  25,
+                               33,   49,   65,   97,   129,  193,   257,   385,   513, 769,
+                               1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+constexpr u8 DIST_EXTRA[30] = {0, 0, 0, 0, 1, 1, 2, 2,  3,  3,  4,  4,  5,  5,  6,
+                               6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+bool inflateCodes(BitReader& reader, const Huffman& lit, const Huffman& dist, u8* out,
+                  usize outSize, usize& pos)
+{
+    for (;;)
+    {
+        const i32 symbol = decodeSymbol(reader, lit);
+        if (symbol < 0 || reader.overrun())
+        {
+            return false;
+        }
+        if (symbol < 256)
+        {
+            if (pos >= outSize)
+            {
+                return false;
+            }
+            out[pos++] = static_cast<u8>(symbol);
+            continue;
+        }
+        if (symbol == 256)
+        {
+            return true;
+        }
+
+        const u32 lengthCode = static_cast<u32>(symbol) - 257;
+        if (lengthCode >= 29)
+        {
+            return false;
+        }
+        reader.ensure(32);
+        const usize length = LENGTH_BASE[lengthCode] + reader.bits(LENGTH_EXTRA[lengthCode]);
+
+        const i32 distCode = decodeSymbol(reader, dist);
+        if (distCode < 0 || distCode >= 30)
+        {
+            return false;
+        }
+        const usize distance = DIST_BASE[distCode] + reader.bits(DIST_EXTRA[distCode]);
+        if (distance > pos || length > outSize - pos || reader.overrun())
+        {
+            return false;
+        }
+
+        u8* dst = out + pos;
+        const u8* src = dst - distance;
+        if (distance >= length)
+        {
+            std::memcpy(dst, src, length);
+        }
+        else
+        {
+            for (usize i = 0; i < length; ++i)
+            {
+                dst[i] = src[i];
+            }
+        }
+        pos += length;
+    }
+}
+
+bool buildFixedTables(Huffman& lit, Huffman& dist)
+{
+    u8 lengths[288];
+    std::fill(lengths, lengths + 144, u8{8});
+    std::fill(lengths + 144, lengths + 256, u8{9});
+    std::fill(lengths + 256, lengths + 280, u8{7});
+    std::fill(lengths + 280, lengths + 288, u8{8});
+    u8 distLengths[30];
+    std::fill(distLengths, distLengths + 30, u8{5});
+    return buildHuffman(lit, lengths, 288) && buildHuffman(dist, distLengths, 30);
+}
+
+bool readDynamicTables(BitReader& reader, Huffman& lit, Huffman& dist)
+{
+    static constexpr u8 ORDER[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5,
+                                     11, 4,  12, 3, 13, 2, 14, 1, 15};
+
+    const u32 literalCount = reader.bits(5) + 257;
+    const u32 distanceCount = reader.bits(5) + 1;
+    const u32 codeLengthCount = reader.bits(4) + 4;
+    if (literalCount > 286 || distanceCount > 30)
+    {
+        return false;
+    }
+
+    u8 codeLengthLengths[19] = {};
+    for (u32 i = 0; i < codeLengthCount; ++i)
+    {
+        codeLengthLengths[ORDER[i]] = static_cast<u8>(reader.bits(3));
+    }
+    Huffman codeLengths;
+    if (!buildHuffman(codeLengths, codeLengthLengths, 19))
+    {
+        return false;
+    }
+
+    u8 lengths[286 + 30] = {};
+    const u32 total = literalCount + distanceCount;
+    u32 n = 0;
+    while (n < total)
+    {
+        const i32 symbol = decodeSymbol(reader, codeLengths);
+        if (symbol < 0 || reader.overrun())
+        {
+            return false;
+        }
+        if (symbol < 16)
+        {
+            lengths[n++] = static_cast<u8>(symbol);
+            continue;
+        }
+
+        u8 fill = 0;
+        u32 repeat = 0;
+        if (symbol == 16)
+        {
+            if (n == 0)
+            {
+                return false;
+            }
+            fill = lengths[n - 1];
+            repeat = reader.bits(2) + 3;
+        }
+        else if (symbol == 17)
+        {
+            repeat = reader.bits(3) + 3;
+        }
+        else
+        {
+            repeat = reader.bits(7) + 11;
+        }
+        if (repeat > total - n)
+        {
+            return false;
+        }
+        std::fill(lengths + n, lengths + n + repeat, fill);
+        n += repeat;
+    }
+
+    if (lengths[256] == 0)
+    {
+        return false;
+    }
+    return buildHuffman(lit, lengths, literalCount) &&
+           buildHuffman(dist, lengths + literalCount, distanceCount);
+}
+
+// Inflate a zlib stream into exactly outSize bytes
+bool zlibInflate(const u8* data, usize size, u8* out, usize outSize)
+{
+    if (size < 2)
+    {
+        return false;
+    }
+    const u32 cmf = data[0];
+    const u32 flg = data[1];
+    if ((cmf & 0x0F) != 8 || (cmf * 256 + flg) % 31 != 0 || (flg & 0x20) != 0)
+    {
+        return false;
+    }
+
+    BitReader reader(data + 2, size - 2);
+    Huffman lit;
+    Huffman dist;
+    usize pos = 0;
+    bool last = false;
+    while (!last)
+    {
+        reader.ensure(3);
+        last = reader.bits(1) != 0;
+        const u32 type = reader.bits(2);
+        if (type == 0)
+        {
+            reader.alignToByte();
+            const usize at = reader.position();
+            if (at + 4 > reader.size())
+            {
+                return false;
+            }
+            const u8* header = reader.data() + at;
+            const usize length = static_cast<usize>(header[0] | (header[1] << 8));
+            const usize check = static_cast<usize>(header[2] | (header[3] << 8));
+            if ((length ^ 0xFFFF) != check || at + 4 + length > reader.size() ||
+                length > outSize - pos)
+            {
+                return false;
+            }
+            std::memcpy(out + pos, header + 4, length);
+            pos += length;
+            reader.skip(4 + length);
+        }
+        else if (type == 1)
+        {
+            if (!buildFixedTables(lit, dist) ||
+                !inflateCodes(reader, lit, dist, out, outSize, pos))
+            {
+                return false;
+            }
+        }
+        else if (type == 2)
+        {
+            if (!readDynamicTables(reader, lit, dist) ||
+                !inflateCodes(reader, lit, dist, out, outSize, pos))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return pos == outSize && !reader.overrun();
+}
+
+// ---------------------------------------------------------------------------
+// PNG
+// ---------------------------------------------------------------------------
+
+u8 paeth(i32 a, i32 b, i32 c)
+{
+    const i32 p = a + b - c;
+    const i32 pa = std::abs(p - a);
+    const i32 pb = std::abs(p - b);
+    const i32 pc = std::abs(p - c);
+    if (pa <= pb && pa <= pc)
+    {
+        return static_cast<u8>(a);
+    }
+    return static_cast<u8>(pb <= pc ? b : c);
+}
+
+bool unfilterRow(u8 filter, u8* row, const u8* previous, usize rowBytes, usize bpp)
+{
+    switch (filter)
+    {
+    case 0:
+        return true;
+    case 1:
+        for (usize i = bpp; i < rowBytes; ++i)
+        {
+            row[i] = static_cast<u8>(row[i] + row[i - bpp]);
+        }
+        return true;
+    case 2:
+        for (usize i = 0; i < rowBytes; ++i)
+        {
+            row[i] = static_cast<u8>(row[i] + previous[i]);
+        }
+        return true;
+    case 3:
+        for (usize i = 0; i < bpp; ++i)
+        {
+            row[i] = static_cast<u8>(row[i] + (previous[i] >> 1));
+        }
+        for (usize i = bpp; i < rowBytes; ++i)
+        {
+            row[i] = static_cast<u8>(row[i] + ((row[i - bpp] + previous[i]) >> 1));
+        }
+        return true;
+    case 4:
+        for (usize i = 0; i < bpp; ++i)
+        {
+            row[i] = static_cast<u8>(row[i] + previous[i]);
+        }
+        for (usize i = bpp; i < rowBytes; ++i)
+        {
+            row[i] = static_cast<u8>(row[i] + paeth(row[i - bpp], previous[i], previous[i - bpp]));
+        }
+        return true;
+    default:
+        return false;
+    }
+}
+
+struct PngInfo
+{
+    u32 width = 0;
+    u32 height = 0;
+    u32 bitDepth = 0;
+    u32 colorType = 0;
+    u32 channels = 0;
+    std::array<u8, 256 * 4> palette{};
+    u32 paletteSize = 0;
+    bool hasColorKey = false;
+    u16 colorKey[3] = {};
+};
+
+// Sample @p index of a row at the image bit depth, unscaled
+u32 sampleAt(const u8* row, usize index, u32 bitDepth)
+{
+    switch (bitDepth)
+    {
+    case 8:
+        return row[index];
+    case 16:
+        return (static_cast<u32>(row[index * 2]) << 8) | row[index * 2 + 1];
+    default:
+    {
+        const usize bit = index * bitDepth;
+        const u32 shift = 8 - bitDepth - static_cast<u32>(bit % 8);
+        return (row[bit / 8] >> shift) & ((1u << bitDepth) - 1);
+    }
+    }
+}
+
+void expandRow(const PngInfo& info, const u8* row, u8* out)
+{
+    const u32 width = info.width;
+    const u32 depth = info.bitDepth;
+
+    // Fast paths for the common 8-bit layouts
+    if (depth == 8 && info.colorType == 6)
+    {
+        std::memcpy(out, row, static_cast<usize>(width) * 4);
+        return;
+    }
+    if (depth == 8 && info.colorType == 2 && !info.hasColorKey)
+    {
+        for (u32 x = 0; x < width; ++x)
+        {
+            out[x * 4 + 0] = row[x * 3 + 0];
+            out[x * 4 + 1] = row[x * 3 + 1];
+            out[x * 4 + 2] = row[x * 3 + 2];
+            out[x * 4 + 3] = 255;
+        }
+        return;
+    }
+
+    // Scale a sample to 8 bits: take the high byte of 16-bit samples and
+    // replicate low bit depths across the byte
+    const u32 maxValue = (1u << depth) - 1;
+    auto to8 = [depth, maxValue](u32 value) -> u8 {
+        if (depth == 16)
+        {
+            return static_cast<u8>(value >> 8);
+        }
+        return static_cast<u8>(value * 255 / maxValue);
+    };
+
+    for (u32 x = 0; x < width; ++x)
+    {
+        u8* p = out + static_cast<usize>(x) * 4;
+        switch (info.colorType)
+        {
+        case 0:
+        {
+            const u32 gray = sampleAt(row, x, depth);
+            p[0] = p[1] = p[2] = to8(gray);
+            p[3] = info.hasColorKey && gray == info.colorKey[0] ? 0 : 255;
+            break;
+        }
+        case 2:
+        {
+            const usize i = static_cast<usize>(x) * 3;
+            const u32 r = sampleAt(row, i, depth);
+            const u32 g = sampleAt(row, i + 1, depth);
+            const u32 b = sampleAt(row, i + 2, depth);
+            p[0] = to8(r);
+            p[1] = to8(g);
+            p[2] = to8(b);
+            p[3] = info.hasColorKey && r == info.colorKey[0] && g == info.colorKey[1] &&
+                           b == info.colorKey[2]
+                       ? 0
+                       : 255;
+            break;
+        }
+        case 3:
+        {
+            // Out-of-range indices read as opaque black
+            const u32 index = sampleAt(row, x, depth);
+            if (index < info.paletteSize)
+            {
+                std::memcpy(p, info.palette.data() + index * 4, 4);
+            }
+            else
+            {
+                p[0] = p[1] = p[2] = 0;
+                p[3] = 255;
+            }
+            break;
+        }
+        case 4:
+        {
+            const usize i = static_cast<usize>(x) * 2;
+            p[0] = p[1] = p[2] = to8(sampleAt(row, i, depth));
+            p[3] = to8(sampleAt(row, i + 1, depth));
+            break;
+        }
+        default: // 6, 16-bit
+        {
+            const usize i = static_cast<usize>(x) * 4;
+            p[0] = to8(sampleAt(row, i, depth));
+            p[1] = to8(sampleAt(row, i + 1, depth));
+            p[2] = to8(sampleAt(row, i + 2, depth));
+            p[3] = to8(sampleAt(row, i + 3, depth));
+            break;
+        }
+        }
+    }
+}
+
+bool validDepth(u32 colorType, u32 depth)
+{
+    switch (colorType)
+    {
+    case 0:
+        return depth == 1 || depth == 2 || depth == 4 || depth == 8 || depth == 16;
+    case 3:
+        return depth == 1 || depth == 2 || depth == 4 || depth == 8;
+    case 2:
+    case 4:
+    case 6:
+        return depth == 8 || depth == 16;
+    default:
+        return false;
+    }
+}
+
+u32 channelsFor(u32 colorType)
+{
+    switch (colorType)
+    {
+    case 2:
+        return 3;
+    case 4:
+        return 2;
+    case 6:
+        return 4;
+    default:
+        return 1;
+    }
+}
+
+} // namespace
+
+ImageFormat ImageDecoder::detectFormat(const u8* data, usize size)
+{
+    if (!data)
+    {
+        return ImageFormat::Unknown;
+    }
+    if (size >= sizeof(PNG_SIGNATURE) &&
+        std::memcmp(data, PNG_SIGNATURE, sizeof(PNG_SIGNATURE)) == 0)
+    {
+        return ImageFormat::PNG;
+    }
+    if (size >= sizeof(QOI_MAGIC) && std::memcmp(data, QOI_MAGIC, sizeof(QOI_MAGIC)) == 0)
+    {
+        return ImageFormat::QOI;
+    }
+    return ImageFormat::Unknown;
+}
+
+Result<DecodedImage> ImageDecoder::decode(const u8* data, usize size,
+                                          const ImageDecodeOptions& options)
+{
+    Result<DecodedImage> result = Result<DecodedImage>::error("Unrecognized image format");
+    switch (detectFormat(data, size))
+    {
+    case ImageFormat::PNG:
+        result = decodePNG(data, size);
+        break;
+    case ImageFormat::QOI:
+        result = decodeQOI(data, size);
+        break;
+    case ImageFormat::Unknown:
+        return result;
+    }
+
+    if (result.isOk())
+    {
+        process(result.value(), options);
+    }
+    return result;
+}
+
+Result<DecodedImage> ImageDecoder::decodePNG(const u8* data, usize size)
+{
+    if (detectFormat(data, size) != ImageFormat::PNG)
+    {
+        return Result<DecodedImage>::error("Not a PNG image");
+    }
+
+    PngInfo info;
+    std::vector<u8> compressed;
+    bool sawHeader = false;
+    bool sawEnd = false;
+    usize pos = sizeof(PNG_SIGNATURE);
+
+    while (!sawEnd)
+    {
+        if (size - pos < 12)
+        {
+            return Result<DecodedImage>::error("Truncated PNG chunk");
+        }
+        const usize length = readBE32(data + pos);
+        const u8* type = data + pos + 4;
+        const u8* body = data + pos + 8;
+        if (length > size - pos - 12)
+        {
+            return Result<DecodedImage>::error("Truncated PNG chunk");
+        }
+        pos += 12 + length;
+
+        if (std::memcmp(type, "IHDR", 4) == 0)
+        {
+            if (length != 13)
+            {
+                return Result<DecodedImage>::error("Invalid PNG header");
+            }
+            info.width = readBE32(body);
+            info.height = readBE32(body + 4);
+            info.bitDepth = body[8];
+            info.colorType = body[9];
+            if (info.width == 0 || info.height == 0 ||
+                static_cast<u64>(info.width) * info.height > MAX_PIXELS ||
+                !validDepth(info.colorType, info.bitDepth) || body[10] != 0 || body[11] != 0)
+            {
+                return Result<DecodedImage>::error("Unsupported PNG header");
+            }
+            if (body[12] != 0)
+            {
+                return Result<DecodedImage>::error("Interlaced PNG images are not supported");
+            }
+            info.channels = channelsFor(info.colorType);
+            sawHeader = true;
+        }
+        else if (!sawHeader)
+        {
+            return Result<DecodedImage>::error("PNG does not start with IHDR");
+        }
+        else if (std::memcmp(type, "PLTE", 4) == 0)
+        {
+            if (length % 3 != 0 || length / 3 > 256)
+            {
+                return Result<DecodedImage>::error("Invalid PNG palette");
+            }
+            info.paletteSize = static_cast<u32>(length / 3);
+            for (u32 i = 0; i < info.paletteSize; ++i)
+            {
+                info.palette[i * 4 + 0] = body[i * 3 + 0];
+                info.palette[i * 4 + 1] = body[i * 3 + 1];
+                info.palette[i * 4 + 2] = body[i * 3 + 2];
+                info.palette[i * 4 + 3] = 255;
+            }
+        }
+        else if (std::memcmp(type, "tRNS", 4) == 0)
+        {
+            if (info.colorType == 3)
+            {
+                if (length > info.paletteSize)
+                {
+                    return Result<DecodedImage>::error("Invalid PNG transparency");
+                }
+                for (usize i = 0; i < length; ++i)
+                {
+                    info.palette[i * 4 + 3] = body[i];
+                }
+            }
+            else if (info.colorType == 0 || info.colorType == 2)
+            {
+                const usize keys = info.colorType == 0 ? 1 : 3;
+                if (length != keys * 2)
+                {
+                    return Result<DecodedImage>::error("Invalid PNG transparency");
+                }
+                for (usize i = 0; i < keys; ++i)
+                {
+                    info.colorKey[i] = static_cast<u16>((body[i * 2] << 8) | body[i * 2 + 1]);
+                }
+                info.hasColorKey = true;
+            }
+        }
+        else if (std::memcmp(type, "IDAT", 4) == 0)
+        {
+            compressed.insert(compressed.end(), body, body + length);
+        }
+        else if (std::memcmp(type, "IEND", 4) == 0)
+        {
+            sawEnd = true;
+        }
+        else if ((type[0] & 0x20) == 0)
+        {
+            return Result<DecodedImage>::error("Unknown critical PNG chunk");
+        }
+    }
+
+    if (info.colorType == 3 && info.paletteSize == 0)
+    {
+        return Result<DecodedImage>::error("PNG palette is missing");
+    }
+
+    const usize bitsPerPixel = static_cast<usize>(info.channels) * info.bitDepth;
+    const usize rowBytes = (static_cast<usize>(info.width) * bitsPerPixel + 7) / 8;
+    const usize filterBpp = std::max<usize>(1, bitsPerPixel / 8);
+    std::vector<u8> filtered(static_cast<usize>(info.height) * (rowBytes + 1));
+    if (!zlibInflate(compressed.data(), compressed.size(), filtered.data(), filtered.size()))
+    {
+        return Result<DecodedImage>::error("Corrupt PNG image data");
+    }
+
+    DecodedImage image;
+    image.width = info.width;
+    image.height = info.height;
+    image.pixels.resize(static_cast<usize>(info.width) * info.height * 4);
+
+    std::vector<u8> zeroRow(rowBytes, 0);
+    const u8* previous = zeroRow.data();
+    for (u32 y = 0; y < info.height; ++y)
+    {
+        u8* line = filtered.data() + static_cast<usize>(y) * (rowBytes + 1);
+        u8* row = line + 1;
+        if (!unfilterRow(line[0], row, previous, rowBytes, filterBpp))
+        {
+            return Result<DecodedImage>::error("Invalid PNG filter type");
+        }
+        expandRow(info, row, image.pixels.data() + static_cast<usize>(y) * info.width * 4);
+        previous = row;
+    }
+
+    return Result<DecodedImage>::ok(std::move(image));
+}
+
+Result<DecodedImage> ImageDecoder::decodeQOI(const u8* data, usize size)
+{
+    constexpr usize HEADER_SIZE = 14;
+    constexpr usize PADDING = 8;
+    if (detectFormat(data, size) != ImageFormat::QOI || size < HEADER_SIZE + PADDING)
+    {
+        return Result<DecodedImage>::error("Not a QOI image");
+    }
+
+    DecodedImage image;
+    image.width = readBE32(data + 4);
+    image.height = readBE32(data + 8);
+    const u8 channels = data[12];
+    if (image.width == 0 || image.height == 0 ||
+        static_cast<u64>(image.width) * image.height > MAX_PIXELS ||
+        (channels != 3 && channels != 4))
+    {
+        return Result<DecodedImage>::error("Invalid QOI header");
+    }
+
+    const usize pixelCount = static_cast<usize>(image.width) * image.height;
+    image.pixels.resize(pixelCount * 4);
+    u8* out = image.pixels.data();
+
+    u8 index[64 * 4] = {};
+    u8 px[4] = {0, 0, 0, 255};
+    u32 run = 0;
+    usize pos = HEADER_SIZE;
+    const usize end = size - PADDING;
+
+    for (usize i = 0; i < pixelCount; ++i)
+    {
+        if (run > 0)
+        {
+            --run;
+        }
+        else
+        {
+            if (pos >= end)
+            {
+                return Result<DecodedImage>::error("Truncated QOI image");
+            }
+            const u8 op = data[pos++];
+            if (op == 0xFE)
+            {
+                if (end - pos < 3)
+                {
+                    return Result<DecodedImage>::error("Truncated QOI image");
+                }
+                px[0] = data[pos];
+                px[1] = data[pos + 1];
+                px[2] = data[pos + 2];
+                pos += 3;
+            }
+            else if (op == 0xFF)
+            {
+                if (end - pos < 4)
+                {
+                    return Result<DecodedImage>::error("Truncated QOI image");
+                }
+                std::memcpy(px, data + pos, 4);
+                pos += 4;
+            }
+            else
+            {
+                switch (op >> 6)
+                {
+                case 0: // index
+                    std::memcpy(px, index + (op & 63) * 4, 4);
+                    break;
+                case 1: // diff
+                    px[0] = static_cast<u8>(px[0] + ((op >> 4) & 3) - 2);
+                    px[1] = static_cast<u8>(px[1] + ((op >> 2) & 3) - 2);
+                    px[2] = static_cast<u8>(px[2] + (op & 3) - 2);
+                    break;
+                case 2: // luma
+                {
+                    if (pos >= end)
+                    {
+                        return Result<DecodedImage>::error("Truncated QOI image");
+                    }
+                    const u8 next = data[pos++];
+                    const i32 dg = (op & 63) - 32;
+                    px[0] = static_cast<u8>(px[0] + dg - 8 + ((next >> 4) & 15));
+                    px[1] = static_cast<u8>(px[1] + dg);
+                    px[2] = static_cast<u8>(px[2] + dg - 8 + (next & 15));
+                    break;
+                }
+                default: // run
+                    run = op & 63;
+                    break;
+                }
+            }
+            const u32 hash = (px[0] * 3u + px[1] * 5u + px[2] * 7u + px[3] * 11u) % 64;
+            std::memcpy(index + hash * 4, px, 4);
+        }
+        std::memcpy(out + i * 4, px, 4);
+    }
+
+    return Result<DecodedImage>::ok(std::move(image));
+}
+
+void ImageDecoder::process(DecodedImage& image, const ImageDecodeOptions& options)
+{
+    const usize pixelCount = static_cast<usize>(image.width) * image.height;
+
+    if (options.convertToLinear && !image.linear)
+    {
+        ImageKernels::srgbToLinear(image.pixels.data(), pixelCount);
+        image.linear = true;
+    }
+    if (options.premultiplyAlpha && !image.premultiplied)
+    {
+        ImageKernels::premultiplyAlpha(image.pixels.data(), pixelCount);
+        image.premultiplied = true;
+    }
+
+    auto tooLarge = [&options](const DecodedImage& img) {
+        return (options.maxWidth != 0 && img.width > options.maxWidth) ||
+               (options.maxHeight != 0 && img.height > options.maxHeight);
+    };
+    std::vector<u8> scratch;
+    while (tooLarge(image) && (image.width > 1 || image.height > 1))
+    {
+        const u32 width = std::max(1u, image.width / 2);
+        const u32 height = std::max(1u, image.height / 2);
+        scratch.resize(static_cast<usize>(width) * height * 4);
+        ImageKernels::resampleHalf(image.pixels.data(), image.width, image.height,
+                                   image.width * 4, scratch.data());
+        image.pixels.swap(scratch);
+        image.width = width;
+        image.height = height;
+    }
+
+    if (options.pixelOrder != image.pixelOrder)
+    {
+        ImageKernels::swapRedBlue(image.pixels.data(),
+                                  static_cast<usize>(image.width) * image.height);
+        image.pixelOrder = options.pixelOrder;
+    }
+}
+
+} // namespace NovelMind::renderer
@@ -0,0 +1,401 @@
+#include "NovelMind/renderer/image_kernels.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define NOVELMIND_KERNELS_AVX2 1
+    #define NOVELMIND_KERNELS_SSE2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define NOVELMIND_KERNELS_SSE2 1
+#elif defined(__ARM_NEON)
+    #include <arm_neon.h>
+    #define NOVELMIND_KERNELS_NEON 1
+#endif
+
+namespace NovelMind::renderer
+{
+
+namespace
+{
+
+// round(c * a / 255) without a division; exact for all 8-bit inputs
+inline u8 mulDiv255(u32 c, u32 a)
+{
+    const u32 t = c * a + 128;
+    return static_cast<u8>((t + (t >> 8)) >> 8);
+}
+
+#if defined(NOVELMIND_KERNELS_SSE2)
+// Premultiply two pixels widened to 16-bit lanes
+inline __m128i premultiplyWide(__m128i px)
+{
+    const __m128i colorMask = _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1);
+    const __m128i alphaOne = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+    __m128i alpha = _mm_shufflelo_epi16(px, _MM_SHUFFLE(3, 3, 3, 3));
+    alpha = _mm_shufflehi_epi16(alpha, _MM_SHUFFLE(3, 3, 3, 3));
+    alpha = _mm_or_si128(_mm_and_si128(alpha, colorMask), alphaOne);
+
+    const __m128i t = _mm_add_epi16(_mm_mullo_epi16(px, alpha), _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+}
+#endif
+
+#if defined(NOVELMIND_KERNELS_AVX2)
+inline __m256i premultiplyWide(__m256i px)
+{
+    const __m256i colorMask =
+        _mm256_broadcastsi128_si256(_mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1));
+    const __m256i alphaOne =
+        _mm256_broadcastsi128_si256(_mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0));
+    __m256i alpha = _mm256_shufflelo_epi16(px, _MM_SHUFFLE(3, 3, 3, 3));
+    alpha = _mm256_shufflehi_epi16(alpha, _MM_SHUFFLE(3, 3, 3, 3));
+    alpha = _mm256_or_si256(_mm256_and_si256(alpha, colorMask), alphaOne);
+
+    const __m256i t = _mm256_add_epi16(_mm256_mullo_epi16(px, alpha), _mm256_set1_epi16(128));
+    return _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+}
+#endif
+
+const std::array<u8, 256>& srgbToLinearTable()
+{
+    static const std::array<u8, 256> table = []() {
+        std::array<u8, 256> values{};
+        for (usize i = 0; i < values.size(); ++i)
+        {
+            const f64 s = static_cast<f64>(i) / 255.0;
+            const f64 linear = s <= 0.04045 ? s / 12.92 : std::pow((s + 0.055) / 1.055, 2.4);
+            values[i] = static_cast<u8>(std::lround(linear * 255.0));
+        }
+        return values;
+    }();
+    return table;
+}
+
+} // namespace
+
+void ImageKernels::premultiplyAlpha(u8* rgba, usize pixelCount)
+{
+    usize i = 0;
+
+#if defined(NOVELMIND_KERNELS_AVX2)
+    const __m256i zero256 = _mm256_setzero_si256();
+    for (; i + 8 <= pixelCount; i += 8)
+    {
+        u8* p = rgba + i * 4;
+        const __m256i px = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        // Unpack and pack both work per 128-bit lane, so pixel order is kept
+        const __m256i lo = premultiplyWide(_mm256_unpacklo_epi8(px, zero256));
+        const __m256i hi = premultiplyWide(_mm256_unpackhi_epi8(px, zero256));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), _mm256_packus_epi16(lo, hi));
+    }
+#endif
+
+#if defined(NOVELMIND_KERNELS_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 4 <= pixelCount; i += 4)
+    {
+        u8* p = rgba + i * 4;
+        const __m128i px = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        const __m128i lo = premultiplyWide(_mm_unpacklo_epi8(px, zero));
+        const __m128i hi = premultiplyWide(_mm_unpackhi_epi8(px, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm_packus_epi16(lo, hi));
+    }
+#elif defined(NOVELMIND_KERNELS_NEON)
+    const uint16x8_t bias = vdupq_n_u16(128);
+    for (; i + 16 <= pixelCount; i += 16)
+    {
+        u8* p = rgba + i * 4;
+        uint8x16x4_t px = vld4q_u8(p);
+        for (int c = 0; c < 3; ++c)
+        {
+            uint16x8_t lo = vaddq_u16(vmull_u8(vget_low_u8(px.val[c]), vget_low_u8(px.val[3])), bias);
+            uint16x8_t hi =
+                vaddq_u16(vmull_u8(vget_high_u8(px.val[c]), vget_high_u8(px.val[3])), bias);
+            lo = vaddq_u16(lo, vshrq_n_u16(lo, 8));
+            hi = vaddq_u16(hi, vshrq_n_u16(hi, 8));
+            px.val[c] = vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8));
+        }
+        vst4q_u8(p, px);
+    }
+#endif
+
+    for (; i < pixelCount; ++i)
+    {
+        u8* p = rgba + i * 4;
+        const u32 a = p[3];
+        p[0] = mulDiv255(p[0], a);
+        p[1] = mulDiv255(p[1], a);
+        p[2] = mulDiv255(p[2], a);
+    }
+}
+
+void ImageKernels::swapRedBlue(u8* rgba, usize pixelCount)
+{
+    usize i = 0;
+
+#if defined(NOVELMIND_KERNELS_AVX2)
+    const __m256i keep256 = _mm256_set1_epi32(static_cast<i32>(0xFF00FF00u));
+    const __m256i low256 = _mm256_set1_epi32(0xFF);
+    for (; i + 8 <= pixelCount; i += 8)
+    {
+        u8* p = rgba + i * 4;
+        const __m256i px = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        const __m256i red = _mm256_slli_epi32(_mm256_and_si256(px, low256), 16);
+        const __m256i blue = _mm256_and_si256(_mm256_srli_epi32(px, 16), low256);
+        const __m256i out = _mm256_or_si256(_mm256_and_si256(px, keep256),
+                                            _mm256_or_si256(red, blue));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), out);
+    }
+#endif
+
+#if defined(NOVELMIND_KERNELS_SSE2)
+    const __m128i keep = _mm_set1_epi32(static_cast<i32>(0xFF00FF00u));
+    const __m128i low = _mm_set1_epi32(0xFF);
+    for (; i + 4 <= pixelCount; i += 4)
+    {
+        u8* p = rgba + i * 4;
+        const __m128i px = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        const __m128i red = _mm_slli_epi32(_mm_and_si128(px, low), 16);
+        const __m128i blue = _mm_and_si128(_mm_srli_epi32(px, 16), low);
+        const __m128i out = _mm_or_si128(_mm_and_si128(px, keep), _mm_or_si128(red, blue));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p), out);
+    }
+#elif defined(NOVELMIND_KERNELS_NEON)
+    for (; i + 16 <= pixelCount; i += 16)
+    {
+        u8* p = rgba + i * 4;
+        uint8x16x4_t px = vld4q_u8(p);
+        const uint8x16_t red = px.val[0];
+        px.val[0] = px.val[2];
+        px.val[2] = red;
+        vst4q_u8(p, px);
+    }
+#endif
+
+    for (; i < pixelCount; ++i)
+    {
+        u8* p = rgba + i * 4;
+        std::swap(p[0], p[2]);
+    }
+}
+
+void ImageKernels::srgbToLinear(u8* rgba, usize pixelCount)
+{
+    // A byte table is faster than any arithmetic path; gathers do not help
+    // with 8-bit lookups
+    const auto& table = srgbToLinearTable();
+    for (usize i = 0; i < pixelCount; ++i)
+    {
+        u8* p = rgba + i * 4;
+        p[0] = table[p[0]];
+        p[1] = table[p[1]];
+        p[2] = table[p[2]];
+    }
+}
+
+void ImageKernels::downsampleHalf(const u8* src, u32 width, u32 height, u32 srcStride, u8* dst)
+{
+    const u32 dstWidth = std::max(1u, width / 2);
+    const u32 dstHeight = std::max(1u, height / 2);
+
+    for (u32 y = 0; y < dstHeight; ++y)
+    {
+        const u8* row0 = src + static_cast<usize>(std::min(y * 2, height - 1)) * srcStride;
+        const u8* row1 = src + static_cast<usize>(std::min(y * 2 + 1, height - 1)) * srcStride;
+        u8* out = dst + static_cast<usize>(y) * dstWidth * 4;
+
+        // Output pixels whose 2x2 block lies fully inside the row
+        const u32 fullPairs = width / 2;
+        u32 x = 0;
+
+#if defined(NOVELMIND_KERNELS_SSE2)
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i two = _mm_set1_epi16(2);
+        for (; x + 2 <= fullPairs; x += 2)
+        {
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row0 + x * 8));
+            const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row1 + x * 8));
+            __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+            __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+            lo = _mm_add_epi16(lo, _mm_srli_si128(lo, 8));
+            hi = _mm_add_epi16(hi, _mm_srli_si128(hi, 8));
+            __m128i sum = _mm_unpacklo_epi64(lo, hi);
+            sum = _mm_srli_epi16(_mm_add_epi16(sum, two), 2);
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(out + x * 4), _mm_packus_epi16(sum, sum));
+        }
+#elif defined(NOVELMIND_KERNELS_NEON)
+        for (; x + 8 <= fullPairs; x += 8)
+        {
+            const uint8x16x4_t a = vld4q_u8(row0 + x * 8);
+            const uint8x16x4_t b = vld4q_u8(row1 + x * 8);
+            uint8x8x4_t result;
+            for (int c = 0; c < 4; ++c)
+            {
+                const uint16x8_t sum = vaddq_u16(vpaddlq_u8(a.val[c]), vpaddlq_u8(b.val[c]));
+                result.val[c] = vrshrn_n_u16(sum, 2);
+            }
+            vst4_u8(out + x * 4, result);
+        }
+#endif
+
+        for (; x < dstWidth; ++x)
+        {
+            const usize x0 = static_cast<usize>(std::min(x * 2, width - 1)) * 4;
+            const usize x1 = static_cast<usize>(std::min(x * 2 + 1, width - 1)) * 4;
+            for (usize c = 0; c < 4; ++c)
+            {
+                const u32 sum = static_cast<u32>(row0[x0 + c]) + row0[x1 + c] + row1[x0 + c] +
+                                row1[x1 + c];
+                out[static_cast<usize>(x) * 4 + c] = static_cast<u8>((sum + 2) / 4);
+            }
+        }
+    }
+}
+
+void ImageKernels::resampleHalf(const u8* src, u32 width, u32 height, u32 srcStride, u8* dst)
+{
+    const u32 dstWidth = std::max(1u, width / 2);
+    const u32 dstHeight = std::max(1u, height / 2);
+    const usize rowLength = static_cast<usize>(width) * 4;
+    const i64 lastRow = static_cast<i64>(height) - 1;
+    const i64 lastColumn = static_cast<i64>(width) - 1;
+
+    // Vertical sums of one output row, at most 8 * 255 per channel
+    std::vector<u16> sums(rowLength);
+
+    for (u32 y = 0; y < dstHeight; ++y)
+    {
+        auto rowAt = [&](i64 row) {
+            return src + static_cast<usize>(std::clamp<i64>(row, 0, lastRow)) * srcStride;
+        };
+        const i64 center = static_cast<i64>(y) * 2;
+        const u8* r0 = rowAt(center - 1);
+        const u8* r1 = rowAt(center);
+        const u8* r2 = rowAt(center + 1);
+        const u8* r3 = rowAt(center + 2);
+
+        usize i = 0;
+#if defined(NOVELMIND_KERNELS_SSE2)
+        const __m128i zero = _mm_setzero_si128();
+        for (; i + 16 <= rowLength; i += 16)
+        {
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(r0 + i));
+            const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(r1 + i));
+            const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(r2 + i));
+            const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(r3 + i));
+
+            const __m128i outerLo =
+                _mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(d, zero));
+            const __m128i outerHi =
+                _mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(d, zero));
+            const __m128i innerLo =
+                _mm_add_epi16(_mm_unpacklo_epi8(b, zero), _mm_unpacklo_epi8(c, zero));
+            const __m128i innerHi =
+                _mm_add_epi16(_mm_unpackhi_epi8(b, zero), _mm_unpackhi_epi8(c, zero));
+            const __m128i lo =
+                _mm_add_epi16(outerLo, _mm_add_epi16(innerLo, _mm_add_epi16(innerLo, innerLo)));
+            const __m128i hi =
+                _mm_add_epi16(outerHi, _mm_add_epi16(innerHi, _mm_add_epi16(innerHi, innerHi)));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(sums.data() + i), lo);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(sums.data() + i + 8), hi);
+        }
+#elif defined(NOVELMIND_KERNELS_NEON)
+        const uint8x8_t three = vdup_n_u8(3);
+        for (; i + 16 <= rowLength; i += 16)
+        {
+            const uint8x16_t a = vld1q_u8(r0 + i);
+            const uint8x16_t b = vld1q_u8(r1 + i);
+            const uint8x16_t c = vld1q_u8(r2 + i);
+            const uint8x16_t d = vld1q_u8(r3 + i);
+
+            uint16x8_t lo = vaddl_u8(vget_low_u8(a), vget_low_u8(d));
+            lo = vmlal_u8(lo, vget_low_u8(b), three);
+            lo = vmlal_u8(lo, vget_low_u8(c), three);
+            uint16x8_t hi = vaddl_u8(vget_high_u8(a), vget_high_u8(d));
+            hi = vmlal_u8(hi, vget_high_u8(b), three);
+            hi = vmlal_u8(hi, vget_high_u8(c), three);
+            vst1q_u16(sums.data() + i, lo);
+            vst1q_u16(sums.data() + i + 8, hi);
+        }
+#endif
+        for (; i < rowLength; ++i)
+        {
+            sums[i] = static_cast<u16>(r0[i] + 3 * (r1[i] + r2[i]) + r3[i]);
+        }
+
+        // Horizontal pass; the total weight is 64
+        u8* out = dst + static_cast<usize>(y) * dstWidth * 4;
+        auto clampedPixel = [&](u32 x) {
+            const i64 left = static_cast<i64>(x) * 2;
+            const usize p0 = static_cast<usize>(std::clamp<i64>(left - 1, 0, lastColumn)) * 4;
+            const usize p1 = static_cast<usize>(std::clamp<i64>(left, 0, lastColumn)) * 4;
+            const usize p2 = static_cast<usize>(std::clamp<i64>(left + 1, 0, lastColumn)) * 4;
+            const usize p3 = static_cast<usize>(std::clamp<i64>(left + 2, 0, lastColumn)) * 4;
+            for (usize c = 0; c < 4; ++c)
+            {
+                const u32 sum = sums[p0 + c] + 3u * (sums[p1 + c] + sums[p2 + c]) + sums[p3 + c];
+                out[static_cast<usize>(x) * 4 + c] = static_cast<u8>((sum + 32) >> 6);
+            }
+        };
+
+        // Pixels 1 .. interiorEnd - 1 read columns 2x-1 .. 2x+2 without clamping
+        clampedPixel(0);
+        u32 x = 1;
+        const u32 interiorEnd = width >= 3 ? std::min(dstWidth, (width - 3) / 2 + 1) : 1;
+#if defined(NOVELMIND_KERNELS_SSE2)
+        const __m128i weightsA = _mm_set_epi16(3, 3, 3, 3, 1, 1, 1, 1);
+        const __m128i weightsB = _mm_set_epi16(1, 1, 1, 1, 3, 3, 3, 3);
+        const __m128i half = _mm_set1_epi16(32);
+        for (; x < interiorEnd; ++x)
+        {
+            const u16* taps = sums.data() + (static_cast<usize>(x) * 2 - 1) * 4;
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(taps));
+            const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(taps + 8));
+            __m128i sum = _mm_add_epi16(_mm_mullo_epi16(a, weightsA), _mm_mullo_epi16(b, weightsB));
+            sum = _mm_add_epi16(sum, _mm_srli_si128(sum, 8));
+            sum = _mm_srli_epi16(_mm_add_epi16(sum, half), 6);
+            const i32 packed = _mm_cvtsi128_si32(_mm_packus_epi16(sum, sum));
+            std::memcpy(out + static_cast<usize>(x) * 4, &packed, 4);
+        }
+#elif defined(NOVELMIND_KERNELS_NEON)
+        const uint16x8_t weightsA = vcombine_u16(vdup_n_u16(1), vdup_n_u16(3));
+        const uint16x8_t weightsB = vcombine_u16(vdup_n_u16(3), vdup_n_u16(1));
+        for (; x < interiorEnd; ++x)
+        {
+            const u16* taps = sums.data() + (static_cast<usize>(x) * 2 - 1) * 4;
+            const uint16x8_t a = vld1q_u16(taps);
+            const uint16x8_t b = vld1q_u16(taps + 8);
+            const uint16x8_t sum = vmlaq_u16(vmulq_u16(a, weightsA), b, weightsB);
+            const uint16x4_t folded =
+                vrshr_n_u16(vadd_u16(vget_low_u16(sum), vget_high_u16(sum)), 6);
+            u8 packed[8];
+            vst1_u8(packed, vmovn_u16(vcombine_u16(folded, folded)));
+            std::memcpy(out + static_cast<usize>(x) * 4, packed, 4);
+        }
+#endif
+        for (; x < dstWidth; ++x)
+        {
+            clampedPixel(x);
+        }
+    }
+}
+
+const char* ImageKernels::getInstructionSet()
+{
+#if defined(NOVELMIND_KERNELS_AVX2)
+    return "AVX2";
+#elif defined(NOVELMIND_KERNELS_SSE2)
+    return "SSE2";
+#elif defined(NOVELMIND_KERNELS_NEON)
+    return "NEON";
+#else
+    return "scalar";
+#endif
+}
+
+} // namespace NovelMind::renderer
@@ -0,0 +1,219 @@
+#include "NovelMind/renderer/raw_texture.hpp"
+#include "NovelMind/renderer/image_kernels.hpp"
+#include "NovelMind/vfs/lz4_block.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace NovelMind::renderer
+{
+
+namespace
+{
+
+// One LZ4 input byte never yields more than about 255 output bytes
+constexpr u64 LZ4_MAX_EXPANSION = 255;
+
+u32 mipCountFor(u32 width, u32 height)
+{
+    u32 count = 1;
+    while (width > 1 || height > 1)
+    {
+        width = std::max(1u, width / 2);
+        height = std::max(1u, height / 2);
+        ++count;
+    }
+    return count;
+}
+
+} // namespace
+
+bool RawTexture::isRawTexture(const u8* data, usize size)
+{
+    if (!data || size < sizeof(RawTextureHeader))
+    {
+        return false;
+    }
+    u32 magic;
+    std::memcpy(&magic, data, sizeof(magic));
+    return magic == RAW_TEXTURE_MAGIC;
+}
+
+u64 RawTexture::payloadSizeFor(u32 width, u32 height, u32 stride, u32 mipCount)
+{
+    u64 size = static_cast<u64>(stride) * height;
+    for (u32 level = 1; level < mipCount; ++level)
+    {
+        width = std::max(1u, width / 2);
+        height = std::max(1u, height / 2);
+        size += static_cast<u64>(width) * height * 4;
+    }
+    return size;
+}
+
+Result<std::vector<u8>> RawTexture::encode(const u8* rgba, u32 width, u32 height, u32 stride,
+                                           const RawTextureOptions& options)
+{
+    if (!rgba || width == 0 || height == 0)
+    {
+        return Result<std::vector<u8>>::error("Invalid texture dimensions");
+    }
+    if (stride == 0)
+    {
+        stride = width * 4;
+    }
+    if (stride < width * 4)
+    {
+        return Result<std::vector<u8>>::error("Row stride smaller than the row");
+    }
+
+    const u32 alignment = std::max(1u, options.rowAlignment);
+    if ((alignment & (alignment - 1)) != 0)
+    {
+        return Result<std::vector<u8>>::error("Row alignment must be a power of two");
+    }
+
+    RawTextureHeader header{};
+    header.magic = RAW_TEXTURE_MAGIC;
+    header.version = RAW_TEXTURE_VERSION;
+    const bool premultiply = options.premultiplyAlpha && !options.sourcePremultiplied;
+    header.flags =
+        options.premultiplyAlpha || options.sourcePremultiplied ? RawTexturePremultiplied : 0;
+    header.width = width;
+    header.height = height;
+    header.stride = (width * 4 + alignment - 1) & ~(alignment - 1);
+    header.mipCount = options.generateMipmaps ? mipCountFor(width, height) : 1;
+    header.rawSize = payloadSizeFor(width, height, header.stride, header.mipCount);
+
+    std::vector<u8> pixels(static_cast<usize>(header.rawSize), 0);
+
+    // Level 0, premultiplied if requested
+    for (u32 y = 0; y < height; ++y)
+    {
+        u8* out = pixels.data() + static_cast<usize>(y) * header.stride;
+        std::memcpy(out, rgba + static_cast<usize>(y) * stride, static_cast<usize>(width) * 4);
+        if (premultiply)
+        {
+            ImageKernels::premultiplyAlpha(out, width);
+        }
+    }
+
+    // Mip chain, each level filtered from the previous one
+    const u8* previous = pixels.data();
+    u32 previousWidth = width;
+    u32 previousHeight = height;
+    u32 previousStride = header.stride;
+    usize offset = static_cast<usize>(header.stride) * height;
+    for (u32 level = 1; level < header.mipCount; ++level)
+    {
+        const u32 levelWidth = std::max(1u, previousWidth / 2);
+        const u32 levelHeight = std::max(1u, previousHeight / 2);
+        u8* levelPixels = pixels.data() + offset;
+        ImageKernels::downsampleHalf(previous, previousWidth, previousHeight, previousStride,
+                                     levelPixels);
+
+        previous = levelPixels;
+        previousWidth = levelWidth;
+        previousHeight = levelHeight;
+        previousStride = levelWidth * 4;
+        offset += static_cast<usize>(levelWidth) * levelHeight * 4;
+    }
+
+    std::vector<u8> payload;
+    header.encoding = static_cast<u8>(RawTextureEncoding::Stored);
+    if (options.compress)
+    {
+        payload = vfs::LZ4Block::compress(pixels.data(), pixels.size());
+        if (payload.size() < pixels.size())
+        {
+            header.encoding = static_cast<u8>(RawTextureEncoding::LZ4);
+        }
+    }
+    if (header.encoding == static_cast<u8>(RawTextureEncoding::Stored))
+    {
+        payload = std::move(pixels);
+    }
+    header.payloadSize = payload.size();
+
+    std::vector<u8> result(sizeof(RawTextureHeader) + payload.size());
+    std::memcpy(result.data(), &header, sizeof(header));
+    std::memcpy(result.data() + sizeof(header), payload.data(), payload.size());
+    return Result<std::vector<u8>>::ok(std::move(result));
+}
+
+Result<RawTextureHeader> RawTexture::readHeader(const u8* data, usize size)
+{
+    if (!isRawTexture(data, size))
+    {
+        return Result<RawTextureHeader>::error("Not a raw texture");
+    }
+
+    RawTextureHeader header;
+    std::memcpy(&header, data, sizeof(header));
+
+    if (header.version != RAW_TEXTURE_VERSION)
+    {
+        return Result<RawTextureHeader>::error("Unsupported raw texture version " +
+                                               std::to_string(header.version));
+    }
+    if (header.encoding > static_cast<u8>(RawTextureEncoding::LZ4))
+    {
+        return Result<RawTextureHeader>::error("Unknown raw texture encoding");
+    }
+    if (header.width == 0 || header.height == 0 || header.mipCount == 0 ||
+        header.mipCount > mipCountFor(header.width, header.height) ||
+        header.stride / 4 < header.width)
+    {
+        return Result<RawTextureHeader>::error("Invalid raw texture dimensions");
+    }
+    if (header.rawSize != payloadSizeFor(header.width, header.height, header.stride,
+                                         header.mipCount))
+    {
+        return Result<RawTextureHeader>::error("Raw texture size does not match its header");
+    }
+    if (header.payloadSize > size - sizeof(RawTextureHeader))
+    {
+        return Result<RawTextureHeader>::error("Truncated raw texture");
+    }
+    if (header.encoding == static_cast<u8>(RawTextureEncoding::Stored) &&
+        header.payloadSize != header.rawSize)
+    {
+        return Result<RawTextureHeader>::error("Stored raw texture has the wrong size");
+    }
+    if (header.encoding == static_cast<u8>(RawTextureEncoding::LZ4) &&
+        header.rawSize / LZ4_MAX_EXPANSION > header.payloadSize)
+    {
+        return Result<RawTextureHeader>::error("Raw texture expands more than LZ4 allows");
+    }
+
+    return Result<RawTextureHeader>::ok(header);
+}
+
+Result<RawTextureView> RawTexture::decode(const u8* data, usize size, std::vector<u8>& scratch)
+{
+    auto headerResult = readHeader(data, size);
+    if (headerResult.isError())
+    {
+        return Result<RawTextureView>::error(headerResult.error());
+    }
+
+    RawTextureView view;
+    view.header = headerResult.value();
+    const u8* payload = data + sizeof(RawTextureHeader);
+
+    if (view.header.encoding == static_cast<u8>(RawTextureEncoding::Stored))
+    {
+        view.pixels = payload;
+        return Result<RawTextureView>::ok(view);
+    }
+
+    scratch.resize(static_cast<usize>(view.header.rawSize));
+    if (!vfs::LZ4Block::decompress(payload, static_cast<usize>(view.header.payloadSize),
+                                   scratch.data(), scratch.size()))
+    {
+        return Result<RawTextureView>::error("Corrupt raw texture payload");
+    }
+    view.pixels = scratch.data();
+    return Result<RawTextureView>::ok(view);
+}
+
+} // namespace NovelMind::renderer
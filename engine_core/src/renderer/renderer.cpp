@@ -67,6 +67,11 @@ public:
         // Nothing to do
     }
 
+    void fillRects(const Rect* /*rects*/, const Color* /*colors*/, usize /*count*/) override
+    {
+        // Nothing to do
+    }
+
     void setFade(f32 /*alpha*/, const Color& /*color*/) override
     {
         // Nothing to do
@@ -0,0 +1,208 @@
+#include "NovelMind/renderer/sdf_font.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace NovelMind::renderer
+{
+
+namespace
+{
+
+// Lookups binary-search both tables, so their order is part of the format
+const char* checkTables(const SdfFontMetrics& metrics)
+{
+    if (metrics.pageCount > SDF_FONT_MAX_PAGES || metrics.pageCount > metrics.glyphs.size())
+    {
+        return "SDF font has more pages than it can use";
+    }
+    for (usize i = 1; i < metrics.glyphs.size(); ++i)
+    {
+        if (metrics.glyphs[i - 1].codepoint >= metrics.glyphs[i].codepoint)
+        {
+            return "SDF font glyphs must be sorted by codepoint";
+        }
+    }
+    for (usize i = 1; i < metrics.kerning.size(); ++i)
+    {
+        const SdfKerningPair& a = metrics.kerning[i - 1];
+        const SdfKerningPair& b = metrics.kerning[i];
+        if (a.left > b.left || (a.left == b.left && a.right >= b.right))
+        {
+            return "SDF font kerning pairs must be sorted";
+        }
+    }
+    for (const auto& glyph : metrics.glyphs)
+    {
+        if (glyph.atlasWidth > 0 && glyph.page >= metrics.pageCount)
+        {
+            return "SDF font glyph refers to a missing page";
+        }
+    }
+    return nullptr;
+}
+
+} // namespace
+
+const SdfGlyph* SdfFontMetrics::findGlyph(u32 codepoint) const
+{
+    auto it = std::lower_bound(glyphs.begin(), glyphs.end(), codepoint,
+                               [](const SdfGlyph& glyph, u32 cp) { return glyph.codepoint < cp; });
+    if (it == glyphs.end() || it->codepoint != codepoint)
+    {
+        return nullptr;
+    }
+    return &*it;
+}
+
+f32 SdfFontMetrics::getKerning(u32 left, u32 right) const
+{
+    if (kerning.empty())
+    {
+        return 0.0f;
+    }
+    auto it = std::lower_bound(kerning.begin(), kerning.end(), std::make_pair(left, right),
+                               [](const SdfKerningPair& pair, const std::pair<u32, u32>& key) {
+                                   return pair.left < key.first ||
+                                          (pair.left == key.first && pair.right < key.second);
+                               });
+    if (it == kerning.end() || it->left != left || it->right != right)
+    {
+        return 0.0f;
+    }
+    return it->adjust;
+}
+
+bool SdfFontFormat::isSdfFont(const u8* data, usize size)
+{
+    if (!data || size < sizeof(SdfFontHeader))
+    {
+        return false;
+    }
+    u32 magic;
+    std::memcpy(&magic, data, sizeof(magic));
+    return magic == SDF_FONT_MAGIC;
+}
+
+Result<std::vector<u8>> SdfFontFormat::encode(const SdfFontMetrics& metrics)
+{
+    if (metrics.emSize <= 0.0f || metrics.distanceRange <= 0.0f)
+    {
+        return Result<std::vector<u8>>::error("SDF font needs a positive em size and range");
+    }
+    if (const char* error = checkTables(metrics))
+    {
+        return Result<std::vector<u8>>::error(error);
+    }
+
+    SdfFontHeader header{};
+    header.magic = SDF_FONT_MAGIC;
+    header.version = SDF_FONT_VERSION;
+    header.emSize = metrics.emSize;
+    header.distanceRange = metrics.distanceRange;
+    header.ascender = metrics.ascender;
+    header.descender = metrics.descender;
+    header.lineGap = metrics.lineGap;
+    header.pageWidth = metrics.pageWidth;
+    header.pageHeight = metrics.pageHeight;
+    header.pageCount = metrics.pageCount;
+    header.glyphCount = static_cast<u32>(metrics.glyphs.size());
+    header.kerningCount = static_cast<u32>(metrics.kerning.size());
+
+    const usize glyphBytes = metrics.glyphs.size() * sizeof(SdfGlyph);
+    const usize kerningBytes = metrics.kerning.size() * sizeof(SdfKerningPair);
+    std::vector<u8> out(sizeof(header) + glyphBytes + kerningBytes);
+    std::memcpy(out.data(), &header, sizeof(header));
+    if (glyphBytes > 0)
+    {
+        std::memcpy(out.data() + sizeof(header), metrics.glyphs.data(), glyphBytes);
+    }
+    if (kerningBytes > 0)
+    {
+        std::memcpy(out.data() + sizeof(header) + glyphBytes, metrics.kerning.data(),
+                    kerningBytes);
+    }
+    return Result<std::vector<u8>>::ok(std::move(out));
+}
+
+Result<SdfFontMetrics> SdfFontFormat::decode(const u8* data, usize size)
+{
+    if (!isSdfFont(data, size))
+    {
+        return Result<SdfFontMetrics>::error("Not an SDF font");
+    }
+
+    SdfFontHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (header.version != SDF_FONT_VERSION)
+    {
+        return Result<SdfFontMetrics>::error("Unsupported SDF font version");
+    }
+    if (!(header.emSize > 0.0f) || !(header.distanceRange > 0.0f))
+    {
+        return Result<SdfFontMetrics>::error("Corrupt SDF font header");
+    }
+    if (header.pageCount > SDF_FONT_MAX_PAGES || header.pageCount > header.glyphCount)
+    {
+        return Result<SdfFontMetrics>::error("SDF font has more pages than it can use");
+    }
+
+    const u64 glyphBytes = static_cast<u64>(header.glyphCount) * sizeof(SdfGlyph);
+    const u64 kerningBytes = static_cast<u64>(header.kerningCount) * sizeof(SdfKerningPair);
+    if (sizeof(header) + glyphBytes + kerningBytes > size)
+    {
+        return Result<SdfFontMetrics>::error("Truncated SDF font");
+    }
+
+    SdfFontMetrics metrics;
+    metrics.emSize = header.emSize;
+    metrics.distanceRange = header.distanceRange;
+    metrics.ascender = header.ascender;
+    metrics.descender = header.descender;
+    metrics.lineGap = header.lineGap;
+    metrics.pageWidth = header.pageWidth;
+    metrics.pageHeight = header.pageHeight;
+    metrics.pageCount = header.pageCount;
+    metrics.glyphs.resize(header.glyphCount);
+    metrics.kerning.resize(header.kerningCount);
+    if (glyphBytes > 0)
+    {
+        std::memcpy(metrics.glyphs.data(), data + sizeof(header), glyphBytes);
+    }
+    if (kerningBytes > 0)
+    {
+        std::memcpy(metrics.kerning.data(), data + sizeof(header) + glyphBytes, kerningBytes);
+    }
+
+    if (const char* error = checkTables(metrics))
+    {
+        return Result<SdfFontMetrics>::error(error);
+    }
+    return Result<SdfFontMetrics>::ok(std::move(metrics));
+}
+
+std::string SdfFontFormat::pageResourceId(std::string_view fontId, u32 page)
+{
+    std::string id(fontId);
+    id += ".page";
+    id += std::to_string(page);
+    return id;
+}
+
+f32 SdfShading::median(f32 a, f32 b, f32 c)
+{
+    return std::max(std::min(a, b), std::min(std::max(a, b), c));
+}
+
+f32 SdfShading::fillCoverage(const u8* texel, f32 screenPxRange)
+{
+    const f32 distance = median(texel[0] / 255.0f, texel[1] / 255.0f, texel[2] / 255.0f) - 0.5f;
+    return std::clamp(distance * screenPxRange + 0.5f, 0.0f, 1.0f);
+}
+
+f32 SdfShading::outlineCoverage(const u8* texel, f32 screenPxRange, f32 outlineWidth)
+{
+    const f32 distance = texel[3] / 255.0f - 0.5f;
+    return std::clamp(distance * screenPxRange + outlineWidth + 0.5f, 0.0f, 1.0f);
+}
+
+} // namespace NovelMind::renderer
@@ -0,0 +1,1541 @@
+#include "NovelMind/renderer/sdf_font_builder.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <thread>
+
+namespace NovelMind::renderer
+{
+
+namespace
+{
+
+// ============================================================================
+// Outline geometry
+// ============================================================================
+
+struct Point
+{
+    f64 x = 0.0;
+    f64 y = 0.0;
+};
+
+Point operator+(Point a, Point b) { return {a.x + b.x, a.y + b.y}; }
+Point operator-(Point a, Point b) { return {a.x - b.x, a.y - b.y}; }
+Point operator*(Point a, f64 s) { return {a.x * s, a.y * s}; }
+f64 dot(Point a, Point b) { return a.x * b.x + a.y * b.y; }
+f64 cross(Point a, Point b) { return a.x * b.y - a.y * b.x; }
+f64 length(Point a) { return std::sqrt(dot(a, a)); }
+
+Point normalize(Point a)
+{
+    const f64 len = length(a);
+    return len > 0.0 ? a * (1.0 / len) : Point{0.0, 0.0};
+}
+
+f64 nonZeroSign(f64 value)
+{
+    return value > 0.0 ? 1.0 : -1.0;
+}
+
+// Channel bits; an edge contributes to every channel its color contains
+enum EdgeColor : u8
+{
+    Black = 0,
+    Red = 1,
+    Green = 2,
+    Yellow = 3,
+    Blue = 4,
+    Magenta = 5,
+    Cyan = 6,
+    White = 7
+};
+
+/**
+ * Distance to an edge, ordered by magnitude and then by how orthogonally
+ * the edge is approached (smaller dot wins ties at shared endpoints)
+ */
+struct SignedDistance
+{
+    f64 distance = -std::numeric_limits<f64>::max();
+    f64 dot = 1.0;
+};
+
+bool operator<(const SignedDistance& a, const SignedDistance& b)
+{
+    const f64 da = std::fabs(a.distance);
+    const f64 db = std::fabs(b.distance);
+    return da < db || (da == db && a.dot < b.dot);
+}
+
+// Real roots of a*t^2 + b*t + c
+int solveQuadratic(f64 roots[2], f64 a, f64 b, f64 c)
+{
+    if (a == 0.0 || std::fabs(b) > 1e12 * std::fabs(a))
+    {
+        if (b == 0.0)
+        {
+            return 0;
+        }
+        roots[0] = -c / b;
+        return 1;
+    }
+    f64 discriminant = b * b - 4.0 * a * c;
+    if (discriminant > 0.0)
+    {
+        discriminant = std::sqrt(discriminant);
+        roots[0] = (-b + discriminant) / (2.0 * a);
+        roots[1] = (-b - discriminant) / (2.0 * a);
+        return 2;
+    }
+    if (discriminant == 0.0)
+    {
+        roots[0] = -b / (2.0 * a);
+        return 1;
+    }
+    return 0;
+}
+
+// Real roots of t^3 + a*t^2 + b*t + c
+int solveCubicNormed(f64 roots[3], f64 a, f64 b, f64 c)
+{
+    constexpr f64 PI = 3.14159265358979323846;
+    const f64 a2 = a * a;
+    f64 q = (a2 - 3.0 * b) / 9.0;
+    const f64 r = (a * (2.0 * a2 - 9.0 * b) + 27.0 * c) / 54.0;
+    const f64 r2 = r * r;
+    const f64 q3 = q * q * q;
+    a /= 3.0;
+    if (r2 < q3)
+    {
+        const f64 t = std::acos(std::clamp(r / std::sqrt(q3), -1.0, 1.0));
+        q = -2.0 * std::sqrt(q);
+        roots[0] = q * std::cos(t / 3.0) - a;
+        roots[1] = q * std::cos((t + 2.0 * PI) / 3.0) - a;
+        roots[2] = q * std::cos((t - 2.0 * PI) / 3.0) - a;
+        return 3;
+    }
+    const f64 u = (r < 0.0 ? 1.0 : -1.0) * std::cbrt(std::fabs(r) + std::sqrt(r2 - q3));
+    const f64 v = u == 0.0 ? 0.0 : q / u;
+    roots[0] = (u + v) - a;
+    if (u == v || std::fabs(u - v) < 1e-12 * std::fabs(u + v))
+    {
+        roots[1] = -0.5 * (u + v) - a;
+        return 2;
+    }
+    return 1;
+}
+
+int solveCubic(f64 roots[3], f64 a, f64 b, f64 c, f64 d)
+{
+    if (a != 0.0)
+    {
+        const f64 bn = b / a;
+        if (std::fabs(bn) < 1e6)
+        {
+            return solveCubicNormed(roots, bn, c / a, d / a);
+        }
+    }
+    return solveQuadratic(roots, b, c, d);
+}
+
+/**
+ * A line (p[0], p[1]) or quadratic Bezier (p[0], control p[1], p[2]).
+ * Distances are positive on the right of the direction of travel, which
+ * is the inside of TrueType's clockwise outer contours.
+ */
+struct Edge
+{
+    Point p[3];
+    bool quadratic = false;
+    u8 color = White;
+
+    [[nodiscard]] Point start() const { return p[0]; }
+    [[nodiscard]] Point end() const { return quadratic ? p[2] : p[1]; }
+
+    [[nodiscard]] Point point(f64 t) const
+    {
+        if (!quadratic)
+        {
+            return p[0] + (p[1] - p[0]) * t;
+        }
+        const f64 s = 1.0 - t;
+        return p[0] * (s * s) + p[1] * (2.0 * s * t) + p[2] * (t * t);
+    }
+
+    [[nodiscard]] Point direction(f64 t) const
+    {
+        if (!quadratic)
+        {
+            return p[1] - p[0];
+        }
+        const Point tangent = (p[1] - p[0]) * (1.0 - t) + (p[2] - p[1]) * t;
+        if (tangent.x == 0.0 && tangent.y == 0.0)
+        {
+            return p[2] - p[0];
+        }
+        return tangent;
+    }
+
+    void reverse()
+    {
+        std::swap(p[0], quadratic ? p[2] : p[1]);
+    }
+
+    void splitInThirds(Edge parts[3]) const
+    {
+        for (int i = 0; i < 3; ++i)
+        {
+            const f64 t0 = i / 3.0;
+            const f64 t1 = (i + 1) / 3.0;
+            parts[i] = *this;
+            parts[i].p[0] = point(t0);
+            if (quadratic)
+            {
+                // Control point of the sub-curve: along the tangent at t0
+                const Point halfTangent = (p[1] - p[0]) * (1.0 - t0) + (p[2] - p[1]) * t0;
+                parts[i].p[1] = point(t0) + halfTangent * (t1 - t0);
+                parts[i].p[2] = point(t1);
+            }
+            else
+            {
+                parts[i].p[1] = point(t1);
+            }
+        }
+    }
+
+    [[nodiscard]] SignedDistance signedDistance(Point origin, f64& param) const
+    {
+        if (!quadratic)
+        {
+            const Point aq = origin - p[0];
+            const Point ab = p[1] - p[0];
+            param = dot(aq, ab) / dot(ab, ab);
+            const Point eq = (param > 0.5 ? p[1] : p[0]) - origin;
+            const f64 endpointDistance = length(eq);
+            if (param > 0.0 && param < 1.0)
+            {
+                const Point normal = normalize(Point{ab.y, -ab.x});
+                const f64 orthoDistance = dot(normal, aq);
+                if (std::fabs(orthoDistance) < endpointDistance)
+                {
+                    return {orthoDistance, 0.0};
+                }
+            }
+            return {nonZeroSign(cross(aq, ab)) * endpointDistance,
+                    std::fabs(dot(normalize(ab), normalize(eq)))};
+        }
+
+        const Point qa = p[0] - origin;
+        const Point ab = p[1] - p[0];
+        const Point br = p[2] - p[1] - ab;
+        f64 roots[3];
+        const int count = solveCubic(roots, dot(br, br), 3.0 * dot(ab, br),
+                                     2.0 * dot(ab, ab) + dot(qa, br), dot(qa, ab));
+
+        Point endDirection = direction(0.0);
+        f64 minDistance = nonZeroSign(cross(endDirection, qa)) * length(qa);
+        param = -dot(qa, endDirection) / dot(endDirection, endDirection);
+        {
+            endDirection = direction(1.0);
+            const f64 distance = length(p[2] - origin);
+            if (distance < std::fabs(minDistance))
+            {
+                minDistance = nonZeroSign(cross(endDirection, p[2] - origin)) * distance;
+                param = dot(origin - p[1], endDirection) / dot(endDirection, endDirection);
+            }
+        }
+        for (int i = 0; i < count; ++i)
+        {
+            if (roots[i] > 0.0 && roots[i] < 1.0)
+            {
+                const Point qe = qa + ab * (2.0 * roots[i]) + br * (roots[i] * roots[i]);
+                const f64 distance = length(qe);
+                if (distance <= std::fabs(minDistance))
+                {
+                    minDistance = nonZeroSign(cross(ab + br * roots[i], qe)) * distance;
+                    param = roots[i];
+                }
+            }
+        }
+
+        if (param >= 0.0 && param <= 1.0)
+        {
+            return {minDistance, 0.0};
+        }
+        if (param < 0.5)
+        {
+            return {minDistance, std::fabs(dot(normalize(direction(0.0)), normalize(qa)))};
+        }
+        return {minDistance,
+                std::fabs(dot(normalize(direction(1.0)), normalize(p[2] - origin)))};
+    }
+
+    /**
+     * Beyond an endpoint, measure to the edge's tangent line instead, which
+     * keeps the channels of a corner's two edges straight up to the corner
+     */
+    void toPseudoDistance(SignedDistance& distance, Point origin, f64 param) const
+    {
+        if (param < 0.0)
+        {
+            const Point dir = normalize(direction(0.0));
+            const Point aq = origin - start();
+            if (dot(aq, dir) < 0.0)
+            {
+                const f64 pseudo = cross(aq, dir);
+                if (std::fabs(pseudo) <= std::fabs(distance.distance))
+                {
+                    distance = {pseudo, 0.0};
+                }
+            }
+        }
+        else if (param > 1.0)
+        {
+            const Point dir = normalize(direction(1.0));
+            const Point bq = origin - end();
+            if (dot(bq, dir) > 0.0)
+            {
+                const f64 pseudo = cross(bq, dir);
+                if (std::fabs(pseudo) <= std::fabs(distance.distance))
+                {
+                    distance = {pseudo, 0.0};
+                }
+            }
+        }
+    }
+};
+
+using Contour = std::vector<Edge>;
+
+struct Shape
+{
+    std::vector<Contour> contours;
+
+    [[nodiscard]] bool empty() const
+    {
+        for (const auto& contour : contours)
+        {
+            if (!contour.empty())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+void reverseContour(Contour& contour)
+{
+    std::reverse(contour.begin(), contour.end());
+    for (auto& edge : contour)
+    {
+        edge.reverse();
+    }
+}
+
+// Twice the signed area, positive for counter-clockwise contours (y up)
+f64 signedArea(const Shape& shape)
+{
+    f64 area = 0.0;
+    for (const auto& contour : shape.contours)
+    {
+        for (const auto& edge : contour)
+        {
+            area += cross(edge.p[0], edge.p[1]);
+            if (edge.quadratic)
+            {
+                area += cross(edge.p[1], edge.p[2]);
+            }
+        }
+    }
+    return area;
+}
+
+// ============================================================================
+// Edge coloring
+// ============================================================================
+
+void switchColor(u8& color, u64& seed, u8 banned = Black)
+{
+    const u8 combined = color & banned;
+    if (combined == Red || combined == Green || combined == Blue)
+    {
+        color = combined ^ White;
+        return;
+    }
+    if (color == Black || color == White)
+    {
+        static constexpr u8 START[3] = {Cyan, Magenta, Yellow};
+        color = START[seed % 3];
+        seed /= 3;
+        return;
+    }
+    const u32 shifted = static_cast<u32>(color) << (1 + (seed & 1));
+    color = static_cast<u8>((shifted | shifted >> 3) & White);
+    seed >>= 1;
+}
+
+int symmetricalTrichotomy(int position, int n)
+{
+    return static_cast<int>(3.0 + 2.875 * position / (n - 1) - 1.4375 + 0.5) - 3;
+}
+
+/**
+ * Assign channels so that the two edges meeting at every sharp corner
+ * differ in at least two channels; smooth contours stay white
+ */
+void colorEdges(Shape& shape, u64 seed)
+{
+    constexpr f64 ANGLE_THRESHOLD = 3.0; // Radians
+    const f64 crossThreshold = std::sin(ANGLE_THRESHOLD);
+
+    for (auto& contour : shape.contours)
+    {
+        if (contour.empty())
+        {
+            continue;
+        }
+
+        std::vector<usize> corners;
+        Point previous = normalize(contour.back().direction(1.0));
+        for (usize i = 0; i < contour.size(); ++i)
+        {
+            const Point current = normalize(contour[i].direction(0.0));
+            if (dot(previous, current) <= 0.0 || std::fabs(cross(previous, current)) > crossThreshold)
+            {
+                corners.push_back(i);
+            }
+            previous = normalize(contour[i].direction(1.0));
+        }
+
+        if (corners.empty())
+        {
+            for (auto& edge : contour)
+            {
+                edge.color = White;
+            }
+            continue;
+        }
+
+        if (corners.size() == 1)
+        {
+            // A teardrop: spread three colors around the contour, splitting
+            // short contours so there are enough edges to carry them
+            usize corner = corners[0];
+            if (contour.size() < 3)
+            {
+                Contour split;
+                for (const auto& edge : contour)
+                {
+                    Edge parts[3];
+                    edge.splitInThirds(parts);
+                    split.insert(split.end(), parts, parts + 3);
+                }
+                contour = std::move(split);
+                corner *= 3;
+            }
+
+            u8 colors[3] = {White, White, White};
+            switchColor(colors[0], seed);
+            colors[2] = colors[0];
+            switchColor(colors[2], seed);
+            const int m = static_cast<int>(contour.size());
+            for (int i = 0; i < m; ++i)
+            {
+                contour[(corner + static_cast<usize>(i)) % static_cast<usize>(m)].color =
+                    colors[1 + symmetricalTrichotomy(i, m)];
+            }
+            continue;
+        }
+
+        // Switch color at every corner, never ending on the initial color
+        const usize cornerCount = corners.size();
+        const usize m = contour.size();
+        usize spline = 0;
+        const usize startIndex = corners[0];
+        u8 color = White;
+        switchColor(color, seed);
+        const u8 initialColor = color;
+        for (usize i = 0; i < m; ++i)
+        {
+            const usize index = (startIndex + i) % m;
+            if (spline + 1 < cornerCount && corners[spline + 1] == index)
+            {
+                ++spline;
+                switchColor(color, seed, spline == cornerCount - 1 ? initialColor : u8{Black});
+            }
+            contour[index].color = color;
+        }
+    }
+}
+
+// ============================================================================
+// Field generation
+// ============================================================================
+
+struct Crossing
+{
+    f64 x;
+    int direction;
+};
+
+void addLineCrossing(Point a, Point b, f64 y, std::vector<Crossing>& out)
+{
+    if ((a.y <= y && y < b.y) || (b.y <= y && y < a.y))
+    {
+        const f64 t = (y - a.y) / (b.y - a.y);
+        out.push_back({a.x + (b.x - a.x) * t, b.y > a.y ? 1 : -1});
+    }
+}
+
+// Points where a horizontal line crosses the outline, for nonzero winding
+void rowCrossings(const Shape& shape, f64 y, std::vector<Crossing>& out)
+{
+    out.clear();
+    for (const auto& contour : shape.contours)
+    {
+        for (const auto& edge : contour)
+        {
+            if (!edge.quadratic)
+            {
+                addLineCrossing(edge.p[0], edge.p[1], y, out);
+                continue;
+            }
+
+            // Split at the vertical extremum into y-monotone pieces
+            const f64 y0 = edge.p[0].y;
+            const f64 y1 = edge.p[1].y;
+            const f64 y2 = edge.p[2].y;
+            const f64 a = y0 - 2.0 * y1 + y2;
+            f64 bounds[3] = {0.0, 1.0, 1.0};
+            int pieces = 1;
+            if (a != 0.0)
+            {
+                const f64 extremum = (y0 - y1) / a;
+                if (extremum > 0.0 && extremum < 1.0)
+                {
+                    bounds[1] = extremum;
+                    pieces = 2;
+                }
+            }
+
+            for (int piece = 0; piece < pieces; ++piece)
+            {
+                const f64 ta = bounds[piece];
+                const f64 tb = bounds[piece + 1];
+                const f64 ya = edge.point(ta).y;
+                const f64 yb = edge.point(tb).y;
+                if (!((ya <= y && y < yb) || (yb <= y && y < ya)))
+                {
+                    continue;
+                }
+
+                f64 roots[2];
+                const int count = solveQuadratic(roots, a, 2.0 * (y1 - y0), y0 - y);
+                f64 t = (ta + tb) * 0.5;
+                for (int i = 0; i < count; ++i)
+                {
+                    if (roots[i] >= ta - 1e-9 && roots[i] <= tb + 1e-9)
+                    {
+                        t = std::clamp(roots[i], ta, tb);
+                        break;
+                    }
+                }
+                out.push_back({edge.point(t).x, yb > ya ? 1 : -1});
+            }
+        }
+    }
+    std::sort(out.begin(), out.end(),
+              [](const Crossing& lhs, const Crossing& rhs) { return lhs.x < rhs.x; });
+}
+
+u8 encodeDistance(f64 distance, f64 range)
+{
+    const f64 value = std::clamp(distance / range + 0.5, 0.0, 1.0);
+    return static_cast<u8>(std::lround(value * 255.0));
+}
+
+/**
+ * Write the field of @p shape (pixel units, y up) into a page rectangle
+ * whose bottom-left texel corner sits at (left, bottom) in shape space
+ */
+void generateField(const Shape& shape, f64 left, f64 bottom, u32 width, u32 height, f64 range,
+                   u8* dst, usize dstStride)
+{
+    std::vector<Crossing> crossings;
+    for (u32 row = 0; row < height; ++row)
+    {
+        const f64 py = bottom + static_cast<f64>(height - row) - 0.5;
+        rowCrossings(shape, py, crossings);
+        usize crossed = 0;
+        int winding = 0;
+        for (const auto& crossing : crossings)
+        {
+            winding += crossing.direction;
+        }
+
+        u8* out = dst + row * dstStride;
+        for (u32 col = 0; col < width; ++col)
+        {
+            const Point origin{left + col + 0.5, py};
+            while (crossed < crossings.size() && crossings[crossed].x <= origin.x)
+            {
+                winding -= crossings[crossed].direction;
+                ++crossed;
+            }
+            const bool inside = winding != 0;
+
+            SignedDistance nearest;
+            SignedDistance channel[3];
+            const Edge* channelEdge[3] = {nullptr, nullptr, nullptr};
+            f64 channelParam[3] = {0.0, 0.0, 0.0};
+            for (const auto& contour : shape.contours)
+            {
+                for (const auto& edge : contour)
+                {
+                    f64 param = 0.0;
+                    const SignedDistance distance = edge.signedDistance(origin, param);
+                    if (distance < nearest)
+                    {
+                        nearest = distance;
+                    }
+                    for (int c = 0; c < 3; ++c)
+                    {
+                        if ((edge.color & (1 << c)) && distance < channel[c])
+                        {
+                            channel[c] = distance;
+                            channelEdge[c] = &edge;
+                            channelParam[c] = param;
+                        }
+                    }
+                }
+            }
+
+            f64 values[3];
+            for (int c = 0; c < 3; ++c)
+            {
+                if (channelEdge[c])
+                {
+                    channelEdge[c]->toPseudoDistance(channel[c], origin, channelParam[c]);
+                }
+                values[c] = channel[c].distance;
+            }
+
+            const f64 trueDistance = inside ? std::fabs(nearest.distance)
+                                            : -std::fabs(nearest.distance);
+            const f64 median = std::max(std::min(values[0], values[1]),
+                                        std::min(std::max(values[0], values[1]), values[2]));
+            if ((median > 0.0) != inside)
+            {
+                values[0] = values[1] = values[2] = trueDistance;
+            }
+
+            out[col * 4 + 0] = encodeDistance(values[0], range);
+            out[col * 4 + 1] = encodeDistance(values[1], range);
+            out[col * 4 + 2] = encodeDistance(values[2], range);
+            out[col * 4 + 3] = encodeDistance(trueDistance, range);
+        }
+    }
+}
+
+// ============================================================================
+// TrueType parsing
+// ============================================================================
+
+// Big-endian reads; out-of-range reads return zero and are caught by the
+// structural checks of the callers
+struct FontReader
+{
+    const u8* data = nullptr;
+    usize size = 0;
+
+    [[nodiscard]] bool inRange(usize offset, usize bytes) const
+    {
+        return offset <= size && bytes <= size - offset;
+    }
+
+    [[nodiscard]] u8 u8At(usize offset) const
+    {
+        return inRange(offset, 1) ? data[offset] : 0;
+    }
+
+    [[nodiscard]] u16 u16At(usize offset) const
+    {
+        return inRange(offset, 2) ? static_cast<u16>(data[offset] << 8 | data[offset + 1]) : 0;
+    }
+
+    [[nodiscard]] i16 i16At(usize offset) const
+    {
+        return static_cast<i16>(u16At(offset));
+    }
+
+    [[nodiscard]] u32 u32At(usize offset) const
+    {
+        return inRange(offset, 4) ? (static_cast<u32>(data[offset]) << 24 |
+                                     static_cast<u32>(data[offset + 1]) << 16 |
+                                     static_cast<u32>(data[offset + 2]) << 8 |
+                                     static_cast<u32>(data[offset + 3]))
+                                  : 0;
+    }
+};
+
+struct Table
+{
+    usize offset = 0;
+    usize length = 0;
+    bool found = false;
+};
+
+// Maps font units into output space: x' = xx*x + xy*y + dx, y' = yx*x + yy*y + dy
+struct Transform
+{
+    f64 xx = 1.0;
+    f64 xy = 0.0;
+    f64 yx = 0.0;
+    f64 yy = 1.0;
+    f64 dx = 0.0;
+    f64 dy = 0.0;
+
+    [[nodiscard]] Point apply(f64 x, f64 y) const
+    {
+        return {xx * x + xy * y + dx, yx * x + yy * y + dy};
+    }
+
+    [[nodiscard]] Transform then(const Transform& outer) const
+    {
+        Transform t;
+        t.xx = outer.xx * xx + outer.xy * yx;
+        t.xy = outer.xx * xy + outer.xy * yy;
+        t.yx = outer.yx * xx + outer.yy * yx;
+        t.yy = outer.yx * xy + outer.yy * yy;
+        t.dx = outer.xx * dx + outer.xy * dy + outer.dx;
+        t.dy = outer.yx * dx + outer.yy * dy + outer.dy;
+        return t;
+    }
+};
+
+class TrueTypeFont
+{
+public:
+    Result<void> parse(const u8* data, usize size);
+
+    [[nodiscard]] u16 getUnitsPerEm() const { return m_unitsPerEm; }
+    [[nodiscard]] i16 getAscender() const { return m_ascender; }
+    [[nodiscard]] i16 getDescender() const { return m_descender; }
+    [[nodiscard]] i16 getLineGap() const { return m_lineGap; }
+    [[nodiscard]] const std::vector<std::pair<u32, u16>>& getCharacterMap() const
+    {
+        return m_cmap;
+    }
+
+    [[nodiscard]] u16 getAdvance(u16 glyph) const;
+    void appendOutline(u16 glyph, const Transform& transform, Shape& shape, int depth = 0) const;
+
+    template <typename Callback>
+    void forEachKerningPair(Callback&& callback) const;
+
+private:
+    [[nodiscard]] bool glyphRange(u16 glyph, usize& offset, usize& length) const;
+    void appendSimpleGlyph(usize offset, i16 contourCount, const Transform& transform,
+                           Shape& shape) const;
+    void parseCharacterMap();
+
+    FontReader m_reader;
+    Table m_head;
+    Table m_hhea;
+    Table m_maxp;
+    Table m_cmapTable;
+    Table m_hmtx;
+    Table m_loca;
+    Table m_glyf;
+    Table m_kern;
+    u16 m_unitsPerEm = 0;
+    u16 m_glyphCount = 0;
+    u16 m_hMetricCount = 0;
+    bool m_longLoca = false;
+    i16 m_ascender = 0;
+    i16 m_descender = 0;
+    i16 m_lineGap = 0;
+    std::vector<std::pair<u32, u16>> m_cmap; // Sorted by codepoint
+};
+
+Result<void> TrueTypeFont::parse(const u8* data, usize size)
+{
+    m_reader = FontReader{data, size};
+    const u32 version = m_reader.u32At(0);
+    if (version == 0x4F54544F) // "OTTO"
+    {
+        return Result<void>::error("CFF-based OpenType fonts are not supported");
+    }
+    if (version == 0x74746366) // "ttcf"
+    {
+        return Result<void>::error("Font collections are not supported");
+    }
+    if (version != 0x00010000 && version != 0x74727565) // 1.0 or "true"
+    {
+        return Result<void>::error("Not a TrueType font");
+    }
+
+    const u16 tableCount = m_reader.u16At(4);
+    if (!m_reader.inRange(12, static_cast<usize>(tableCount) * 16))
+    {
+        return Result<void>::error("Truncated font table directory");
+    }
+    for (u16 i = 0; i < tableCount; ++i)
+    {
+        const usize record = 12 + static_cast<usize>(i) * 16;
+        const u32 tag = m_reader.u32At(record);
+        Table table;
+        table.offset = m_reader.u32At(record + 8);
+        table.length = m_reader.u32At(record + 12);
+        table.found = m_reader.inRange(table.offset, table.length);
+        switch (tag)
+        {
+            case 0x68656164: m_head = table; break; // head
+            case 0x68686561: m_hhea = table; break; // hhea
+            case 0x6D617870: m_maxp = table; break; // maxp
+            case 0x636D6170: m_cmapTable = table; break; // cmap
+            case 0x686D7478: m_hmtx = table; break; // hmtx
+            case 0x6C6F6361: m_loca = table; break; // loca
+            case 0x676C7966: m_glyf = table; break; // glyf
+            case 0x6B65726E: m_kern = table; break; // kern
+            default: break;
+        }
+    }
+
+    if (!m_head.found || !m_hhea.found || !m_maxp.found || !m_cmapTable.found ||
+        !m_hmtx.found || !m_loca.found || !m_glyf.found)
+    {
+        return Result<void>::error("Font is missing required TrueType tables");
+    }
+
+    m_unitsPerEm = m_reader.u16At(m_head.offset + 18);
+    m_longLoca = m_reader.i16At(m_head.offset + 50) != 0;
+    m_glyphCount = m_reader.u16At(m_maxp.offset + 4);
+    m_ascender = m_reader.i16At(m_hhea.offset + 4);
+    m_descender = m_reader.i16At(m_hhea.offset + 6);
+    m_lineGap = m_reader.i16At(m_hhea.offset + 8);
+    m_hMetricCount = m_reader.u16At(m_hhea.offset + 34);
+    if (m_unitsPerEm == 0 || m_glyphCount == 0 || m_hMetricCount == 0 ||
+        m_hMetricCount > m_glyphCount)
+    {
+        return Result<void>::error("Corrupt font header");
+    }
+    const usize locaEntry = m_longLoca ? 4 : 2;
+    if (m_loca.length < (static_cast<usize>(m_glyphCount) + 1) * locaEntry ||
+        m_hmtx.length < static_cast<usize>(m_hMetricCount) * 4)
+    {
+        return Result<void>::error("Truncated glyph location or metrics table");
+    }
+
+    parseCharacterMap();
+    if (m_cmap.empty())
+    {
+        return Result<void>::error("Font has no Unicode character map");
+    }
+    return Result<void>::ok();
+}
+
+void TrueTypeFont::parseCharacterMap()
+{
+    const usize base = m_cmapTable.offset;
+    const u16 subtableCount = m_reader.u16At(base + 2);
+
+    // Prefer full-repertoire format 12 over the BMP-only format 4
+    usize best = 0;
+    int bestScore = 0;
+    for (u16 i = 0; i < subtableCount; ++i)
+    {
+        const usize record = base + 4 + static_cast<usize>(i) * 8;
+        const u16 platform = m_reader.u16At(record);
+        const u16 encoding = m_reader.u16At(record + 2);
+        const usize offset = base + m_reader.u32At(record + 4);
+        const u16 format = m_reader.u16At(offset);
+        const bool unicode = platform == 0 || (platform == 3 && (encoding == 1 || encoding == 10));
+        if (!unicode || !m_reader.inRange(offset, 4))
+        {
+            continue;
+        }
+        const int score = format == 12 ? 2 : format == 4 ? 1 : 0;
+        if (score > bestScore)
+        {
+            best = offset;
+            bestScore = score;
+        }
+    }
+
+    m_cmap.clear();
+    if (bestScore == 2)
+    {
+        const u32 groupCount = m_reader.u32At(best + 12);
+        for (u32 g = 0; g < groupCount && m_reader.inRange(best + 16 + g * 12ull, 12); ++g)
+        {
+            const usize group = best + 16 + static_cast<usize>(g) * 12;
+            const u32 first = m_reader.u32At(group);
+            const u32 last = std::min(m_reader.u32At(group + 4), 0x10FFFFu);
+            const u32 glyph = m_reader.u32At(group + 8);
+            for (u32 cp = first; cp <= last && glyph + (cp - first) < m_glyphCount; ++cp)
+            {
+                m_cmap.emplace_back(cp, static_cast<u16>(glyph + (cp - first)));
+            }
+        }
+    }
+    else if (bestScore == 1)
+    {
+        const usize segmentCount = m_reader.u16At(best + 6) / 2;
+        const usize endCodes = best + 14;
+        const usize startCodes = endCodes + segmentCount * 2 + 2;
+        const usize deltas = startCodes + segmentCount * 2;
+        const usize rangeOffsets = deltas + segmentCount * 2;
+        for (usize s = 0; s < segmentCount; ++s)
+        {
+            const u32 first = m_reader.u16At(startCodes + s * 2);
+            const u32 last = m_reader.u16At(endCodes + s * 2);
+            const u16 delta = m_reader.u16At(deltas + s * 2);
+            const usize rangeOffsetPos = rangeOffsets + s * 2;
+            const u16 rangeOffset = m_reader.u16At(rangeOffsetPos);
+            for (u32 cp = first; cp <= last && cp != 0xFFFF; ++cp)
+            {
+                u16 glyph;
+                if (rangeOffset == 0)
+                {
+                    glyph = static_cast<u16>(cp + delta);
+                }
+                else
+                {
+                    glyph = m_reader.u16At(rangeOffsetPos + rangeOffset + (cp - first) * 2);
+                    if (glyph != 0)
+                    {
+                        glyph = static_cast<u16>(glyph + delta);
+                    }
+                }
+                if (glyph != 0 && glyph < m_glyphCount)
+                {
+                    m_cmap.emplace_back(cp, glyph);
+                }
+            }
+        }
+    }
+
+    std::sort(m_cmap.begin(), m_cmap.end());
+    m_cmap.erase(std::unique(m_cmap.begin(), m_cmap.end(),
+                             [](const auto& a, const auto& b) { return a.first == b.first; }),
+                 m_cmap.end());
+}
+
+u16 TrueTypeFont::getAdvance(u16 glyph) const
+{
+    const u16 index = glyph < m_hMetricCount ? glyph : static_cast<u16>(m_hMetricCount - 1);
+    return m_reader.u16At(m_hmtx.offset + static_cast<usize>(index) * 4);
+}
+
+bool TrueTypeFont::glyphRange(u16 glyph, usize& offset, usize& length) const
+{
+    if (glyph >= m_glyphCount)
+    {
+        return false;
+    }
+    usize start;
+    usize end;
+    if (m_longLoca)
+    {
+        start = m_reader.u32At(m_loca.offset + static_cast<usize>(glyph) * 4);
+        end = m_reader.u32At(m_loca.offset + static_cast<usize>(glyph) * 4 + 4);
+    }
+    else
+    {
+        start = static_cast<usize>(m_reader.u16At(m_loca.offset + static_cast<usize>(glyph) * 2)) * 2;
+        end = static_cast<usize>(m_reader.u16At(m_loca.offset + static_cast<usize>(glyph) * 2 + 2)) * 2;
+    }
+    if (end <= start || end > m_glyf.length)
+    {
+        return false;
+    }
+    offset = m_glyf.offset + start;
+    length = end - start;
+    return true;
+}
+
+void TrueTypeFont::appendOutline(u16 glyph, const Transform& transform, Shape& shape,
+                                 int depth) const
+{
+    constexpr int MAX_COMPONENT_DEPTH = 8;
+    usize offset;
+    usize length;
+    if (depth > MAX_COMPONENT_DEPTH || !glyphRange(glyph, offset, length) || length < 10)
+    {
+        return;
+    }
+
+    const i16 contourCount = m_reader.i16At(offset);
+    if (contourCount >= 0)
+    {
+        appendSimpleGlyph(offset, contourCount, transform, shape);
+        return;
+    }
+
+    // Composite glyph: transformed references to other glyphs
+    constexpr u16 ARGS_ARE_WORDS = 0x0001;
+    constexpr u16 ARGS_ARE_XY_VALUES = 0x0002;
+    constexpr u16 HAVE_SCALE = 0x0008;
+    constexpr u16 MORE_COMPONENTS = 0x0020;
+    constexpr u16 HAVE_XY_SCALE = 0x0040;
+    constexpr u16 HAVE_TWO_BY_TWO = 0x0080;
+
+    usize pos = offset + 10;
+    const usize end = offset + length;
+    u16 flags;
+    do
+    {
+        if (pos + 4 > end)
+        {
+            return;
+        }
+        flags = m_reader.u16At(pos);
+        const u16 component = m_reader.u16At(pos + 2);
+        pos += 4;
+
+        Transform local;
+        if (flags & ARGS_ARE_WORDS)
+        {
+            if (flags & ARGS_ARE_XY_VALUES)
+            {
+                local.dx = m_reader.i16At(pos);
+                local.dy = m_reader.i16At(pos + 2);
+            }
+            pos += 4;
+        }
+        else
+        {
+            if (flags & ARGS_ARE_XY_VALUES)
+            {
+                local.dx = static_cast<i8>(m_reader.u8At(pos));
+                local.dy = static_cast<i8>(m_reader.u8At(pos + 1));
+            }
+            pos += 2;
+        }
+        // Point-matched placement (ARGS_ARE_XY_VALUES unset) is left at the origin
+
+        auto f2dot14 = [this](usize at) { return m_reader.i16At(at) / 16384.0; };
+        if (flags & HAVE_SCALE)
+        {
+            local.xx = local.yy = f2dot14(pos);
+            pos += 2;
+        }
+        else if (flags & HAVE_XY_SCALE)
+        {
+            local.xx = f2dot14(pos);
+            local.yy = f2dot14(pos + 2);
+            pos += 4;
+        }
+        else if (flags & HAVE_TWO_BY_TWO)
+        {
+            local.xx = f2dot14(pos);
+            local.yx = f2dot14(pos + 2);
+            local.xy = f2dot14(pos + 4);
+            local.yy = f2dot14(pos + 6);
+            pos += 8;
+        }
+
+        appendOutline(component, local.then(transform), shape, depth + 1);
+    } while (flags & MORE_COMPONENTS);
+}
+
+void TrueTypeFont::appendSimpleGlyph(usize offset, i16 contourCount, const Transform& transform,
+                                     Shape& shape) const
+{
+    constexpr u8 ON_CURVE = 0x01;
+    constexpr u8 X_SHORT = 0x02;
+    constexpr u8 Y_SHORT = 0x04;
+    constexpr u8 REPEAT = 0x08;
+    constexpr u8 X_SAME_OR_POSITIVE = 0x10;
+    constexpr u8 Y_SAME_OR_POSITIVE = 0x20;
+
+    if (contourCount == 0)
+    {
+        return;
+    }
+    const usize endPoints = offset + 10;
+    const usize pointCount =
+        static_cast<usize>(m_reader.u16At(endPoints + (static_cast<usize>(contourCount) - 1) * 2)) + 1;
+    const usize instructionLength =
+        m_reader.u16At(endPoints + static_cast<usize>(contourCount) * 2);
+    usize pos = endPoints + static_cast<usize>(contourCount) * 2 + 2 + instructionLength;
+
+    std::vector<u8> flags;
+    flags.reserve(pointCount);
+    while (flags.size() < pointCount)
+    {
+        if (!m_reader.inRange(pos, 1))
+        {
+            return;
+        }
+        const u8 flag = m_reader.u8At(pos++);
+        flags.push_back(flag);
+        if (flag & REPEAT)
+        {
+            const u8 repeat = m_reader.u8At(pos++);
+            for (u8 r = 0; r < repeat && flags.size() < pointCount; ++r)
+            {
+                flags.push_back(flag);
+            }
+        }
+    }
+
+    std::vector<Point> points(pointCount);
+    i32 value = 0;
+    for (usize i = 0; i < pointCount; ++i)
+    {
+        if (flags[i] & X_SHORT)
+        {
+            const i32 delta = m_reader.u8At(pos++);
+            value += (flags[i] & X_SAME_OR_POSITIVE) ? delta : -delta;
+        }
+        else if (!(flags[i] & X_SAME_OR_POSITIVE))
+        {
+            value += m_reader.i16At(pos);
+            pos += 2;
+        }
+        points[i].x = value;
+    }
+    value = 0;
+    for (usize i = 0; i < pointCount; ++i)
+    {
+        if (flags[i] & Y_SHORT)
+        {
+            const i32 delta = m_reader.u8At(pos++);
+            value += (flags[i] & Y_SAME_OR_POSITIVE) ? delta : -delta;
+        }
+        else if (!(flags[i] & Y_SAME_OR_POSITIVE))
+        {
+            value += m_reader.i16At(pos);
+            pos += 2;
+        }
+        points[i].y = value;
+    }
+    if (!m_reader.inRange(0, pos))
+    {
+        return;
+    }
+
+    const bool mirrored = transform.xx * transform.yy - transform.xy * transform.yx < 0.0;
+    usize first = 0;
+    for (i16 c = 0; c < contourCount; ++c)
+    {
+        const usize last = m_reader.u16At(endPoints + static_cast<usize>(c) * 2);
+        if (last < first || last >= pointCount)
+        {
+            return;
+        }
+
+        // Insert the implied on-curve points between consecutive off-curve ones
+        struct OutlinePoint
+        {
+            Point position;
+            bool onCurve;
+        };
+        std::vector<OutlinePoint> ring;
+        const usize n = last - first + 1;
+        for (usize i = 0; i < n; ++i)
+        {
+            const usize index = first + i;
+            const usize next = first + (i + 1) % n;
+            const Point current = transform.apply(points[index].x, points[index].y);
+            const bool onCurve = (flags[index] & ON_CURVE) != 0;
+            ring.push_back({current, onCurve});
+            if (!onCurve && !(flags[next] & ON_CURVE))
+            {
+                const Point following = transform.apply(points[next].x, points[next].y);
+                ring.push_back({(current + following) * 0.5, true});
+            }
+        }
+        first = last + 1;
+
+        usize startIndex = 0;
+        while (startIndex < ring.size() && !ring[startIndex].onCurve)
+        {
+            ++startIndex;
+        }
+        if (startIndex == ring.size())
+        {
+            continue;
+        }
+
+        Contour contour;
+        const usize count = ring.size();
+        Point cursor = ring[startIndex].position;
+        for (usize i = 1; i <= count; ++i)
+        {
+            const OutlinePoint& point = ring[(startIndex + i) % count];
+            Edge edge;
+            edge.p[0] = cursor;
+            if (point.onCurve)
+            {
+                edge.p[1] = point.position;
+            }
+            else
+            {
+                const Point endPoint = ring[(startIndex + i + 1) % count].position;
+                edge.quadratic = true;
+                edge.p[1] = point.position;
+                edge.p[2] = endPoint;
+                ++i;
+                const Point control = point.position;
+                if (cross(control - cursor, endPoint - cursor) == 0.0 &&
+                    dot(control - cursor, endPoint - control) >= 0.0)
+                {
+                    // Degenerate curve: a straight line
+                    edge.quadratic = false;
+                    edge.p[1] = endPoint;
+                }
+            }
+            cursor = edge.end();
+            if (edge.start().x != edge.end().x || edge.start().y != edge.end().y)
+            {
+                contour.push_back(edge);
+            }
+        }
+
+        if (!contour.empty())
+        {
+            if (mirrored)
+            {
+                reverseContour(contour);
+            }
+            shape.contours.push_back(std::move(contour));
+        }
+    }
+}
+
+template <typename Callback>
+void TrueTypeFont::forEachKerningPair(Callback&& callback) const
+{
+    if (!m_kern.found || m_reader.u16At(m_kern.offset) != 0)
+    {
+        return;
+    }
+
+    const u16 subtableCount = m_reader.u16At(m_kern.offset + 2);
+    usize pos = m_kern.offset + 4;
+    for (u16 s = 0; s < subtableCount && m_reader.inRange(pos, 6); ++s)
+    {
+        const u16 length = m_reader.u16At(pos + 2);
+        const u16 coverage = m_reader.u16At(pos + 4);
+        const bool horizontal = (coverage & 0x1) != 0;
+        const bool minimum = (coverage & 0x2) != 0;
+        const bool crossStream = (coverage & 0x4) != 0;
+        if ((coverage >> 8) == 0 && horizontal && !minimum && !crossStream)
+        {
+            const u16 pairCount = m_reader.u16At(pos + 6);
+            for (u16 p = 0; p < pairCount; ++p)
+            {
+                const usize pair = pos + 14 + static_cast<usize>(p) * 6;
+                if (!m_reader.inRange(pair, 6))
+                {
+                    break;
+                }
+                callback(m_reader.u16At(pair), m_reader.u16At(pair + 2),
+                         m_reader.i16At(pair + 4));
+            }
+        }
+        if (length == 0)
+        {
+            break;
+        }
+        pos += length;
+    }
+}
+
+struct GlyphJob
+{
+    u16 glyph = 0;
+    f64 left = 0.0;   // Field origin in em-scaled pixels
+    f64 bottom = 0.0;
+    u32 width = 0;
+    u32 height = 0;
+    u32 page = 0;
+    u32 x = 0;
+    u32 y = 0;
+};
+
+Shape loadShape(const TrueTypeFont& font, u16 glyph, f64 scale)
+{
+    Transform transform;
+    transform.xx = scale;
+    transform.yy = scale;
+    Shape shape;
+    font.appendOutline(glyph, transform, shape);
+
+    // Outer contours must run clockwise so that positive distances are inside
+    if (signedArea(shape) > 0.0)
+    {
+        for (auto& contour : shape.contours)
+        {
+            reverseContour(contour);
+        }
+    }
+    return shape;
+}
+
+} // namespace
+
+bool SdfFontBuilder::isTrueType(const u8* data, usize size)
+{
+    if (!data || size < 12)
+    {
+        return false;
+    }
+    const FontReader reader{data, size};
+    const u32 version = reader.u32At(0);
+    return version == 0x00010000 || version == 0x74727565;
+}
+
+Result<SdfFontBuild> SdfFontBuilder::build(const u8* fontData, usize size,
+                                           const SdfFontBuildOptions& options)
+{
+    if (!(options.emSize > 0.0f) || !(options.distanceRange > 0.0f) || options.pageSize == 0)
+    {
+        return Result<SdfFontBuild>::error("Invalid SDF font build options");
+    }
+
+    TrueTypeFont font;
+    auto parsed = font.parse(fontData, size);
+    if (parsed.isError())
+    {
+        return Result<SdfFontBuild>::error(parsed.error());
+    }
+
+    const f64 unitsPerEm = font.getUnitsPerEm();
+    const f64 scale = static_cast<f64>(options.emSize) / unitsPerEm;
+    const f64 range = options.distanceRange;
+    const auto& cmap = font.getCharacterMap();
+
+    // Codepoints to include, in codepoint order
+    std::vector<std::pair<u32, u16>> mapped;
+    if (options.codepoints.empty())
+    {
+        mapped = cmap;
+    }
+    else
+    {
+        std::vector<u32> wanted = options.codepoints;
+        std::sort(wanted.begin(), wanted.end());
+        wanted.erase(std::unique(wanted.begin(), wanted.end()), wanted.end());
+        for (u32 cp : wanted)
+        {
+            auto it = std::lower_bound(cmap.begin(), cmap.end(), std::make_pair(cp, u16{0}));
+            if (it != cmap.end() && it->first == cp)
+            {
+                mapped.push_back(*it);
+            }
+        }
+    }
+    if (mapped.empty())
+    {
+        return Result<SdfFontBuild>::error("Font maps none of the requested characters");
+    }
+
+    // One field per distinct glyph, sized from its outline bounds; codepoints
+    // that share a glyph share its atlas rectangle
+    std::vector<GlyphJob> jobs;
+    std::vector<usize> jobOfGlyph(65536, static_cast<usize>(-1));
+    const f64 padding = std::ceil(range * 0.5) + 1.0;
+    for (const auto& [cp, glyph] : mapped)
+    {
+        if (jobOfGlyph[glyph] != static_cast<usize>(-1))
+        {
+            continue;
+        }
+        jobOfGlyph[glyph] = jobs.size();
+
+        GlyphJob job;
+        job.glyph = glyph;
+        const Shape shape = loadShape(font, glyph, scale);
+        if (!shape.empty())
+        {
+            f64 minX = std::numeric_limits<f64>::max();
+            f64 minY = std::numeric_limits<f64>::max();
+            f64 maxX = std::numeric_limits<f64>::lowest();
+            f64 maxY = std::numeric_limits<f64>::lowest();
+            for (const auto& contour : shape.contours)
+            {
+                for (const auto& edge : contour)
+                {
+                    for (int i = 0; i < (edge.quadratic ? 3 : 2); ++i)
+                    {
+                        minX = std::min(minX, edge.p[i].x);
+                        minY = std::min(minY, edge.p[i].y);
+                        maxX = std::max(maxX, edge.p[i].x);
+                        maxY = std::max(maxY, edge.p[i].y);
+                    }
+                }
+            }
+            job.left = std::floor(minX) - padding;
+            job.bottom = std::floor(minY) - padding;
+            job.width = static_cast<u32>(std::ceil(maxX) + padding - job.left);
+            job.height = static_cast<u32>(std::ceil(maxY) + padding - job.bottom);
+            if (job.width + options.glyphSpacing > options.pageSize ||
+                job.height + options.glyphSpacing > options.pageSize || job.width > 0xFFFF ||
+                job.height > 0xFFFF)
+            {
+                return Result<SdfFontBuild>::error("Glyph does not fit on an atlas page");
+            }
+        }
+        jobs.push_back(job);
+    }
+
+    // Shelf-pack in codepoint order so every page covers a contiguous range
+    SdfFontBuild build;
+    const u32 spacing = options.glyphSpacing;
+    u32 penX = spacing;
+    u32 penY = spacing;
+    u32 shelfHeight = 0;
+    u32 page = 0;
+    bool pageUsed = false;
+    for (auto& job : jobs)
+    {
+        if (job.width == 0)
+        {
+            continue;
+        }
+        if (penX + job.width + spacing > options.pageSize)
+        {
+            penX = spacing;
+            penY += shelfHeight + spacing;
+            shelfHeight = 0;
+        }
+        if (penY + job.height + spacing > options.pageSize)
+        {
+            build.pageHeights.push_back(options.pageSize);
+            ++page;
+            penX = spacing;
+            penY = spacing;
+            shelfHeight = 0;
+        }
+        job.page = page;
+        job.x = penX;
+        job.y = penY;
+        penX += job.width + spacing;
+        shelfHeight = std::max(shelfHeight, job.height);
+        pageUsed = true;
+    }
+    if (pageUsed)
+    {
+        // Trim the last page to its used rows
+        const u32 usedHeight = std::min(options.pageSize, (penY + shelfHeight + spacing + 3) & ~3u);
+        build.pageHeights.push_back(usedHeight);
+    }
+
+    const u32 pageWidth = options.pageSize;
+    build.pages.resize(build.pageHeights.size());
+    for (usize p = 0; p < build.pages.size(); ++p)
+    {
+        build.pages[p].assign(static_cast<usize>(pageWidth) * build.pageHeights[p] * 4, 0);
+    }
+
+    // Fields are independent and write disjoint page rectangles
+    std::atomic<usize> nextJob{0};
+    auto worker = [&]() {
+        for (usize index = nextJob.fetch_add(1); index < jobs.size();
+             index = nextJob.fetch_add(1))
+        {
+            const GlyphJob& job = jobs[index];
+            if (job.width == 0)
+            {
+                continue;
+            }
+            Shape shape = loadShape(font, job.glyph, scale);
+            colorEdges(shape, 0);
+            const usize stride = static_cast<usize>(pageWidth) * 4;
+            u8* dst = build.pages[job.page].data() + job.y * stride + job.x * 4;
+            generateField(shape, job.left, job.bottom, job.width, job.height, range, dst, stride);
+        }
+    };
+    u32 threadCount = options.threadCount > 0 ? options.threadCount
+                                              : std::max(1u, std::thread::hardware_concurrency());
+    threadCount = static_cast<u32>(std::min<usize>(threadCount, jobs.size()));
+    std::vector<std::thread> threads;
+    for (u32 t = 1; t < threadCount; ++t)
+    {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Metrics tables
+    SdfFontMetrics& metrics = build.metrics;
+    metrics.emSize = options.emSize;
+    metrics.distanceRange = options.distanceRange;
+    metrics.ascender = static_cast<f32>(font.getAscender() / unitsPerEm);
+    metrics.descender = static_cast<f32>(font.getDescender() / unitsPerEm);
+    metrics.lineGap = static_cast<f32>(font.getLineGap() / unitsPerEm);
+    metrics.pageWidth = pageWidth;
+    metrics.pageHeight = build.pageHeights.empty()
+                             ? 0
+                             : *std::max_element(build.pageHeights.begin(),
+                                                 build.pageHeights.end());
+    metrics.pageCount = static_cast<u32>(build.pages.size());
+
+    const f64 emSize = options.emSize;
+    metrics.glyphs.reserve(mapped.size());
+    for (const auto& [cp, glyph] : mapped)
+    {
+        const GlyphJob& job = jobs[jobOfGlyph[glyph]];
+        SdfGlyph out{};
+        out.codepoint = cp;
+        out.advance = static_cast<f32>(font.getAdvance(glyph) / unitsPerEm);
+        if (job.width > 0)
+        {
+            out.page = job.page;
+            out.atlasX = static_cast<u16>(job.x);
+            out.atlasY = static_cast<u16>(job.y);
+            out.atlasWidth = static_cast<u16>(job.width);
+            out.atlasHeight = static_cast<u16>(job.height);
+            out.planeLeft = static_cast<f32>(job.left / emSize);
+            out.planeBottom = static_cast<f32>(job.bottom / emSize);
+            out.planeRight = static_cast<f32>((job.left + job.width) / emSize);
+            out.planeTop = static_cast<f32>((job.bottom + job.height) / emSize);
+        }
+        metrics.glyphs.push_back(out);
+    }
+
+    // Kerning between included glyphs, expanded to their codepoints
+    std::vector<std::vector<u32>> codepointsOfJob(jobs.size());
+    for (const auto& [cp, glyph] : mapped)
+    {
+        codepointsOfJob[jobOfGlyph[glyph]].push_back(cp);
+    }
+    font.forEachKerningPair([&](u16 left, u16 right, i16 value) {
+        if (value == 0 || jobOfGlyph[left] == static_cast<usize>(-1) ||
+            jobOfGlyph[right] == static_cast<usize>(-1))
+        {
+            return;
+        }
+        const f32 adjust = static_cast<f32>(value / unitsPerEm);
+        for (u32 l : codepointsOfJob[jobOfGlyph[left]])
+        {
+            for (u32 r : codepointsOfJob[jobOfGlyph[right]])
+            {
+                metrics.kerning.push_back({l, r, adjust});
+            }
+        }
+    });
+    std::sort(metrics.kerning.begin(), metrics.kerning.end(),
+              [](const SdfKerningPair& a, const SdfKerningPair& b) {
+                  return a.left < b.left || (a.left == b.left && a.right < b.right);
+              });
+    metrics.kerning.erase(std::unique(metrics.kerning.begin(), metrics.kerning.end(),
+                                      [](const SdfKerningPair& a, const SdfKerningPair& b) {
+                                          return a.left == b.left && a.right == b.right;
+                                      }),
+                          metrics.kerning.end());
+
+    return Result<SdfFontBuild>::ok(std::move(build));
+}
+
+} // namespace NovelMind::renderer
@@ -7,6 +7,97 @@
 namespace NovelMind::renderer
 {
 
+namespace
+{
+
+// Decode the UTF-8 sequence at text[pos] and advance past it; malformed
+// bytes decode one at a time as U+FFFD
+u32 decodeUtf8(const std::string& text, size_t& pos)
+{
+    const u8 lead = static_cast<u8>(text[pos]);
+    if (lead < 0x80)
+    {
+        ++pos;
+        return lead;
+    }
+
+    size_t length;
+    u32 codepoint;
+    if ((lead & 0xE0) == 0xC0)
+    {
+        length = 2;
+        codepoint = lead & 0x1F;
+    }
+    else if ((lead & 0xF0) == 0xE0)
+    {
+        length = 3;
+        codepoint = lead & 0x0F;
+    }
+    else if ((lead & 0xF8) == 0xF0)
+    {
+        length = 4;
+        codepoint = lead & 0x07;
+    }
+    else
+    {
+        ++pos;
+        return 0xFFFD;
+    }
+
+    if (pos + length > text.length())
+    {
+        ++pos;
+        return 0xFFFD;
+    }
+    for (size_t i = 1; i < length; ++i)
+    {
+        const u8 next = static_cast<u8>(text[pos + i]);
+        if ((next & 0xC0) != 0x80)
+        {
+            ++pos;
+            return 0xFFFD;
+        }
+        codepoint = (codepoint << 6) | (next & 0x3F);
+    }
+    pos += length;
+    return codepoint;
+}
+
+// Scripts written without spaces between words
+bool isBreakableIdeograph(u32 codepoint)
+{
+    return (codepoint >= 0x2E80 && codepoint <= 0x9FFF) ||   // CJK radicals to unified ideographs
+           (codepoint >= 0xF900 && codepoint <= 0xFAFF) ||   // Compatibility ideographs
+           (codepoint >= 0xFF00 && codepoint <= 0xFFEF) ||   // Fullwidth forms
+           (codepoint >= 0x20000 && codepoint <= 0x3FFFF);   // Supplementary ideographs
+}
+
+// Punctuation that must not start a line
+bool isNoBreakBefore(u32 codepoint)
+{
+    switch (codepoint)
+    {
+        case '.': case ',': case '!': case '?': case ')': case ':': case ';':
+        case 0x2026: // …
+        case 0x3001: // 、
+        case 0x3002: // 。
+        case 0x300D: // 」
+        case 0x300F: // 』
+        case 0x3011: // 】
+        case 0x30FC: // ー
+        case 0xFF01: // ！
+        case 0xFF09: // ）
+        case 0xFF0C: // ，
+        case 0xFF0E: // ．
+        case 0xFF1F: // ？
+            return true;
+        default:
+            return false;
+    }
+}
+
+} // namespace
+
 // RichTextParser implementation
 
 std::vector<TextSegment> RichTextParser::parse(const std::string& text,
@@ -308,6 +399,49 @@ TextLayout TextLayoutEngine::layout(const std::string& text) const
     f32 lineHeight = m_defaultStyle.size * m_lineHeight;
     i32 charCount = 0;
 
+    // Center the font's ascender-to-descender box in the line
+    f32 baseline = 0.0f;
+    if (m_font && m_font->hasMetrics())
+    {
+        const f32 ascender = m_font->getAscender(m_defaultStyle.size);
+        const f32 glyphHeight = ascender - m_font->getDescender(m_defaultStyle.size);
+        baseline = (lineHeight - glyphHeight) * 0.5f + ascender;
+    }
+
+    auto finishLine = [&]() {
+        currentLine.width = lineWidth;
+        currentLine.height = lineHeight;
+        currentLine.baseline = baseline;
+        result.lines.push_back(std::move(currentLine));
+        result.totalHeight += lineHeight;
+        result.totalWidth = std::max(result.totalWidth, lineWidth);
+
+        currentLine = TextLine{};
+        lineWidth = 0.0f;
+    };
+
+    auto appendWord = [&](std::string& word, const TextStyle& style) {
+        if (word.empty())
+        {
+            return;
+        }
+        f32 wordWidth = measureWord(word, style);
+
+        // Check if we need to wrap
+        if (m_maxWidth > 0.0f && lineWidth + wordWidth > m_maxWidth && lineWidth > 0.0f)
+        {
+            finishLine();
+        }
+
+        TextSegment wordSeg;
+        wordSeg.text = word;
+        wordSeg.style = style;
+        currentLine.segments.push_back(std::move(wordSeg));
+        lineWidth += wordWidth;
+        charCount += static_cast<i32>(word.length());
+        word.clear();
+    };
+
     for (const auto& segment : segments)
     {
         if (segment.isCommand())
@@ -321,64 +455,25 @@ TextLayout TextLayoutEngine::layout(const std::string& text) const
         // Process text segment
         const std::string& segText = segment.text;
         std::string currentWord;
+        bool afterIdeograph = false;
 
-        for (size_t i = 0; i < segText.length(); ++i)
+        size_t pos = 0;
+        while (pos < segText.length())
         {
-            char c = segText[i];
+            const size_t start = pos;
+            const u32 codepoint = decodeUtf8(segText, pos);
 
-            if (c == '\n')
+            if (codepoint == '\n')
             {
-                // Handle newline
-                if (!currentWord.empty())
-                {
-                    TextSegment wordSeg;
-                    wordSeg.text = currentWord;
-                    wordSeg.style = segment.style;
-                    currentLine.segments.push_back(std::move(wordSeg));
-                    charCount += static_cast<i32>(currentWord.length());
-                    currentWord.clear();
-                }
-
-                // Finish current line
-                currentLine.width = lineWidth;
-                currentLine.height = lineHeight;
-                result.lines.push_back(std::move(currentLine));
-                result.totalHeight += lineHeight;
-                result.totalWidth = std::max(result.totalWidth, lineWidth);
-
-                // Start new line
-                currentLine = TextLine{};
-                lineWidth = 0.0f;
+                appendWord(currentWord, segment.style);
+                finishLine();
+                afterIdeograph = false;
             }
-            else if (std::isspace(c))
+            else if (codepoint < 0x80 && std::isspace(static_cast<int>(codepoint)))
             {
                 // End of word
-                if (!currentWord.empty())
-                {
-                    f32 wordWidth = measureWord(currentWord, segment.style);
-
-                    // Check if we need to wrap
-                    if (m_maxWidth > 0.0f && lineWidth + wordWidth > m_maxWidth && lineWidth > 0.0f)
-                    {
-                        // Wrap to next line
-                        currentLine.width = lineWidth;
-                        currentLine.height = lineHeight;
-                        result.lines.push_back(std::move(currentLine));
-                        result.totalHeight += lineHeight;
-                        result.totalWidth = std::max(result.totalWidth, lineWidth);
-
-                        currentLine = TextLine{};
-                        lineWidth = 0.0f;
-                    }
-
-                    TextSegment wordSeg;
-                    wordSeg.text = currentWord;
-                    wordSeg.style = segment.style;
-                    currentLine.segments.push_back(std::move(wordSeg));
-                    lineWidth += wordWidth;
-                    charCount += static_cast<i32>(currentWord.length());
-                    currentWord.clear();
-                }
+                appendWord(currentWord, segment.style);
+                afterIdeograph = false;
 
                 // Add space
                 f32 spaceWidth = measureChar(' ', segment.style);
@@ -394,45 +489,26 @@ TextLayout TextLayoutEngine::layout(const std::string& text) const
             }
             else
             {
-                currentWord += c;
+                // Text without spaces (CJK) may wrap around any ideograph,
+                // except before closing punctuation
+                const bool ideograph = isBreakableIdeograph(codepoint);
+                if ((ideograph || afterIdeograph) && !isNoBreakBefore(codepoint))
+                {
+                    appendWord(currentWord, segment.style);
+                }
+                currentWord.append(segText, start, pos - start);
+                afterIdeograph = ideograph;
             }
         }
 
         // Handle remaining word
-        if (!currentWord.empty())
-        {
-            f32 wordWidth = measureWord(currentWord, segment.style);
-
-            // Check if we need to wrap
-            if (m_maxWidth > 0.0f && lineWidth + wordWidth > m_maxWidth && lineWidth > 0.0f)
-            {
-                currentLine.width = lineWidth;
-                currentLine.height = lineHeight;
-                result.lines.push_back(std::move(currentLine));
-                result.totalHeight += lineHeight;
-                result.totalWidth = std::max(result.totalWidth, lineWidth);
-
-                currentLine = TextLine{};
-                lineWidth = 0.0f;
-            }
-
-            TextSegment wordSeg;
-            wordSeg.text = currentWord;
-            wordSeg.style = segment.style;
-            currentLine.segments.push_back(std::move(wordSeg));
-            lineWidth += wordWidth;
-            charCount += static_cast<i32>(currentWord.length());
-        }
+        appendWord(currentWord, segment.style);
     }
 
     // Add last line
     if (!currentLine.segments.empty())
     {
-        currentLine.width = lineWidth;
-        currentLine.height = lineHeight;
-        result.lines.push_back(std::move(currentLine));
-        result.totalHeight += lineHeight;
-        result.totalWidth = std::max(result.totalWidth, lineWidth);
+        finishLine();
     }
 
     result.totalCharacters = charCount;
@@ -456,6 +532,7 @@ i32 TextLayoutEngine::getCharacterAtPosition(const TextLayout& layout, f32 x, f3
         {
             // Found the line
             f32 currentX = 0.0f;
+            i32 lastIndex = charIndex - 1;
 
             for (const auto& segment : line.segments)
             {
@@ -464,19 +541,22 @@ i32 TextLayoutEngine::getCharacterAtPosition(const TextLayout& layout, f32 x, f3
                     continue;
                 }
 
-                for (char c : segment.text)
+                size_t pos = 0;
+                while (pos < segment.text.length())
                 {
-                    f32 charWidth = measureChar(c, segment.style);
+                    const size_t start = pos;
+                    f32 charWidth = measureChar(decodeUtf8(segment.text, pos), segment.style);
+                    lastIndex = charIndex + static_cast<i32>(start);
                     if (x >= currentX && x < currentX + charWidth)
                     {
-                        return charIndex;
+                        return lastIndex;
                     }
                     currentX += charWidth;
-                    ++charIndex;
                 }
+                charIndex += static_cast<i32>(segment.text.length());
             }
 
-            return charIndex - 1;
+            return lastIndex;
         }
 
         currentY += line.height;
@@ -510,15 +590,17 @@ std::pair<f32, f32> TextLayoutEngine::getCharacterPosition(const TextLayout& lay
                 continue;
             }
 
-            for (char c : segment.text)
+            size_t pos = 0;
+            while (pos < segment.text.length())
             {
-                if (charIndex == targetIndex)
+                const u32 codepoint = decodeUtf8(segment.text, pos);
+                if (targetIndex < charIndex + static_cast<i32>(pos))
                 {
                     return {currentX, currentY};
                 }
-                currentX += measureChar(c, segment.style);
-                ++charIndex;
+                currentX += measureChar(codepoint, segment.style);
             }
+            charIndex += static_cast<i32>(segment.text.length());
         }
 
         currentY += line.height;
@@ -527,6 +609,85 @@ std::pair<f32, f32> TextLayoutEngine::getCharacterPosition(const TextLayout& lay
     return {0.0f, currentY};
 }
 
+void TextLayoutEngine::buildGlyphQuads(const TextLayout& layout,
+                                       std::vector<SdfGlyphQuad>& quads) const
+{
+    quads.clear();
+    if (!m_font || !m_font->hasMetrics())
+    {
+        return;
+    }
+
+    const SdfFontMetrics& metrics = m_font->getMetrics();
+    const f32 alignWidth = m_maxWidth > 0.0f ? m_maxWidth : layout.totalWidth;
+    f32 lineTop = 0.0f;
+    u32 charIndex = 0;
+
+    for (const auto& line : layout.lines)
+    {
+        f32 x = 0.0f;
+        if (m_alignment == TextAlign::Center)
+        {
+            x = (alignWidth - line.width) * 0.5f;
+        }
+        else if (m_alignment == TextAlign::Right)
+        {
+            x = alignWidth - line.width;
+        }
+        const f32 baseline = lineTop + line.baseline;
+
+        for (const auto& segment : line.segments)
+        {
+            if (segment.isCommand())
+            {
+                continue;
+            }
+
+            const TextStyle& style = segment.style;
+            const f32 size = style.size;
+            const f32 pxRange = metrics.distanceRange * size / metrics.emSize;
+            u32 previous = 0;
+            size_t pos = 0;
+            while (pos < segment.text.length())
+            {
+                const size_t start = pos;
+                const u32 codepoint = decodeUtf8(segment.text, pos);
+                if (previous != 0)
+                {
+                    x += m_font->getKerning(previous, codepoint, size);
+                }
+                previous = codepoint;
+
+                const SdfGlyph* glyph = m_font->findGlyph(codepoint);
+                if (glyph && glyph->atlasWidth > 0)
+                {
+                    SdfGlyphQuad quad;
+                    quad.screen = Rect(x + glyph->planeLeft * size, baseline - glyph->planeTop * size,
+                                       (glyph->planeRight - glyph->planeLeft) * size,
+                                       (glyph->planeTop - glyph->planeBottom) * size);
+                    quad.atlas = Rect(glyph->atlasX, glyph->atlasY, glyph->atlasWidth,
+                                      glyph->atlasHeight);
+                    quad.page = glyph->page;
+                    quad.charIndex = charIndex + static_cast<u32>(start);
+                    quad.pxRange = pxRange;
+                    quad.color = style.color;
+                    quad.outlineColor = style.outlineColor;
+                    // The field saturates half a distance range outside the glyph
+                    quad.outlineWidth = std::min(style.outlineWidth, pxRange * 0.5f);
+                    quad.shadowColor = style.shadowColor;
+                    quad.shadowOffsetX = style.shadowOffsetX;
+                    quad.shadowOffsetY = style.shadowOffsetY;
+                    quads.push_back(quad);
+                }
+                x += m_font->getAdvance(codepoint, size);
+            }
+            charIndex += static_cast<u32>(segment.text.length());
+        }
+
+        lineTop += line.height;
+    }
+}
+
 std::vector<std::string> TextLayoutEngine::breakIntoWords(const std::string& text) const
 {
     std::vector<std::string> words;
@@ -556,10 +717,15 @@ std::vector<std::string> TextLayoutEngine::breakIntoWords(const std::string& tex
     return words;
 }
 
-f32 TextLayoutEngine::measureChar(char c, const TextStyle& style) const
+f32 TextLayoutEngine::measureChar(u32 codepoint, const TextStyle& style) const
 {
-    // Character width estimation using monospace approximation.
-    // When font metrics are available, FreeType glyph advances are used.
+    if (m_font && m_font->hasMetrics())
+    {
+        return m_font->getAdvance(codepoint, style.size);
+    }
+
+    // Character width estimation using monospace approximation
+    // for fonts loaded without metrics.
     if (m_font)
     {
         // Monospace approximation: 0.6 * size
@@ -567,6 +733,12 @@ f32 TextLayoutEngine::measureChar(char c, const TextStyle& style) const
     }
 
     // Fallback: estimate based on character
+    if (codepoint >= 0x80)
+    {
+        return isBreakableIdeograph(codepoint) ? style.size : style.size * 0.5f;
+    }
+
+    const char c = static_cast<char>(codepoint);
     if (std::isspace(c))
     {
         return style.size * 0.25f;
@@ -591,10 +763,19 @@ f32 TextLayoutEngine::measureChar(char c, const TextStyle& style) const
 
 f32 TextLayoutEngine::measureWord(const std::string& word, const TextStyle& style) const
 {
+    const bool kerning = m_font && m_font->hasMetrics();
     f32 width = 0.0f;
-    for (char c : word)
+    u32 previous = 0;
+    size_t pos = 0;
+    while (pos < word.length())
     {
-        width += measureChar(c, style);
+        const u32 codepoint = decodeUtf8(word, pos);
+        if (kerning && previous != 0)
+        {
+            width += m_font->getKerning(previous, codepoint, style.size);
+        }
+        width += measureChar(codepoint, style);
+        previous = codepoint;
     }
     return width;
 }
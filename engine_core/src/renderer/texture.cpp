@@ -1,4 +1,5 @@
 #include "NovelMind/renderer/texture.hpp"
+#include "NovelMind/renderer/raw_texture.hpp"
 #include "NovelMind/core/logger.hpp"
 
 namespace NovelMind::renderer
@@ -8,6 +9,8 @@ Texture::Texture()
     : m_handle(nullptr)
     , m_width(0)
     , m_height(0)
+    , m_premultiplied(false)
+    , m_mipLevels(0)
 {
 }
 
@@ -20,10 +23,14 @@ Texture::Texture(Texture&& other) noexcept
     : m_handle(other.m_handle)
     , m_width(other.m_width)
     , m_height(other.m_height)
+    , m_premultiplied(other.m_premultiplied)
+    , m_mipLevels(other.m_mipLevels)
 {
     other.m_handle = nullptr;
     other.m_width = 0;
     other.m_height = 0;
+    other.m_premultiplied = false;
+    other.m_mipLevels = 0;
 }
 
 Texture& Texture::operator=(Texture&& other) noexcept
@@ -34,9 +41,13 @@ Texture& Texture::operator=(Texture&& other) noexcept
         m_handle = other.m_handle;
         m_width = other.m_width;
         m_height = other.m_height;
+        m_premultiplied = other.m_premultiplied;
+        m_mipLevels = other.m_mipLevels;
         other.m_handle = nullptr;
         other.m_width = 0;
         other.m_height = 0;
+        other.m_premultiplied = false;
+        other.m_mipLevels = 0;
     }
     return *this;
 }
@@ -48,6 +59,11 @@ Result<void> Texture::loadFromMemory(const std::vector<u8>& data)
         return Result<void>::error("Empty texture data");
     }
 
+    if (RawTexture::isRawTexture(data.data(), data.size()))
+    {
+        return loadFromRaw(data.data(), data.size());
+    }
+
     // Image decoding (stb_image/libpng) is configured via build options.
     // This placeholder validates input and returns success for testing.
     NOVELMIND_LOG_DEBUG("Texture::loadFromMemory - placeholder implementation");
@@ -55,7 +71,30 @@ Result<void> Texture::loadFromMemory(const std::vector<u8>& data)
     return Result<void>::ok();
 }
 
-Result<void> Texture::loadFromRGBA(const u8* pixels, i32 width, i32 height)
+Result<void> Texture::loadFromRaw(const u8* data, usize size)
+{
+    // Decompression buffer reused across loads on the same thread
+    thread_local std::vector<u8> scratch;
+
+    auto decoded = RawTexture::decode(data, size, scratch);
+    if (decoded.isError())
+    {
+        return Result<void>::error(decoded.error());
+    }
+
+    const RawTextureView& view = decoded.value();
+    auto result = loadFromRGBA(view.pixels, static_cast<i32>(view.header.width),
+                               static_cast<i32>(view.header.height), view.isPremultiplied());
+    if (result.isOk())
+    {
+        // The backend uploads level 0 with the header's stride as the row
+        // length and the mip chain from the following bytes
+        m_mipLevels = view.header.mipCount;
+    }
+    return result;
+}
+
+Result<void> Texture::loadFromRGBA(const u8* pixels, i32 width, i32 height, bool premultiplied)
 {
     if (!pixels || width <= 0 || height <= 0)
     {
@@ -66,6 +105,8 @@ Result<void> Texture::loadFromRGBA(const u8* pixels, i32 width, i32 height)
     // Dimensions are stored for metric queries.
     m_width = width;
     m_height = height;
+    m_premultiplied = premultiplied;
+    m_mipLevels = 1;
 
     NOVELMIND_LOG_DEBUG("Texture::loadFromRGBA - placeholder implementation");
 
@@ -81,6 +122,8 @@ void Texture::destroy()
     }
     m_width = 0;
     m_height = 0;
+    m_premultiplied = false;
+    m_mipLevels = 0;
 }
 
 bool Texture::isValid() const
@@ -98,6 +141,16 @@ i32 Texture::getHeight() const
     return m_height;
 }
 
+bool Texture::isPremultiplied() const
+{
+    return m_premultiplied;
+}
+
+u32 Texture::getMipLevelCount() const
+{
+    return m_mipLevels;
+}
+
 void* Texture::getNativeHandle() const
 {
     return m_handle;
@@ -0,0 +1,281 @@
+#include "NovelMind/save/read_history.hpp"
+#include <cstring>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace NovelMind::save
+{
+
+namespace
+{
+
+constexpr u32 READ_HISTORY_MAGIC = 0x48524D4E; // "NMRH"
+constexpr u16 READ_HISTORY_VERSION = 1;
+constexpr u32 MIN_BIT_COUNT = 64;
+constexpr u32 MAX_BIT_COUNT = 1u << 31;
+
+struct FileHeader
+{
+    u32 magic;
+    u16 version;
+    u16 reserved;
+    u32 bitCount;
+    u32 reserved2;
+};
+static_assert(sizeof(FileHeader) % sizeof(u64) == 0, "bitset must stay word aligned");
+
+u32 roundBitCount(u32 bitCount)
+{
+    u32 rounded = MIN_BIT_COUNT;
+    while (rounded < bitCount && rounded < MAX_BIT_COUNT)
+    {
+        rounded <<= 1;
+    }
+    return rounded;
+}
+
+usize fileSizeFor(u32 bitCount)
+{
+    return sizeof(FileHeader) + bitCount / 8;
+}
+
+bool isValidBitCount(u32 bitCount)
+{
+    return bitCount >= MIN_BIT_COUNT && bitCount <= MAX_BIT_COUNT &&
+           (bitCount & (bitCount - 1)) == 0;
+}
+
+} // namespace
+
+ReadHistory::ReadHistory() = default;
+
+ReadHistory::~ReadHistory()
+{
+    close();
+}
+
+Result<void> ReadHistory::open(const std::string& path, u32 bitCount)
+{
+    close();
+
+    const u32 newBitCount = roundBitCount(bitCount);
+    usize fileSize = 0;
+    bool created = false;
+
+#if defined(_WIN32)
+    HANDLE file = ::CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ,
+                                nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return Result<void>::error("Cannot open read history: " + path);
+    }
+
+    LARGE_INTEGER existingSize{};
+    ::GetFileSizeEx(file, &existingSize);
+    created = existingSize.QuadPart == 0;
+    fileSize = created ? fileSizeFor(newBitCount) : static_cast<usize>(existingSize.QuadPart);
+
+    // Creating the mapping with an explicit size grows a new file to fit
+    const u64 mappingSize = static_cast<u64>(fileSize);
+    HANDLE fileMapping = ::CreateFileMappingA(file, nullptr, PAGE_READWRITE,
+                                              static_cast<DWORD>(mappingSize >> 32),
+                                              static_cast<DWORD>(mappingSize & 0xFFFFFFFFu),
+                                              nullptr);
+    void* view = fileMapping ? ::MapViewOfFile(fileMapping, FILE_MAP_ALL_ACCESS, 0, 0, fileSize)
+                             : nullptr;
+    if (!view)
+    {
+        if (fileMapping)
+        {
+            ::CloseHandle(fileMapping);
+        }
+        ::CloseHandle(file);
+        return Result<void>::error("Cannot map read history: " + path);
+    }
+
+    m_file = file;
+    m_fileMapping = fileMapping;
+#else
+    const int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd < 0)
+    {
+        return Result<void>::error("Cannot open read history: " + path);
+    }
+
+    struct stat info{};
+    if (::fstat(fd, &info) != 0)
+    {
+        ::close(fd);
+        return Result<void>::error("Cannot stat read history: " + path);
+    }
+
+    created = info.st_size == 0;
+    fileSize = created ? fileSizeFor(newBitCount) : static_cast<usize>(info.st_size);
+    if (created && ::ftruncate(fd, static_cast<off_t>(fileSize)) != 0)
+    {
+        ::close(fd);
+        return Result<void>::error("Cannot size read history: " + path);
+    }
+
+    void* view = fileSize >= sizeof(FileHeader)
+                     ? ::mmap(nullptr, fileSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)
+                     : MAP_FAILED;
+    if (view == MAP_FAILED)
+    {
+        ::close(fd);
+        return Result<void>::error("Cannot map read history: " + path);
+    }
+
+    m_fd = fd;
+#endif
+
+    m_mapping = static_cast<u8*>(view);
+    m_mappingSize = fileSize;
+    m_path = path;
+
+    auto* header = reinterpret_cast<FileHeader*>(m_mapping);
+    if (created)
+    {
+        header->magic = READ_HISTORY_MAGIC;
+        header->version = READ_HISTORY_VERSION;
+        header->reserved = 0;
+        header->bitCount = newBitCount;
+        header->reserved2 = 0;
+    }
+    else if (header->magic != READ_HISTORY_MAGIC || header->version != READ_HISTORY_VERSION ||
+             !isValidBitCount(header->bitCount) || fileSizeFor(header->bitCount) != fileSize)
+    {
+        close();
+        return Result<void>::error("Invalid read history file: " + path);
+    }
+
+    m_bitMask = header->bitCount - 1;
+    m_bits = reinterpret_cast<u64*>(m_mapping + sizeof(FileHeader));
+    return Result<void>::ok();
+}
+
+void ReadHistory::close()
+{
+    if (m_mapping)
+    {
+        flush();
+#if defined(_WIN32)
+        ::UnmapViewOfFile(m_mapping);
+#else
+        ::munmap(m_mapping, m_mappingSize);
+#endif
+    }
+
+#if defined(_WIN32)
+    if (m_fileMapping)
+    {
+        ::CloseHandle(m_fileMapping);
+        m_fileMapping = nullptr;
+    }
+    if (m_file)
+    {
+        ::CloseHandle(m_file);
+        m_file = nullptr;
+    }
+#else
+    if (m_fd >= 0)
+    {
+        ::close(m_fd);
+        m_fd = -1;
+    }
+#endif
+
+    m_mapping = nullptr;
+    m_bits = nullptr;
+    m_mappingSize = 0;
+    m_bitMask = 0;
+    m_path.clear();
+}
+
+u64 ReadHistory::lineId(std::string_view scene, std::string_view text)
+{
+    // FNV-1a over "scene \xFF text", then a 64-bit finalizer so both 32-bit
+    // halves are usable as independent probes
+    u64 hash = 14695981039346656037ull;
+    auto mix = [&hash](std::string_view bytes) {
+        for (char c : bytes)
+        {
+            hash ^= static_cast<u8>(c);
+            hash *= 1099511628211ull;
+        }
+    };
+    mix(scene);
+    hash ^= 0xFFu;
+    hash *= 1099511628211ull;
+    mix(text);
+
+    hash ^= hash >> 30;
+    hash *= 0xBF58476D1CE4E5B9ull;
+    hash ^= hash >> 27;
+    hash *= 0x94D049BB133111EBull;
+    hash ^= hash >> 31;
+    return hash;
+}
+
+void ReadHistory::markRead(u64 lineId)
+{
+    if (!m_bits)
+    {
+        return;
+    }
+    const u32 a = static_cast<u32>(lineId) & m_bitMask;
+    const u32 b = static_cast<u32>(lineId >> 32) & m_bitMask;
+    m_bits[a >> 6] |= 1ull << (a & 63);
+    m_bits[b >> 6] |= 1ull << (b & 63);
+}
+
+bool ReadHistory::isRead(u64 lineId) const
+{
+    if (!m_bits)
+    {
+        return false;
+    }
+    const u32 a = static_cast<u32>(lineId) & m_bitMask;
+    const u32 b = static_cast<u32>(lineId >> 32) & m_bitMask;
+    return (m_bits[a >> 6] >> (a & 63) & 1u) && (m_bits[b >> 6] >> (b & 63) & 1u);
+}
+
+void ReadHistory::clear()
+{
+    if (m_bits)
+    {
+        std::memset(m_bits, 0, (static_cast<usize>(m_bitMask) + 1) / 8);
+    }
+}
+
+Result<void> ReadHistory::flush()
+{
+    if (!m_mapping)
+    {
+        return Result<void>::ok();
+    }
+#if defined(_WIN32)
+    if (!::FlushViewOfFile(m_mapping, m_mappingSize) || !::FlushFileBuffers(m_file))
+#else
+    if (::msync(m_mapping, m_mappingSize, MS_SYNC) != 0)
+#endif
+    {
+        return Result<void>::error("Cannot flush read history: " + m_path);
+    }
+    return Result<void>::ok();
+}
+
+} // namespace NovelMind::save
@@ -11,7 +11,10 @@ SaveManager::SaveManager()
 {
 }
 
-SaveManager::~SaveManager() = default;
+SaveManager::~SaveManager()
+{
+    m_thumbnailWriter.shutdown();
+}
 
 Result<void> SaveManager::save(i32 slot, const SaveData& data)
 {
@@ -186,6 +189,13 @@ Result<void> SaveManager::deleteSave(i32 slot)
         return Result<void>::error("Failed to delete save file");
     }
 
+    // A capture still in flight would bring the thumbnail back
+    m_thumbnailWriter.waitForAll();
+    applyFinishedThumbnails();
+    const std::string thumbnail = getThumbnailFilename(slot);
+    std::remove(thumbnail.c_str());
+    m_thumbnailCache.invalidate(thumbnail);
+
     NOVELMIND_LOG_INFO("Deleted save slot " + std::to_string(slot));
     return Result<void>::ok();
 }
@@ -214,8 +224,67 @@ i32 SaveManager::getMaxSlots() const
     return MAX_SLOTS;
 }
 
+Result<void> SaveManager::captureThumbnail(i32 slot, std::vector<u8> frame, u32 width,
+                                           u32 height, u32 stride)
+{
+    if (slot < 0 || slot >= MAX_SLOTS)
+    {
+        return Result<void>::error("Invalid save slot");
+    }
+
+    const u64 timestamp = static_cast<u64>(
+        std::chrono::system_clock::now().time_since_epoch().count()
+    );
+    return m_thumbnailWriter.submit(getThumbnailFilename(slot), std::move(frame), width, height,
+                                    stride, timestamp);
+}
+
+void SaveManager::setThumbnailSize(u32 maxWidth, u32 maxHeight)
+{
+    m_thumbnailWriter.setMaxSize(maxWidth, maxHeight);
+}
+
+Result<SaveThumbnailHeader> SaveManager::getThumbnailHeader(i32 slot) const
+{
+    if (slot < 0 || slot >= MAX_SLOTS)
+    {
+        return Result<SaveThumbnailHeader>::error("Invalid save slot");
+    }
+    return SaveThumbnailFormat::readHeader(getThumbnailFilename(slot));
+}
+
+const SaveThumbnail* SaveManager::getThumbnail(i32 slot)
+{
+    if (slot < 0 || slot >= MAX_SLOTS)
+    {
+        return nullptr;
+    }
+    applyFinishedThumbnails();
+    return m_thumbnailCache.get(getThumbnailFilename(slot));
+}
+
+void SaveManager::flushThumbnails()
+{
+    m_thumbnailWriter.waitForAll();
+    applyFinishedThumbnails();
+}
+
+void SaveManager::applyFinishedThumbnails()
+{
+    for (const auto& write : m_thumbnailWriter.takeCompleted())
+    {
+        if (!write.error.empty())
+        {
+            NOVELMIND_LOG_ERROR(write.error);
+        }
+        m_thumbnailCache.invalidate(write.path);
+    }
+}
+
 void SaveManager::setSavePath(const std::string& path)
 {
+    // Queued thumbnails keep the paths they were captured for
+    m_thumbnailCache.clear();
     m_savePath = path;
     if (!m_savePath.empty() && m_savePath.back() != '/')
     {
@@ -233,6 +302,11 @@ std::string SaveManager::getSlotFilename(i32 slot) const
     return m_savePath + "save_" + std::to_string(slot) + ".nmsav";
 }
 
+std::string SaveManager::getThumbnailFilename(i32 slot) const
+{
+    return m_savePath + "save_" + std::to_string(slot) + ".nmthumb";
+}
+
 u32 SaveManager::calculateChecksum(const SaveData& data)
 {
     u32 checksum = 0;
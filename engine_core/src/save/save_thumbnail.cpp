@@ -0,0 +1,535 @@
+#include "NovelMind/save/save_thumbnail.hpp"
+#include "NovelMind/renderer/image_decoder.hpp"
+#include "NovelMind/renderer/image_kernels.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace NovelMind::save
+{
+
+namespace
+{
+
+constexpr u32 MAX_THUMBNAIL_DIMENSION = 4096;
+
+u32 fnv1a(const u8* data, usize size)
+{
+    u32 hash = 2166136261u;
+    for (usize i = 0; i < size; ++i)
+    {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+void writeBE32(std::vector<u8>& out, u32 value)
+{
+    out.push_back(static_cast<u8>(value >> 24));
+    out.push_back(static_cast<u8>(value >> 16));
+    out.push_back(static_cast<u8>(value >> 8));
+    out.push_back(static_cast<u8>(value));
+}
+
+// QOI encoder matching ImageDecoder::decodeQOI; always 4 channels, sRGB
+void encodeQOI(const u8* rgba, u32 width, u32 height, std::vector<u8>& out)
+{
+    out.insert(out.end(), {'q', 'o', 'i', 'f'});
+    writeBE32(out, width);
+    writeBE32(out, height);
+    out.push_back(4);
+    out.push_back(0);
+
+    u8 index[64 * 4] = {};
+    u8 prev[4] = {0, 0, 0, 255};
+    u32 run = 0;
+    const usize pixelCount = static_cast<usize>(width) * height;
+
+    for (usize i = 0; i < pixelCount; ++i)
+    {
+        const u8* px = rgba + i * 4;
+        if (std::memcmp(px, prev, 4) == 0)
+        {
+            ++run;
+            if (run == 62 || i + 1 == pixelCount)
+            {
+                out.push_back(static_cast<u8>(0xC0 | (run - 1)));
+                run = 0;
+            }
+            continue;
+        }
+
+        if (run > 0)
+        {
+            out.push_back(static_cast<u8>(0xC0 | (run - 1)));
+            run = 0;
+        }
+
+        const u32 hash = (px[0] * 3u + px[1] * 5u + px[2] * 7u + px[3] * 11u) % 64;
+        if (std::memcmp(index + hash * 4, px, 4) == 0)
+        {
+            out.push_back(static_cast<u8>(hash));
+        }
+        else
+        {
+            std::memcpy(index + hash * 4, px, 4);
+            if (px[3] == prev[3])
+            {
+                const i32 dr = static_cast<i8>(px[0] - prev[0]);
+                const i32 dg = static_cast<i8>(px[1] - prev[1]);
+                const i32 db = static_cast<i8>(px[2] - prev[2]);
+                const i32 drg = dr - dg;
+                const i32 dbg = db - dg;
+                if (dr >= -2 && dr <= 1 && dg >= -2 && dg <= 1 && db >= -2 && db <= 1)
+                {
+                    out.push_back(static_cast<u8>(0x40 | ((dr + 2) << 4) | ((dg + 2) << 2) |
+                                                  (db + 2)));
+                }
+                else if (drg >= -8 && drg <= 7 && dg >= -32 && dg <= 31 && dbg >= -8 &&
+                         dbg <= 7)
+                {
+                    out.push_back(static_cast<u8>(0x80 | (dg + 32)));
+                    out.push_back(static_cast<u8>(((drg + 8) << 4) | (dbg + 8)));
+                }
+                else
+                {
+                    out.insert(out.end(), {0xFE, px[0], px[1], px[2]});
+                }
+            }
+            else
+            {
+                out.insert(out.end(), {0xFF, px[0], px[1], px[2], px[3]});
+            }
+        }
+        std::memcpy(prev, px, 4);
+    }
+
+    out.insert(out.end(), {0, 0, 0, 0, 0, 0, 0, 1});
+}
+
+struct AxisTap
+{
+    u32 first;
+    std::vector<f32> weights; // Normalized coverage of source texels first..
+};
+
+std::vector<AxisTap> areaTaps(u32 srcSize, u32 dstSize)
+{
+    std::vector<AxisTap> taps(dstSize);
+    const f64 scale = static_cast<f64>(srcSize) / dstSize;
+    for (u32 i = 0; i < dstSize; ++i)
+    {
+        const f64 start = i * scale;
+        const f64 end = (i + 1) * scale;
+        const u32 first = static_cast<u32>(start);
+        const u32 last = std::min(srcSize, static_cast<u32>(std::ceil(end)));
+        taps[i].first = first;
+        for (u32 s = first; s < last; ++s)
+        {
+            const f64 coverage = std::min(end, s + 1.0) - std::max(start, static_cast<f64>(s));
+            taps[i].weights.push_back(static_cast<f32>(coverage / scale));
+        }
+    }
+    return taps;
+}
+
+} // namespace
+
+// ============================================================================
+// SaveThumbnailFormat
+// ============================================================================
+
+void SaveThumbnailFormat::fitWithin(u32 width, u32 height, u32 maxWidth, u32 maxHeight,
+                                    u32& outWidth, u32& outHeight)
+{
+    outWidth = width;
+    outHeight = height;
+    if (width == 0 || height == 0 || (width <= maxWidth && height <= maxHeight))
+    {
+        return;
+    }
+
+    const f64 scale = std::min(static_cast<f64>(maxWidth) / width,
+                               static_cast<f64>(maxHeight) / height);
+    outWidth = std::max(1u, static_cast<u32>(std::lround(width * scale)));
+    outHeight = std::max(1u, static_cast<u32>(std::lround(height * scale)));
+}
+
+std::vector<u8> SaveThumbnailFormat::downscale(const u8* rgba, u32 width, u32 height, u32 stride,
+                                               u32 targetWidth, u32 targetHeight)
+{
+    if (stride == 0)
+    {
+        stride = width * 4;
+    }
+    targetWidth = std::clamp(targetWidth, 1u, width);
+    targetHeight = std::clamp(targetHeight, 1u, height);
+
+    // Halving runs through the SIMD kernels and does most of the reduction
+    std::vector<u8> current;
+    const u8* src = rgba;
+    while (width >= targetWidth * 2 && height >= targetHeight * 2)
+    {
+        std::vector<u8> half(static_cast<usize>(width / 2) * (height / 2) * 4);
+        renderer::ImageKernels::downsampleHalf(src, width, height, stride, half.data());
+        current = std::move(half);
+        src = current.data();
+        width /= 2;
+        height /= 2;
+        stride = width * 4;
+    }
+
+    std::vector<u8> result(static_cast<usize>(targetWidth) * targetHeight * 4);
+    if (width == targetWidth && height == targetHeight)
+    {
+        for (u32 y = 0; y < height; ++y)
+        {
+            std::memcpy(result.data() + static_cast<usize>(y) * width * 4,
+                        src + static_cast<usize>(y) * stride, static_cast<usize>(width) * 4);
+        }
+        return result;
+    }
+
+    // Remaining factor is below two: one separable area-average pass
+    const auto columns = areaTaps(width, targetWidth);
+    const auto rows = areaTaps(height, targetHeight);
+    std::vector<f32> horizontal(static_cast<usize>(targetWidth) * height * 4);
+    for (u32 y = 0; y < height; ++y)
+    {
+        const u8* row = src + static_cast<usize>(y) * stride;
+        f32* out = horizontal.data() + static_cast<usize>(y) * targetWidth * 4;
+        for (u32 x = 0; x < targetWidth; ++x)
+        {
+            f32 sum[4] = {};
+            const AxisTap& tap = columns[x];
+            for (usize k = 0; k < tap.weights.size(); ++k)
+            {
+                const u8* px = row + (tap.first + k) * 4;
+                for (u32 c = 0; c < 4; ++c)
+                {
+                    sum[c] += px[c] * tap.weights[k];
+                }
+            }
+            std::memcpy(out + x * 4, sum, sizeof(sum));
+        }
+    }
+
+    for (u32 y = 0; y < targetHeight; ++y)
+    {
+        const AxisTap& tap = rows[y];
+        u8* out = result.data() + static_cast<usize>(y) * targetWidth * 4;
+        for (u32 x = 0; x < targetWidth * 4; ++x)
+        {
+            f32 sum = 0.0f;
+            for (usize k = 0; k < tap.weights.size(); ++k)
+            {
+                sum += horizontal[(tap.first + k) * targetWidth * 4 + x] * tap.weights[k];
+            }
+            out[x] = static_cast<u8>(std::clamp(sum + 0.5f, 0.0f, 255.0f));
+        }
+    }
+    return result;
+}
+
+Result<std::vector<u8>> SaveThumbnailFormat::encode(const u8* rgba, u32 width, u32 height,
+                                                    u64 timestamp)
+{
+    if (!rgba || width == 0 || height == 0 || width > MAX_THUMBNAIL_DIMENSION ||
+        height > MAX_THUMBNAIL_DIMENSION)
+    {
+        return Result<std::vector<u8>>::error("Invalid thumbnail dimensions");
+    }
+
+    std::vector<u8> out(sizeof(SaveThumbnailHeader));
+    encodeQOI(rgba, width, height, out);
+
+    SaveThumbnailHeader header{};
+    header.magic = SAVE_THUMBNAIL_MAGIC;
+    header.version = SAVE_THUMBNAIL_VERSION;
+    header.width = width;
+    header.height = height;
+    header.timestamp = timestamp;
+    header.payloadSize = static_cast<u32>(out.size() - sizeof(header));
+    header.payloadHash = fnv1a(out.data() + sizeof(header), header.payloadSize);
+    std::memcpy(out.data(), &header, sizeof(header));
+    return Result<std::vector<u8>>::ok(std::move(out));
+}
+
+Result<SaveThumbnail> SaveThumbnailFormat::decode(const u8* data, usize size)
+{
+    if (!data || size < sizeof(SaveThumbnailHeader))
+    {
+        return Result<SaveThumbnail>::error("Truncated thumbnail");
+    }
+
+    SaveThumbnailHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (header.magic != SAVE_THUMBNAIL_MAGIC || header.version != SAVE_THUMBNAIL_VERSION)
+    {
+        return Result<SaveThumbnail>::error("Not a save thumbnail");
+    }
+    if (size - sizeof(header) < header.payloadSize)
+    {
+        return Result<SaveThumbnail>::error("Truncated thumbnail");
+    }
+
+    const u8* payload = data + sizeof(header);
+    if (fnv1a(payload, header.payloadSize) != header.payloadHash)
+    {
+        return Result<SaveThumbnail>::error("Corrupt thumbnail");
+    }
+
+    auto image = renderer::ImageDecoder::decodeQOI(payload, header.payloadSize);
+    if (image.isError())
+    {
+        return Result<SaveThumbnail>::error(image.error());
+    }
+    if (image.value().width != header.width || image.value().height != header.height)
+    {
+        return Result<SaveThumbnail>::error("Thumbnail size does not match its header");
+    }
+
+    SaveThumbnail thumbnail;
+    thumbnail.width = header.width;
+    thumbnail.height = header.height;
+    thumbnail.timestamp = header.timestamp;
+    thumbnail.pixels = std::move(image.value().pixels);
+    return Result<SaveThumbnail>::ok(std::move(thumbnail));
+}
+
+Result<SaveThumbnailHeader> SaveThumbnailFormat::readHeader(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open())
+    {
+        return Result<SaveThumbnailHeader>::error("Thumbnail not found: " + path);
+    }
+
+    SaveThumbnailHeader header;
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)))
+    {
+        return Result<SaveThumbnailHeader>::error("Truncated thumbnail: " + path);
+    }
+    if (header.magic != SAVE_THUMBNAIL_MAGIC || header.version != SAVE_THUMBNAIL_VERSION)
+    {
+        return Result<SaveThumbnailHeader>::error("Not a save thumbnail: " + path);
+    }
+    return Result<SaveThumbnailHeader>::ok(header);
+}
+
+Result<SaveThumbnail> SaveThumbnailFormat::load(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open())
+    {
+        return Result<SaveThumbnail>::error("Thumbnail not found: " + path);
+    }
+    std::vector<u8> data((std::istreambuf_iterator<char>(file)),
+                         std::istreambuf_iterator<char>());
+    return decode(data.data(), data.size());
+}
+
+// ============================================================================
+// SaveThumbnailWriter
+// ============================================================================
+
+SaveThumbnailWriter::~SaveThumbnailWriter()
+{
+    shutdown();
+}
+
+void SaveThumbnailWriter::setMaxSize(u32 maxWidth, u32 maxHeight)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_maxWidth = std::clamp(maxWidth, 1u, MAX_THUMBNAIL_DIMENSION);
+    m_maxHeight = std::clamp(maxHeight, 1u, MAX_THUMBNAIL_DIMENSION);
+}
+
+Result<void> SaveThumbnailWriter::submit(std::string path, std::vector<u8> frame, u32 width,
+                                         u32 height, u32 stride, u64 timestamp)
+{
+    if (stride == 0)
+    {
+        stride = width * 4;
+    }
+    if (width == 0 || height == 0 || stride < width * 4 ||
+        frame.size() < static_cast<usize>(stride) * (height - 1) + width * 4)
+    {
+        return Result<void>::error("Invalid thumbnail frame");
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_worker.joinable())
+    {
+        m_stopWorker = false;
+        m_worker = std::thread([this]() { workerLoop(); });
+    }
+    ++m_inFlight;
+    m_jobs.push_back(Job{std::move(path), std::move(frame), width, height, stride, m_maxWidth,
+                         m_maxHeight, timestamp});
+    m_work.notify_one();
+    return Result<void>::ok();
+}
+
+std::vector<SaveThumbnailWrite> SaveThumbnailWriter::takeCompleted()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<SaveThumbnailWrite> completed;
+    completed.swap(m_completed);
+    return completed;
+}
+
+bool SaveThumbnailWriter::hasPending() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_inFlight > 0;
+}
+
+void SaveThumbnailWriter::waitForAll()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_idle.wait(lock, [this]() { return m_inFlight == 0; });
+}
+
+void SaveThumbnailWriter::shutdown()
+{
+    std::thread worker;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopWorker = true;
+        worker.swap(m_worker);
+    }
+    m_work.notify_all();
+    if (worker.joinable())
+    {
+        worker.join();
+    }
+}
+
+void SaveThumbnailWriter::workerLoop()
+{
+    for (;;)
+    {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_work.wait(lock, [this]() { return m_stopWorker || !m_jobs.empty(); });
+            // Queued thumbnails belong to saves that were already written,
+            // so they are finished before stopping
+            if (m_jobs.empty())
+            {
+                return;
+            }
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+        }
+
+        std::string error = process(job);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_completed.push_back(SaveThumbnailWrite{std::move(job.path), std::move(error)});
+        --m_inFlight;
+        m_idle.notify_all();
+    }
+}
+
+std::string SaveThumbnailWriter::process(const Job& job)
+{
+    u32 width = 0;
+    u32 height = 0;
+    SaveThumbnailFormat::fitWithin(job.width, job.height, job.maxWidth, job.maxHeight, width,
+                                   height);
+    const auto pixels = SaveThumbnailFormat::downscale(job.frame.data(), job.width, job.height,
+                                                       job.stride, width, height);
+    auto encoded = SaveThumbnailFormat::encode(pixels.data(), width, height, job.timestamp);
+    if (encoded.isError())
+    {
+        return encoded.error();
+    }
+
+    // Replace the file in one step so readers see the old or the new one
+    const std::string tempPath = job.path + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(encoded.value().data()),
+                   static_cast<std::streamsize>(encoded.value().size()));
+        if (!file)
+        {
+            return "Failed to write thumbnail: " + tempPath;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(tempPath, job.path, ec);
+    if (ec)
+    {
+        std::filesystem::remove(tempPath, ec);
+        return "Failed to replace thumbnail: " + job.path;
+    }
+    return {};
+}
+
+// ============================================================================
+// SaveThumbnailCache
+// ============================================================================
+
+SaveThumbnailCache::SaveThumbnailCache(usize capacity)
+    : m_capacity(std::max<usize>(1, capacity))
+{
+}
+
+const SaveThumbnail* SaveThumbnailCache::get(const std::string& path)
+{
+    auto it = m_index.find(path);
+    if (it != m_index.end())
+    {
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        return it->second->valid ? &it->second->thumbnail : nullptr;
+    }
+
+    auto loaded = SaveThumbnailFormat::load(path);
+    Entry entry{path, loaded.isOk(), {}};
+    if (loaded.isOk())
+    {
+        entry.thumbnail = std::move(loaded).value();
+    }
+    m_entries.push_front(std::move(entry));
+    m_index[path] = m_entries.begin();
+    evict();
+    return m_entries.front().valid ? &m_entries.front().thumbnail : nullptr;
+}
+
+void SaveThumbnailCache::invalidate(const std::string& path)
+{
+    auto it = m_index.find(path);
+    if (it != m_index.end())
+    {
+        m_entries.erase(it->second);
+        m_index.erase(it);
+    }
+}
+
+void SaveThumbnailCache::clear()
+{
+    m_entries.clear();
+    m_index.clear();
+}
+
+void SaveThumbnailCache::setCapacity(usize capacity)
+{
+    m_capacity = std::max<usize>(1, capacity);
+    evict();
+}
+
+void SaveThumbnailCache::evict()
+{
+    while (m_entries.size() > m_capacity)
+    {
+        m_index.erase(m_entries.back().path);
+        m_entries.pop_back();
+    }
+}
+
+} // namespace NovelMind::save
@@ -0,0 +1,309 @@
+#include "NovelMind/scene/compiled_timeline.hpp"
+#include "NovelMind/scene/bezier.hpp"
+#include <algorithm>
+
+namespace NovelMind::scene
+{
+
+// ============================================================================
+// CompiledTimeline
+// ============================================================================
+
+usize CompiledTimeline::bind(SceneGraph& graph)
+{
+    usize bound = 0;
+    for (auto& channel : m_channels)
+    {
+        SceneObjectBase* object = graph.findObject(channel.targetId);
+        channel.target = object ? object->getAnimatableProperty(channel.property) : nullptr;
+        if (channel.target)
+        {
+            ++bound;
+        }
+    }
+    return bound;
+}
+
+void CompiledTimeline::bindTarget(const std::string& targetId, SceneObjectBase* object)
+{
+    for (auto& channel : m_channels)
+    {
+        if (channel.targetId == targetId)
+        {
+            channel.target = object ? object->getAnimatableProperty(channel.property) : nullptr;
+        }
+    }
+}
+
+void CompiledTimeline::unbind()
+{
+    for (auto& channel : m_channels)
+    {
+        channel.target = nullptr;
+    }
+}
+
+void CompiledTimeline::setTrackActive(u32 track, bool active)
+{
+    if (track < m_trackActive.size())
+    {
+        m_trackActive[track] = active ? 1 : 0;
+    }
+}
+
+bool CompiledTimeline::isTrackActive(u32 track) const
+{
+    return track < m_trackActive.size() && m_trackActive[track] != 0;
+}
+
+void CompiledTimeline::evaluate(f64 time)
+{
+    const f32 t = static_cast<f32>(time);
+    for (auto& channel : m_channels)
+    {
+        if (!channel.target || m_trackActive[channel.track] == 0)
+        {
+            continue;
+        }
+
+        f32 value = evaluateChannel(channel, t);
+        if (channel.property == AnimatableProperty::Alpha)
+        {
+            value = std::clamp(value, 0.0f, 1.0f);
+        }
+        *channel.target = value;
+    }
+}
+
+f32 CompiledTimeline::sample(usize channelIndex, f64 time)
+{
+    if (channelIndex >= m_channels.size())
+    {
+        return 0.0f;
+    }
+    return evaluateChannel(m_channels[channelIndex], static_cast<f32>(time));
+}
+
+void CompiledTimeline::rewind()
+{
+    for (auto& channel : m_channels)
+    {
+        channel.cursor = 0;
+    }
+}
+
+usize CompiledTimeline::seekSegment(Channel& channel, f32 time)
+{
+    const auto& times = channel.times;
+    const usize lastSegment = times.size() - 2;
+    usize seg = std::min(channel.cursor, lastSegment);
+
+    // Sequential playback stays in the current segment or moves to a
+    // neighbour; only seeks fall through to the binary search.
+    if (time >= times[seg])
+    {
+        if (seg == lastSegment || time < times[seg + 1])
+        {
+            return seg;
+        }
+        if (seg + 1 == lastSegment || time < times[seg + 2])
+        {
+            channel.cursor = seg + 1;
+            return seg + 1;
+        }
+    }
+    else if (seg > 0 && time >= times[seg - 1])
+    {
+        channel.cursor = seg - 1;
+        return seg - 1;
+    }
+
+    auto it = std::upper_bound(times.begin(), times.end(), time);
+    const usize index = static_cast<usize>(it - times.begin());
+    seg = index == 0 ? 0 : std::min(index - 1, lastSegment);
+    channel.cursor = seg;
+    return seg;
+}
+
+f32 CompiledTimeline::evaluateChannel(Channel& channel, f32 time) const
+{
+    const usize count = channel.times.size();
+    if (count == 0)
+    {
+        return 0.0f;
+    }
+    if (count == 1 || time <= channel.times.front())
+    {
+        channel.cursor = 0;
+        return channel.values.front();
+    }
+    if (time >= channel.times.back())
+    {
+        channel.cursor = count - 2;
+        return channel.values.back();
+    }
+
+    const usize seg = seekSegment(channel, time);
+    const f32 t0 = channel.times[seg];
+    const f32 t1 = channel.times[seg + 1];
+    const f32 v0 = channel.values[seg];
+    const f32 v1 = channel.values[seg + 1];
+    const f32 span = t1 - t0;
+    if (span <= 0.0f)
+    {
+        return v1;
+    }
+    const f32 u = (time - t0) / span;
+
+    switch (channel.interpolation[seg])
+    {
+        case TimelineInterpolation::Constant:
+            return v0;
+
+        case TimelineInterpolation::Linear:
+            return v0 + (v1 - v0) * u;
+
+        case TimelineInterpolation::EaseIn:
+            return v0 + (v1 - v0) * ease(EaseType::EaseInQuad, u);
+
+        case TimelineInterpolation::EaseOut:
+            return v0 + (v1 - v0) * ease(EaseType::EaseOutQuad, u);
+
+        case TimelineInterpolation::EaseInOut:
+            return v0 + (v1 - v0) * ease(EaseType::EaseInOutQuad, u);
+
+        case TimelineInterpolation::Bezier:
+        {
+            const u32 offset = channel.lutOffset[seg];
+            if (offset != NO_LUT)
+            {
+                const f32 pos = u * static_cast<f32>(m_lutSize - 1);
+                const u32 index = std::min(static_cast<u32>(pos), m_lutSize - 2);
+                const f32 frac = pos - static_cast<f32>(index);
+                const f32 a = m_lut[offset + index];
+                const f32 b = m_lut[offset + index + 1];
+                return a + (b - a) * frac;
+            }
+            const f32 s = solveCubicBezierParameter(channel.controlX1[seg],
+                                                    channel.controlX2[seg], u);
+            return cubicBezier(v0, channel.control1[seg], channel.control2[seg], v1, s);
+        }
+    }
+
+    return v0;
+}
+
+// ============================================================================
+// TimelineCompiler
+// ============================================================================
+
+TimelineCompiler::TimelineCompiler(TimelineCompileOptions options)
+    : m_options(options)
+{
+    m_options.bezierLutSize = std::max<u32>(2, m_options.bezierLutSize);
+}
+
+std::optional<AnimatableProperty> TimelineCompiler::parseProperty(const std::string& name)
+{
+    if (name == "position.x" || name == "x") return AnimatableProperty::PositionX;
+    if (name == "position.y" || name == "y") return AnimatableProperty::PositionY;
+    if (name == "scale.x" || name == "scaleX") return AnimatableProperty::ScaleX;
+    if (name == "scale.y" || name == "scaleY") return AnimatableProperty::ScaleY;
+    if (name == "rotation") return AnimatableProperty::Rotation;
+    if (name == "opacity" || name == "alpha") return AnimatableProperty::Alpha;
+    return std::nullopt;
+}
+
+u32 TimelineCompiler::addTrack()
+{
+    return m_trackCount++;
+}
+
+void TimelineCompiler::addChannel(u32 track, const std::string& targetId,
+                                  AnimatableProperty property, std::vector<TimelineKey> keys)
+{
+    if (keys.empty())
+    {
+        return;
+    }
+    if (track >= m_trackCount)
+    {
+        m_trackCount = track + 1;
+    }
+    m_pending.push_back({track, targetId, property, std::move(keys)});
+}
+
+Result<CompiledTimeline> TimelineCompiler::compile()
+{
+    CompiledTimeline timeline;
+    timeline.m_lutSize = m_options.bezierLutSize;
+    timeline.m_trackActive.assign(m_trackCount, 1);
+    timeline.m_channels.reserve(m_pending.size());
+
+    for (auto& pending : m_pending)
+    {
+        auto& keys = pending.keys;
+        std::stable_sort(keys.begin(), keys.end(),
+            [](const TimelineKey& a, const TimelineKey& b) { return a.time < b.time; });
+
+        CompiledTimeline::Channel channel;
+        channel.targetId = pending.targetId;
+        channel.property = pending.property;
+        channel.track = pending.track;
+
+        const usize count = keys.size();
+        channel.times.reserve(count);
+        channel.values.reserve(count);
+        for (const auto& key : keys)
+        {
+            channel.times.push_back(static_cast<f32>(key.time));
+            channel.values.push_back(key.value);
+        }
+
+        const usize segments = count > 1 ? count - 1 : 0;
+        channel.interpolation.resize(segments);
+        channel.control1.resize(segments);
+        channel.control2.resize(segments);
+        channel.controlX1.resize(segments);
+        channel.controlX2.resize(segments);
+        channel.lutOffset.assign(segments, CompiledTimeline::NO_LUT);
+
+        for (usize i = 0; i < segments; ++i)
+        {
+            const TimelineKey& k0 = keys[i];
+            const TimelineKey& k1 = keys[i + 1];
+            const f32 span = static_cast<f32>(k1.time - k0.time);
+
+            channel.interpolation[i] = k0.interpolation;
+            channel.control1[i] = k0.value + k0.outTangent * k0.outWeight * span;
+            channel.control2[i] = k1.value - k1.inTangent * k1.inWeight * span;
+            channel.controlX1[i] = std::clamp(k0.outWeight, 0.0f, 1.0f);
+            channel.controlX2[i] = std::clamp(1.0f - k1.inWeight, 0.0f, 1.0f);
+
+            if (k0.interpolation != TimelineInterpolation::Bezier || !m_options.bakeBezier)
+            {
+                continue;
+            }
+
+            channel.lutOffset[i] = static_cast<u32>(timeline.m_lut.size());
+            const u32 lutSize = m_options.bezierLutSize;
+            for (u32 j = 0; j < lutSize; ++j)
+            {
+                const f32 u = static_cast<f32>(j) / static_cast<f32>(lutSize - 1);
+                const f32 s = solveCubicBezierParameter(channel.controlX1[i],
+                                                        channel.controlX2[i], u);
+                timeline.m_lut.push_back(cubicBezier(k0.value, channel.control1[i],
+                                                     channel.control2[i], k1.value, s));
+            }
+        }
+
+        timeline.m_duration = std::max(timeline.m_duration, keys.back().time);
+        timeline.m_channels.push_back(std::move(channel));
+    }
+
+    m_pending.clear();
+    m_trackCount = 0;
+    return Result<CompiledTimeline>::ok(std::move(timeline));
+}
+
+} // namespace NovelMind::scene
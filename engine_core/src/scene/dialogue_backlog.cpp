@@ -0,0 +1,336 @@
+#include "NovelMind/scene/dialogue_backlog.hpp"
+#include <algorithm>
+
+namespace NovelMind::scene
+{
+
+namespace
+{
+
+u64 hashBytes(u64 hash, std::string_view bytes)
+{
+    for (char c : bytes)
+    {
+        hash ^= static_cast<u8>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+const std::string& emptyString()
+{
+    static const std::string empty;
+    return empty;
+}
+
+} // namespace
+
+DialogueBacklog::DialogueBacklog(usize capacity)
+    : m_capacity(std::max<usize>(1, capacity))
+{
+}
+
+void DialogueBacklog::push(u32 textIndex, u32 speakerIndex, std::string_view voiceId,
+                           const VariableMap& variables)
+{
+    Entry entry;
+    entry.textIndex = textIndex;
+    entry.speakerIndex = speakerIndex;
+    entry.voiceSlot = voiceId.empty() ? NONE : internVoice(voiceId);
+
+    if (!variables.empty())
+    {
+        entry.variableHash = hashVariables(variables);
+        Snapshot& snapshot = m_snapshots[entry.variableHash];
+        if (snapshot.refs++ == 0)
+        {
+            snapshot.variables = variables;
+        }
+    }
+
+    if (m_count < m_capacity)
+    {
+        // The ring grows on demand until it first fills up
+        if (m_entries.size() < m_capacity)
+        {
+            m_entries.push_back(entry);
+        }
+        else
+        {
+            m_entries[slotOf(m_count)] = entry;
+        }
+        ++m_count;
+    }
+    else
+    {
+        // Full: overwrite the oldest entry
+        releaseEntry(m_entries[m_head]);
+        auto cached = m_layoutLookup.find(m_totalPushed - m_count);
+        if (cached != m_layoutLookup.end())
+        {
+            m_layoutCache.erase(cached->second);
+            m_layoutLookup.erase(cached);
+        }
+        m_entries[m_head] = entry;
+        m_head = (m_head + 1) % m_capacity;
+    }
+    ++m_totalPushed;
+}
+
+void DialogueBacklog::clear()
+{
+    m_entries.clear();
+    m_head = 0;
+    m_count = 0;
+    m_voices.clear();
+    m_voiceLookup.clear();
+    m_freeVoiceSlots.clear();
+    m_snapshots.clear();
+    invalidateLayouts();
+}
+
+const DialogueBacklog::Entry& DialogueBacklog::getEntry(usize index) const
+{
+    static const Entry empty;
+    return index < m_count ? m_entries[slotOf(index)] : empty;
+}
+
+void DialogueBacklog::setStringTable(const std::vector<std::string>* stringTable,
+                                     const localization::LocalizationManager* localization)
+{
+    m_stringTable = stringTable;
+    m_localization = localization;
+    m_resolver = nullptr;
+    invalidateLayouts();
+}
+
+void DialogueBacklog::setTextResolver(TextResolver resolver)
+{
+    m_resolver = std::move(resolver);
+    invalidateLayouts();
+}
+
+std::string DialogueBacklog::getText(usize index) const
+{
+    if (index >= m_count)
+    {
+        return {};
+    }
+    const Entry& entry = m_entries[slotOf(index)];
+    return resolve(entry.textIndex, entry.variableHash);
+}
+
+std::string DialogueBacklog::getSpeaker(usize index) const
+{
+    if (index >= m_count)
+    {
+        return {};
+    }
+    return resolve(m_entries[slotOf(index)].speakerIndex, 0);
+}
+
+const std::string& DialogueBacklog::getVoiceId(usize index) const
+{
+    if (index >= m_count)
+    {
+        return emptyString();
+    }
+    const u32 voiceSlot = m_entries[slotOf(index)].voiceSlot;
+    return voiceSlot == NONE ? emptyString() : m_voices[voiceSlot].id;
+}
+
+void DialogueBacklog::setLayoutEngine(const renderer::TextLayoutEngine* engine)
+{
+    m_layoutEngine = engine;
+    invalidateLayouts();
+}
+
+void DialogueBacklog::setLayoutCacheSize(usize size)
+{
+    m_layoutCacheSize = std::max<usize>(1, size);
+    while (m_layoutCache.size() > m_layoutCacheSize)
+    {
+        m_layoutLookup.erase(m_layoutCache.back().first);
+        m_layoutCache.pop_back();
+    }
+}
+
+const renderer::TextLayout& DialogueBacklog::layout(usize index)
+{
+    static const renderer::TextLayout empty;
+    if (index >= m_count || !m_layoutEngine)
+    {
+        return empty;
+    }
+
+    const u64 sequence = sequenceOf(index);
+    auto it = m_layoutLookup.find(sequence);
+    if (it != m_layoutLookup.end())
+    {
+        m_layoutCache.splice(m_layoutCache.begin(), m_layoutCache, it->second);
+        return it->second->second;
+    }
+
+    if (m_layoutCache.size() >= m_layoutCacheSize)
+    {
+        m_layoutLookup.erase(m_layoutCache.back().first);
+        m_layoutCache.pop_back();
+    }
+
+    m_layoutCache.emplace_front(sequence, m_layoutEngine->layout(getText(index)));
+    m_layoutLookup[sequence] = m_layoutCache.begin();
+    return m_layoutCache.front().second;
+}
+
+usize DialogueBacklog::forEachVisible(usize first, f32 viewportHeight,
+                                      const VisibleCallback& callback)
+{
+    usize visited = 0;
+    f32 height = 0.0f;
+    for (usize index = first; index < m_count && height < viewportHeight; ++index)
+    {
+        const renderer::TextLayout& entryLayout = layout(index);
+        if (callback)
+        {
+            callback(index, entryLayout);
+        }
+        height += entryLayout.totalHeight;
+        ++visited;
+    }
+    return visited;
+}
+
+void DialogueBacklog::invalidateLayouts()
+{
+    m_layoutCache.clear();
+    m_layoutLookup.clear();
+}
+
+audio::AudioHandle DialogueBacklog::replayVoice(usize index, audio::AudioManager& audio,
+                                                const audio::VoiceConfig& config) const
+{
+    const std::string& voiceId = getVoiceId(index);
+    if (voiceId.empty())
+    {
+        return {};
+    }
+    return audio.playVoice(voiceId, config);
+}
+
+usize DialogueBacklog::slotOf(usize index) const
+{
+    return (m_head + index) % m_capacity;
+}
+
+u64 DialogueBacklog::sequenceOf(usize index) const
+{
+    return m_totalPushed - m_count + index;
+}
+
+std::string DialogueBacklog::resolve(u32 stringIndex, u64 variableHash) const
+{
+    if (stringIndex == NONE)
+    {
+        return {};
+    }
+
+    static const VariableMap noVariables;
+    const VariableMap* variables = &noVariables;
+    if (variableHash != 0)
+    {
+        auto it = m_snapshots.find(variableHash);
+        if (it != m_snapshots.end())
+        {
+            variables = &it->second.variables;
+        }
+    }
+
+    if (m_resolver)
+    {
+        return m_resolver(stringIndex, *variables);
+    }
+    if (!m_stringTable || stringIndex >= m_stringTable->size())
+    {
+        return {};
+    }
+
+    const std::string& source = (*m_stringTable)[stringIndex];
+    if (!m_localization)
+    {
+        return source;
+    }
+    const bool translated = m_localization->hasString(source) ||
+                            m_localization->hasString(m_localization->getDefaultLocale(), source);
+    return translated ? m_localization->get(source, *variables)
+                      : m_localization->interpolate(source, *variables);
+}
+
+u32 DialogueBacklog::internVoice(std::string_view voiceId)
+{
+    std::string key(voiceId);
+    auto it = m_voiceLookup.find(key);
+    if (it != m_voiceLookup.end())
+    {
+        ++m_voices[it->second].refs;
+        return it->second;
+    }
+
+    u32 slot;
+    if (!m_freeVoiceSlots.empty())
+    {
+        slot = m_freeVoiceSlots.back();
+        m_freeVoiceSlots.pop_back();
+    }
+    else
+    {
+        slot = static_cast<u32>(m_voices.size());
+        m_voices.emplace_back();
+    }
+
+    m_voices[slot].id = key;
+    m_voices[slot].refs = 1;
+    m_voiceLookup.emplace(std::move(key), slot);
+    return slot;
+}
+
+void DialogueBacklog::releaseEntry(const Entry& entry)
+{
+    if (entry.voiceSlot != NONE)
+    {
+        VoiceSlot& voice = m_voices[entry.voiceSlot];
+        if (--voice.refs == 0)
+        {
+            m_voiceLookup.erase(voice.id);
+            voice.id.clear();
+            voice.id.shrink_to_fit();
+            m_freeVoiceSlots.push_back(entry.voiceSlot);
+        }
+    }
+
+    if (entry.variableHash != 0)
+    {
+        auto it = m_snapshots.find(entry.variableHash);
+        if (it != m_snapshots.end() && --it->second.refs == 0)
+        {
+            m_snapshots.erase(it);
+        }
+    }
+}
+
+u64 DialogueBacklog::hashVariables(const VariableMap& variables)
+{
+    // Order-independent: sum of per-pair hashes, so equal maps hash equally
+    // regardless of bucket order
+    u64 hash = 0;
+    for (const auto& [name, value] : variables)
+    {
+        u64 pair = hashBytes(14695981039346656037ull, name);
+        pair = hashBytes(pair ^ 0xFFu, value);
+        pair ^= pair >> 31;
+        pair *= 0x9E3779B97F4A7C15ull;
+        hash += pair;
+    }
+    return hash == 0 ? 1 : hash;
+}
+
+} // namespace NovelMind::scene
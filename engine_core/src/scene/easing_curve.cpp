@@ -0,0 +1,151 @@
+#include "NovelMind/scene/easing_curve.hpp"
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define NOVELMIND_EASING_SSE2 1
+#elif defined(__ARM_NEON)
+    #include <arm_neon.h>
+    #define NOVELMIND_EASING_NEON 1
+#endif
+
+namespace NovelMind::scene
+{
+
+EasingCurve::EasingCurve()
+    : m_samples{0.0f, 1.0f}
+    , m_scale(1.0f)
+{
+}
+
+EasingCurve EasingCurve::bake(const ExactFunction& exact, f32 tolerance)
+{
+    EasingCurve curve;
+    if (!exact)
+    {
+        return curve;
+    }
+
+    std::vector<f32> samples;
+    f32 maxError = 0.0f;
+    for (u32 count = MIN_SAMPLES; count <= MAX_SAMPLES; count = (count - 1) * 2 + 1)
+    {
+        const f32 step = 1.0f / static_cast<f32>(count - 1);
+        samples.resize(count);
+        for (u32 i = 0; i < count; ++i)
+        {
+            samples[i] = exact(static_cast<f32>(i) * step);
+        }
+
+        // Midpoints are where linear interpolation deviates the most
+        maxError = 0.0f;
+        for (u32 i = 0; i + 1 < count; ++i)
+        {
+            const f32 mid = (static_cast<f32>(i) + 0.5f) * step;
+            const f32 approx = 0.5f * (samples[i] + samples[i + 1]);
+            maxError = std::max(maxError, std::fabs(exact(mid) - approx));
+        }
+
+        if (maxError <= tolerance)
+        {
+            break;
+        }
+    }
+
+    curve = fromSamples(std::move(samples));
+    curve.m_maxError = maxError;
+    return curve;
+}
+
+EasingCurve EasingCurve::fromSamples(std::vector<f32> samples)
+{
+    EasingCurve curve;
+    if (samples.size() < 2)
+    {
+        return curve;
+    }
+    curve.m_samples = std::move(samples);
+    curve.m_scale = static_cast<f32>(curve.m_samples.size() - 1);
+    return curve;
+}
+
+f32 EasingCurve::evaluate(f32 t) const
+{
+    t = std::clamp(t, 0.0f, 1.0f);
+    const f32 pos = t * m_scale;
+    const f32 index = std::min(std::floor(pos), m_scale - 1.0f);
+    const usize i = static_cast<usize>(index);
+    const f32 frac = pos - index;
+    return m_samples[i] + (m_samples[i + 1] - m_samples[i]) * frac;
+}
+
+f32 EasingCurve::evaluateDerivative(f32 t) const
+{
+    t = std::clamp(t, 0.0f, 1.0f);
+    const f32 pos = t * m_scale;
+    const usize i = static_cast<usize>(std::min(std::floor(pos), m_scale - 1.0f));
+    return (m_samples[i + 1] - m_samples[i]) * m_scale;
+}
+
+void EasingCurve::evaluateBatch(const f32* times, f32* out, usize count) const
+{
+    usize i = 0;
+    const f32* samples = m_samples.data();
+
+#if defined(NOVELMIND_EASING_SSE2)
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 scale = _mm_set1_ps(m_scale);
+    const __m128 maxIndex = _mm_set1_ps(m_scale - 1.0f);
+    alignas(16) i32 indices[4];
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 t = _mm_loadu_ps(times + i);
+        t = _mm_min_ps(_mm_max_ps(t, zero), one);
+        const __m128 pos = _mm_mul_ps(t, scale);
+        // pos is non-negative, so truncation equals floor
+        const __m128 index = _mm_min_ps(_mm_cvtepi32_ps(_mm_cvttps_epi32(pos)), maxIndex);
+        const __m128 frac = _mm_sub_ps(pos, index);
+        _mm_store_si128(reinterpret_cast<__m128i*>(indices), _mm_cvttps_epi32(index));
+
+        const __m128 a = _mm_setr_ps(samples[indices[0]], samples[indices[1]],
+                                     samples[indices[2]], samples[indices[3]]);
+        const __m128 b = _mm_setr_ps(samples[indices[0] + 1], samples[indices[1] + 1],
+                                     samples[indices[2] + 1], samples[indices[3] + 1]);
+        _mm_storeu_ps(out + i, _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), frac)));
+    }
+#elif defined(NOVELMIND_EASING_NEON)
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t scale = vdupq_n_f32(m_scale);
+    const float32x4_t maxIndex = vdupq_n_f32(m_scale - 1.0f);
+    alignas(16) u32 indices[4];
+
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4_t t = vld1q_f32(times + i);
+        t = vminq_f32(vmaxq_f32(t, zero), one);
+        const float32x4_t pos = vmulq_f32(t, scale);
+        const float32x4_t index = vminq_f32(vcvtq_f32_u32(vcvtq_u32_f32(pos)), maxIndex);
+        const float32x4_t frac = vsubq_f32(pos, index);
+        vst1q_u32(indices, vcvtq_u32_f32(index));
+
+        const f32 av[4] = {samples[indices[0]], samples[indices[1]],
+                           samples[indices[2]], samples[indices[3]]};
+        const f32 bv[4] = {samples[indices[0] + 1], samples[indices[1] + 1],
+                           samples[indices[2] + 1], samples[indices[3] + 1]};
+        const float32x4_t a = vld1q_f32(av);
+        const float32x4_t b = vld1q_f32(bv);
+        vst1q_f32(out + i, vmlaq_f32(a, vsubq_f32(b, a), frac));
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        out[i] = evaluate(times[i]);
+    }
+}
+
+} // namespace NovelMind::scene
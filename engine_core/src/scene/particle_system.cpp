@@ -0,0 +1,494 @@
+#include "NovelMind/scene/particle_system.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define NOVELMIND_PARTICLES_SSE2 1
+#elif defined(__ARM_NEON)
+    #include <arm_neon.h>
+    #define NOVELMIND_PARTICLES_NEON 1
+#endif
+
+namespace NovelMind::scene
+{
+
+namespace
+{
+
+constexpr u32 MAX_POOL_SIZE = 1u << 20;
+
+bool parseColor(const std::string& text, renderer::Color& out)
+{
+    if ((text.size() != 7 && text.size() != 9) || text[0] != '#')
+    {
+        return false;
+    }
+    char* end = nullptr;
+    const unsigned long value = std::strtoul(text.c_str() + 1, &end, 16);
+    if (end != text.c_str() + text.size())
+    {
+        return false;
+    }
+    const u32 rgba = text.size() == 7 ? (static_cast<u32>(value) << 8) | 0xFFu
+                                      : static_cast<u32>(value);
+    out = renderer::Color::fromRGBA(rgba);
+    return true;
+}
+
+f32* numericField(ParticleEmitterDef& def, const std::string& key)
+{
+    struct Field
+    {
+        const char* name;
+        f32 ParticleEmitterDef::*member;
+    };
+    static const Field fields[] = {
+        {"emissionRate", &ParticleEmitterDef::emissionRate},
+        {"lifetimeMin", &ParticleEmitterDef::lifetimeMin},
+        {"lifetimeMax", &ParticleEmitterDef::lifetimeMax},
+        {"velocityMinX", &ParticleEmitterDef::velocityMinX},
+        {"velocityMaxX", &ParticleEmitterDef::velocityMaxX},
+        {"velocityMinY", &ParticleEmitterDef::velocityMinY},
+        {"velocityMaxY", &ParticleEmitterDef::velocityMaxY},
+        {"gravityX", &ParticleEmitterDef::gravityX},
+        {"gravityY", &ParticleEmitterDef::gravityY},
+        {"width", &ParticleEmitterDef::width},
+        {"height", &ParticleEmitterDef::height},
+        {"sizeVariance", &ParticleEmitterDef::sizeVariance},
+        {"swayAmplitude", &ParticleEmitterDef::swayAmplitude},
+        {"swayFrequency", &ParticleEmitterDef::swayFrequency},
+    };
+
+    for (const Field& field : fields)
+    {
+        if (key == field.name)
+        {
+            return &(def.*field.member);
+        }
+    }
+
+    renderer::Rect& area = def.spawnArea;
+    if (key == "spawnX")
+    {
+        return &area.x;
+    }
+    if (key == "spawnY")
+    {
+        return &area.y;
+    }
+    if (key == "spawnWidth")
+    {
+        return &area.width;
+    }
+    if (key == "spawnHeight")
+    {
+        return &area.height;
+    }
+    return nullptr;
+}
+
+u8 lerpChannel(u8 a, u8 b, f32 t)
+{
+    return static_cast<u8>(static_cast<f32>(a) + (static_cast<f32>(b) - static_cast<f32>(a)) * t);
+}
+
+} // namespace
+
+// ============================================================================
+// ParticleEmitterDef
+// ============================================================================
+
+ParticleEmitterDef ParticleEmitterDef::rain()
+{
+    ParticleEmitterDef def;
+    def.emissionRate = 900.0f;
+    def.maxParticles = 1500;
+    def.lifetimeMin = 0.8f;
+    def.lifetimeMax = 1.2f;
+    def.spawnArea = {-200.0f, -60.0f, 2320.0f, 20.0f};
+    def.velocityMinX = 150.0f;
+    def.velocityMaxX = 200.0f;
+    def.velocityMinY = 1300.0f;
+    def.velocityMaxY = 1600.0f;
+    def.width = 2.0f;
+    def.height = 26.0f;
+    def.sizeVariance = 0.3f;
+    def.startColor = {180, 200, 230, 170};
+    def.endColor = {180, 200, 230, 110};
+    return def;
+}
+
+ParticleEmitterDef ParticleEmitterDef::snow()
+{
+    ParticleEmitterDef def;
+    def.emissionRate = 80.0f;
+    def.maxParticles = 1200;
+    def.lifetimeMin = 10.0f;
+    def.lifetimeMax = 14.0f;
+    def.spawnArea = {-100.0f, -30.0f, 2120.0f, 10.0f};
+    def.velocityMinX = -15.0f;
+    def.velocityMaxX = 15.0f;
+    def.velocityMinY = 60.0f;
+    def.velocityMaxY = 120.0f;
+    def.width = 6.0f;
+    def.height = 6.0f;
+    def.sizeVariance = 0.5f;
+    def.swayAmplitude = 25.0f;
+    def.swayFrequency = 1.5f;
+    def.startColor = {255, 255, 255, 230};
+    def.endColor = {255, 255, 255, 180};
+    return def;
+}
+
+ParticleEmitterDef ParticleEmitterDef::petals()
+{
+    ParticleEmitterDef def;
+    def.emissionRate = 25.0f;
+    def.maxParticles = 300;
+    def.lifetimeMin = 8.0f;
+    def.lifetimeMax = 12.0f;
+    def.spawnArea = {-100.0f, -30.0f, 2120.0f, 10.0f};
+    def.velocityMinX = 30.0f;
+    def.velocityMaxX = 90.0f;
+    def.velocityMinY = 50.0f;
+    def.velocityMaxY = 100.0f;
+    def.width = 10.0f;
+    def.height = 7.0f;
+    def.sizeVariance = 0.3f;
+    def.swayAmplitude = 40.0f;
+    def.swayFrequency = 2.0f;
+    def.startColor = {255, 190, 210, 240};
+    def.endColor = {255, 190, 210, 0};
+    return def;
+}
+
+Result<ParticleEmitterDef> ParticleEmitterDef::parse(const std::string& json)
+{
+    ParticleEmitterDef def;
+
+    usize pos = json.find('{');
+    if (pos == std::string::npos)
+    {
+        return Result<ParticleEmitterDef>::error("Emitter definition must be a JSON object");
+    }
+    ++pos;
+
+    auto skipSpace = [&json, &pos]() {
+        while (pos < json.size() && std::isspace(static_cast<unsigned char>(json[pos])))
+        {
+            ++pos;
+        }
+    };
+    auto readString = [&json, &pos](std::string& out) {
+        const usize end = json.find('"', pos + 1);
+        if (end == std::string::npos)
+        {
+            return false;
+        }
+        out = json.substr(pos + 1, end - pos - 1);
+        pos = end + 1;
+        return true;
+    };
+
+    while (true)
+    {
+        skipSpace();
+        if (pos >= json.size())
+        {
+            return Result<ParticleEmitterDef>::error("Unterminated emitter definition");
+        }
+        if (json[pos] == '}')
+        {
+            break;
+        }
+        if (json[pos] == ',')
+        {
+            ++pos;
+            continue;
+        }
+
+        std::string key;
+        if (json[pos] != '"' || !readString(key))
+        {
+            return Result<ParticleEmitterDef>::error("Expected a key in emitter definition");
+        }
+        skipSpace();
+        if (pos >= json.size() || json[pos] != ':')
+        {
+            return Result<ParticleEmitterDef>::error("Expected ':' after \"" + key + "\"");
+        }
+        ++pos;
+        skipSpace();
+
+        if (pos < json.size() && json[pos] == '"')
+        {
+            std::string text;
+            if (!readString(text))
+            {
+                return Result<ParticleEmitterDef>::error("Unterminated string for \"" + key + "\"");
+            }
+            if (key == "startColor" || key == "endColor")
+            {
+                if (!parseColor(text, key == "startColor" ? def.startColor : def.endColor))
+                {
+                    return Result<ParticleEmitterDef>::error("Invalid color for \"" + key +
+                                                             "\": " + text);
+                }
+            }
+            continue;
+        }
+
+        char* end = nullptr;
+        const f32 value = std::strtof(json.c_str() + pos, &end);
+        if (end == json.c_str() + pos)
+        {
+            return Result<ParticleEmitterDef>::error("Invalid value for \"" + key + "\"");
+        }
+        pos = static_cast<usize>(end - json.c_str());
+
+        if (key == "maxParticles")
+        {
+            if (!(value >= 0.0f && value <= static_cast<f32>(MAX_POOL_SIZE)))
+            {
+                return Result<ParticleEmitterDef>::error("maxParticles out of range");
+            }
+            def.maxParticles = static_cast<u32>(value);
+        }
+        else if (f32* field = numericField(def, key))
+        {
+            *field = value;
+        }
+    }
+
+    if (def.lifetimeMin <= 0.0f || def.lifetimeMax < def.lifetimeMin)
+    {
+        return Result<ParticleEmitterDef>::error("Invalid particle lifetime range");
+    }
+
+    return Result<ParticleEmitterDef>::ok(def);
+}
+
+Result<ParticleEmitterDef> ParticleEmitterDef::loadFromFile(const std::string& path)
+{
+    std::ifstream file(path);
+    if (!file.is_open())
+    {
+        return Result<ParticleEmitterDef>::error("Failed to open emitter definition: " + path);
+    }
+
+    std::ostringstream content;
+    content << file.rdbuf();
+    return parse(content.str());
+}
+
+// ============================================================================
+// ParticleSystem
+// ============================================================================
+
+ParticleSystem::ParticleSystem()
+{
+    setEmitter(m_def);
+}
+
+void ParticleSystem::setEmitter(const ParticleEmitterDef& def)
+{
+    m_def = def;
+    const usize capacity = std::min(def.maxParticles, MAX_POOL_SIZE);
+
+    for (auto* array : {&m_posX, &m_posY, &m_velX, &m_velY, &m_life, &m_invLifetime, &m_scale,
+                        &m_phase})
+    {
+        array->assign(capacity, 0.0f);
+    }
+    m_rects.resize(capacity);
+    m_colors.resize(capacity);
+    clear();
+}
+
+void ParticleSystem::setSeed(u32 seed)
+{
+    m_rng = seed != 0 ? seed : 0x9E3779B9u;
+}
+
+void ParticleSystem::burst(u32 count)
+{
+    spawn(count);
+}
+
+void ParticleSystem::update(f32 deltaTime)
+{
+    if (deltaTime <= 0.0f)
+    {
+        return;
+    }
+
+    integrate(deltaTime);
+    recycle();
+
+    if (m_emitting)
+    {
+        m_emitAccumulator += m_def.emissionRate * m_intensity * deltaTime;
+        const f32 whole = std::floor(m_emitAccumulator);
+        m_emitAccumulator -= whole;
+        spawn(static_cast<u32>(std::min(whole, static_cast<f32>(MAX_POOL_SIZE))));
+    }
+    else
+    {
+        m_emitAccumulator = 0.0f;
+    }
+}
+
+void ParticleSystem::render(renderer::IRenderer& renderer, f32 alpha)
+{
+    if (m_alive == 0 || alpha <= 0.0f)
+    {
+        return;
+    }
+
+    const f32 halfWidth = m_def.width * 0.5f;
+    const f32 halfHeight = m_def.height * 0.5f;
+    const bool sway = m_def.swayAmplitude != 0.0f;
+
+    for (usize i = 0; i < m_alive; ++i)
+    {
+        const f32 t = std::clamp(1.0f - m_life[i] * m_invLifetime[i], 0.0f, 1.0f);
+        const f32 x = sway ? m_posX[i] + m_def.swayAmplitude *
+                                             std::sin(m_phase[i] + m_life[i] * m_def.swayFrequency)
+                           : m_posX[i];
+        const f32 s = m_scale[i];
+        m_rects[i] = {x - halfWidth * s, m_posY[i] - halfHeight * s, m_def.width * s,
+                      m_def.height * s};
+
+        renderer::Color& color = m_colors[i];
+        color.r = lerpChannel(m_def.startColor.r, m_def.endColor.r, t);
+        color.g = lerpChannel(m_def.startColor.g, m_def.endColor.g, t);
+        color.b = lerpChannel(m_def.startColor.b, m_def.endColor.b, t);
+        color.a = static_cast<u8>(
+            static_cast<f32>(lerpChannel(m_def.startColor.a, m_def.endColor.a, t)) * alpha);
+    }
+
+    renderer.fillRects(m_rects.data(), m_colors.data(), m_alive);
+}
+
+void ParticleSystem::clear()
+{
+    m_alive = 0;
+    m_emitAccumulator = 0.0f;
+}
+
+void ParticleSystem::spawn(u32 count)
+{
+    const usize end = std::min(m_alive + count, getCapacity());
+    for (usize i = m_alive; i < end; ++i)
+    {
+        m_posX[i] = m_def.spawnArea.x + random01() * m_def.spawnArea.width;
+        m_posY[i] = m_def.spawnArea.y + random01() * m_def.spawnArea.height;
+        m_velX[i] = randomRange(m_def.velocityMinX, m_def.velocityMaxX);
+        m_velY[i] = randomRange(m_def.velocityMinY, m_def.velocityMaxY);
+        const f32 lifetime = std::max(randomRange(m_def.lifetimeMin, m_def.lifetimeMax), 1e-3f);
+        m_life[i] = lifetime;
+        m_invLifetime[i] = 1.0f / lifetime;
+        m_scale[i] = randomRange(1.0f - m_def.sizeVariance, 1.0f + m_def.sizeVariance);
+        m_phase[i] = random01() * 6.2831853f;
+    }
+    m_alive = end;
+}
+
+void ParticleSystem::integrate(f32 deltaTime)
+{
+    f32* posX = m_posX.data();
+    f32* posY = m_posY.data();
+    f32* velX = m_velX.data();
+    f32* velY = m_velY.data();
+    f32* life = m_life.data();
+    const f32 dvX = m_def.gravityX * deltaTime;
+    const f32 dvY = m_def.gravityY * deltaTime;
+    const usize count = m_alive;
+    usize i = 0;
+
+#if defined(NOVELMIND_PARTICLES_SSE2)
+    const __m128 dt = _mm_set1_ps(deltaTime);
+    const __m128 gx = _mm_set1_ps(dvX);
+    const __m128 gy = _mm_set1_ps(dvY);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128 vx = _mm_add_ps(_mm_loadu_ps(velX + i), gx);
+        const __m128 vy = _mm_add_ps(_mm_loadu_ps(velY + i), gy);
+        _mm_storeu_ps(velX + i, vx);
+        _mm_storeu_ps(velY + i, vy);
+        _mm_storeu_ps(posX + i, _mm_add_ps(_mm_loadu_ps(posX + i), _mm_mul_ps(vx, dt)));
+        _mm_storeu_ps(posY + i, _mm_add_ps(_mm_loadu_ps(posY + i), _mm_mul_ps(vy, dt)));
+        _mm_storeu_ps(life + i, _mm_sub_ps(_mm_loadu_ps(life + i), dt));
+    }
+#elif defined(NOVELMIND_PARTICLES_NEON)
+    const float32x4_t dt = vdupq_n_f32(deltaTime);
+    const float32x4_t gx = vdupq_n_f32(dvX);
+    const float32x4_t gy = vdupq_n_f32(dvY);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        const float32x4_t vx = vaddq_f32(vld1q_f32(velX + i), gx);
+        const float32x4_t vy = vaddq_f32(vld1q_f32(velY + i), gy);
+        vst1q_f32(velX + i, vx);
+        vst1q_f32(velY + i, vy);
+        vst1q_f32(posX + i, vmlaq_f32(vld1q_f32(posX + i), vx, dt));
+        vst1q_f32(posY + i, vmlaq_f32(vld1q_f32(posY + i), vy, dt));
+        vst1q_f32(life + i, vsubq_f32(vld1q_f32(life + i), dt));
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        velX[i] += dvX;
+        velY[i] += dvY;
+        posX[i] += velX[i] * deltaTime;
+        posY[i] += velY[i] * deltaTime;
+        life[i] -= deltaTime;
+    }
+}
+
+void ParticleSystem::recycle()
+{
+    // Move the last live particle into each dead slot
+    usize i = 0;
+    while (i < m_alive)
+    {
+        if (m_life[i] > 0.0f)
+        {
+            ++i;
+            continue;
+        }
+
+        const usize last = --m_alive;
+        m_posX[i] = m_posX[last];
+        m_posY[i] = m_posY[last];
+        m_velX[i] = m_velX[last];
+        m_velY[i] = m_velY[last];
+        m_life[i] = m_life[last];
+        m_invLifetime[i] = m_invLifetime[last];
+        m_scale[i] = m_scale[last];
+        m_phase[i] = m_phase[last];
+    }
+}
+
+f32 ParticleSystem::random01()
+{
+    // xorshift32
+    m_rng ^= m_rng << 13;
+    m_rng ^= m_rng >> 17;
+    m_rng ^= m_rng << 5;
+    return static_cast<f32>(m_rng >> 8) * (1.0f / 16777216.0f);
+}
+
+f32 ParticleSystem::randomRange(f32 min, f32 max)
+{
+    return min + (max - min) * random01();
+}
+
+} // namespace NovelMind::scene
@@ -275,6 +275,20 @@ void SceneObjectBase::animateScale(f32 toScaleX, f32 toScaleY, f32 duration, Eas
     m_animations.push_back(std::move(tweenY));
 }
 
+f32* SceneObjectBase::getAnimatableProperty(AnimatableProperty property)
+{
+    switch (property)
+    {
+        case AnimatableProperty::PositionX: return &m_transform.x;
+        case AnimatableProperty::PositionY: return &m_transform.y;
+        case AnimatableProperty::ScaleX: return &m_transform.scaleX;
+        case AnimatableProperty::ScaleY: return &m_transform.scaleY;
+        case AnimatableProperty::Rotation: return &m_transform.rotation;
+        case AnimatableProperty::Alpha: return &m_alpha;
+    }
+    return nullptr;
+}
+
 void SceneObjectBase::notifyPropertyChanged(const std::string& property,
                                             const std::string& oldValue,
                                             const std::string& newValue)
@@ -742,7 +756,12 @@ EffectOverlayObject::EffectOverlayObject(const std::string& id)
 
 void EffectOverlayObject::setEffectType(EffectType type)
 {
+    if (type == m_effectType)
+    {
+        return;
+    }
     m_effectType = type;
+    configureParticles();
 }
 
 void EffectOverlayObject::setColor(const renderer::Color& color)
@@ -768,6 +787,59 @@ void EffectOverlayObject::stopEffect()
     m_effectTimer = 0.0f;
 }
 
+void EffectOverlayObject::setParticleEmitter(const ParticleEmitterDef& def)
+{
+    m_customEmitter = def;
+    m_customEmitterPath.clear();
+    if (m_effectType == EffectType::Custom)
+    {
+        configureParticles();
+    }
+}
+
+Result<void> EffectOverlayObject::loadParticleEmitter(const std::string& path)
+{
+    auto def = ParticleEmitterDef::loadFromFile(path);
+    if (def.isError())
+    {
+        return Result<void>::error(def.error());
+    }
+
+    setParticleEmitter(def.value());
+    m_customEmitterPath = path;
+    return Result<void>::ok();
+}
+
+bool EffectOverlayObject::isParticleEffect() const
+{
+    return m_effectType == EffectType::Rain || m_effectType == EffectType::Snow ||
+           (m_effectType == EffectType::Custom && m_customEmitter.has_value());
+}
+
+void EffectOverlayObject::configureParticles()
+{
+    switch (m_effectType)
+    {
+        case EffectType::Rain:
+            m_particles.setEmitter(ParticleEmitterDef::rain());
+            break;
+        case EffectType::Snow:
+            m_particles.setEmitter(ParticleEmitterDef::snow());
+            break;
+        case EffectType::Custom:
+            if (m_customEmitter)
+            {
+                m_particles.setEmitter(*m_customEmitter);
+                break;
+            }
+            [[fallthrough]];
+        default:
+            m_particles.setEmitting(false);
+            m_particles.clear();
+            break;
+    }
+}
+
 void EffectOverlayObject::update(f64 deltaTime)
 {
     SceneObjectBase::update(deltaTime);
@@ -781,11 +853,18 @@ void EffectOverlayObject::update(f64 deltaTime)
             m_effectTimer = 0.0f;
         }
     }
+
+    if (isParticleEffect())
+    {
+        m_particles.setEmitting(m_effectActive);
+        m_particles.setIntensity(m_intensity);
+        m_particles.update(static_cast<f32>(deltaTime));
+    }
 }
 
 void EffectOverlayObject::render(renderer::IRenderer& renderer)
 {
-    if (!m_visible || m_alpha <= 0.0f || !m_effectActive)
+    if (!m_visible || m_alpha <= 0.0f || (!m_effectActive && m_particles.getAliveCount() == 0))
     {
         return;
     }
@@ -816,10 +895,10 @@ void EffectOverlayObject::render(renderer::IRenderer& renderer)
             break;
         case EffectType::Rain:
         case EffectType::Snow:
-            // Particle effects would be rendered here
+        case EffectType::Custom:
+            m_particles.render(renderer, m_alpha);
             break;
         case EffectType::None:
-        case EffectType::Custom:
             break;
     }
 }
@@ -830,6 +909,10 @@ SceneObjectState EffectOverlayObject::saveState() const
     state.properties["effectType"] = std::to_string(static_cast<int>(m_effectType));
     state.properties["intensity"] = std::to_string(m_intensity);
     state.properties["effectActive"] = m_effectActive ? "true" : "false";
+    if (!m_customEmitterPath.empty())
+    {
+        state.properties["particleEmitter"] = m_customEmitterPath;
+    }
     return state;
 }
 
@@ -837,10 +920,17 @@ void EffectOverlayObject::loadState(const SceneObjectState& state)
 {
     SceneObjectBase::loadState(state);
 
-    auto it = state.properties.find("effectType");
+    auto it = state.properties.find("particleEmitter");
+    if (it != state.properties.end() && it->second != m_customEmitterPath)
+    {
+        // A missing file leaves the Custom effect without particles
+        (void)loadParticleEmitter(it->second);
+    }
+
+    it = state.properties.find("effectType");
     if (it != state.properties.end())
     {
-        m_effectType = static_cast<EffectType>(std::stoi(it->second));
+        setEffectType(static_cast<EffectType>(std::stoi(it->second)));
     }
 
     it = state.properties.find("intensity");
@@ -0,0 +1,281 @@
+#include "NovelMind/scripting/bytecode_verifier.hpp"
+#include <algorithm>
+
+namespace NovelMind::scripting
+{
+
+namespace
+{
+
+bool isKnownOpcode(OpCode op)
+{
+    switch (op)
+    {
+        case OpCode::NOP:
+        case OpCode::HALT:
+        case OpCode::JUMP:
+        case OpCode::JUMP_IF:
+        case OpCode::JUMP_IF_NOT:
+        case OpCode::CALL:
+        case OpCode::RETURN:
+        case OpCode::PUSH_INT:
+        case OpCode::PUSH_FLOAT:
+        case OpCode::PUSH_STRING:
+        case OpCode::PUSH_BOOL:
+        case OpCode::PUSH_NULL:
+        case OpCode::POP:
+        case OpCode::DUP:
+        case OpCode::LOAD_VAR:
+        case OpCode::STORE_VAR:
+        case OpCode::LOAD_GLOBAL:
+        case OpCode::STORE_GLOBAL:
+        case OpCode::ADD:
+        case OpCode::SUB:
+        case OpCode::MUL:
+        case OpCode::DIV:
+        case OpCode::MOD:
+        case OpCode::NEG:
+        case OpCode::EQ:
+        case OpCode::NE:
+        case OpCode::LT:
+        case OpCode::LE:
+        case OpCode::GT:
+        case OpCode::GE:
+        case OpCode::AND:
+        case OpCode::OR:
+        case OpCode::NOT:
+        case OpCode::SHOW_BACKGROUND:
+        case OpCode::SHOW_CHARACTER:
+        case OpCode::HIDE_CHARACTER:
+        case OpCode::SAY:
+        case OpCode::CHOICE:
+        case OpCode::SET_FLAG:
+        case OpCode::CHECK_FLAG:
+        case OpCode::PLAY_SOUND:
+        case OpCode::PLAY_MUSIC:
+        case OpCode::STOP_MUSIC:
+        case OpCode::WAIT:
+        case OpCode::TRANSITION:
+        case OpCode::GOTO_SCENE:
+            return true;
+
+        case OpCode::BREAK:
+            // Only the VM patches traps in, after verification
+            return false;
+    }
+    return false;
+}
+
+// Opcodes whose operand the VM resolves through the string table
+bool hasStringOperand(OpCode op)
+{
+    return op == OpCode::PUSH_STRING || op == OpCode::LOAD_VAR || op == OpCode::STORE_VAR ||
+           op == OpCode::LOAD_GLOBAL || op == OpCode::STORE_GLOBAL || op == OpCode::SET_FLAG ||
+           op == OpCode::CHECK_FLAG;
+}
+
+bool isJump(OpCode op)
+{
+    return op == OpCode::JUMP || op == OpCode::JUMP_IF || op == OpCode::JUMP_IF_NOT;
+}
+
+std::string at(usize index)
+{
+    return " at instruction " + std::to_string(index);
+}
+
+} // namespace
+
+BytecodeVerifier::StackEffect BytecodeVerifier::stackEffect(OpCode op)
+{
+    switch (op)
+    {
+        case OpCode::JUMP_IF:
+        case OpCode::JUMP_IF_NOT:
+        case OpCode::POP:
+        case OpCode::STORE_VAR:
+        case OpCode::STORE_GLOBAL:
+        case OpCode::SET_FLAG:
+            return {1, 0};
+
+        case OpCode::PUSH_INT:
+        case OpCode::PUSH_FLOAT:
+        case OpCode::PUSH_STRING:
+        case OpCode::PUSH_BOOL:
+        case OpCode::PUSH_NULL:
+        case OpCode::LOAD_VAR:
+        case OpCode::LOAD_GLOBAL:
+        case OpCode::CHECK_FLAG:
+            return {0, 1};
+
+        case OpCode::DUP:
+            return {1, 2};
+
+        case OpCode::ADD:
+        case OpCode::SUB:
+        case OpCode::MUL:
+        case OpCode::DIV:
+        case OpCode::EQ:
+        case OpCode::NE:
+        case OpCode::LT:
+        case OpCode::LE:
+        case OpCode::GT:
+        case OpCode::GE:
+        case OpCode::AND:
+        case OpCode::OR:
+            return {2, 1};
+
+        case OpCode::NOT:
+            return {1, 1};
+
+        default:
+            // Control flow, host commands (which do not consume the stack) and
+            // the opcodes the VM does not implement yet
+            return {0, 0};
+    }
+}
+
+bool BytecodeVerifier::endsBlock(OpCode op)
+{
+    return isJump(op) || op == OpCode::HALT || op == OpCode::SAY || op == OpCode::CHOICE ||
+           op == OpCode::WAIT;
+}
+
+Result<BytecodeVerification> BytecodeVerifier::verify(const std::vector<Instruction>& program,
+                                                      const std::vector<std::string>& stringTable,
+                                                      const VMSecurityLimits& limits)
+{
+    BytecodeVerification result;
+    const usize size = program.size();
+    if (size == 0)
+    {
+        result.stackVerified = true;
+        return Result<BytecodeVerification>::ok(std::move(result));
+    }
+
+    // Structural checks, and basic block leaders
+    std::vector<u8> leader(size, 0);
+    leader[0] = 1;
+    for (usize i = 0; i < size; ++i)
+    {
+        const Instruction& instr = program[i];
+        if (!isKnownOpcode(instr.opcode))
+        {
+            return Result<BytecodeVerification>::error(
+                "Invalid opcode " + std::to_string(static_cast<u32>(instr.opcode)) + at(i));
+        }
+        if (hasStringOperand(instr.opcode) && instr.operand >= stringTable.size())
+        {
+            return Result<BytecodeVerification>::error(
+                "String index " + std::to_string(instr.operand) + " out of range" + at(i));
+        }
+        if (instr.opcode == OpCode::PUSH_BOOL && instr.operand > 1)
+        {
+            return Result<BytecodeVerification>::error("Invalid boolean operand" + at(i));
+        }
+        if (isJump(instr.opcode))
+        {
+            // Jumping to the end is allowed and halts the program
+            if (instr.operand > size)
+            {
+                return Result<BytecodeVerification>::error(
+                    "Jump target " + std::to_string(instr.operand) + " out of range" + at(i));
+            }
+            if (instr.operand < size)
+            {
+                leader[instr.operand] = 1;
+            }
+        }
+        if (endsBlock(instr.opcode) && i + 1 < size)
+        {
+            leader[i + 1] = 1;
+        }
+    }
+
+    result.blockCost.assign(size, 0);
+    usize blockStart = 0;
+    for (usize i = 1; i <= size; ++i)
+    {
+        if (i == size || leader[i])
+        {
+            result.blockCost[blockStart] = static_cast<u32>(i - blockStart);
+            blockStart = i;
+        }
+    }
+
+    // Abstract interpretation of stack depth, one pass per reachable block
+    std::vector<i64> entryDepth(size, -1);
+    std::vector<usize> worklist{0};
+    entryDepth[0] = 0;
+    i64 maxDepth = 0;
+
+    auto stackFailure = [&result](std::string reason) {
+        result.stackVerified = false;
+        result.stackFailure = std::move(reason);
+        return Result<BytecodeVerification>::ok(std::move(result));
+    };
+
+    while (!worklist.empty())
+    {
+        const usize start = worklist.back();
+        worklist.pop_back();
+        const usize end = start + result.blockCost[start];
+
+        i64 depth = entryDepth[start];
+        for (usize i = start; i < end; ++i)
+        {
+            const StackEffect effect = stackEffect(program[i].opcode);
+            if (depth < static_cast<i64>(effect.pops))
+            {
+                return stackFailure("Stack underflow" + at(i));
+            }
+            depth += static_cast<i64>(effect.pushes) - static_cast<i64>(effect.pops);
+            maxDepth = std::max(maxDepth, depth);
+        }
+
+        const Instruction& last = program[end - 1];
+        usize successors[2];
+        usize successorCount = 0;
+        if (isJump(last.opcode))
+        {
+            successors[successorCount++] = last.operand;
+        }
+        if (last.opcode != OpCode::JUMP && last.opcode != OpCode::HALT)
+        {
+            successors[successorCount++] = end;
+        }
+
+        for (usize s = 0; s < successorCount; ++s)
+        {
+            const usize next = successors[s];
+            if (next >= size)
+            {
+                continue;
+            }
+            if (entryDepth[next] < 0)
+            {
+                entryDepth[next] = depth;
+                worklist.push_back(next);
+            }
+            else if (entryDepth[next] != depth)
+            {
+                return stackFailure("Inconsistent stack depth (" + std::to_string(entryDepth[next]) +
+                                    " vs " + std::to_string(depth) + ")" + at(next));
+            }
+        }
+    }
+
+    // Host commands leave their arguments on the stack, so a long linear scene
+    // outgrows the limit without being unsafe; it runs on the checked path
+    if (static_cast<u64>(maxDepth) > limits.maxStackSize)
+    {
+        return stackFailure("Stack depth " + std::to_string(maxDepth) + " exceeds limit of " +
+                            std::to_string(limits.maxStackSize));
+    }
+
+    result.stackVerified = true;
+    result.maxStackDepth = static_cast<u32>(maxDepth);
+    return Result<BytecodeVerification>::ok(std::move(result));
+}
+
+} // namespace NovelMind::scripting
@@ -45,6 +45,34 @@ Result<CompiledScript> Compiler::compile(const Program& program)
     return Result<CompiledScript>::ok(std::move(m_output));
 }
 
+Result<CompiledExpression> Compiler::compileStandaloneExpression(const Expression& expr)
+{
+    reset();
+
+    try
+    {
+        compileExpression(expr);
+    }
+    catch (...)
+    {
+        if (m_errors.empty())
+        {
+            error("Internal compiler error");
+        }
+    }
+    emit(OpCode::HALT);
+
+    if (!m_errors.empty())
+    {
+        return Result<CompiledExpression>::error(m_errors[0].message);
+    }
+
+    CompiledExpression compiled;
+    compiled.instructions = std::move(m_output.instructions);
+    compiled.stringTable = std::move(m_output.stringTable);
+    return Result<CompiledExpression>::ok(std::move(compiled));
+}
+
 const std::vector<CompileError>& Compiler::getErrors() const
 {
     return m_errors;
@@ -153,6 +181,8 @@ void Compiler::compileScene(const SceneDecl& decl)
 
 void Compiler::compileStatement(const Statement& stmt)
 {
+    m_output.lineTable.add(static_cast<u32>(m_output.instructions.size()), stmt.location);
+
     std::visit([this](const auto& s)
     {
         using T = std::decay_t<decltype(s)>;
@@ -0,0 +1,150 @@
+#include "NovelMind/scripting/line_table.hpp"
+
+namespace NovelMind::scripting
+{
+
+namespace
+{
+
+void writeVarint(std::vector<u8>& out, u32 value)
+{
+    while (value >= 0x80)
+    {
+        out.push_back(static_cast<u8>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<u8>(value));
+}
+
+u32 readVarint(const u8*& p)
+{
+    u32 value = 0;
+    u32 shift = 0;
+    while (*p & 0x80)
+    {
+        value |= static_cast<u32>(*p++ & 0x7F) << shift;
+        shift += 7;
+    }
+    return value | static_cast<u32>(*p++) << shift;
+}
+
+u32 zigzag(i64 value)
+{
+    return static_cast<u32>(value < 0 ? ((-value) << 1) - 1 : value << 1);
+}
+
+i64 unzigzag(u32 value)
+{
+    return (value & 1) ? -static_cast<i64>(value >> 1) - 1 : static_cast<i64>(value >> 1);
+}
+
+// Walks the encoded entries in order
+class Decoder
+{
+public:
+    Decoder(const std::vector<u8>& data, u32 count)
+        : m_p(data.data())
+        , m_remaining(count)
+    {
+    }
+
+    bool next(LineTableEntry& entry)
+    {
+        if (m_remaining == 0)
+        {
+            return false;
+        }
+        --m_remaining;
+        m_ip += readVarint(m_p);
+        m_line = static_cast<u32>(static_cast<i64>(m_line) + unzigzag(readVarint(m_p)));
+        entry.ip = m_ip;
+        entry.location = SourceLocation(m_line, readVarint(m_p));
+        return true;
+    }
+
+private:
+    const u8* m_p;
+    u32 m_remaining;
+    u32 m_ip = 0;
+    u32 m_line = 0;
+};
+
+} // namespace
+
+void LineTable::add(u32 ip, SourceLocation location)
+{
+    if (m_count > 0)
+    {
+        if (ip < m_last.ip)
+        {
+            return;
+        }
+        if (ip == m_last.ip)
+        {
+            m_data.resize(m_lastOffset);
+            m_last = m_beforeLast;
+            --m_count;
+        }
+        if (m_count > 0 && m_last.location.line == location.line &&
+            m_last.location.column == location.column)
+        {
+            return;
+        }
+    }
+    append(ip, location);
+}
+
+void LineTable::append(u32 ip, SourceLocation location)
+{
+    m_lastOffset = m_data.size();
+    writeVarint(m_data, ip - m_last.ip);
+    writeVarint(m_data, zigzag(static_cast<i64>(location.line) -
+                               static_cast<i64>(m_last.location.line)));
+    writeVarint(m_data, location.column);
+
+    m_beforeLast = m_last;
+    m_last = {ip, location};
+    ++m_count;
+}
+
+std::optional<SourceLocation> LineTable::getLocation(u32 ip) const
+{
+    std::optional<SourceLocation> found;
+    Decoder decoder(m_data, m_count);
+    LineTableEntry entry{};
+    while (decoder.next(entry) && entry.ip <= ip)
+    {
+        found = entry.location;
+    }
+    return found;
+}
+
+std::vector<u32> LineTable::getInstructions(u32 line) const
+{
+    std::vector<u32> ips;
+    Decoder decoder(m_data, m_count);
+    LineTableEntry entry{};
+    while (decoder.next(entry))
+    {
+        if (entry.location.line == line)
+        {
+            ips.push_back(entry.ip);
+        }
+    }
+    return ips;
+}
+
+std::vector<LineTableEntry> LineTable::decode() const
+{
+    std::vector<LineTableEntry> entries;
+    entries.reserve(m_count);
+    Decoder decoder(m_data, m_count);
+    LineTableEntry entry{};
+    while (decoder.next(entry))
+    {
+        entries.push_back(entry);
+    }
+    return entries;
+}
+
+} // namespace NovelMind::scripting
@@ -38,6 +38,34 @@ Result<Program> Parser::parse(const std::vector<Token>& tokens)
     return Result<Program>::ok(std::move(m_program));
 }
 
+Result<ExprPtr> Parser::parseStandaloneExpression(const std::vector<Token>& tokens)
+{
+    m_tokens = &tokens;
+    m_current = 0;
+    m_errors.clear();
+
+    ExprPtr expr;
+    if (!tokens.empty())
+    {
+        expr = parseExpression();
+        if (m_errors.empty() && !isAtEnd())
+        {
+            error("Unexpected '" + peek().lexeme + "' after expression");
+        }
+    }
+    else
+    {
+        m_errors.emplace_back("Expected expression", SourceLocation{});
+    }
+
+    if (!m_errors.empty())
+    {
+        return Result<ExprPtr>::error(m_errors[0].message);
+    }
+
+    return Result<ExprPtr>::ok(std::move(expr));
+}
+
 const std::vector<ParseError>& Parser::getErrors() const
 {
     return m_errors;
@@ -174,6 +202,7 @@ CharacterDecl Parser::parseCharacterDecl()
 
     const Token& id = consume(TokenType::Identifier, "Expected character identifier");
     decl.id = id.lexeme;
+    decl.location = id.location;
 
     if (match(TokenType::LeftParen))
     {
@@ -219,6 +248,7 @@ SceneDecl Parser::parseSceneDecl()
 
     const Token& name = consume(TokenType::Identifier, "Expected scene name");
     decl.name = name.lexeme;
+    decl.location = name.location;
 
     consume(TokenType::LeftBrace, "Expected '{' before scene body");
 
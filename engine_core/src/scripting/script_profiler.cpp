@@ -0,0 +1,300 @@
+#include "NovelMind/scripting/script_profiler.hpp"
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <unordered_map>
+
+namespace NovelMind::scripting
+{
+
+namespace
+{
+
+const std::string GLOBAL_SCENE = "(global)";
+
+// Folded stack frames are separated by ';'
+std::string frameName(std::string name)
+{
+    std::replace(name.begin(), name.end(), ';', ':');
+    return name;
+}
+
+// Walks instructions in order, tracking the line and scene each belongs to
+class SourceCursor
+{
+public:
+    explicit SourceCursor(const CompiledScript& script)
+        : m_lines(script.lineTable.decode())
+    {
+        m_scenes.reserve(script.sceneEntryPoints.size());
+        for (const auto& [name, entry] : script.sceneEntryPoints)
+        {
+            m_scenes.emplace_back(entry, &name);
+        }
+        std::sort(m_scenes.begin(), m_scenes.end());
+    }
+
+    void advance(u32 ip)
+    {
+        while (m_nextLine < m_lines.size() && m_lines[m_nextLine].ip <= ip)
+        {
+            m_line = m_lines[m_nextLine++].location.line;
+        }
+        while (m_nextScene < m_scenes.size() && m_scenes[m_nextScene].first <= ip)
+        {
+            m_scene = m_scenes[m_nextScene++].second;
+        }
+    }
+
+    [[nodiscard]] u32 line() const { return m_line; }
+    [[nodiscard]] const std::string& scene() const { return *m_scene; }
+
+private:
+    std::vector<LineTableEntry> m_lines;
+    std::vector<std::pair<u32, const std::string*>> m_scenes;
+    usize m_nextLine = 0;
+    usize m_nextScene = 0;
+    u32 m_line = 0;
+    const std::string* m_scene = &GLOBAL_SCENE;
+};
+
+} // namespace
+
+void ScriptProfiler::attach(usize programSize)
+{
+    if (programSize > m_instructionCounts.size())
+    {
+        m_instructionCounts.resize(programSize, 0);
+        m_callbackNanos.resize(programSize, 0);
+        m_callbackCalls.resize(programSize, 0);
+    }
+}
+
+void ScriptProfiler::reset()
+{
+    std::fill(m_instructionCounts.begin(), m_instructionCounts.end(), 0);
+    std::fill(m_callbackNanos.begin(), m_callbackNanos.end(), 0);
+    std::fill(m_callbackCalls.begin(), m_callbackCalls.end(), 0);
+    m_callbacks.fill(ScriptProfileCallback{});
+}
+
+void ScriptProfiler::recordCallback(u32 ip, OpCode op, u64 nanos)
+{
+    if (ip < m_callbackNanos.size())
+    {
+        m_callbackNanos[ip] += nanos;
+        ++m_callbackCalls[ip];
+    }
+
+    ScriptProfileCallback& stats = m_callbacks[static_cast<u8>(op)];
+    stats.opcode = op;
+    ++stats.calls;
+    stats.totalNanos += nanos;
+    stats.maxNanos = std::max(stats.maxNanos, nanos);
+}
+
+u64 ScriptProfiler::getInstructionCount(u32 ip) const
+{
+    return ip < m_instructionCounts.size() ? m_instructionCounts[ip] : 0;
+}
+
+u64 ScriptProfiler::getTotalInstructions() const
+{
+    u64 total = 0;
+    for (u64 count : m_instructionCounts)
+    {
+        total += count;
+    }
+    return total;
+}
+
+const ScriptProfileCallback& ScriptProfiler::getCallbackStats(OpCode op) const
+{
+    return m_callbacks[static_cast<u8>(op)];
+}
+
+ScriptProfileReport ScriptProfiler::buildReport(const CompiledScript& script) const
+{
+    ScriptProfileReport report;
+    std::unordered_map<std::string, usize> sceneIndex;
+    std::vector<std::unordered_map<u32, usize>> lineIndex;
+
+    SourceCursor cursor(script);
+    const usize size = std::min(m_instructionCounts.size(), script.instructions.size());
+    for (u32 ip = 0; ip < size; ++ip)
+    {
+        if (m_instructionCounts[ip] == 0 && m_callbackCalls[ip] == 0)
+        {
+            continue;
+        }
+        cursor.advance(ip);
+
+        auto [sceneIt, newScene] = sceneIndex.try_emplace(cursor.scene(), report.scenes.size());
+        if (newScene)
+        {
+            report.scenes.push_back({cursor.scene(), 0, 0, {}});
+            lineIndex.emplace_back();
+        }
+        ScriptProfileScene& scene = report.scenes[sceneIt->second];
+        auto& lines = lineIndex[sceneIt->second];
+        auto [lineIt, newLine] = lines.try_emplace(cursor.line(), scene.lines.size());
+        if (newLine)
+        {
+            scene.lines.push_back({cursor.line(), 0, 0, 0});
+        }
+        ScriptProfileLine& line = scene.lines[lineIt->second];
+
+        line.instructions += m_instructionCounts[ip];
+        line.callbackCalls += m_callbackCalls[ip];
+        line.callbackNanos += m_callbackNanos[ip];
+        scene.instructions += m_instructionCounts[ip];
+        scene.callbackNanos += m_callbackNanos[ip];
+        report.totalInstructions += m_instructionCounts[ip];
+        report.totalCallbackNanos += m_callbackNanos[ip];
+    }
+
+    for (auto& scene : report.scenes)
+    {
+        std::sort(scene.lines.begin(), scene.lines.end(),
+                  [](const ScriptProfileLine& a, const ScriptProfileLine& b) {
+                      if (a.callbackNanos != b.callbackNanos)
+                      {
+                          return a.callbackNanos > b.callbackNanos;
+                      }
+                      return a.instructions != b.instructions ? a.instructions > b.instructions
+                                                              : a.line < b.line;
+                  });
+    }
+    std::sort(report.scenes.begin(), report.scenes.end(),
+              [](const ScriptProfileScene& a, const ScriptProfileScene& b) {
+                  if (a.callbackNanos != b.callbackNanos)
+                  {
+                      return a.callbackNanos > b.callbackNanos;
+                  }
+                  return a.instructions != b.instructions ? a.instructions > b.instructions
+                                                          : a.name < b.name;
+              });
+
+    for (const auto& stats : m_callbacks)
+    {
+        if (stats.calls > 0)
+        {
+            report.callbacks.push_back(stats);
+        }
+    }
+    std::sort(report.callbacks.begin(), report.callbacks.end(),
+              [](const ScriptProfileCallback& a, const ScriptProfileCallback& b) {
+                  return a.totalNanos > b.totalNanos;
+              });
+
+    return report;
+}
+
+std::string ScriptProfiler::toFoldedStacks(const CompiledScript& script,
+                                           ScriptProfileMetric metric,
+                                           const LineLabeler& labeler) const
+{
+    // Keyed by the whole stack so equal stacks merge and output is sorted
+    std::map<std::string, u64> stacks;
+
+    SourceCursor cursor(script);
+    const usize size = std::min(m_instructionCounts.size(), script.instructions.size());
+    for (u32 ip = 0; ip < size; ++ip)
+    {
+        const u64 weight = metric == ScriptProfileMetric::Instructions ? m_instructionCounts[ip]
+                                                                       : m_callbackNanos[ip];
+        if (weight == 0)
+        {
+            continue;
+        }
+        cursor.advance(ip);
+
+        std::string stack = frameName(cursor.scene()) + ";" +
+                            frameName(labeler ? labeler(cursor.line())
+                                              : "line " + std::to_string(cursor.line()));
+        if (metric == ScriptProfileMetric::CallbackTime)
+        {
+            stack += ";";
+            stack += getOpCodeName(script.instructions[ip].opcode);
+        }
+        stacks[stack] += weight;
+    }
+
+    std::string out;
+    for (const auto& [stack, weight] : stacks)
+    {
+        out += stack + " " + std::to_string(weight) + "\n";
+    }
+    return out;
+}
+
+bool ScriptProfiler::exportToFoldedStacks(const std::string& filename,
+                                          const CompiledScript& script,
+                                          ScriptProfileMetric metric,
+                                          const LineLabeler& labeler) const
+{
+    std::ofstream file(filename, std::ios::binary);
+    if (!file)
+    {
+        return false;
+    }
+    file << toFoldedStacks(script, metric, labeler);
+    return static_cast<bool>(file);
+}
+
+const char* ScriptProfiler::getOpCodeName(OpCode op)
+{
+    switch (op)
+    {
+        case OpCode::NOP: return "NOP";
+        case OpCode::HALT: return "HALT";
+        case OpCode::JUMP: return "JUMP";
+        case OpCode::JUMP_IF: return "JUMP_IF";
+        case OpCode::JUMP_IF_NOT: return "JUMP_IF_NOT";
+        case OpCode::CALL: return "CALL";
+        case OpCode::RETURN: return "RETURN";
+        case OpCode::BREAK: return "BREAK";
+        case OpCode::PUSH_INT: return "PUSH_INT";
+        case OpCode::PUSH_FLOAT: return "PUSH_FLOAT";
+        case OpCode::PUSH_STRING: return "PUSH_STRING";
+        case OpCode::PUSH_BOOL: return "PUSH_BOOL";
+        case OpCode::PUSH_NULL: return "PUSH_NULL";
+        case OpCode::POP: return "POP";
+        case OpCode::DUP: return "DUP";
+        case OpCode::LOAD_VAR: return "LOAD_VAR";
+        case OpCode::STORE_VAR: return "STORE_VAR";
+        case OpCode::LOAD_GLOBAL: return "LOAD_GLOBAL";
+        case OpCode::STORE_GLOBAL: return "STORE_GLOBAL";
+        case OpCode::ADD: return "ADD";
+        case OpCode::SUB: return "SUB";
+        case OpCode::MUL: return "MUL";
+        case OpCode::DIV: return "DIV";
+        case OpCode::MOD: return "MOD";
+        case OpCode::NEG: return "NEG";
+        case OpCode::EQ: return "EQ";
+        case OpCode::NE: return "NE";
+        case OpCode::LT: return "LT";
+        case OpCode::LE: return "LE";
+        case OpCode::GT: return "GT";
+        case OpCode::GE: return "GE";
+        case OpCode::AND: return "AND";
+        case OpCode::OR: return "OR";
+        case OpCode::NOT: return "NOT";
+        case OpCode::SHOW_BACKGROUND: return "SHOW_BACKGROUND";
+        case OpCode::SHOW_CHARACTER: return "SHOW_CHARACTER";
+        case OpCode::HIDE_CHARACTER: return "HIDE_CHARACTER";
+        case OpCode::SAY: return "SAY";
+        case OpCode::CHOICE: return "CHOICE";
+        case OpCode::SET_FLAG: return "SET_FLAG";
+        case OpCode::CHECK_FLAG: return "CHECK_FLAG";
+        case OpCode::PLAY_SOUND: return "PLAY_SOUND";
+        case OpCode::PLAY_MUSIC: return "PLAY_MUSIC";
+        case OpCode::STOP_MUSIC: return "STOP_MUSIC";
+        case OpCode::WAIT: return "WAIT";
+        case OpCode::TRANSITION: return "TRANSITION";
+        case OpCode::GOTO_SCENE: return "GOTO_SCENE";
+    }
+    return "UNKNOWN";
+}
+
+} // namespace NovelMind::scripting
@@ -1,4 +1,5 @@
 #include "NovelMind/scripting/script_runtime.hpp"
+#include <algorithm>
 #include <cstring>
 
 namespace NovelMind::scripting
@@ -18,6 +19,16 @@ Result<void> ScriptRuntime::load(const CompiledScript& script)
     }
 
     registerCallbacks();
+    buildLineIds();
+    if (m_backlog)
+    {
+        m_backlog->clear();
+        m_backlog->setStringTable(&m_script.stringTable);
+    }
+    if (m_voicePreloader)
+    {
+        m_voicePreloader->setScript(m_script);
+    }
     m_state = RuntimeState::Idle;
 
     return Result<void>::ok();
@@ -80,14 +91,24 @@ Result<void> ScriptRuntime::gotoScene(const std::string& sceneName)
     }
 
     m_currentScene = sceneName;
+    m_skipCurrentLine = false;
     m_vm.reset();
 
     // Load the full program and set IP to scene entry
-    m_vm.load(m_script.instructions, m_script.stringTable);
+    auto loaded = m_vm.load(m_script.instructions, m_script.stringTable);
+    if (loaded.isError())
+    {
+        return loaded;
+    }
 
     // Set instruction pointer manually would require VM modification
     // For now, we'll run until we reach the scene
 
+    if (m_voicePreloader)
+    {
+        m_voicePreloader->preloadFrom(it->second);
+    }
+
     m_state = RuntimeState::Running;
     fireEvent(ScriptEventType::SceneChange, sceneName);
 
@@ -131,8 +152,11 @@ void ScriptRuntime::update(f64 deltaTime)
             // Execute VM steps
             if (m_skipMode)
             {
-                // In skip mode, run faster
-                for (i32 i = 0; i < 10 && m_state == RuntimeState::Running; ++i)
+                // In skip mode, run until the script yields, passing lines
+                // that have already been read
+                const usize budget =
+                    std::max<usize>(1, m_vm.getSecurityLimits().maxInstructionsPerStep);
+                for (usize i = 0; i < budget && m_state == RuntimeState::Running; ++i)
                 {
                     if (!m_vm.step())
                     {
@@ -140,6 +164,18 @@ void ScriptRuntime::update(f64 deltaTime)
                         break;
                     }
 
+                    if (m_vm.isWaiting() && m_skipCurrentLine)
+                    {
+                        m_skipCurrentLine = false;
+                        m_state = RuntimeState::Running;
+                        m_vm.signalContinue();
+                        if (m_dialogueBox)
+                        {
+                            m_dialogueBox->clear();
+                        }
+                        continue;
+                    }
+
                     if (m_vm.isWaiting() || m_vm.isPaused())
                     {
                         break;
@@ -159,6 +195,12 @@ void ScriptRuntime::update(f64 deltaTime)
                     m_state = RuntimeState::Halted;
                 }
             }
+
+            // A breakpoint trap paused the VM; resume() continues from it
+            if (m_state == RuntimeState::Running && m_vm.isPaused())
+            {
+                m_state = RuntimeState::Paused;
+            }
             break;
     }
 
@@ -277,6 +319,7 @@ bool ScriptRuntime::getFlag(const std::string& name) const
 void ScriptRuntime::setSkipMode(bool enabled)
 {
     m_skipMode = enabled;
+    m_skipCurrentLine = false;
 }
 
 bool ScriptRuntime::isSkipMode() const
@@ -284,13 +327,66 @@ bool ScriptRuntime::isSkipMode() const
     return m_skipMode;
 }
 
+void ScriptRuntime::setReadHistory(save::ReadHistory* history)
+{
+    m_readHistory = history;
+}
+
+save::ReadHistory* ScriptRuntime::getReadHistory() const
+{
+    return m_readHistory;
+}
+
+bool ScriptRuntime::isCurrentLineRead() const
+{
+    return m_currentLineRead;
+}
+
+void ScriptRuntime::setBacklog(scene::DialogueBacklog* backlog)
+{
+    m_backlog = backlog;
+    if (m_backlog)
+    {
+        m_backlog->setStringTable(&m_script.stringTable);
+    }
+}
+
+scene::DialogueBacklog* ScriptRuntime::getBacklog() const
+{
+    return m_backlog;
+}
+
+void ScriptRuntime::setVoicePreloader(audio::VoicePreloader* preloader)
+{
+    m_voicePreloader = preloader;
+    if (m_voicePreloader)
+    {
+        m_voicePreloader->setScript(m_script);
+    }
+}
+
+audio::VoicePreloader* ScriptRuntime::getVoicePreloader() const
+{
+    return m_voicePreloader;
+}
+
+void ScriptRuntime::setProfiler(ScriptProfiler* profiler)
+{
+    m_vm.setProfiler(profiler);
+}
+
+ScriptProfiler* ScriptRuntime::getProfiler() const
+{
+    return m_vm.getProfiler();
+}
+
 RuntimeSaveState ScriptRuntime::saveState() const
 {
     RuntimeSaveState state;
     state.currentScene = m_currentScene;
-    state.instructionPointer = 0; // Would need VM modification to get this
-
-    // Save all variables from VM (would need VM modification)
+    state.instructionPointer = m_vm.getIP();
+    state.variables = m_vm.getVariables();
+    state.flags = m_vm.getFlags();
     state.inDialogue = m_dialogueActive;
 
     return state;
@@ -395,6 +491,12 @@ void ScriptRuntime::onHideCharacter(const std::vector<Value>& args)
 
 void ScriptRuntime::onSay(const std::vector<Value>& args)
 {
+    // Line ids come from the instruction, so tracking does not depend on the
+    // arguments the VM passes
+    trackLineRead();
+    recordBacklogLine();
+    playLineVoice();
+
     if (args.empty())
     {
         return;
@@ -620,6 +722,109 @@ void ScriptRuntime::registerCallbacks()
     });
 }
 
+void ScriptRuntime::buildLineIds()
+{
+    std::vector<std::pair<u32, const std::string*>> scenes;
+    scenes.reserve(m_script.sceneEntryPoints.size());
+    for (const auto& [name, entry] : m_script.sceneEntryPoints)
+    {
+        scenes.emplace_back(entry, &name);
+    }
+    std::sort(scenes.begin(), scenes.end());
+
+    // A SAY belongs to the scene with the closest entry point at or before it
+    m_lineIds.assign(m_script.instructions.size(), 0);
+    usize nextScene = 0;
+    std::string_view scene;
+    for (usize ip = 0; ip < m_script.instructions.size(); ++ip)
+    {
+        while (nextScene < scenes.size() && scenes[nextScene].first <= ip)
+        {
+            scene = *scenes[nextScene].second;
+            ++nextScene;
+        }
+
+        const Instruction& instr = m_script.instructions[ip];
+        if (instr.opcode == OpCode::SAY && instr.operand < m_script.stringTable.size())
+        {
+            m_lineIds[ip] = save::ReadHistory::lineId(scene, m_script.stringTable[instr.operand]);
+        }
+    }
+}
+
+void ScriptRuntime::trackLineRead()
+{
+    const u32 ip = m_vm.getIP();
+    const u64 id = ip < m_lineIds.size() ? m_lineIds[ip] : 0;
+
+    m_currentLineRead = m_readHistory && m_readHistory->isRead(id);
+    if (m_readHistory)
+    {
+        m_readHistory->markRead(id);
+    }
+
+    if (m_skipMode)
+    {
+        if (!m_readHistory || m_currentLineRead || m_config.skipUnreadText)
+        {
+            m_skipCurrentLine = true;
+        }
+        else
+        {
+            // Stop at unread text so the player sees it
+            m_skipMode = false;
+        }
+    }
+}
+
+void ScriptRuntime::recordBacklogLine()
+{
+    const u32 ip = m_vm.getIP();
+    if (!m_backlog || ip >= m_script.instructions.size())
+    {
+        return;
+    }
+
+    // The compiler pushes the speaker name right before SAY
+    u32 speakerIndex = scene::DialogueBacklog::NONE;
+    if (ip > 0 && m_script.instructions[ip - 1].opcode == OpCode::PUSH_STRING)
+    {
+        speakerIndex = m_script.instructions[ip - 1].operand;
+    }
+
+    // The snapshot lets the backlog re-resolve interpolated text later
+    scene::DialogueBacklog::VariableMap variables;
+    variables.reserve(m_vm.getVariables().size());
+    for (const auto& [name, value] : m_vm.getVariables())
+    {
+        variables.emplace(name, asString(value));
+    }
+
+    std::string_view voiceId;
+    if (m_voicePreloader)
+    {
+        voiceId = m_voicePreloader->getVoiceId(ip);
+    }
+    m_backlog->push(m_script.instructions[ip].operand, speakerIndex, voiceId, variables);
+}
+
+void ScriptRuntime::playLineVoice()
+{
+    if (!m_voicePreloader)
+    {
+        return;
+    }
+
+    const u32 ip = m_vm.getIP();
+    const std::string& voiceId = m_voicePreloader->getVoiceId(ip);
+    if (m_audioManager && !voiceId.empty() && !m_skipCurrentLine)
+    {
+        m_audioManager->playVoice(voiceId);
+    }
+
+    m_voicePreloader->preloadFrom(ip + 1);
+}
+
 void ScriptRuntime::fireEvent(ScriptEventType type, const std::string& name, const Value& value)
 {
     if (m_eventCallback)
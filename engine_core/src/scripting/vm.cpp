@@ -1,10 +1,57 @@
 #include "NovelMind/scripting/vm.hpp"
 #include "NovelMind/core/logger.hpp"
+#include "NovelMind/scripting/script_profiler.hpp"
+#include <algorithm>
+#include <chrono>
 #include <cstring>
 
 namespace NovelMind::scripting
 {
 
+namespace
+{
+
+// Opcodes a standalone expression compiles to
+bool isExpressionOpcode(OpCode op)
+{
+    switch (op)
+    {
+        case OpCode::NOP:
+        case OpCode::HALT:
+        case OpCode::JUMP:
+        case OpCode::JUMP_IF:
+        case OpCode::JUMP_IF_NOT:
+        case OpCode::PUSH_INT:
+        case OpCode::PUSH_FLOAT:
+        case OpCode::PUSH_STRING:
+        case OpCode::PUSH_BOOL:
+        case OpCode::PUSH_NULL:
+        case OpCode::POP:
+        case OpCode::DUP:
+        case OpCode::LOAD_VAR:
+        case OpCode::LOAD_GLOBAL:
+        case OpCode::ADD:
+        case OpCode::SUB:
+        case OpCode::MUL:
+        case OpCode::DIV:
+        case OpCode::EQ:
+        case OpCode::NE:
+        case OpCode::LT:
+        case OpCode::LE:
+        case OpCode::GT:
+        case OpCode::GE:
+        case OpCode::AND:
+        case OpCode::OR:
+        case OpCode::NOT:
+        case OpCode::CHECK_FLAG:
+            return true;
+        default:
+            return false;
+    }
+}
+
+} // namespace
+
 VirtualMachine::VirtualMachine()
     : m_ip(0)
     , m_running(false)
@@ -25,9 +72,41 @@ Result<void> VirtualMachine::load(const std::vector<Instruction>& program,
         return Result<void>::error("Empty program");
     }
 
+    auto verification = BytecodeVerifier::verify(program, stringTable, m_limits);
+    if (verification.isError())
+    {
+        return Result<void>::error("Bytecode verification failed: " + verification.error());
+    }
+
     m_program = program;
     m_stringTable = stringTable;
+
+    // Traps stay at the same indices, over the new program's instructions
+    for (auto it = m_breakOriginals.begin(); it != m_breakOriginals.end();)
+    {
+        if (it->first < m_program.size())
+        {
+            it->second = m_program[it->first];
+            m_program[it->first] = Instruction(OpCode::BREAK);
+            ++it;
+        }
+        else
+        {
+            it = m_breakOriginals.erase(it);
+        }
+    }
+    m_verification = std::move(verification.value());
+    if (!m_verification.stackVerified)
+    {
+        NOVELMIND_LOG_WARN("Program not stack-verified (" + m_verification.stackFailure +
+                           "); using checked execution");
+    }
     reset();
+    m_stack.reserve(m_verification.maxStackDepth);
+    if (m_profiler)
+    {
+        m_profiler->attach(m_program.size());
+    }
 
     return Result<void>::ok();
 }
@@ -40,7 +119,9 @@ void VirtualMachine::reset()
     m_paused = false;
     m_waiting = false;
     m_halted = false;
+    m_fuelExhausted = false;
     m_choiceResult = -1;
+    m_resumeBreakIp = NO_BREAK;
 }
 
 bool VirtualMachine::step()
@@ -56,7 +137,18 @@ bool VirtualMachine::step()
         return false;
     }
 
-    executeInstruction(m_program[m_ip]);
+    if (m_profiler)
+    {
+        m_profiler->countInstruction(m_ip);
+    }
+    if (m_verification.stackVerified)
+    {
+        executeInstruction<false>(m_program[m_ip]);
+    }
+    else
+    {
+        executeInstruction<true>(m_program[m_ip]);
+    }
     ++m_ip;
 
     return !m_halted;
@@ -66,13 +158,77 @@ void VirtualMachine::run()
 {
     m_running = true;
     m_paused = false;
+    m_fuelExhausted = false;
 
+    if (m_verification.stackVerified)
+    {
+        if (m_profiler)
+        {
+            runVerified<true>(m_limits.maxInstructionsPerStep);
+        }
+        else
+        {
+            runVerified<false>(m_limits.maxInstructionsPerStep);
+        }
+    }
+    else
+    {
+        runChecked(m_limits.maxInstructionsPerStep);
+    }
+}
+
+void VirtualMachine::runChecked(usize fuel)
+{
     while (m_running && !m_halted && !m_paused && !m_waiting)
     {
+        if (fuel == 0)
+        {
+            m_fuelExhausted = true;
+            break;
+        }
+        --fuel;
         step();
     }
 }
 
+template <bool Profiled>
+void VirtualMachine::runVerified(usize fuel)
+{
+    // Fuel is charged once per basic block; within a block the verifier has
+    // already proven every pop, jump and string operand safe
+    const usize budget = fuel;
+    const Instruction* code = m_program.data();
+    const u32* blockCost = m_verification.blockCost.data();
+    const usize size = m_program.size();
+
+    while (m_running && !m_halted && !m_paused && !m_waiting)
+    {
+        if (m_ip >= size)
+        {
+            m_halted = true;
+            break;
+        }
+
+        if (const u32 cost = blockCost[m_ip])
+        {
+            // A block longer than the whole budget may still run on a fresh budget
+            if (cost > fuel && fuel != budget)
+            {
+                m_fuelExhausted = true;
+                break;
+            }
+            fuel -= std::min<usize>(cost, fuel);
+        }
+
+        if constexpr (Profiled)
+        {
+            m_profiler->countInstruction(m_ip);
+        }
+        executeInstruction<false>(code[m_ip]);
+        ++m_ip;
+    }
+}
+
 void VirtualMachine::pause()
 {
     m_paused = true;
@@ -147,6 +303,115 @@ void VirtualMachine::registerCallback(OpCode op, NativeCallback callback)
     m_callbacks[op] = std::move(callback);
 }
 
+Result<void> VirtualMachine::setBreakpoint(u32 ip)
+{
+    if (ip >= m_program.size())
+    {
+        return Result<void>::error("Breakpoint at " + std::to_string(ip) +
+                                   " is outside the program");
+    }
+    if (m_breakOriginals.find(ip) == m_breakOriginals.end())
+    {
+        m_breakOriginals.emplace(ip, m_program[ip]);
+        m_program[ip] = Instruction(OpCode::BREAK);
+    }
+    return Result<void>::ok();
+}
+
+void VirtualMachine::clearBreakpoint(u32 ip)
+{
+    auto it = m_breakOriginals.find(ip);
+    if (it != m_breakOriginals.end())
+    {
+        m_program[ip] = it->second;
+        m_breakOriginals.erase(it);
+    }
+}
+
+void VirtualMachine::clearBreakpoints()
+{
+    for (const auto& [ip, original] : m_breakOriginals)
+    {
+        m_program[ip] = original;
+    }
+    m_breakOriginals.clear();
+}
+
+bool VirtualMachine::hasBreakpoint(u32 ip) const
+{
+    return m_breakOriginals.find(ip) != m_breakOriginals.end();
+}
+
+void VirtualMachine::setBreakHandler(BreakHandler handler)
+{
+    m_breakHandler = std::move(handler);
+}
+
+Instruction VirtualMachine::getInstruction(u32 ip) const
+{
+    auto it = m_breakOriginals.find(ip);
+    if (it != m_breakOriginals.end())
+    {
+        return it->second;
+    }
+    return ip < m_program.size() ? m_program[ip] : Instruction(OpCode::HALT);
+}
+
+Result<Value> VirtualMachine::evaluate(const std::vector<Instruction>& code,
+                                       const std::vector<std::string>& stringTable)
+{
+    for (const auto& instr : code)
+    {
+        if (!isExpressionOpcode(instr.opcode))
+        {
+            return Result<Value>::error("Instruction not allowed in an expression");
+        }
+    }
+
+    // Swap the snippet in for the program; the script's state is restored after
+    std::vector<Instruction> program(code);
+    std::vector<std::string> strings(stringTable);
+    std::vector<Value> stack;
+    std::swap(m_program, program);
+    std::swap(m_stringTable, strings);
+    std::swap(m_stack, stack);
+    const u32 savedIp = m_ip;
+    const bool savedHalted = m_halted;
+    m_ip = 0;
+    m_halted = false;
+
+    usize fuel = m_limits.maxInstructionsPerStep;
+    while (!m_halted && m_ip < m_program.size() && fuel > 0)
+    {
+        --fuel;
+        executeInstruction<true>(m_program[m_ip]);
+        ++m_ip;
+    }
+    const bool finished = m_halted || m_ip >= m_program.size();
+    Value result = m_stack.empty() ? Value{std::monostate{}} : m_stack.back();
+
+    std::swap(m_program, program);
+    std::swap(m_stringTable, strings);
+    std::swap(m_stack, stack);
+    m_ip = savedIp;
+    m_halted = savedHalted;
+
+    if (!finished)
+    {
+        return Result<Value>::error("Expression exceeded the instruction limit");
+    }
+    return Result<Value>::ok(std::move(result));
+}
+
+void VirtualMachine::setProfiler(ScriptProfiler* profiler)
+{
+    m_profiler = profiler;
+    if (m_profiler)
+    {
+        m_profiler->attach(m_program.size());
+    }
+}
+
 void VirtualMachine::signalContinue()
 {
     m_waiting = false;
@@ -166,6 +431,35 @@ void VirtualMachine::signalChoice(i32 choice)
     }
 }
 
+template <bool Checked>
+Value VirtualMachine::take()
+{
+    if constexpr (Checked)
+    {
+        return pop();
+    }
+    else
+    {
+        Value val = std::move(m_stack.back());
+        m_stack.pop_back();
+        return val;
+    }
+}
+
+template <bool Checked>
+const std::string& VirtualMachine::stringOperand(u32 index) const
+{
+    if constexpr (Checked)
+    {
+        return getString(index);
+    }
+    else
+    {
+        return m_stringTable[index];
+    }
+}
+
+template <bool Checked>
 void VirtualMachine::executeInstruction(const Instruction& instr)
 {
     switch (instr.opcode)
@@ -181,15 +475,36 @@ void VirtualMachine::executeInstruction(const Instruction& instr)
             m_ip = instr.operand - 1; // -1 because we increment after
             break;
 
+        case OpCode::BREAK:
+        {
+            auto it = m_breakOriginals.find(m_ip);
+            if (it == m_breakOriginals.end())
+            {
+                break;
+            }
+            const Instruction original = it->second;
+            if (m_resumeBreakIp != m_ip && (!m_breakHandler || m_breakHandler(m_ip)))
+            {
+                // Stay on the trap; resuming runs the original instruction
+                m_resumeBreakIp = m_ip;
+                m_paused = true;
+                --m_ip;
+                break;
+            }
+            m_resumeBreakIp = NO_BREAK;
+            executeInstruction<Checked>(original);
+            break;
+        }
+
         case OpCode::JUMP_IF:
-            if (asBool(pop()))
+            if (asBool(take<Checked>()))
             {
                 m_ip = instr.operand - 1;
             }
             break;
 
         case OpCode::JUMP_IF_NOT:
-            if (!asBool(pop()))
+            if (!asBool(take<Checked>()))
             {
                 m_ip = instr.operand - 1;
             }
@@ -208,7 +523,7 @@ void VirtualMachine::executeInstruction(const Instruction& instr)
         }
 
         case OpCode::PUSH_STRING:
-            push(getString(instr.operand));
+            push(stringOperand<Checked>(instr.operand));
             break;
 
         case OpCode::PUSH_BOOL:
@@ -220,34 +535,36 @@ void VirtualMachine::executeInstruction(const Instruction& instr)
             break;
 
         case OpCode::POP:
-            pop();
+            take<Checked>();
             break;
 
         case OpCode::DUP:
-            if (!m_stack.empty())
+            if (!Checked || !m_stack.empty())
             {
                 push(m_stack.back());
             }
             break;
 
         case OpCode::LOAD_VAR:
+        case OpCode::LOAD_GLOBAL:
         {
-            const std::string& name = getString(instr.operand);
+            const std::string& name = stringOperand<Checked>(instr.operand);
             push(getVariable(name));
             break;
         }
 
         case OpCode::STORE_VAR:
+        case OpCode::STORE_GLOBAL:
         {
-            const std::string& name = getString(instr.operand);
-            setVariable(name, pop());
+            const std::string& name = stringOperand<Checked>(instr.operand);
+            setVariable(name, take<Checked>());
             break;
         }
 
         case OpCode::ADD:
         {
-            Value b = pop();
-            Value a = pop();
+            Value b = take<Checked>();
+            Value a = take<Checked>();
             if (getValueType(a) == ValueType::String ||
                 getValueType(b) == ValueType::String)
             {
@@ -267,8 +584,8 @@ void VirtualMachine::executeInstruction(const Instruction& instr)
 
         case OpCode::SUB:
         {
-            Value b = pop();
-            Value a = pop();
+            Value b = take<Checked>();
+            Value a = take<Checked>();
             if (getValueType(a) == ValueType::Float ||
                 getValueType(b) == ValueType::Float)
             {
@@ -283,8 +600,8 @@ void VirtualMachine::executeInstruction(const Instruction& instr)
 
         case OpCode::MUL:
         {
-            Value b = pop();
-            Value a = pop();
+            Value b = take<Checked>();
+            Value a = take<Checked>();
             if (getValueType(a) == ValueType::Float ||
                 getValueType(b) == ValueType::Float)
             {
@@ -299,8 +616,8 @@ void VirtualMachine::executeInstruction(const Instruction& instr)
 
         case OpCode::DIV:
         {
-            Value b = pop();
-            Value a = pop();
+            Value b = take<Checked>();
+            Value a = take<Checked>();
             f32 divisor = asFloat(b);
             if (divisor != 0.0f)
             {
@@ -316,86 +633,86 @@ void VirtualMachine::executeInstruction(const Instruction& instr)
 
         case OpCode::EQ:
         {
-            Value b = pop();
-            Value a = pop();
+            Value b = take<Checked>();
+            Value a = take<Checked>();
             push(asString(a) == asString(b));
             break;
         }
 
         case OpCode::NE:
         {
-            Value b = pop();
-            Value a = pop();
+            Value b = take<Checked>();
+            Value a = take<Checked>();
             push(asString(a) != asString(b));
             break;
         }
 
         case OpCode::LT:
         {
-            Value b = pop();
-            Value a = pop();
+            Value b = take<Checked>();
+            Value a = take<Checked>();
             push(asFloat(a) < asFloat(b));
             break;
         }
 
         case OpCode::LE:
         {
-            Value b = pop();
-            Value a = pop();
+            Value b = take<Checked>();
+            Value a = take<Checked>();
             push(asFloat(a) <= asFloat(b));
             break;
         }
 
         case OpCode::GT:
         {
-            Value b = pop();
-            Value a = pop();
+            Value b = take<Checked>();
+            Value a = take<Checked>();
             push(asFloat(a) > asFloat(b));
             break;
         }
 
         case OpCode::GE:
         {
-            Value b = pop();
-            Value a = pop();
+            Value b = take<Checked>();
+            Value a = take<Checked>();
             push(asFloat(a) >= asFloat(b));
             break;
         }
 
         case OpCode::AND:
         {
-            Value b = pop();
-            Value a = pop();
+            Value b = take<Checked>();
+            Value a = take<Checked>();
             push(asBool(a) && asBool(b));
             break;
         }
 
         case OpCode::OR:
         {
-            Value b = pop();
-            Value a = pop();
+            Value b = take<Checked>();
+            Value a = take<Checked>();
             push(asBool(a) || asBool(b));
             break;
         }
 
         case OpCode::NOT:
         {
-            Value a = pop();
+            Value a = take<Checked>();
             push(!asBool(a));
             break;
         }
 
         case OpCode::SET_FLAG:
         {
-            bool value = asBool(pop());
-            const std::string& name = getString(instr.operand);
+            bool value = asBool(take<Checked>());
+            const std::string& name = stringOperand<Checked>(instr.operand);
             setFlag(name, value);
             break;
         }
 
         case OpCode::CHECK_FLAG:
         {
-            const std::string& name = getString(instr.operand);
+            const std::string& name = stringOperand<Checked>(instr.operand);
             push(getFlag(name));
             break;
         }
@@ -417,7 +734,23 @@ void VirtualMachine::executeInstruction(const Instruction& instr)
             {
                 std::vector<Value> args;
                 // Collect args from stack if needed
-                it->second(args);
+                if (m_profiler)
+                {
+                    // The callback may change scene and with it the program
+                    const u32 ip = m_ip;
+                    const OpCode op = instr.opcode;
+                    const auto start = std::chrono::steady_clock::now();
+                    it->second(args);
+                    const auto elapsed = std::chrono::steady_clock::now() - start;
+                    m_profiler->recordCallback(
+                        ip, op,
+                        static_cast<u64>(
+                            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+                }
+                else
+                {
+                    it->second(args);
+                }
             }
 
             // These commands typically wait for user input
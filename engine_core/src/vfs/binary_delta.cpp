@@ -0,0 +1,278 @@
+#include "NovelMind/vfs/binary_delta.hpp"
+#include <cstring>
+
+namespace NovelMind::vfs
+{
+
+namespace
+{
+
+constexpr u8 OP_ADD = 0;
+constexpr u8 OP_COPY = 1;
+constexpr u64 ROLL_PRIME = 0x100000001B3ull;
+
+u64 rollPower()
+{
+    u64 power = 1;
+    for (usize i = 1; i < BinaryDelta::MIN_MATCH; ++i)
+    {
+        power *= ROLL_PRIME;
+    }
+    return power;
+}
+
+u64 windowHash(const u8* data)
+{
+    u64 hash = 0;
+    for (usize i = 0; i < BinaryDelta::MIN_MATCH; ++i)
+    {
+        hash = hash * ROLL_PRIME + data[i];
+    }
+    return hash;
+}
+
+u64 slotOf(u64 hash, u64 mask)
+{
+    return ((hash ^ (hash >> 29)) * 0x9E3779B97F4A7C15ull >> 16) & mask;
+}
+
+void putVarint(std::vector<u8>& out, u64 value)
+{
+    while (value >= 0x80)
+    {
+        out.push_back(static_cast<u8>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<u8>(value));
+}
+
+bool getVarint(const u8*& p, const u8* end, u64& value)
+{
+    value = 0;
+    for (u32 shift = 0; shift < 64; shift += 7)
+    {
+        if (p == end)
+        {
+            return false;
+        }
+        const u8 byte = *p++;
+        value |= static_cast<u64>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void emitAdd(std::vector<u8>& out, const u8* data, usize size)
+{
+    if (size == 0)
+    {
+        return;
+    }
+    out.push_back(OP_ADD);
+    putVarint(out, size);
+    out.insert(out.end(), data, data + size);
+}
+
+void emitCopy(std::vector<u8>& out, usize offset, usize size)
+{
+    out.push_back(OP_COPY);
+    putVarint(out, size);
+    putVarint(out, offset);
+}
+
+} // namespace
+
+std::vector<u8> BinaryDelta::create(const std::vector<u8>& base, const std::vector<u8>& target)
+{
+    DeltaHeader header{};
+    header.magic = DELTA_MAGIC;
+    header.baseSize = base.size();
+    header.targetSize = target.size();
+    header.baseDigest = ContentChunker::digest(base.data(), base.size());
+    header.targetDigest = ContentChunker::digest(target.data(), target.size());
+
+    std::vector<u8> out(sizeof(DeltaHeader));
+    std::memcpy(out.data(), &header, sizeof(DeltaHeader));
+
+    const usize n = target.size();
+    if (base.size() < MIN_MATCH || n < MIN_MATCH)
+    {
+        emitAdd(out, target.data(), n);
+        return out;
+    }
+
+    // Index the base at block granularity; the target is scanned at every
+    // byte with a rolling hash, so shifted content still finds its blocks
+    const usize blockCount = base.size() / MIN_MATCH;
+    usize tableSize = 16;
+    while (tableSize < blockCount * 2)
+    {
+        tableSize <<= 1;
+    }
+    const u64 mask = tableSize - 1;
+    std::vector<u32> table(tableSize, 0); // base offset + 1, 0 = empty
+    for (usize block = blockCount; block-- > 0;)
+    {
+        const usize offset = block * MIN_MATCH;
+        table[slotOf(windowHash(base.data() + offset), mask)] = static_cast<u32>(offset + 1);
+    }
+
+    const u64 power = rollPower();
+    const u8* t = target.data();
+    const u8* b = base.data();
+
+    usize literalStart = 0;
+    usize i = 0;
+    u64 hash = windowHash(t);
+    while (i + MIN_MATCH <= n)
+    {
+        const u32 entry = table[slotOf(hash, mask)];
+        if (entry != 0)
+        {
+            usize offset = entry - 1;
+            if (std::memcmp(b + offset, t + i, MIN_MATCH) == 0)
+            {
+                usize start = i;
+                while (start > literalStart && offset > 0 && b[offset - 1] == t[start - 1])
+                {
+                    --start;
+                    --offset;
+                }
+                usize length = i + MIN_MATCH - start;
+                while (start + length < n && offset + length < base.size() &&
+                       b[offset + length] == t[start + length])
+                {
+                    ++length;
+                }
+
+                emitAdd(out, t + literalStart, start - literalStart);
+                emitCopy(out, offset, length);
+                i = start + length;
+                literalStart = i;
+                if (i + MIN_MATCH <= n)
+                {
+                    hash = windowHash(t + i);
+                }
+                continue;
+            }
+        }
+
+        if (i + MIN_MATCH < n)
+        {
+            hash = (hash - t[i] * power) * ROLL_PRIME + t[i + MIN_MATCH];
+        }
+        ++i;
+    }
+
+    emitAdd(out, t + literalStart, n - literalStart);
+    return out;
+}
+
+Result<DeltaHeader> BinaryDelta::readHeader(const std::vector<u8>& delta)
+{
+    if (delta.size() < sizeof(DeltaHeader))
+    {
+        return Result<DeltaHeader>::error("Delta payload truncated");
+    }
+
+    DeltaHeader header;
+    std::memcpy(&header, delta.data(), sizeof(DeltaHeader));
+    if (header.magic != DELTA_MAGIC)
+    {
+        return Result<DeltaHeader>::error("Invalid delta magic number");
+    }
+    return Result<DeltaHeader>::ok(header);
+}
+
+Result<std::vector<u8>> BinaryDelta::apply(const std::vector<u8>& base,
+                                           const std::vector<u8>& delta)
+{
+    auto headerResult = readHeader(delta);
+    if (headerResult.isError())
+    {
+        return Result<std::vector<u8>>::error(headerResult.error());
+    }
+    const DeltaHeader header = headerResult.value();
+
+    if (header.baseSize != base.size() ||
+        header.baseDigest != ContentChunker::digest(base.data(), base.size()))
+    {
+        return Result<std::vector<u8>>::error("Delta was created against a different base");
+    }
+
+    // Validate every instruction before allocating, so a corrupt header
+    // cannot size the target
+    const u8* const begin = delta.data() + sizeof(DeltaHeader);
+    const u8* const end = delta.data() + delta.size();
+    u64 total = 0;
+    for (const u8* p = begin; p != end;)
+    {
+        const u8 op = *p++;
+        u64 length = 0;
+        if (!getVarint(p, end, length) || length > header.targetSize - total)
+        {
+            return Result<std::vector<u8>>::error("Corrupt delta instruction");
+        }
+
+        if (op == OP_ADD)
+        {
+            if (length > static_cast<u64>(end - p))
+            {
+                return Result<std::vector<u8>>::error("Corrupt delta literal");
+            }
+            p += length;
+        }
+        else if (op == OP_COPY)
+        {
+            u64 offset = 0;
+            if (!getVarint(p, end, offset) || offset > base.size() ||
+                length > base.size() - offset)
+            {
+                return Result<std::vector<u8>>::error("Corrupt delta copy");
+            }
+        }
+        else
+        {
+            return Result<std::vector<u8>>::error("Unknown delta instruction");
+        }
+        total += length;
+    }
+    if (total != header.targetSize)
+    {
+        return Result<std::vector<u8>>::error("Delta instructions do not cover the target");
+    }
+
+    std::vector<u8> target(static_cast<usize>(total));
+    usize position = 0;
+    for (const u8* p = begin; p != end;)
+    {
+        const u8 op = *p++;
+        u64 length = 0;
+        getVarint(p, end, length);
+        if (op == OP_ADD)
+        {
+            std::memcpy(target.data() + position, p, static_cast<usize>(length));
+            p += length;
+        }
+        else
+        {
+            u64 offset = 0;
+            getVarint(p, end, offset);
+            std::memcpy(target.data() + position, base.data() + offset,
+                        static_cast<usize>(length));
+        }
+        position += static_cast<usize>(length);
+    }
+
+    if (header.targetDigest != ContentChunker::digest(target.data(), target.size()))
+    {
+        return Result<std::vector<u8>>::error("Delta result does not match its digest");
+    }
+
+    return Result<std::vector<u8>>::ok(std::move(target));
+}
+
+} // namespace NovelMind::vfs
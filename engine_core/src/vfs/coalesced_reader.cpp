@@ -0,0 +1,226 @@
+#include "NovelMind/vfs/coalesced_reader.hpp"
+#include <algorithm>
+#include <cstring>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#define NOVELMIND_HAS_PREAD 1
+#if defined(__linux__)
+#include <sys/uio.h>
+#define NOVELMIND_HAS_PREADV 1
+#endif
+#else
+#include <fstream>
+#endif
+
+namespace NovelMind::vfs
+{
+
+namespace
+{
+
+class SpanFile
+{
+public:
+    explicit SpanFile(const std::string& path)
+    {
+#if defined(NOVELMIND_HAS_PREAD)
+        m_fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+#if defined(__linux__)
+        if (m_fd >= 0)
+        {
+            ::posix_fadvise(m_fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+        }
+#endif
+#else
+        m_file.open(path, std::ios::binary);
+#endif
+    }
+
+    ~SpanFile()
+    {
+#if defined(NOVELMIND_HAS_PREAD)
+        if (m_fd >= 0)
+        {
+            ::close(m_fd);
+        }
+#endif
+    }
+
+    SpanFile(const SpanFile&) = delete;
+    SpanFile& operator=(const SpanFile&) = delete;
+
+    [[nodiscard]] bool isOpen() const
+    {
+#if defined(NOVELMIND_HAS_PREAD)
+        return m_fd >= 0;
+#else
+        return m_file.is_open();
+#endif
+    }
+
+    bool readSpan(const ReadSpan& span, const ReadSegment* segments)
+    {
+#if defined(NOVELMIND_HAS_PREADV)
+        if (scatter(span, segments))
+        {
+            return true;
+        }
+#endif
+        // Overlapping segments or a short scatter read: read the span whole
+        m_buffer.resize(static_cast<usize>(span.size));
+        if (!readAt(m_buffer.data(), span.size, span.offset))
+        {
+            return false;
+        }
+        for (usize i = 0; i < span.segmentCount; ++i)
+        {
+            const ReadSegment& segment = segments[i];
+            if (segment.size != 0)
+            {
+                std::memcpy(segment.dest, m_buffer.data() + (segment.offset - span.offset),
+                            static_cast<usize>(segment.size));
+            }
+        }
+        return true;
+    }
+
+private:
+#if defined(NOVELMIND_HAS_PREADV)
+    bool scatter(const ReadSpan& span, const ReadSegment* segments)
+    {
+        m_iov.clear();
+        u64 cursor = span.offset;
+        u64 largestGap = 0;
+        for (usize i = 0; i < span.segmentCount; ++i)
+        {
+            if (segments[i].offset < cursor)
+            {
+                return false;
+            }
+            largestGap = std::max(largestGap, segments[i].offset - cursor);
+            cursor = segments[i].offset + segments[i].size;
+        }
+        if (m_scratch.size() < largestGap)
+        {
+            m_scratch.resize(static_cast<usize>(largestGap));
+        }
+
+        // Gap bytes are read into the shared scratch buffer and discarded
+        cursor = span.offset;
+        for (usize i = 0; i < span.segmentCount; ++i)
+        {
+            const ReadSegment& segment = segments[i];
+            if (segment.offset > cursor)
+            {
+                m_iov.push_back({m_scratch.data(), static_cast<usize>(segment.offset - cursor)});
+            }
+            if (segment.size != 0)
+            {
+                m_iov.push_back({segment.dest, static_cast<usize>(segment.size)});
+            }
+            cursor = segment.offset + segment.size;
+        }
+        if (m_iov.empty())
+        {
+            return true;
+        }
+
+        const ssize_t n = ::preadv(m_fd, m_iov.data(), static_cast<int>(m_iov.size()),
+                                   static_cast<off_t>(span.offset));
+        return n >= 0 && static_cast<u64>(n) == span.size;
+    }
+#endif
+
+    bool readAt(u8* out, u64 size, u64 offset)
+    {
+#if defined(NOVELMIND_HAS_PREAD)
+        while (size > 0)
+        {
+            const ssize_t n = ::pread(m_fd, out, static_cast<usize>(size),
+                                      static_cast<off_t>(offset));
+            if (n <= 0)
+            {
+                return false;
+            }
+            out += n;
+            size -= static_cast<u64>(n);
+            offset += static_cast<u64>(n);
+        }
+        return true;
+#else
+        m_file.clear();
+        m_file.seekg(static_cast<std::streamoff>(offset));
+        m_file.read(reinterpret_cast<char*>(out), static_cast<std::streamsize>(size));
+        return static_cast<bool>(m_file);
+#endif
+    }
+
+#if defined(NOVELMIND_HAS_PREAD)
+    int m_fd = -1;
+#else
+    std::ifstream m_file;
+#endif
+#if defined(NOVELMIND_HAS_PREADV)
+    std::vector<iovec> m_iov;
+    std::vector<u8> m_scratch;
+#endif
+    std::vector<u8> m_buffer;
+};
+
+} // namespace
+
+std::vector<ReadSpan> CoalescedReader::plan(std::vector<ReadSegment>& segments,
+                                            const CoalesceOptions& options)
+{
+    std::stable_sort(segments.begin(), segments.end(),
+                     [](const ReadSegment& a, const ReadSegment& b) { return a.offset < b.offset; });
+
+    std::vector<ReadSpan> spans;
+    u64 spanEnd = 0;
+    for (usize i = 0; i < segments.size(); ++i)
+    {
+        const ReadSegment& segment = segments[i];
+        const u64 end = segment.offset + segment.size;
+
+        if (!spans.empty())
+        {
+            ReadSpan& span = spans.back();
+            const u64 mergedEnd = std::max(spanEnd, end);
+            if (segment.offset <= spanEnd + options.maxGap &&
+                mergedEnd - span.offset <= options.maxSpan &&
+                span.segmentCount < options.maxSegments)
+            {
+                spanEnd = mergedEnd;
+                span.size = spanEnd - span.offset;
+                ++span.segmentCount;
+                continue;
+            }
+        }
+
+        spans.push_back({segment.offset, segment.size, i, 1});
+        spanEnd = end;
+    }
+    return spans;
+}
+
+void CoalescedReader::read(
+    const std::string& path, std::vector<ReadSegment>& segments, const CoalesceOptions& options,
+    const std::function<void(const ReadSegment& segment, bool ok)>& onSegment)
+{
+    const std::vector<ReadSpan> spans = plan(segments, options);
+
+    SpanFile file(path);
+    for (const ReadSpan& span : spans)
+    {
+        const ReadSegment* first = segments.data() + span.firstSegment;
+        const bool ok = file.isOpen() && file.readSpan(span, first);
+        for (usize i = 0; i < span.segmentCount; ++i)
+        {
+            onSegment(first[i], ok);
+        }
+    }
+}
+
+} // namespace NovelMind::vfs
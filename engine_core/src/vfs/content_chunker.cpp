@@ -0,0 +1,161 @@
+#include "NovelMind/vfs/content_chunker.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+namespace NovelMind::vfs
+{
+
+namespace
+{
+
+constexpr u64 splitMix64(u64& state)
+{
+    u64 z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+constexpr std::array<u64, 256> makeGearTable()
+{
+    std::array<u64, 256> table{};
+    u64 state = 0x4E4D4344434B4E4Dull; // fixed seed: boundaries must be stable across builds
+    for (auto& value : table)
+    {
+        value = splitMix64(state);
+    }
+    return table;
+}
+
+constexpr std::array<u64, 256> GEAR = makeGearTable();
+
+u32 log2Floor(u32 value)
+{
+    u32 bits = 0;
+    while (value > 1)
+    {
+        value >>= 1;
+        ++bits;
+    }
+    return bits;
+}
+
+/**
+ * @brief Mask with the given number of bits set at the top of the word
+ *
+ * The gear hash shifts left, so the high bits depend on the most bytes.
+ */
+u64 topMask(u32 bits)
+{
+    bits = std::clamp(bits, 1u, 63u);
+    return ~0ull << (64 - bits);
+}
+
+u64 mix(u64 value)
+{
+    value ^= value >> 33;
+    value *= 0xFF51AFD7ED558CCDull;
+    value ^= value >> 33;
+    value *= 0xC4CEB9FE1A85EC53ull;
+    value ^= value >> 33;
+    return value;
+}
+
+} // namespace
+
+std::vector<ChunkSpan> ContentChunker::split(const u8* data, usize size,
+                                             const ChunkerParams& params)
+{
+    std::vector<ChunkSpan> chunks;
+    if (size == 0)
+    {
+        return chunks;
+    }
+
+    const usize minSize = std::max<u32>(params.minSize, 64);
+    const usize maxSize = std::max<usize>(params.maxSize, minSize);
+    const usize avgSize = std::clamp<usize>(params.avgSize, minSize, maxSize);
+
+    // Normalized chunking: stricter mask before the average size, looser after
+    const u32 bits = log2Floor(static_cast<u32>(avgSize));
+    const u64 maskStrict = topMask(bits + 2);
+    const u64 maskLoose = topMask(bits > 2 ? bits - 2 : 1);
+
+    chunks.reserve(size / avgSize + 1);
+
+    usize start = 0;
+    while (start < size)
+    {
+        const usize remaining = size - start;
+        if (remaining <= minSize)
+        {
+            chunks.push_back({start, static_cast<u32>(remaining)});
+            break;
+        }
+
+        const usize limit = std::min(remaining, maxSize);
+        const usize normal = std::min(limit, avgSize);
+        const u8* p = data + start;
+
+        usize cut = limit;
+        u64 hash = 0;
+        usize i = minSize;
+        for (; i < normal; ++i)
+        {
+            hash = (hash << 1) + GEAR[p[i]];
+            if ((hash & maskStrict) == 0)
+            {
+                cut = i + 1;
+                break;
+            }
+        }
+        if (i == normal)
+        {
+            for (; i < limit; ++i)
+            {
+                hash = (hash << 1) + GEAR[p[i]];
+                if ((hash & maskLoose) == 0)
+                {
+                    cut = i + 1;
+                    break;
+                }
+            }
+        }
+
+        chunks.push_back({start, static_cast<u32>(cut)});
+        start += cut;
+    }
+
+    return chunks;
+}
+
+ChunkDigest ContentChunker::digest(const u8* data, usize size)
+{
+    // Two independently seeded multiply-mix lanes over 8-byte words
+    u64 a = 0x243F6A8885A308D3ull ^ size;
+    u64 b = 0x13198A2E03707344ull + size;
+
+    usize i = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+        u64 word = 0;
+        std::memcpy(&word, data + i, sizeof(word));
+        a = (a ^ mix(word)) * 0x9E3779B97F4A7C15ull;
+        b = (b + mix(word ^ 0xA0761D6478BD642Full)) * 0xC2B2AE3D27D4EB4Full;
+        a = (a << 31) | (a >> 33);
+        b = (b << 29) | (b >> 35);
+    }
+
+    u64 tail = 0;
+    std::memcpy(&tail, data + i, size - i);
+    a ^= mix(tail + 0x165667B19E3779F9ull);
+    b ^= mix(tail ^ 0x27D4EB2F165667C5ull);
+
+    ChunkDigest result;
+    result.lo = mix(a ^ (b >> 17));
+    result.hi = mix(b ^ (a << 13) ^ size);
+    return result;
+}
+
+} // namespace NovelMind::vfs
@@ -0,0 +1,206 @@
+#include "NovelMind/vfs/lz4_block.hpp"
+#include <cstring>
+
+namespace NovelMind::vfs
+{
+
+namespace
+{
+
+constexpr usize MIN_MATCH = 4;
+constexpr usize LAST_LITERALS = 5;   // The block always ends in literals
+constexpr usize MATCH_FIND_LIMIT = 12; // No match may start in the last 12 bytes
+constexpr usize MAX_OFFSET = 65535;
+constexpr u32 HASH_BITS = 14;
+constexpr u32 NO_POSITION = 0xFFFFFFFFu;
+
+u32 read32(const u8* p)
+{
+    u32 value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+u32 hashSequence(u32 sequence)
+{
+    return (sequence * 2654435761u) >> (32 - HASH_BITS);
+}
+
+void writeLength(std::vector<u8>& out, usize length)
+{
+    // Lengths of 15 or more continue in 255-saturated bytes
+    length -= 15;
+    while (length >= 255)
+    {
+        out.push_back(255);
+        length -= 255;
+    }
+    out.push_back(static_cast<u8>(length));
+}
+
+void emitSequence(std::vector<u8>& out, const u8* literals, usize literalCount, usize offset,
+                  usize matchLength)
+{
+    const usize matchCode = matchLength - MIN_MATCH;
+    const u8 token = static_cast<u8>(((literalCount < 15 ? literalCount : 15) << 4) |
+                                     (matchCode < 15 ? matchCode : 15));
+    out.push_back(token);
+    if (literalCount >= 15)
+    {
+        writeLength(out, literalCount);
+    }
+    out.insert(out.end(), literals, literals + literalCount);
+    out.push_back(static_cast<u8>(offset & 0xFF));
+    out.push_back(static_cast<u8>(offset >> 8));
+    if (matchCode >= 15)
+    {
+        writeLength(out, matchCode);
+    }
+}
+
+void emitLastLiterals(std::vector<u8>& out, const u8* literals, usize literalCount)
+{
+    out.push_back(static_cast<u8>((literalCount < 15 ? literalCount : 15) << 4));
+    if (literalCount >= 15)
+    {
+        writeLength(out, literalCount);
+    }
+    out.insert(out.end(), literals, literals + literalCount);
+}
+
+bool readLength(const u8* block, usize blockSize, usize& pos, usize& length)
+{
+    u8 byte;
+    do
+    {
+        if (pos >= blockSize)
+        {
+            return false;
+        }
+        byte = block[pos++];
+        length += byte;
+    } while (byte == 255);
+    return true;
+}
+
+} // namespace
+
+usize LZ4Block::compressBound(usize inputSize)
+{
+    return inputSize + inputSize / 255 + 16;
+}
+
+std::vector<u8> LZ4Block::compress(const u8* data, usize size)
+{
+    std::vector<u8> out;
+    out.reserve(compressBound(size));
+
+    usize anchor = 0;
+    if (data && size > MATCH_FIND_LIMIT)
+    {
+        std::vector<u32> table(usize{1} << HASH_BITS, NO_POSITION);
+        const usize matchLimit = size - LAST_LITERALS;
+        const usize searchLimit = size - MATCH_FIND_LIMIT;
+
+        usize pos = 0;
+        while (pos < searchLimit)
+        {
+            const u32 sequence = read32(data + pos);
+            const u32 hash = hashSequence(sequence);
+            const u32 candidate = table[hash];
+            table[hash] = static_cast<u32>(pos);
+
+            if (candidate != NO_POSITION && pos - candidate <= MAX_OFFSET &&
+                read32(data + candidate) == sequence)
+            {
+                usize length = MIN_MATCH;
+                while (pos + length < matchLimit && data[candidate + length] == data[pos + length])
+                {
+                    ++length;
+                }
+
+                emitSequence(out, data + anchor, pos - anchor, pos - candidate, length);
+                pos += length;
+                anchor = pos;
+                continue;
+            }
+
+            // Step faster through incompressible runs, as the reference
+            // implementation does
+            pos += 1 + ((pos - anchor) >> 6);
+        }
+    }
+
+    emitLastLiterals(out, data + anchor, size - anchor);
+    return out;
+}
+
+bool LZ4Block::decompress(const u8* block, usize blockSize, u8* output, usize outputSize)
+{
+    usize in = 0;
+    usize out = 0;
+    while (in < blockSize)
+    {
+        const u8 token = block[in++];
+
+        usize literalCount = token >> 4;
+        if (literalCount == 15 && !readLength(block, blockSize, in, literalCount))
+        {
+            return false;
+        }
+        if (literalCount > blockSize - in || literalCount > outputSize - out)
+        {
+            return false;
+        }
+        std::memcpy(output + out, block + in, literalCount);
+        in += literalCount;
+        out += literalCount;
+
+        if (in == blockSize)
+        {
+            break; // Last sequence has no match
+        }
+
+        if (blockSize - in < 2)
+        {
+            return false;
+        }
+        const usize offset = static_cast<usize>(block[in]) | (static_cast<usize>(block[in + 1]) << 8);
+        in += 2;
+        if (offset == 0 || offset > out)
+        {
+            return false;
+        }
+
+        usize matchLength = token & 15;
+        if (matchLength == 15 && !readLength(block, blockSize, in, matchLength))
+        {
+            return false;
+        }
+        matchLength += MIN_MATCH;
+        if (matchLength > outputSize - out)
+        {
+            return false;
+        }
+
+        u8* dest = output + out;
+        const u8* source = dest - offset;
+        if (offset >= matchLength)
+        {
+            std::memcpy(dest, source, matchLength);
+        }
+        else
+        {
+            // Overlapping copy repeats the last `offset` bytes
+            for (usize i = 0; i < matchLength; ++i)
+            {
+                dest[i] = source[i];
+            }
+        }
+        out += matchLength;
+    }
+
+    return out == outputSize;
+}
+
+} // namespace NovelMind::vfs
@@ -4,9 +4,12 @@
  */
 
 #include "NovelMind/vfs/multi_pack_manager.hpp"
+#include "NovelMind/vfs/binary_delta.hpp"
+#include "NovelMind/vfs/resource_variants.hpp"
 #include <filesystem>
 #include <algorithm>
 #include <fstream>
+#include <iterator>
 #include <sstream>
 #include <regex>
 
@@ -44,6 +47,7 @@ MultiPackManager::MultiPackManager() = default;
 
 MultiPackManager::~MultiPackManager()
 {
+    stopAsyncLoads();
     if (m_initialized)
     {
         shutdown();
@@ -64,6 +68,7 @@ Result<void> MultiPackManager::initialize()
     m_packs.clear();
     m_packIdToIndex.clear();
     m_resourceIndex.clear();
+    m_priorityOrder.clear();
     m_modLoadOrder.clear();
 
     m_initialized = true;
@@ -72,6 +77,7 @@ Result<void> MultiPackManager::initialize()
 
 void MultiPackManager::shutdown()
 {
+    stopAsyncLoads();
     unloadAllPacks();
     m_initialized = false;
 }
@@ -103,12 +109,24 @@ PackLoadResult MultiPackManager::loadPack(const std::string& path, PackType type
 PackLoadResult MultiPackManager::loadPackInternal(const std::string& path, PackType type, i32 priority)
 {
     PackLoadResult result;
+    auto pack = preparePack(path, type, priority, m_nextLoadSequence++, result);
+    if (pack)
+    {
+        publishPack(std::move(pack), result);
+    }
+    return result;
+}
+
+std::unique_ptr<MultiPackManager::LoadedPack> MultiPackManager::preparePack(
+    const std::string& path, PackType type, i32 priority, u64 loadSequence,
+    PackLoadResult& result)
+{
     result.success = false;
 
     if (!fs::exists(path))
     {
         result.errors.push_back("Pack file not found: " + path);
-        return result;
+        return nullptr;
     }
 
     // Read pack manifest/header
@@ -120,7 +138,7 @@ PackLoadResult MultiPackManager::loadPackInternal(const std::string& path, PackT
     catch (const std::exception& e)
     {
         result.errors.push_back("Failed to read pack manifest: " + std::string(e.what()));
-        return result;
+        return nullptr;
     }
 
     info.path = path;
@@ -128,15 +146,45 @@ PackLoadResult MultiPackManager::loadPackInternal(const std::string& path, PackT
     info.priority = priority;
     result.packId = info.id;
 
+    // Create pack reader
+    auto reader = std::make_unique<PackReader>();
+    auto openResult = reader->mount(path);
+    if (openResult.isError())
+    {
+        result.errors.push_back("Failed to open pack: " + openResult.error());
+        return nullptr;
+    }
+
+    // Create loaded pack entry
+    auto loadedPack = std::make_unique<LoadedPack>();
+    loadedPack->info = std::move(info);
+    loadedPack->reader = std::move(reader);
+    loadedPack->effectivePriority = calculateEffectivePriority(type, priority);
+    loadedPack->loadSequence = loadSequence;
+
+    // Collect provided resources; ids are hashed once here
+    LoadedPack& pack = *loadedPack;
+    pack.reader->forEachResource(
+        [&pack](const std::string& resId, PackReader::ResourceHandle handle) {
+            const std::string* id = &*pack.providedResources.insert(resId).first;
+            pack.resources.push_back({VFS::ResourceId::hashOf(resId), id, handle});
+        });
+    result.loadedResources = loadedPack->providedResources.size();
+
+    return loadedPack;
+}
+
+void MultiPackManager::publishPack(std::unique_ptr<LoadedPack> loadedPack, PackLoadResult& result)
+{
     // Check if already loaded
-    if (isPackLoaded(info.id))
+    if (isPackLoaded(loadedPack->info.id))
     {
-        result.errors.push_back("Pack already loaded: " + info.id);
-        return result;
+        result.errors.push_back("Pack already loaded: " + loadedPack->info.id);
+        return;
     }
 
     // Check dependencies
-    auto missingDeps = getMissingDependencies(info);
+    auto missingDeps = getMissingDependencies(loadedPack->info);
     if (!missingDeps.empty())
     {
         result.missingDependencies = missingDeps;
@@ -147,46 +195,195 @@ PackLoadResult MultiPackManager::loadPackInternal(const std::string& path, PackT
         // Continue loading but warn about missing dependencies
     }
 
-    // Create pack reader
-    auto reader = std::make_unique<PackReader>();
-    auto openResult = reader->mount(path);
-    if (openResult.isError())
+    // Chunked packs may reference chunks stored in other packs of the stack
+    const LoadedPack* requester = loadedPack.get();
+    loadedPack->reader->setExternalChunkResolver(
+        [this, requester](const ChunkDigest& digest, u8* out, u32 size) {
+            return resolveExternalChunk(requester, digest, out, size);
+        });
+
+    // Add to packs list
+    LoadedPack& pack = *loadedPack;
+    m_packIdToIndex[pack.info.id] = m_packs.size();
+    m_packs.push_back(std::move(loadedPack));
+
+    // If this is a mod, add to load order
+    if (pack.info.type == PackType::Mod &&
+        std::find(m_modLoadOrder.begin(), m_modLoadOrder.end(), pack.info.id) ==
+            m_modLoadOrder.end())
     {
-        result.errors.push_back("Failed to open pack: " + openResult.error());
-        return result;
+        m_modLoadOrder.push_back(pack.info.id);
     }
 
-    // Create loaded pack entry
-    auto loadedPack = std::make_unique<LoadedPack>();
-    loadedPack->info = std::move(info);
-    loadedPack->reader = std::move(reader);
-    loadedPack->effectivePriority = calculateEffectivePriority(type, priority);
+    // Index only the new pack's resources
+    updatePriorityOrder();
+    indexPack(pack);
+    m_deltaCache.clear();
+
+    result.success = true;
+    firePackLoaded(pack.info);
+}
+
+// =========================================================================
+// Asynchronous Loading
+// =========================================================================
+
+void MultiPackManager::loadPackAsync(const std::string& path, PackType type, i32 priority)
+{
+    enqueueAsyncLoad(path, type, priority);
+}
 
-    // Collect provided resources
-    auto resources = loadedPack->reader->listResources();
-    for (const auto& resId : resources)
+void MultiPackManager::loadModsAsync()
+{
+    if (m_modsDirectory.empty())
     {
-        loadedPack->providedResources.insert(resId);
+        return;
     }
-    result.loadedResources = loadedPack->providedResources.size();
 
-    // Add to packs list
-    m_packIdToIndex[loadedPack->info.id] = m_packs.size();
-    m_packs.push_back(std::move(loadedPack));
+    // Worker jobs only see copies of manager state
+    std::string directory = m_modsDirectory;
+    std::vector<std::string> order = m_modLoadOrder;
 
-    // If this is a mod, add to load order
-    if (type == PackType::Mod)
+    enqueueAsyncJob([this, directory = std::move(directory), order = std::move(order)]() {
+        auto discovered = scanPackDirectory(directory);
+        std::sort(discovered.begin(), discovered.end(),
+                  [](const DiscoveredPack& a, const DiscoveredPack& b) { return a.path < b.path; });
+
+        i32 next = static_cast<i32>(order.size());
+        for (const auto& pack : discovered)
+        {
+            if (!pack.canLoad)
+            {
+                continue;
+            }
+            auto it = std::find(order.begin(), order.end(), pack.info.id);
+            const i32 priority =
+                it != order.end() ? static_cast<i32>(it - order.begin()) : next++;
+            enqueueAsyncLoad(pack.path, PackType::Mod, priority);
+        }
+    });
+}
+
+std::vector<PackLoadResult> MultiPackManager::processAsyncLoads()
+{
+    std::vector<AsyncLoad> ready;
     {
-        m_modLoadOrder.push_back(result.packId);
+        std::lock_guard<std::mutex> lock(m_asyncMutex);
+        ready.swap(m_asyncReady);
     }
 
-    // Rebuild resource index
-    rebuildResourceIndex();
+    std::vector<PackLoadResult> results;
+    results.reserve(ready.size());
+    for (auto& load : ready)
+    {
+        if (load.pack)
+        {
+            publishPack(std::move(load.pack), load.result);
+        }
+        if (m_onAsyncLoadCompleted)
+        {
+            m_onAsyncLoadCompleted(load.result);
+        }
+        results.push_back(std::move(load.result));
+    }
+    return results;
+}
 
-    result.success = true;
-    firePackLoaded(m_packs.back()->info);
+bool MultiPackManager::hasPendingAsyncLoads() const
+{
+    std::lock_guard<std::mutex> lock(m_asyncMutex);
+    return m_asyncInFlight > 0 || !m_asyncReady.empty();
+}
 
-    return result;
+void MultiPackManager::waitForAsyncLoads()
+{
+    std::unique_lock<std::mutex> lock(m_asyncMutex);
+    m_asyncIdle.wait(lock, [this]() { return m_asyncInFlight == 0; });
+}
+
+void MultiPackManager::setOnAsyncLoadCompleted(OnAsyncLoadCompleted callback)
+{
+    m_onAsyncLoadCompleted = std::move(callback);
+}
+
+void MultiPackManager::enqueueAsyncLoad(const std::string& path, PackType type, i32 priority)
+{
+    const u64 sequence = m_nextLoadSequence++;
+    enqueueAsyncJob([this, path, type, priority, sequence]() {
+        AsyncLoad load;
+        load.pack = preparePack(path, type, priority, sequence, load.result);
+
+        std::lock_guard<std::mutex> lock(m_asyncMutex);
+        m_asyncReady.push_back(std::move(load));
+    });
+}
+
+void MultiPackManager::enqueueAsyncJob(std::function<void()> job)
+{
+    std::lock_guard<std::mutex> lock(m_asyncMutex);
+    if (m_stopWorkers)
+    {
+        return; // Queued by a job that is finishing during stopAsyncLoads()
+    }
+    if (m_mountWorkers.empty())
+    {
+        const u32 cores = std::max(1u, std::thread::hardware_concurrency());
+        const u32 workerCount = std::min(cores, MAX_MOUNT_WORKERS);
+        for (u32 i = 0; i < workerCount; ++i)
+        {
+            m_mountWorkers.emplace_back([this]() { mountWorkerLoop(); });
+        }
+    }
+
+    ++m_asyncInFlight;
+    m_asyncJobs.push_back(std::move(job));
+    m_asyncWork.notify_one();
+}
+
+void MultiPackManager::mountWorkerLoop()
+{
+    for (;;)
+    {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(m_asyncMutex);
+            m_asyncWork.wait(lock, [this]() { return m_stopWorkers || !m_asyncJobs.empty(); });
+            if (m_stopWorkers)
+            {
+                return;
+            }
+            job = std::move(m_asyncJobs.front());
+            m_asyncJobs.pop_front();
+        }
+
+        job();
+
+        std::lock_guard<std::mutex> lock(m_asyncMutex);
+        --m_asyncInFlight;
+        m_asyncIdle.notify_all();
+    }
+}
+
+void MultiPackManager::stopAsyncLoads()
+{
+    std::vector<std::thread> workers;
+    {
+        std::lock_guard<std::mutex> lock(m_asyncMutex);
+        m_stopWorkers = true;
+        workers.swap(m_mountWorkers);
+    }
+    m_asyncWork.notify_all();
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    std::lock_guard<std::mutex> lock(m_asyncMutex);
+    m_asyncJobs.clear();
+    m_asyncReady.clear();
+    m_asyncInFlight = 0;
+    m_stopWorkers = false;
+    m_asyncIdle.notify_all();
 }
 
 void MultiPackManager::unloadPack(const std::string& packId)
@@ -196,10 +393,20 @@ void MultiPackManager::unloadPack(const std::string& packId)
 
     size_t index = it->second;
 
+    // Hand its resources to the next provider before the reader goes away
+    LoadedPack& pack = *m_packs[index];
+    if (pack.info.enabled)
+    {
+        pack.info.enabled = false;
+        updatePriorityOrder();
+        unindexPack(pack);
+        m_deltaCache.clear();
+    }
+
     // Close the pack reader
-    if (m_packs[index]->reader)
+    if (pack.reader)
     {
-        m_packs[index]->reader->unmountAll();
+        pack.reader->unmountAll();
     }
 
     // Remove from mod load order if applicable
@@ -217,7 +424,6 @@ void MultiPackManager::unloadPack(const std::string& packId)
         m_packIdToIndex[m_packs[i]->info.id] = i;
     }
 
-    rebuildResourceIndex();
     firePackUnloaded(packId);
 }
 
@@ -254,6 +460,8 @@ void MultiPackManager::unloadAllPacks()
     m_packs.clear();
     m_packIdToIndex.clear();
     m_resourceIndex.clear();
+    m_priorityOrder.clear();
+    m_deltaCache.clear();
     m_modLoadOrder.clear();
 }
 
@@ -279,11 +487,23 @@ PackLoadResult MultiPackManager::reloadPack(const std::string& packId)
 void MultiPackManager::setPackEnabled(const std::string& packId, bool enabled)
 {
     auto it = m_packIdToIndex.find(packId);
-    if (it != m_packIdToIndex.end())
+    if (it == m_packIdToIndex.end() || m_packs[it->second]->info.enabled == enabled)
     {
-        m_packs[it->second]->info.enabled = enabled;
-        rebuildResourceIndex();
+        return;
+    }
+
+    LoadedPack& pack = *m_packs[it->second];
+    pack.info.enabled = enabled;
+    updatePriorityOrder();
+    if (enabled)
+    {
+        indexPack(pack);
+    }
+    else
+    {
+        unindexPack(pack);
     }
+    m_deltaCache.clear(); // Delta bases may have changed
 }
 
 // =========================================================================
@@ -291,12 +511,37 @@ void MultiPackManager::setPackEnabled(const std::string& packId, bool enabled)
 // =========================================================================
 
 std::vector<DiscoveredPack> MultiPackManager::discoverPacks(const std::string& directory)
+{
+    std::vector<DiscoveredPack> discovered = scanPackDirectory(directory);
+
+    for (auto& pack : discovered)
+    {
+        if (!pack.canLoad) continue;
+
+        // Check dependencies
+        auto missing = getMissingDependencies(pack.info);
+        if (!missing.empty())
+        {
+            pack.loadError = "Missing dependencies: ";
+            for (size_t i = 0; i < missing.size(); ++i)
+            {
+                if (i > 0) pack.loadError += ", ";
+                pack.loadError += missing[i];
+            }
+        }
+    }
+
+    return discovered;
+}
+
+std::vector<DiscoveredPack> MultiPackManager::scanPackDirectory(const std::string& directory)
 {
     std::vector<DiscoveredPack> discovered;
 
-    if (!fs::exists(directory)) return discovered;
+    std::error_code ec;
+    if (!fs::exists(directory, ec)) return discovered;
 
-    for (const auto& entry : fs::recursive_directory_iterator(directory))
+    for (const auto& entry : fs::recursive_directory_iterator(directory, ec))
     {
         if (!entry.is_regular_file()) continue;
 
@@ -310,18 +555,6 @@ std::vector<DiscoveredPack> MultiPackManager::discoverPacks(const std::string& d
             {
                 pack.info = readPackManifest(pack.path);
                 pack.canLoad = true;
-
-                // Check dependencies
-                auto missing = getMissingDependencies(pack.info);
-                if (!missing.empty())
-                {
-                    pack.loadError = "Missing dependencies: ";
-                    for (size_t i = 0; i < missing.size(); ++i)
-                    {
-                        if (i > 0) pack.loadError += ", ";
-                        pack.loadError += missing[i];
-                    }
-                }
             }
             catch (const std::exception& e)
             {
@@ -440,43 +673,175 @@ bool MultiPackManager::isPackEnabled(const std::string& packId) const
 
 Result<std::vector<u8>> MultiPackManager::readResource(const std::string& resourceId)
 {
-    auto it = m_resourceIndex.find(resourceId);
-    if (it == m_resourceIndex.end())
+    return readLookup(VFS::ResourceId::hashOf(resourceId), resourceId);
+}
+
+Result<std::vector<u8>> MultiPackManager::readResource(const VFS::ResourceId& resourceId)
+{
+    return readLookup(resourceId.hash(), resourceId.id());
+}
+
+Result<std::vector<u8>> MultiPackManager::readResource(const std::string& resourceId, f32 zoom)
+{
+    return readLookup(VFS::ResourceId::hashOf(resourceId), resourceId, zoom);
+}
+
+void MultiPackManager::readResources(const std::vector<std::string>& resourceIds,
+                                     const BatchReadCallback& onRead)
+{
+    // Winning pack -> the ids it provides, in first-seen order
+    std::vector<std::pair<const LoadedPack*, std::vector<std::string>>> groups;
+    // Variant id -> requested id, so results are reported under the id asked for
+    std::unordered_map<std::string, std::string> variantOf;
+    for (const auto& requestedId : resourceIds)
+    {
+        const IndexedResource* resource =
+            m_resourceIndex.find(VFS::ResourceId::hashOf(requestedId), requestedId);
+        if (!resource)
+        {
+            onRead(requestedId, Result<std::vector<u8>>::error("Resource not found: " + requestedId));
+            continue;
+        }
+
+        std::string resourceId = requestedId;
+        std::string variantId;
+        if (const IndexedResource* variant = findVariant(*resource, requestedId, 1.0f, variantId))
+        {
+            resource = variant;
+            resourceId = variantId;
+            variantOf.emplace(variantId, requestedId);
+        }
+
+        // Deltas need their base applied, so they are read individually
+        if (resource->handle.isDelta())
+        {
+            onRead(requestedId, readIndexed(*resource, resourceId));
+            continue;
+        }
+
+        auto it = std::find_if(groups.begin(), groups.end(),
+                               [resource](const auto& group) { return group.first == resource->pack; });
+        if (it == groups.end())
+        {
+            it = groups.insert(groups.end(), {resource->pack, {}});
+        }
+        it->second.push_back(resourceId);
+    }
+
+    const BatchReadCallback renamed = [&](const std::string& resourceId,
+                                          Result<std::vector<u8>> data) {
+        auto it = variantOf.find(resourceId);
+        onRead(it != variantOf.end() ? it->second : resourceId, std::move(data));
+    };
+    for (const auto& [pack, ids] : groups)
+    {
+        pack->reader->readFiles(ids, variantOf.empty() ? onRead : renamed);
+    }
+}
+
+Result<std::vector<u8>> MultiPackManager::readLookup(u64 hash, const std::string& resourceId,
+                                                     f32 zoom)
+{
+    const IndexedResource* resource = m_resourceIndex.find(hash, resourceId);
+    if (!resource)
     {
         return Result<std::vector<u8>>::error("Resource not found: " + resourceId);
     }
 
-    auto& pack = m_packs[it->second];
-    if (!pack->info.enabled)
+    std::string variantId;
+    if (const IndexedResource* variant = findVariant(*resource, resourceId, zoom, variantId))
+    {
+        return readIndexed(*variant, variantId);
+    }
+    return readIndexed(*resource, resourceId);
+}
+
+const MultiPackManager::IndexedResource* MultiPackManager::findVariant(
+    const IndexedResource& original, const std::string& resourceId, f32 zoom,
+    std::string& variantId) const
+{
+    if (m_outputScale >= 1.0f ||
+        static_cast<ResourceType>(original.handle.entry->type) != ResourceType::Texture)
     {
-        return Result<std::vector<u8>>::error("Pack is disabled: " + pack->info.id);
+        return nullptr;
     }
 
-    return pack->reader->readFile(resourceId);
+    const f32 shotZoom = m_upgradeOnZoom ? std::max(1.0f, zoom) : 1.0f;
+    const u32 divisor = ResourceVariants::divisorForScale(m_outputScale * shotZoom);
+    for (auto it = std::rbegin(RESOURCE_VARIANT_DIVISORS); it != std::rend(RESOURCE_VARIANT_DIVISORS);
+         ++it)
+    {
+        if (*it > divisor)
+        {
+            continue;
+        }
+        std::string id = ResourceVariants::variantId(resourceId, *it);
+        const IndexedResource* variant = m_resourceIndex.find(VFS::ResourceId::hashOf(id), id);
+        if (variant && variant->pack == original.pack)
+        {
+            variantId = std::move(id);
+            return variant;
+        }
+    }
+    return nullptr;
+}
+
+void MultiPackManager::setOutputResolution(u32 outputWidth, u32 outputHeight, u32 authoredWidth,
+                                           u32 authoredHeight)
+{
+    if (authoredWidth == 0 || authoredHeight == 0)
+    {
+        m_outputScale = 1.0f;
+        return;
+    }
+
+    // The larger ratio, so the variant is never softer than the output on either axis
+    const f32 scaleX = static_cast<f32>(outputWidth) / static_cast<f32>(authoredWidth);
+    const f32 scaleY = static_cast<f32>(outputHeight) / static_cast<f32>(authoredHeight);
+    m_outputScale = std::max(scaleX, scaleY);
+}
+
+std::string MultiPackManager::resolveVariant(const std::string& resourceId, f32 zoom) const
+{
+    const IndexedResource* resource =
+        m_resourceIndex.find(VFS::ResourceId::hashOf(resourceId), resourceId);
+    std::string variantId;
+    if (resource && findVariant(*resource, resourceId, zoom, variantId))
+    {
+        return variantId;
+    }
+    return resourceId;
 }
 
 bool MultiPackManager::exists(const std::string& resourceId) const
 {
-    return m_resourceIndex.find(resourceId) != m_resourceIndex.end();
+    return m_resourceIndex.find(VFS::ResourceId::hashOf(resourceId), resourceId) != nullptr;
+}
+
+bool MultiPackManager::exists(const VFS::ResourceId& resourceId) const
+{
+    return m_resourceIndex.find(resourceId.hash(), resourceId.id()) != nullptr;
 }
 
 std::optional<ResourceInfo> MultiPackManager::getResourceInfo(const std::string& resourceId) const
 {
-    auto it = m_resourceIndex.find(resourceId);
-    if (it == m_resourceIndex.end())
+    const IndexedResource* resource =
+        m_resourceIndex.find(VFS::ResourceId::hashOf(resourceId), resourceId);
+    if (!resource)
     {
         return std::nullopt;
     }
 
-    return m_packs[it->second]->reader->getInfo(resourceId);
+    return resource->pack->reader->getInfo(resourceId);
 }
 
 std::string MultiPackManager::getResourcePack(const std::string& resourceId) const
 {
-    auto it = m_resourceIndex.find(resourceId);
-    if (it != m_resourceIndex.end())
+    const IndexedResource* resource =
+        m_resourceIndex.find(VFS::ResourceId::hashOf(resourceId), resourceId);
+    if (resource)
     {
-        return m_packs[it->second]->info.id;
+        return resource->pack->info.id;
     }
     return "";
 }
@@ -484,22 +849,22 @@ std::string MultiPackManager::getResourcePack(const std::string& resourceId) con
 std::vector<std::string> MultiPackManager::listResources(ResourceType type) const
 {
     std::vector<std::string> result;
+    result.reserve(m_resourceIndex.size());
 
-    for (const auto& [resourceId, packIndex] : m_resourceIndex)
-    {
-        if (type == ResourceType::Unknown)
+    // Variants are part of their logical resource and are not listed
+    m_resourceIndex.forEach([&](const std::string& resourceId, const IndexedResource& resource) {
+        std::string_view logicalId;
+        u32 divisor = 1;
+        if (ResourceVariants::parseVariantId(resourceId, logicalId, divisor))
         {
-            result.push_back(resourceId);
+            return;
         }
-        else
+        if (type == ResourceType::Unknown ||
+            static_cast<ResourceType>(resource.handle.entry->type) == type)
         {
-            auto info = m_packs[packIndex]->reader->getInfo(resourceId);
-            if (info && info->type == type)
-            {
-                result.push_back(resourceId);
-            }
+            result.push_back(resourceId);
         }
-    }
+    });
 
     return result;
 }
@@ -562,7 +927,24 @@ Result<std::vector<u8>> MultiPackManager::readResourceFromPack(const std::string
         return Result<std::vector<u8>>::error("Pack not found: " + packId);
     }
 
-    return m_packs[it->second]->reader->readFile(resourceId);
+    const LoadedPack* pack = m_packs[it->second].get();
+    const auto handle = pack->reader->findResource(resourceId);
+    if (!handle)
+    {
+        return Result<std::vector<u8>>::error("Resource not found: " + resourceId);
+    }
+
+    return readIndexed({pack, handle}, resourceId);
+}
+
+void MultiPackManager::setDeltaCacheSize(usize bytes)
+{
+    m_deltaCache.setMaxSize(bytes);
+}
+
+usize MultiPackManager::getDeltaCacheUsage() const
+{
+    return m_deltaCache.currentSize();
 }
 
 // =========================================================================
@@ -806,36 +1188,162 @@ PackInfo MultiPackManager::readPackManifest(const std::string& path)
 
 void MultiPackManager::rebuildResourceIndex()
 {
+    updatePriorityOrder();
     m_resourceIndex.clear();
+    m_deltaCache.clear(); // Delta bases may have changed
 
-    // Sort packs by effective priority (descending for override)
-    std::vector<std::pair<size_t, i32>> sorted;
-    for (size_t i = 0; i < m_packs.size(); ++i)
+    usize total = 0;
+    for (const LoadedPack* pack : m_priorityOrder)
+    {
+        total += pack->resources.size();
+    }
+    m_resourceIndex.reserve(total);
+
+    for (const LoadedPack* pack : m_priorityOrder)
+    {
+        indexPack(*pack);
+    }
+}
+
+bool MultiPackManager::outranks(const LoadedPack& a, const LoadedPack& b) const
+{
+    if (a.effectivePriority != b.effectivePriority)
     {
-        if (m_packs[i]->info.enabled)
+        return a.effectivePriority > b.effectivePriority;
+    }
+    return a.loadSequence < b.loadSequence;
+}
+
+void MultiPackManager::updatePriorityOrder()
+{
+    m_priorityOrder.clear();
+    for (const auto& pack : m_packs)
+    {
+        if (pack->info.enabled)
         {
-            sorted.emplace_back(i, m_packs[i]->effectivePriority);
+            m_priorityOrder.push_back(pack.get());
         }
     }
 
-    std::sort(sorted.begin(), sorted.end(),
-              [](const auto& a, const auto& b) {
-                  return a.second > b.second; // Higher priority first
-              });
+    std::sort(m_priorityOrder.begin(), m_priorityOrder.end(),
+              [this](const LoadedPack* a, const LoadedPack* b) { return outranks(*a, *b); });
+}
 
-    // Build index (first occurrence wins due to descending sort)
-    for (const auto& [idx, priority] : sorted)
+void MultiPackManager::indexPack(const LoadedPack& pack)
+{
+    m_resourceIndex.reserve(m_resourceIndex.size() + pack.resources.size());
+
+    for (const auto& resource : pack.resources)
+    {
+        const IndexedResource* current = m_resourceIndex.find(resource.hash, *resource.id);
+        if (!current || outranks(pack, *current->pack))
+        {
+            m_resourceIndex.assign(resource.hash, resource.id, {&pack, resource.handle});
+        }
+    }
+}
+
+void MultiPackManager::unindexPack(const LoadedPack& pack)
+{
+    // Expects the pack to be already removed from m_priorityOrder
+    for (const auto& resource : pack.resources)
     {
-        for (const auto& resourceId : m_packs[idx]->providedResources)
+        const IndexedResource* current = m_resourceIndex.find(resource.hash, *resource.id);
+        if (!current || current->pack != &pack)
         {
-            if (m_resourceIndex.find(resourceId) == m_resourceIndex.end())
+            continue;
+        }
+
+        bool replaced = false;
+        for (const LoadedPack* candidate : m_priorityOrder)
+        {
+            auto it = candidate->providedResources.find(*resource.id);
+            if (it != candidate->providedResources.end())
             {
-                m_resourceIndex[resourceId] = idx;
+                m_resourceIndex.assign(resource.hash, &*it,
+                                       {candidate, candidate->reader->findResource(*it)});
+                replaced = true;
+                break;
             }
         }
+
+        if (!replaced)
+        {
+            m_resourceIndex.erase(resource.hash, *resource.id);
+        }
     }
 }
 
+Result<std::vector<u8>> MultiPackManager::readIndexed(const IndexedResource& resource,
+                                                      const std::string& resourceId)
+{
+    const LoadedPack* pack = resource.pack;
+    if (!resource.handle.isDelta())
+    {
+        return pack->reader->readResource(resource.handle);
+    }
+
+    const VFS::ResourceId cacheKey(pack->info.id + ":" + resourceId);
+    if (auto cached = m_deltaCache.get(cacheKey))
+    {
+        return Result<std::vector<u8>>::ok(std::move(*cached));
+    }
+
+    const LoadedPack* base = findDeltaBase(pack, resourceId);
+    if (!base)
+    {
+        return Result<std::vector<u8>>::error("No base pack provides delta resource: " +
+                                              resourceId);
+    }
+
+    auto delta = pack->reader->readResource(resource.handle);
+    if (delta.isError())
+    {
+        return delta;
+    }
+    auto baseData = readIndexed({base, base->reader->findResource(resourceId)}, resourceId);
+    if (baseData.isError())
+    {
+        return baseData;
+    }
+
+    auto result = BinaryDelta::apply(baseData.value(), delta.value());
+    if (result.isOk())
+    {
+        m_deltaCache.put(cacheKey, result.value());
+    }
+    return result;
+}
+
+const MultiPackManager::LoadedPack* MultiPackManager::findDeltaBase(
+    const LoadedPack* pack, const std::string& resourceId) const
+{
+    // The next enabled pack below this one that provides the resource
+    for (const LoadedPack* candidate : m_priorityOrder)
+    {
+        if (candidate != pack && outranks(*pack, *candidate) &&
+            candidate->providedResources.count(resourceId) != 0)
+        {
+            return candidate;
+        }
+    }
+    return nullptr;
+}
+
+bool MultiPackManager::resolveExternalChunk(const LoadedPack* requester,
+                                            const ChunkDigest& digest, u8* out, u32 size) const
+{
+    for (const LoadedPack* pack : m_priorityOrder)
+    {
+        // The requester does not store the chunk itself
+        if (pack != requester && pack->reader->readChunk(digest, out, size))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 i32 MultiPackManager::calculateEffectivePriority(PackType type, i32 basePriority) const
 {
     i32 typeBase = 0;
@@ -1,10 +1,23 @@
 #include "NovelMind/vfs/pack_reader.hpp"
 #include "NovelMind/core/logger.hpp"
+#include "NovelMind/vfs/pack_security.hpp"
 #include <cstring>
 
 namespace NovelMind::vfs
 {
 
+namespace
+{
+
+// Whether size bytes at offset into the data section lie inside the file
+bool fitsInFile(u64 fileSize, u64 dataOffset, u64 offset, u64 size)
+{
+    return dataOffset <= fileSize && offset <= fileSize - dataOffset &&
+           size <= fileSize - dataOffset - offset;
+}
+
+} // namespace
+
 PackReader::~PackReader()
 {
     unmountAll();
@@ -12,21 +25,27 @@ PackReader::~PackReader()
 
 Result<void> PackReader::mount(const std::string& packPath)
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
-
-    if (m_packs.find(packPath) != m_packs.end())
     {
-        return Result<void>::error("Pack already mounted: " + packPath);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_packs.find(packPath) != m_packs.end())
+        {
+            return Result<void>::error("Pack already mounted: " + packPath);
+        }
     }
 
-    std::ifstream file(packPath, std::ios::binary);
+    // Tables are parsed without holding the lock, so reads from packs that
+    // are already mounted are not blocked by a slow mount
+    std::ifstream file(packPath, std::ios::binary | std::ios::ate);
     if (!file.is_open())
     {
         return Result<void>::error("Failed to open pack file: " + packPath);
     }
+    const u64 fileSize = static_cast<u64>(file.tellg());
+    file.seekg(0);
 
     MountedPack pack;
     pack.path = packPath;
+    pack.fileSize = fileSize;
 
     auto headerResult = readPackHeader(file, pack.header);
     if (headerResult.isError())
@@ -34,19 +53,44 @@ Result<void> PackReader::mount(const std::string& packPath)
         return headerResult;
     }
 
-    auto tableResult = readResourceTable(file, pack);
+    if (pack.header.flags & static_cast<u32>(PackFlags::Chunked))
+    {
+        auto chunkResult = readChunkTable(file, pack, fileSize);
+        if (chunkResult.isError())
+        {
+            return chunkResult;
+        }
+    }
+
+    std::vector<PackResourceEntry> entries;
+    auto tableResult = readResourceTable(file, pack.header, entries, fileSize);
     if (tableResult.isError())
     {
         return tableResult;
     }
 
-    auto stringResult = readStringTable(file, pack);
+    auto stringResult = readStringTable(file, pack, fileSize);
     if (stringResult.isError())
     {
         return stringResult;
     }
 
-    m_packs[packPath] = std::move(pack);
+    pack.entries.reserve(entries.size());
+    for (const auto& entry : entries)
+    {
+        if (entry.idStringOffset < pack.stringTable.size())
+        {
+            pack.entries[pack.stringTable[entry.idStringOffset]] = entry;
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_packs.emplace(packPath, std::move(pack)).second)
+        {
+            return Result<void>::error("Pack already mounted: " + packPath);
+        }
+    }
     NOVELMIND_LOG_INFO("Mounted pack: " + packPath);
 
     return Result<void>::ok();
@@ -68,18 +112,230 @@ void PackReader::unmountAll()
 
 Result<std::vector<u8>> PackReader::readFile(const std::string& resourceId) const
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
+    // The read itself happens after the lock is released: an external chunk
+    // resolver may call into another reader, which must not wait on this one
+    Result<ResourceRead> read = Result<ResourceRead>::error("Resource not found: " + resourceId);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const auto& [packPath, pack] : m_packs)
+        {
+            auto it = pack.entries.find(resourceId);
+            if (it != pack.entries.end())
+            {
+                read = planResourceRead(pack, it->second);
+                break;
+            }
+        }
+    }
 
-    for (const auto& [packPath, pack] : m_packs)
+    if (read.isError())
     {
-        auto it = pack.entries.find(resourceId);
-        if (it != pack.entries.end())
+        return Result<std::vector<u8>>::error(read.error());
+    }
+    return readResourceData(read.value());
+}
+
+void PackReader::readFiles(const std::vector<std::string>& resourceIds,
+                           const BatchReadCallback& onRead) const
+{
+    struct ExternalChunk
+    {
+        ChunkDigest digest;
+        u64 position;
+        u32 size;
+    };
+
+    struct Request
+    {
+        std::vector<u8> data;
+        usize remaining = 0;    // Segments still to be read
+        bool failed = false;
+        bool chunked = false;
+        u32 checksum = 0;
+        std::vector<ExternalChunk> externals;
+        std::string error;
+    };
+
+    struct PackBatch
+    {
+        std::string path;
+        std::vector<ReadSegment> segments;
+    };
+
+    std::vector<Request> requests(resourceIds.size());
+    std::vector<PackBatch> batches;
+    ChunkResolver resolver;
+    CoalesceOptions options;
+
+    // Plan every read under the lock, then do the I/O without it
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        resolver = m_chunkResolver;
+        options = m_coalesceOptions;
+
+        std::unordered_map<const MountedPack*, usize> batchIndex;
+        std::vector<ReadSegment> segments;
+        for (usize i = 0; i < resourceIds.size(); ++i)
         {
-            return readResourceData(packPath, it->second);
+            Request& request = requests[i];
+            const MountedPack* pack = nullptr;
+            const PackResourceEntry* entry = nullptr;
+            for (const auto& [packPath, mounted] : m_packs)
+            {
+                auto it = mounted.entries.find(resourceIds[i]);
+                if (it != mounted.entries.end())
+                {
+                    pack = &mounted;
+                    entry = &it->second;
+                    break;
+                }
+            }
+            if (!entry)
+            {
+                request.error = "Resource not found: " + resourceIds[i];
+                continue;
+            }
+
+            const u32 tag = static_cast<u32>(i);
+            segments.clear();
+            request.checksum = entry->checksum;
+            request.chunked = (entry->flags & static_cast<u32>(PackResourceFlags::Chunked)) != 0;
+
+            if (!request.chunked)
+            {
+                if (!fitsInFile(pack->fileSize, pack->header.dataOffset, entry->dataOffset,
+                                entry->compressedSize))
+                {
+                    request.error = "Corrupt resource entry";
+                    continue;
+                }
+                request.data.resize(static_cast<usize>(entry->compressedSize));
+                if (!request.data.empty())
+                {
+                    segments.push_back({pack->header.dataOffset + entry->dataOffset,
+                                        entry->compressedSize, request.data.data(), tag});
+                }
+            }
+            else
+            {
+                const u64 firstRef = entry->dataOffset;
+                const u64 refCount = entry->compressedSize;
+                if (firstRef > pack->chunkRefs.size() || refCount > pack->chunkRefs.size() - firstRef)
+                {
+                    request.error = "Corrupt chunked resource entry";
+                    continue;
+                }
+
+                // The chunks decide the size; the entry's is only checked against them
+                u64 total = 0;
+                for (u64 r = firstRef; r < firstRef + refCount; ++r)
+                {
+                    total += pack->chunks[pack->chunkRefs[static_cast<usize>(r)]].size;
+                }
+                if (total != entry->uncompressedSize)
+                {
+                    request.error = total > entry->uncompressedSize
+                                        ? "Chunk list exceeds resource size"
+                                        : "Chunk list does not cover resource";
+                    continue;
+                }
+
+                request.data.resize(static_cast<usize>(total));
+                u64 position = 0;
+                for (u64 r = firstRef; r < firstRef + refCount; ++r)
+                {
+                    const PackChunkEntry& chunk =
+                        pack->chunks[pack->chunkRefs[static_cast<usize>(r)]];
+                    if (chunk.flags & static_cast<u32>(PackChunkFlags::External))
+                    {
+                        request.externals.push_back({chunk.digest, position, chunk.size});
+                    }
+                    else
+                    {
+                        segments.push_back({pack->header.dataOffset + chunk.dataOffset, chunk.size,
+                                            request.data.data() + position, tag});
+                    }
+                    position += chunk.size;
+                }
+            }
+
+            if (segments.empty())
+            {
+                continue;
+            }
+            auto [it, inserted] = batchIndex.emplace(pack, batches.size());
+            if (inserted)
+            {
+                batches.push_back({pack->path, {}});
+            }
+            auto& batch = batches[it->second].segments;
+            batch.insert(batch.end(), segments.begin(), segments.end());
+            request.remaining = segments.size();
         }
     }
 
-    return Result<std::vector<u8>>::error("Resource not found: " + resourceId);
+    auto finish = [&](usize i) {
+        Request& request = requests[i];
+        if (request.failed)
+        {
+            onRead(resourceIds[i], Result<std::vector<u8>>::error("Failed to read resource data"));
+            return;
+        }
+
+        for (const ExternalChunk& chunk : request.externals)
+        {
+            if (!resolver || !resolver(chunk.digest, request.data.data() + chunk.position,
+                                       chunk.size))
+            {
+                onRead(resourceIds[i], Result<std::vector<u8>>::error(
+                                           "External chunk not available in any mounted pack"));
+                return;
+            }
+        }
+
+        if (request.chunked &&
+            VFS::PackIntegrityChecker::calculateCrc32(request.data.data(), request.data.size()) !=
+                request.checksum)
+        {
+            onRead(resourceIds[i],
+                   Result<std::vector<u8>>::error("Chunked resource checksum mismatch"));
+            return;
+        }
+
+        onRead(resourceIds[i], Result<std::vector<u8>>::ok(std::move(request.data)));
+    };
+
+    // Failures and resources with nothing to read locally complete up front
+    for (usize i = 0; i < requests.size(); ++i)
+    {
+        if (!requests[i].error.empty())
+        {
+            onRead(resourceIds[i], Result<std::vector<u8>>::error(requests[i].error));
+        }
+        else if (requests[i].remaining == 0)
+        {
+            finish(i);
+        }
+    }
+
+    for (PackBatch& batch : batches)
+    {
+        CoalescedReader::read(batch.path, batch.segments, options,
+                              [&](const ReadSegment& segment, bool ok) {
+                                  Request& request = requests[segment.tag];
+                                  request.failed = request.failed || !ok;
+                                  if (--request.remaining == 0)
+                                  {
+                                      finish(segment.tag);
+                                  }
+                              });
+    }
+}
+
+void PackReader::setCoalesceOptions(const CoalesceOptions& options)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_coalesceOptions = options;
 }
 
 bool PackReader::exists(const std::string& resourceId) const
@@ -139,6 +395,120 @@ std::vector<std::string> PackReader::listResources(ResourceType type) const
     return result;
 }
 
+PackReader::ResourceHandle PackReader::findResource(const std::string& resourceId) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (const auto& [packPath, pack] : m_packs)
+    {
+        auto it = pack.entries.find(resourceId);
+        if (it != pack.entries.end())
+        {
+            return {&pack, &it->second};
+        }
+    }
+
+    return {};
+}
+
+void PackReader::forEachResource(
+    const std::function<void(const std::string& resourceId, ResourceHandle handle)>& fn) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (const auto& [packPath, pack] : m_packs)
+    {
+        for (const auto& [id, entry] : pack.entries)
+        {
+            fn(id, ResourceHandle{&pack, &entry});
+        }
+    }
+}
+
+Result<std::vector<u8>> PackReader::readResource(ResourceHandle handle) const
+{
+    if (!handle)
+    {
+        return Result<std::vector<u8>>::error("Invalid resource handle");
+    }
+
+    Result<ResourceRead> read = [&] {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return planResourceRead(*static_cast<const MountedPack*>(handle.pack), *handle.entry);
+    }();
+
+    if (read.isError())
+    {
+        return Result<std::vector<u8>>::error(read.error());
+    }
+    return readResourceData(read.value());
+}
+
+bool PackReader::isDeltaResource(const std::string& resourceId) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (const auto& [packPath, pack] : m_packs)
+    {
+        auto it = pack.entries.find(resourceId);
+        if (it != pack.entries.end())
+        {
+            return (it->second.flags & static_cast<u32>(PackResourceFlags::Delta)) != 0;
+        }
+    }
+
+    return false;
+}
+
+void PackReader::setExternalChunkResolver(ChunkResolver resolver)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_chunkResolver = std::move(resolver);
+}
+
+bool PackReader::readChunk(const ChunkDigest& digest, u8* out, u32 size) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (const auto& [packPath, pack] : m_packs)
+    {
+        auto it = pack.localChunks.find(digest);
+        if (it == pack.localChunks.end() || pack.chunks[it->second].size != size)
+        {
+            continue;
+        }
+
+        // One stream per pack, kept open across calls; the lock serializes its use
+        std::ifstream& file = pack.chunkStream;
+        if (!file.is_open())
+        {
+            file.open(packPath, std::ios::binary);
+        }
+        file.clear();
+        file.seekg(static_cast<std::streamoff>(pack.header.dataOffset +
+                                               pack.chunks[it->second].dataOffset));
+        file.read(reinterpret_cast<char*>(out), static_cast<std::streamsize>(size));
+        return static_cast<bool>(file);
+    }
+
+    return false;
+}
+
+std::vector<ChunkDigest> PackReader::getChunkDigests() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::vector<ChunkDigest> result;
+    for (const auto& [packPath, pack] : m_packs)
+    {
+        for (const auto& [digest, index] : pack.localChunks)
+        {
+            result.push_back(digest);
+        }
+    }
+    return result;
+}
+
 Result<void> PackReader::readPackHeader(std::ifstream& file, PackHeader& header)
 {
     file.read(reinterpret_cast<char*>(&header), sizeof(PackHeader));
@@ -161,115 +531,265 @@ Result<void> PackReader::readPackHeader(std::ifstream& file, PackHeader& header)
     return Result<void>::ok();
 }
 
-Result<void> PackReader::readResourceTable(std::ifstream& file, MountedPack& pack)
+Result<void> PackReader::readResourceTable(std::ifstream& file, const PackHeader& header,
+                                           std::vector<PackResourceEntry>& entries, u64 fileSize)
 {
-    file.seekg(static_cast<std::streamoff>(pack.header.resourceTableOffset));
+    // The count comes from the file, so the table must fit in it before it is allocated
+    if (header.resourceTableOffset > fileSize ||
+        header.resourceCount > (fileSize - header.resourceTableOffset) / sizeof(PackResourceEntry))
+    {
+        return Result<void>::error("Corrupt resource table");
+    }
+
+    file.seekg(static_cast<std::streamoff>(header.resourceTableOffset));
 
     if (!file)
     {
         return Result<void>::error("Failed to seek to resource table");
     }
 
-    for (u32 i = 0; i < pack.header.resourceCount; ++i)
-    {
-        PackResourceEntry entry;
-        file.read(reinterpret_cast<char*>(&entry), sizeof(PackResourceEntry));
-
-        if (!file)
-        {
-            return Result<void>::error("Failed to read resource entry");
-        }
+    // The whole table in one read; entry ids are resolved once the string table is in
+    entries.resize(header.resourceCount);
+    file.read(reinterpret_cast<char*>(entries.data()),
+              static_cast<std::streamsize>(entries.size() * sizeof(PackResourceEntry)));
 
-        // Entry ID will be resolved after reading string table
-        pack.entries[std::to_string(i)] = entry;
+    if (!file)
+    {
+        return Result<void>::error("Failed to read resource table");
     }
 
     return Result<void>::ok();
 }
 
-Result<void> PackReader::readStringTable(std::ifstream& file, MountedPack& pack)
+Result<void> PackReader::readStringTable(std::ifstream& file, MountedPack& pack, u64 fileSize)
 {
-    file.seekg(static_cast<std::streamoff>(pack.header.stringTableOffset));
+    const u64 start = pack.header.stringTableOffset;
 
-    if (!file)
+    // The table runs up to the next section that follows it
+    u64 end = fileSize;
+    const u64 sections[] = {pack.header.resourceTableOffset, pack.header.dataOffset,
+                            pack.chunkTable.chunkTableOffset, pack.chunkTable.refTableOffset};
+    for (u64 offset : sections)
     {
-        return Result<void>::error("Failed to seek to string table");
+        if (offset > start && offset < end)
+        {
+            end = offset;
+        }
     }
 
-    u32 stringCount = 0;
-    file.read(reinterpret_cast<char*>(&stringCount), sizeof(u32));
-
-    if (!file)
+    if (end < start + sizeof(u32))
     {
         return Result<void>::error("Failed to read string count");
     }
 
-    // Read string offsets
-    std::vector<u32> offsets(stringCount);
-    file.read(reinterpret_cast<char*>(offsets.data()),
-              static_cast<std::streamsize>(stringCount * sizeof(u32)));
+    std::vector<char> buffer(static_cast<usize>(end - start));
+    file.seekg(static_cast<std::streamoff>(start));
+    file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
 
     if (!file)
+    {
+        return Result<void>::error("Failed to read string table");
+    }
+
+    u32 stringCount = 0;
+    std::memcpy(&stringCount, buffer.data(), sizeof(u32));
+    const usize dataStart = sizeof(u32) + static_cast<usize>(stringCount) * sizeof(u32);
+    if (dataStart > buffer.size())
     {
         return Result<void>::error("Failed to read string offsets");
     }
 
-    // Read string data
-    auto stringDataStart = file.tellg();
+    const char* data = buffer.data() + dataStart;
+    const usize dataSize = buffer.size() - dataStart;
     pack.stringTable.reserve(stringCount);
 
     for (u32 i = 0; i < stringCount; ++i)
     {
-        file.seekg(stringDataStart + static_cast<std::streamoff>(offsets[i]));
-        std::string str;
-        std::getline(file, str, '\0');
-        pack.stringTable.push_back(str);
+        u32 offset = 0;
+        std::memcpy(&offset, buffer.data() + sizeof(u32) + i * sizeof(u32), sizeof(u32));
+        if (offset > dataSize)
+        {
+            return Result<void>::error("Corrupt string table offset");
+        }
+
+        const char* str = data + offset;
+        const void* terminator = std::memchr(str, '\0', dataSize - offset);
+        const usize length = terminator ? static_cast<usize>(static_cast<const char*>(terminator) - str)
+                                        : dataSize - offset;
+        pack.stringTable.emplace_back(str, length);
+    }
+
+    return Result<void>::ok();
+}
+
+Result<void> PackReader::readChunkTable(std::ifstream& file, MountedPack& pack, u64 fileSize)
+{
+    PackChunkTableHeader& table = pack.chunkTable;
+    file.seekg(static_cast<std::streamoff>(sizeof(PackHeader)));
+    file.read(reinterpret_cast<char*>(&table), sizeof(PackChunkTableHeader));
+
+    if (!file)
+    {
+        return Result<void>::error("Failed to read chunk table header");
     }
 
-    // Re-map entries with actual string IDs
-    std::unordered_map<std::string, PackResourceEntry> newEntries;
-    u32 index = 0;
-    for (auto& [key, entry] : pack.entries)
+    // Both tables must fit in the file before anything is allocated for them
+    auto fits = [fileSize](u64 offset, u64 count, u64 entrySize) {
+        return offset <= fileSize && count <= (fileSize - offset) / entrySize;
+    };
+    if (!fits(table.chunkTableOffset, table.chunkCount, sizeof(PackChunkEntry)) ||
+        !fits(table.refTableOffset, table.refCount, sizeof(u32)))
     {
-        if (entry.idStringOffset < pack.stringTable.size())
+        return Result<void>::error("Corrupt chunk table");
+    }
+
+    pack.chunks.resize(table.chunkCount);
+    file.seekg(static_cast<std::streamoff>(table.chunkTableOffset));
+    file.read(reinterpret_cast<char*>(pack.chunks.data()),
+              static_cast<std::streamsize>(pack.chunks.size() * sizeof(PackChunkEntry)));
+
+    pack.chunkRefs.resize(table.refCount);
+    file.seekg(static_cast<std::streamoff>(table.refTableOffset));
+    file.read(reinterpret_cast<char*>(pack.chunkRefs.data()),
+              static_cast<std::streamsize>(pack.chunkRefs.size() * sizeof(u32)));
+
+    if (!file)
+    {
+        return Result<void>::error("Failed to read chunk table");
+    }
+
+    for (u32 ref : pack.chunkRefs)
+    {
+        if (ref >= table.chunkCount)
+        {
+            return Result<void>::error("Corrupt chunk reference table");
+        }
+    }
+
+    for (u32 i = 0; i < table.chunkCount; ++i)
+    {
+        if (!(pack.chunks[i].flags & static_cast<u32>(PackChunkFlags::External)))
         {
-            const std::string& resourceId = pack.stringTable[entry.idStringOffset];
-            newEntries[resourceId] = entry;
+            pack.localChunks.emplace(pack.chunks[i].digest, i);
         }
-        ++index;
     }
-    pack.entries = std::move(newEntries);
 
     return Result<void>::ok();
 }
 
-Result<std::vector<u8>> PackReader::readResourceData(
-    const std::string& packPath,
+Result<PackReader::ResourceRead> PackReader::planResourceRead(
+    const MountedPack& pack,
     const PackResourceEntry& entry) const
 {
-    std::ifstream file(packPath, std::ios::binary);
+    ResourceRead read;
+    read.path = pack.path;
+    read.entry = entry;
+
+    if (!(entry.flags & static_cast<u32>(PackResourceFlags::Chunked)))
+    {
+        if (!fitsInFile(pack.fileSize, pack.header.dataOffset, entry.dataOffset,
+                        entry.compressedSize))
+        {
+            return Result<ResourceRead>::error("Corrupt resource entry");
+        }
+        read.dataOffset = pack.header.dataOffset + entry.dataOffset;
+        return Result<ResourceRead>::ok(std::move(read));
+    }
+
+    const u64 firstRef = entry.dataOffset;
+    const u64 refCount = entry.compressedSize;
+    if (firstRef > pack.chunkRefs.size() || refCount > pack.chunkRefs.size() - firstRef)
+    {
+        return Result<ResourceRead>::error("Corrupt chunked resource entry");
+    }
+
+    read.dataOffset = pack.header.dataOffset;
+    read.chunks.reserve(static_cast<usize>(refCount));
+    for (u64 r = firstRef; r < firstRef + refCount; ++r)
+    {
+        read.chunks.push_back(pack.chunks[pack.chunkRefs[static_cast<usize>(r)]]);
+    }
+    read.resolver = m_chunkResolver;
+    return Result<ResourceRead>::ok(std::move(read));
+}
+
+Result<std::vector<u8>> PackReader::readChunkedResource(std::ifstream& file,
+                                                        const ResourceRead& read)
+{
+    // The chunks decide the size; the entry's is only checked against them
+    u64 total = 0;
+    for (const PackChunkEntry& chunk : read.chunks)
+    {
+        total += chunk.size;
+    }
+    if (total > read.entry.uncompressedSize)
+    {
+        return Result<std::vector<u8>>::error("Chunk list exceeds resource size");
+    }
+    if (total < read.entry.uncompressedSize)
+    {
+        return Result<std::vector<u8>>::error("Chunk list does not cover resource");
+    }
+
+    // Chunks are read straight into the output buffer, so a single-chunk
+    // resource costs exactly one read and no intermediate copy
+    std::vector<u8> data(static_cast<usize>(total));
+    u64 position = 0;
+    for (const PackChunkEntry& chunk : read.chunks)
+    {
+        u8* dst = data.data() + position;
+        if (chunk.flags & static_cast<u32>(PackChunkFlags::External))
+        {
+            if (!read.resolver || !read.resolver(chunk.digest, dst, chunk.size))
+            {
+                return Result<std::vector<u8>>::error(
+                    "External chunk not available in any mounted pack");
+            }
+        }
+        else
+        {
+            file.seekg(static_cast<std::streamoff>(read.dataOffset + chunk.dataOffset));
+            file.read(reinterpret_cast<char*>(dst), static_cast<std::streamsize>(chunk.size));
+            if (!file)
+            {
+                return Result<std::vector<u8>>::error("Failed to read chunk data");
+            }
+        }
+        position += chunk.size;
+    }
+
+    // Chunks are shared by digest, so verify the reassembled content
+    if (VFS::PackIntegrityChecker::calculateCrc32(data.data(), data.size()) != read.entry.checksum)
+    {
+        return Result<std::vector<u8>>::error("Chunked resource checksum mismatch");
+    }
+
+    return Result<std::vector<u8>>::ok(std::move(data));
+}
+
+Result<std::vector<u8>> PackReader::readResourceData(const ResourceRead& read)
+{
+    std::ifstream file(read.path, std::ios::binary);
     if (!file.is_open())
     {
         return Result<std::vector<u8>>::error("Failed to open pack file");
     }
 
-    auto it = m_packs.find(packPath);
-    if (it == m_packs.end())
+    if (read.entry.flags & static_cast<u32>(PackResourceFlags::Chunked))
     {
-        return Result<std::vector<u8>>::error("Pack not mounted");
+        return readChunkedResource(file, read);
     }
 
-    u64 absoluteOffset = it->second.header.dataOffset + entry.dataOffset;
-    file.seekg(static_cast<std::streamoff>(absoluteOffset));
+    file.seekg(static_cast<std::streamoff>(read.dataOffset));
 
     if (!file)
     {
         return Result<std::vector<u8>>::error("Failed to seek to resource data");
     }
 
-    std::vector<u8> data(static_cast<usize>(entry.compressedSize));
+    std::vector<u8> data(static_cast<usize>(read.entry.compressedSize));
     file.read(reinterpret_cast<char*>(data.data()),
-              static_cast<std::streamsize>(entry.compressedSize));
+              static_cast<std::streamsize>(read.entry.compressedSize));
 
     if (!file)
     {
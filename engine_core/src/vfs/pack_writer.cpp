@@ -0,0 +1,204 @@
+#include "NovelMind/vfs/pack_writer.hpp"
+#include "NovelMind/vfs/pack_reader.hpp"
+#include "NovelMind/vfs/pack_security.hpp"
+#include <cstring>
+#include <fstream>
+
+namespace NovelMind::vfs
+{
+
+void PackWriter::addBaseChunks(const std::vector<ChunkDigest>& digests)
+{
+    m_baseChunks.insert(digests.begin(), digests.end());
+}
+
+void PackWriter::addResource(const std::string& id, ResourceType type, std::vector<u8> data)
+{
+    auto it = m_resourceIndex.find(id);
+    if (it != m_resourceIndex.end())
+    {
+        m_resources[it->second] = {id, type, std::move(data), 0};
+        return;
+    }
+
+    m_resourceIndex.emplace(id, m_resources.size());
+    m_resources.push_back({id, type, std::move(data), 0});
+}
+
+void PackWriter::addDeltaResource(const std::string& id, ResourceType type,
+                                  std::vector<u8> delta)
+{
+    addResource(id, type, std::move(delta));
+    m_resources[m_resourceIndex[id]].flags = static_cast<u32>(PackResourceFlags::Delta);
+}
+
+void PackWriter::clear()
+{
+    m_resources.clear();
+    m_resourceIndex.clear();
+    m_baseChunks.clear();
+}
+
+Result<PackWriteStats> PackWriter::write(const std::string& path) const
+{
+    PackWriteStats stats;
+    stats.resourceCount = m_resources.size();
+
+    // Plan the data section first so every offset is known before writing
+    struct StoredBlock
+    {
+        const u8* data;
+        u32 size;
+    };
+    std::vector<StoredBlock> blocks;
+    std::vector<PackResourceEntry> entries(m_resources.size());
+    std::vector<PackChunkEntry> chunks;
+    std::vector<u32> refs;
+    std::unordered_map<ChunkDigest, u32, ChunkDigestHash> chunkIds;
+    u64 dataSize = 0;
+
+    for (usize r = 0; r < m_resources.size(); ++r)
+    {
+        const PendingResource& resource = m_resources[r];
+        PackResourceEntry& entry = entries[r];
+        std::memset(&entry, 0, sizeof(entry));
+        entry.idStringOffset = static_cast<u32>(r);
+        entry.type = static_cast<u32>(resource.type);
+        entry.flags = resource.flags;
+        entry.uncompressedSize = resource.data.size();
+        entry.checksum =
+            VFS::PackIntegrityChecker::calculateCrc32(resource.data.data(), resource.data.size());
+        stats.inputBytes += resource.data.size();
+
+        if (!m_chunking)
+        {
+            if (resource.data.size() > 0xFFFFFFFFull)
+            {
+                return Result<PackWriteStats>::error("Resource too large: " + resource.id);
+            }
+            entry.dataOffset = dataSize;
+            entry.compressedSize = resource.data.size();
+            blocks.push_back({resource.data.data(), static_cast<u32>(resource.data.size())});
+            dataSize += resource.data.size();
+            continue;
+        }
+
+        entry.flags |= static_cast<u32>(PackResourceFlags::Chunked);
+        entry.dataOffset = refs.size();
+
+        for (const ChunkSpan& span :
+             ContentChunker::split(resource.data.data(), resource.data.size(), m_params))
+        {
+            const u8* chunkData = resource.data.data() + span.offset;
+            const ChunkDigest digest = ContentChunker::digest(chunkData, span.size);
+
+            auto it = chunkIds.find(digest);
+            if (it != chunkIds.end())
+            {
+                stats.dedupedBytes += span.size;
+                refs.push_back(it->second);
+                continue;
+            }
+
+            PackChunkEntry chunk{};
+            chunk.digest = digest;
+            chunk.size = span.size;
+            if (m_baseChunks.count(digest) != 0)
+            {
+                chunk.flags = static_cast<u32>(PackChunkFlags::External);
+                stats.dedupedBytes += span.size;
+                ++stats.externalChunkCount;
+            }
+            else
+            {
+                chunk.dataOffset = dataSize;
+                blocks.push_back({chunkData, span.size});
+                dataSize += span.size;
+            }
+
+            const u32 index = static_cast<u32>(chunks.size());
+            chunkIds.emplace(digest, index);
+            chunks.push_back(chunk);
+            refs.push_back(index);
+        }
+
+        entry.compressedSize = refs.size() - entry.dataOffset;
+    }
+
+    stats.chunkCount = chunks.size();
+    stats.storedBytes = dataSize;
+
+    // String table: count, offsets, then NUL-terminated ids
+    std::vector<u32> stringOffsets;
+    std::string stringData;
+    stringOffsets.reserve(m_resources.size());
+    for (const auto& resource : m_resources)
+    {
+        stringOffsets.push_back(static_cast<u32>(stringData.size()));
+        stringData += resource.id;
+        stringData.push_back('\0');
+    }
+
+    PackHeader header{};
+    header.magic = PACK_MAGIC;
+    header.versionMajor = PACK_VERSION_MAJOR;
+    header.versionMinor = PACK_VERSION_MINOR;
+    header.flags = m_chunking ? static_cast<u32>(PackFlags::Chunked) : 0u;
+    header.resourceCount = static_cast<u32>(m_resources.size());
+
+    PackChunkTableHeader chunkTable{};
+    chunkTable.chunkCount = static_cast<u32>(chunks.size());
+    chunkTable.refCount = static_cast<u32>(refs.size());
+
+    header.dataOffset = sizeof(PackHeader) + (m_chunking ? sizeof(PackChunkTableHeader) : 0);
+    header.resourceTableOffset = header.dataOffset + dataSize;
+    header.stringTableOffset =
+        header.resourceTableOffset + entries.size() * sizeof(PackResourceEntry);
+    const u64 stringTableEnd = header.stringTableOffset + sizeof(u32) +
+                               stringOffsets.size() * sizeof(u32) + stringData.size();
+    chunkTable.chunkTableOffset = stringTableEnd;
+    chunkTable.refTableOffset = stringTableEnd + chunks.size() * sizeof(PackChunkEntry);
+    header.totalSize = m_chunking ? chunkTable.refTableOffset + refs.size() * sizeof(u32)
+                                  : stringTableEnd;
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        return Result<PackWriteStats>::error("Failed to open pack for writing: " + path);
+    }
+
+    auto writeBytes = [&file](const void* data, usize size) {
+        file.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(size));
+    };
+
+    writeBytes(&header, sizeof(header));
+    if (m_chunking)
+    {
+        writeBytes(&chunkTable, sizeof(chunkTable));
+    }
+    for (const StoredBlock& block : blocks)
+    {
+        writeBytes(block.data, block.size);
+    }
+    writeBytes(entries.data(), entries.size() * sizeof(PackResourceEntry));
+
+    const u32 stringCount = static_cast<u32>(stringOffsets.size());
+    writeBytes(&stringCount, sizeof(stringCount));
+    writeBytes(stringOffsets.data(), stringOffsets.size() * sizeof(u32));
+    writeBytes(stringData.data(), stringData.size());
+
+    if (m_chunking)
+    {
+        writeBytes(chunks.data(), chunks.size() * sizeof(PackChunkEntry));
+        writeBytes(refs.data(), refs.size() * sizeof(u32));
+    }
+
+    if (!file)
+    {
+        return Result<PackWriteStats>::error("Failed to write pack: " + path);
+    }
+
+    return Result<PackWriteStats>::ok(stats);
+}
+
+} // namespace NovelMind::vfs
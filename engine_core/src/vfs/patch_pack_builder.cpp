@@ -0,0 +1,100 @@
+#include "NovelMind/vfs/patch_pack_builder.hpp"
+#include "NovelMind/vfs/binary_delta.hpp"
+#include "NovelMind/vfs/pack_reader.hpp"
+#include "NovelMind/vfs/pack_writer.hpp"
+#include <algorithm>
+
+namespace NovelMind::vfs
+{
+
+Result<PatchBuildStats> PatchPackBuilder::build(const std::string& oldPackPath,
+                                                const std::string& newPackPath,
+                                                const std::string& outputPath,
+                                                const PatchBuildOptions& options)
+{
+    PackReader oldPack;
+    PackReader newPack;
+    if (auto result = oldPack.mount(oldPackPath); result.isError())
+    {
+        return Result<PatchBuildStats>::error(result.error());
+    }
+    if (auto result = newPack.mount(newPackPath); result.isError())
+    {
+        return Result<PatchBuildStats>::error(result.error());
+    }
+
+    PatchBuildStats stats;
+    PackWriter writer;
+    writer.setChunkingEnabled(options.chunking);
+    if (options.chunking)
+    {
+        writer.addBaseChunks(oldPack.getChunkDigests());
+    }
+
+    // Sorted so identical inputs always produce identical patch packs
+    auto resources = newPack.listResources();
+    std::sort(resources.begin(), resources.end());
+
+    for (const auto& id : resources)
+    {
+        auto newData = newPack.readFile(id);
+        if (newData.isError())
+        {
+            return Result<PatchBuildStats>::error(newData.error());
+        }
+        const auto type = newPack.getInfo(id)->type;
+
+        if (!oldPack.exists(id))
+        {
+            ++stats.addedCount;
+            stats.newBytes += newData.value().size();
+            writer.addResource(id, type, std::move(newData).value());
+            continue;
+        }
+
+        auto oldData = oldPack.readFile(id);
+        if (oldData.isError())
+        {
+            return Result<PatchBuildStats>::error(oldData.error());
+        }
+        if (oldData.value() == newData.value())
+        {
+            ++stats.unchangedCount;
+            continue;
+        }
+
+        stats.newBytes += newData.value().size();
+        auto delta = BinaryDelta::create(oldData.value(), newData.value());
+        if (static_cast<f64>(delta.size()) <=
+            static_cast<f64>(options.maxDeltaRatio) * static_cast<f64>(newData.value().size()))
+        {
+            ++stats.deltaCount;
+            writer.addDeltaResource(id, type, std::move(delta));
+        }
+        else
+        {
+            ++stats.replacedCount;
+            writer.addResource(id, type, std::move(newData).value());
+        }
+    }
+
+    for (const auto& id : oldPack.listResources())
+    {
+        if (!newPack.exists(id))
+        {
+            stats.removedResources.push_back(id);
+        }
+    }
+    std::sort(stats.removedResources.begin(), stats.removedResources.end());
+
+    auto written = writer.write(outputPath);
+    if (written.isError())
+    {
+        return Result<PatchBuildStats>::error(written.error());
+    }
+    stats.patchBytes = written.value().storedBytes;
+
+    return Result<PatchBuildStats>::ok(std::move(stats));
+}
+
+} // namespace NovelMind::vfs
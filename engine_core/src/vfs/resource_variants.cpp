@@ -0,0 +1,71 @@
+#include "NovelMind/vfs/resource_variants.hpp"
+#include <iterator>
+
+namespace NovelMind::vfs
+{
+
+namespace
+{
+
+// Output sizes a little above a variant's scale (e.g. 1100 lines from a
+// 2160-line original) still use it rather than the next larger one
+constexpr f32 SCALE_TOLERANCE = 1.05f;
+
+} // namespace
+
+std::string ResourceVariants::variantId(std::string_view logicalId, u32 divisor)
+{
+    std::string id(logicalId);
+    if (divisor > 1)
+    {
+        id += '@';
+        id += std::to_string(divisor);
+    }
+    return id;
+}
+
+bool ResourceVariants::parseVariantId(std::string_view id, std::string_view& logicalId,
+                                      u32& divisor)
+{
+    const usize at = id.rfind('@');
+    if (at == std::string_view::npos || at == 0 || at + 1 == id.size())
+    {
+        return false;
+    }
+
+    u32 value = 0;
+    for (usize i = at + 1; i < id.size(); ++i)
+    {
+        if (id[i] < '0' || id[i] > '9' || value > 1000)
+        {
+            return false;
+        }
+        value = value * 10 + static_cast<u32>(id[i] - '0');
+    }
+
+    for (u32 known : RESOURCE_VARIANT_DIVISORS)
+    {
+        if (value == known)
+        {
+            logicalId = id.substr(0, at);
+            divisor = value;
+            return true;
+        }
+    }
+    return false;
+}
+
+u32 ResourceVariants::divisorForScale(f32 requiredScale)
+{
+    for (auto it = std::rbegin(RESOURCE_VARIANT_DIVISORS); it != std::rend(RESOURCE_VARIANT_DIVISORS);
+         ++it)
+    {
+        if (requiredScale * static_cast<f32>(*it) <= SCALE_TOLERANCE)
+        {
+            return *it;
+        }
+    }
+    return 1;
+}
+
+} // namespace NovelMind::vfs
@@ -1,12 +1,18 @@
 #include "NovelMind/vfs/virtual_fs.hpp"
 
-// This file intentionally left mostly empty.
-// Virtual base class methods are pure virtual - implementations
+// Most of the interface is pure virtual - implementations
 // are in memory_fs.cpp and pack_reader.cpp
 
 namespace NovelMind::vfs
 {
 
-// Resource type helper functions could go here if needed
+void IVirtualFileSystem::readFiles(const std::vector<std::string>& resourceIds,
+                                   const BatchReadCallback& onRead) const
+{
+    for (const auto& resourceId : resourceIds)
+    {
+        onRead(resourceId, readFile(resourceId));
+    }
+}
 
 } // namespace NovelMind::vfs
@@ -1,5 +1,6 @@
 #include <catch2/catch_test_macros.hpp>
 #include "NovelMind/editor/asset_pipeline.hpp"
+#include <filesystem>
 
 using namespace NovelMind;
 using namespace NovelMind::editor;
@@ -122,89 +123,97 @@ TEST_CASE("AssetDatabase - Add and retrieve asset", "[asset_database]")
 {
     AssetDatabase db;
 
-    AssetEntry entry;
+    AssetMetadata entry;
     entry.id = "test_asset";
     entry.name = "Test Asset";
     entry.type = AssetType::Image;
     entry.sourcePath = "/path/to/image.png";
+    entry.importedPath = "Assets/image.png";
 
-    db.addAsset(entry);
+    db.registerAsset(entry);
 
     auto retrieved = db.getAsset("test_asset");
     REQUIRE(retrieved.has_value());
     CHECK(retrieved->name == "Test Asset");
     CHECK(retrieved->type == AssetType::Image);
+    CHECK(db.getAssetByPath("Assets/image.png").has_value());
 }
 
 TEST_CASE("AssetDatabase - Has asset check", "[asset_database]")
 {
     AssetDatabase db;
 
-    CHECK(db.hasAsset("nonexistent") == false);
+    CHECK(db.getAsset("nonexistent").has_value() == false);
 
-    AssetEntry entry;
+    AssetMetadata entry;
     entry.id = "exists";
     entry.type = AssetType::Audio;
-    db.addAsset(entry);
+    db.registerAsset(entry);
 
-    CHECK(db.hasAsset("exists") == true);
+    CHECK(db.getAsset("exists").has_value() == true);
 }
 
 TEST_CASE("AssetDatabase - Remove asset", "[asset_database]")
 {
     AssetDatabase db;
 
-    AssetEntry entry;
+    AssetMetadata entry;
     entry.id = "to_remove";
     entry.type = AssetType::Font;
-    db.addAsset(entry);
+    db.registerAsset(entry);
 
-    CHECK(db.hasAsset("to_remove") == true);
+    CHECK(db.getAsset("to_remove").has_value() == true);
 
-    db.removeAsset("to_remove");
+    db.unregisterAsset("to_remove");
 
-    CHECK(db.hasAsset("to_remove") == false);
+    CHECK(db.getAsset("to_remove").has_value() == false);
 }
 
-TEST_CASE("AssetDatabase - Clear all assets", "[asset_database]")
+TEST_CASE("AssetDatabase - Close releases all assets", "[asset_database]")
 {
+    namespace fs = std::filesystem;
+    const fs::path dir = fs::temp_directory_path() / "novelmind_asset_db_close_test";
+    fs::remove_all(dir);
+
     AssetDatabase db;
+    REQUIRE(db.initialize(dir.string()).isOk());
 
-    AssetEntry entry1;
+    AssetMetadata entry1;
     entry1.id = "asset1";
     entry1.type = AssetType::Image;
-    db.addAsset(entry1);
+    db.registerAsset(entry1);
 
-    AssetEntry entry2;
+    AssetMetadata entry2;
     entry2.id = "asset2";
     entry2.type = AssetType::Audio;
-    db.addAsset(entry2);
+    db.registerAsset(entry2);
 
     CHECK(db.getAllAssets().size() == 2);
 
-    db.clear();
+    db.close();
 
     CHECK(db.getAllAssets().empty());
+    fs::remove_all(dir);
 }
 
 TEST_CASE("AssetDatabase - Get assets by type", "[asset_database]")
 {
     AssetDatabase db;
 
-    AssetEntry img1;
+    AssetMetadata img1;
     img1.id = "img1";
     img1.type = AssetType::Image;
-    db.addAsset(img1);
+    db.registerAsset(img1);
 
-    AssetEntry img2;
+    AssetMetadata img2;
     img2.id = "img2";
     img2.type = AssetType::Image;
-    db.addAsset(img2);
+    db.registerAsset(img2);
 
-    AssetEntry audio;
+    AssetMetadata audio;
     audio.id = "audio1";
     audio.type = AssetType::Audio;
-    db.addAsset(audio);
+    db.registerAsset(audio);
 
     auto images = db.getAssetsByType(AssetType::Image);
     CHECK(images.size() == 2);
@@ -0,0 +1,237 @@
+#include <catch2/catch_test_macros.hpp>
+#include "NovelMind/editor/crash_safety.hpp"
+#include "NovelMind/editor/editor_runtime_host.hpp"
+#include <filesystem>
+#include <fstream>
+
+using namespace NovelMind;
+using namespace NovelMind::editor;
+
+namespace
+{
+
+CheckpointSnapshot makeSnapshot(i32 step, usize objectCount = 256)
+{
+    CheckpointSnapshot snapshot;
+    snapshot.description = "step " + std::to_string(step);
+    snapshot.timestamp = static_cast<u64>(step);
+    snapshot.runtime.currentScene = "intro";
+    snapshot.runtime.instructionPointer = static_cast<u32>(step);
+    snapshot.runtime.inDialogue = true;
+    snapshot.runtime.variables["step"] = step;
+    snapshot.runtime.variables["name"] = std::string("hero");
+    snapshot.runtime.variables["speed"] = 1.5f;
+    snapshot.runtime.flags["visited"] = step % 2 == 0;
+    snapshot.scene.sceneId = "intro";
+    snapshot.scene.visibleCharacters = {"hero"};
+    for (usize i = 0; i < objectCount; ++i)
+    {
+        scene::SceneObjectState object;
+        object.id = "object" + std::to_string(i);
+        object.type = scene::SceneObjectType::Sprite;
+        object.x = static_cast<f32>(i * 37 % 101);
+        object.rotation = static_cast<f32>(i) * 0.7f;
+        object.properties["texture"] = "sprites/object" + std::to_string(i) + ".png";
+        object.properties["seed"] = std::to_string(static_cast<u32>(i) * 2654435761u);
+        snapshot.scene.objects.push_back(object);
+    }
+    // Only the last object moves between steps
+    snapshot.scene.objects.back().y = static_cast<f32>(step);
+    return snapshot;
+}
+
+} // namespace
+
+TEST_CASE("CheckpointStore serializes a snapshot losslessly", "[checkpoint_store]")
+{
+    const auto snapshot = makeSnapshot(7, 3);
+    const auto image = CheckpointStore::serialize(snapshot);
+
+    auto restored = CheckpointStore::deserialize(image.data(), image.size());
+    REQUIRE(restored.isOk());
+    const auto& state = restored.value();
+    CHECK(state.description == "step 7");
+    CHECK(state.runtime.instructionPointer == 7);
+    CHECK(std::get<i32>(state.runtime.variables.at("step")) == 7);
+    CHECK(std::get<std::string>(state.runtime.variables.at("name")) == "hero");
+    CHECK(std::get<f32>(state.runtime.variables.at("speed")) == 1.5f);
+    CHECK_FALSE(state.runtime.flags.at("visited"));
+    REQUIRE(state.scene.objects.size() == 3);
+    CHECK(state.scene.objects[2].y == 7.0f);
+    CHECK(state.scene.objects[1].properties.at("texture") == "sprites/object1.png");
+
+    // Map order does not leak into the bytes
+    auto reordered = snapshot;
+    reordered.runtime.variables.clear();
+    reordered.runtime.variables["speed"] = 1.5f;
+    reordered.runtime.variables["name"] = std::string("hero");
+    reordered.runtime.variables["step"] = 7;
+    CHECK(CheckpointStore::serialize(reordered) == image);
+
+    auto truncated = image;
+    truncated.pop_back();
+    CHECK(CheckpointStore::deserialize(truncated.data(), truncated.size()).isError());
+}
+
+TEST_CASE("CheckpointStore stores deltas and restores any checkpoint", "[checkpoint_store]")
+{
+    CheckpointStoreConfig config;
+    config.keyframeInterval = 4;
+    CheckpointStore store(config);
+
+    std::vector<u64> ids;
+    for (i32 step = 0; step < 10; ++step)
+    {
+        ids.push_back(store.submit(makeSnapshot(step)));
+    }
+    store.waitForAll();
+
+    const auto checkpoints = store.getCheckpoints();
+    REQUIRE(checkpoints.size() == 10);
+    CHECK(checkpoints[0].keyframe);
+    CHECK_FALSE(checkpoints[1].keyframe);
+    CHECK(checkpoints[5].keyframe);
+    CHECK(checkpoints[1].storedBytes < checkpoints[0].storedBytes / 4);
+
+    for (i32 step = 0; step < 10; ++step)
+    {
+        auto restored = store.restore(ids[static_cast<usize>(step)]);
+        REQUIRE(restored.isOk());
+        CHECK(restored.value().scene.objects.back().y == static_cast<f32>(step));
+        CHECK(std::get<i32>(restored.value().runtime.variables.at("step")) == step);
+    }
+    auto latest = store.restoreLatest();
+    REQUIRE(latest.isOk());
+    CHECK(latest.value().description == "step 9");
+
+    store.clear();
+    CHECK(store.getCheckpointCount() == 0);
+    CHECK(store.restore(ids[0]).isError());
+    store.submit(makeSnapshot(10));
+    store.waitForAll();
+    CHECK(store.getCheckpoints()[0].keyframe);
+}
+
+TEST_CASE("CheckpointStore deltas survive strings changing length", "[checkpoint_store]")
+{
+    CheckpointStore store;
+    const u64 first = store.submit(makeSnapshot(1));
+
+    // A longer string near the start of the image shifts everything after it
+    auto longer = makeSnapshot(2);
+    longer.runtime.variables["name"] = std::string("a hero with a much longer name");
+    const u64 second = store.submit(longer);
+
+    auto shorter = makeSnapshot(3);
+    shorter.runtime.variables["name"] = std::string("h");
+    shorter.scene.objects.erase(shorter.scene.objects.begin() + 10);
+    const u64 third = store.submit(shorter);
+    store.waitForAll();
+
+    const auto checkpoints = store.getCheckpoints();
+    REQUIRE(checkpoints.size() == 3);
+    CHECK_FALSE(checkpoints[1].keyframe);
+    CHECK_FALSE(checkpoints[2].keyframe);
+    CHECK(checkpoints[1].storedBytes < checkpoints[0].storedBytes / 4);
+    CHECK(checkpoints[2].storedBytes < checkpoints[0].storedBytes / 4);
+
+    auto restored = store.restore(second);
+    REQUIRE(restored.isOk());
+    CHECK(std::get<std::string>(restored.value().runtime.variables.at("name")) ==
+          "a hero with a much longer name");
+    CHECK(restored.value().scene.objects.back().y == 2.0f);
+
+    restored = store.restore(third);
+    REQUIRE(restored.isOk());
+    CHECK(std::get<std::string>(restored.value().runtime.variables.at("name")) == "h");
+    CHECK(restored.value().scene.objects.size() == 255);
+    CHECK(restored.value().scene.objects[10].id == "object11");
+
+    restored = store.restore(first);
+    REQUIRE(restored.isOk());
+    CHECK(std::get<std::string>(restored.value().runtime.variables.at("name")) == "hero");
+}
+
+TEST_CASE("CheckpointStore keeps within its byte budget", "[checkpoint_store]")
+{
+    CheckpointStoreConfig config;
+    config.keyframeInterval = 8;
+    CheckpointStore store(config);
+    for (i32 step = 0; step < 4; ++step)
+    {
+        store.submit(makeSnapshot(step));
+    }
+    store.waitForAll();
+    const usize keyframeBytes = store.getCheckpoints()[0].storedBytes;
+
+    // Room for one keyframe and a few deltas, so old ones are dropped and rebased
+    config.byteBudget = keyframeBytes + keyframeBytes / 2;
+    store.setConfig(config);
+    for (i32 step = 4; step < 40; ++step)
+    {
+        store.submit(makeSnapshot(step));
+    }
+    store.waitForAll();
+
+    const auto checkpoints = store.getCheckpoints();
+    REQUIRE_FALSE(checkpoints.empty());
+    CHECK(checkpoints.size() < 36);
+    CHECK(store.getStoredBytes() <= config.byteBudget);
+    CHECK(checkpoints.front().keyframe);
+    CHECK(checkpoints.back().description == "step 39");
+
+    auto oldest = store.restore(checkpoints.front().id);
+    REQUIRE(oldest.isOk());
+    CHECK(oldest.value().description == checkpoints.front().description);
+}
+
+TEST_CASE("CrashSafetyManager restores runtime state from a checkpoint", "[crash_safety]")
+{
+    auto tempDir = std::filesystem::temp_directory_path() / "nm_crash_safety_project";
+    std::filesystem::create_directories(tempDir / "scripts");
+    std::filesystem::create_directories(tempDir / "assets");
+    {
+        std::ofstream file(tempDir / "scripts" / "main.nms");
+        file << "character Hero(name=\"Hero\", color=\"#FF0000\")\n"
+                "scene intro {\n"
+                "    say Hero \"Hello\"\n"
+                "}\n";
+    }
+
+    EditorRuntimeHost host;
+    ProjectDescriptor project;
+    project.name = "CrashSafety";
+    project.path = tempDir.string();
+    project.scriptsPath = (tempDir / "scripts").string();
+    project.assetsPath = (tempDir / "assets").string();
+    project.startScene = "intro";
+    REQUIRE(host.loadProject(project).isOk());
+    REQUIRE(host.play().isOk());
+
+    CrashSafetyManager manager;
+    CHECK(manager.restoreLatestCheckpoint().isError());
+    manager.initialize(&host);
+
+    host.setVariable("points", 10);
+    host.setFlag("visited", true);
+    REQUIRE(manager.createCheckpoint("Before edit").isOk());
+    host.setVariable("points", 99);
+    host.setFlag("visited", false);
+    REQUIRE(manager.createCheckpoint().isOk());
+
+    REQUIRE(manager.restoreCheckpoint(0).isOk());
+    CHECK(std::get<i32>(host.getVariable("points")) == 10);
+    CHECK(host.getFlag("visited"));
+
+    const auto checkpoints = manager.getCheckpoints();
+    REQUIRE(checkpoints.size() == 2);
+    CHECK(checkpoints[0].description == "Before edit");
+    CHECK(checkpoints[0].sceneName == "intro");
+    CHECK(manager.restoreCheckpoint(2).isError());
+
+    REQUIRE(manager.restoreLatestCheckpoint().isOk());
+    CHECK(std::get<i32>(host.getVariable("points")) == 99);
+
+    host.stop();
+    std::filesystem::remove_all(tempDir);
+}
@@ -57,6 +57,41 @@ TEST_CASE("DiagnosticsPanel - Clear does not crash", "[diagnostics_panel]")
     CHECK(panel.getDiagnosticCount() == 0);
 }
 
+TEST_CASE("DiagnosticsPanel - Script profile hot lines navigate to source", "[diagnostics_panel]")
+{
+    DiagnosticsPanel panel;
+    CHECK_FALSE(panel.hasScriptProfile());
+
+    scripting::ScriptProfileReport report;
+    report.totalInstructions = 42;
+    ScriptHotspot hotspot;
+    hotspot.scriptPath = "scripts/main.nms";
+    hotspot.sceneName = "intro";
+    hotspot.line = 7;
+    hotspot.instructions = 42;
+    panel.setScriptProfile(report, {hotspot});
+    CHECK(panel.hasScriptProfile());
+    CHECK(panel.getScriptProfile().totalInstructions == 42);
+    REQUIRE(panel.getScriptHotspots().size() == 1);
+
+    std::string openedPath;
+    u32 openedLine = 0;
+    panel.setOnDiagnosticDoubleClicked([&](const std::string& path, u32 line, u32) {
+        openedPath = path;
+        openedLine = line;
+    });
+    panel.openScriptHotspot(3);  // Out of range: ignored
+    CHECK(openedPath.empty());
+    panel.openScriptHotspot(0);
+    CHECK(openedPath == "scripts/main.nms");
+    CHECK(openedLine == 7);
+
+    panel.render();
+    panel.clearScriptProfile();
+    CHECK_FALSE(panel.hasScriptProfile());
+    CHECK(panel.getScriptHotspots().empty());
+}
+
 TEST_CASE("DiagnosticsPanel - Filter setting", "[diagnostics_panel]")
 {
     DiagnosticsPanel panel;
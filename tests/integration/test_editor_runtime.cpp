@@ -451,6 +451,65 @@ TEST_CASE("EditorRuntimeHost - Hot reload toggle", "[editor_runtime]")
     CHECK(host.isAutoHotReloadEnabled());
 }
 
+TEST_CASE("EditorRuntimeHost - Script profiling maps hot lines to files", "[editor_runtime]")
+{
+    auto tempDir = createTempDir();
+    writeTestScript(tempDir, SIMPLE_SCRIPT);
+
+    EditorRuntimeHost host;
+    CHECK_FALSE(host.isScriptProfilingEnabled());
+    host.setScriptProfilingEnabled(true);
+
+    ProjectDescriptor project;
+    project.name = "TestProject";
+    project.path = tempDir.string();
+    project.scriptsPath = (tempDir / "scripts").string();
+    project.assetsPath = (tempDir / "assets").string();
+    project.startScene = "intro";
+
+    REQUIRE(host.loadProject(project).isOk());
+    REQUIRE(host.playFromScene("intro").isOk());
+    for (int i = 0; i < 4; ++i)
+    {
+        host.update(0.016);
+    }
+
+    auto report = host.getScriptProfile();
+    CHECK(report.totalInstructions > 0);
+    REQUIRE_FALSE(report.scenes.empty());
+    CHECK(report.scenes.front().name == "intro");
+
+    auto hotspots = host.getScriptHotspots();
+    REQUIRE_FALSE(hotspots.empty());
+    bool sawBackground = false;
+    for (const auto& hotspot : hotspots)
+    {
+        CHECK(std::filesystem::path(hotspot.scriptPath).filename() == "main.nms");
+        sawBackground = sawBackground || hotspot.line == 6;  // show background "bg_test"
+    }
+    CHECK(sawBackground);
+    CHECK(host.getScriptHotspots(1).size() == 1);
+
+    auto exportPath = tempDir / "profile.folded";
+    REQUIRE(host.exportScriptProfile(exportPath.string(),
+                                     ScriptProfileMetric::Instructions).isOk());
+    std::ifstream file(exportPath);
+    std::string firstLine;
+    std::getline(file, firstLine);
+    CHECK(firstLine.rfind("intro;main.nms:", 0) == 0);
+
+    host.resetScriptProfile();
+    CHECK(host.getScriptProfile().totalInstructions == 0);
+
+    // Disabled: nothing is counted
+    host.setScriptProfilingEnabled(false);
+    host.update(0.016);
+    CHECK(host.getScriptProfile().totalInstructions == 0);
+
+    host.stop();
+    cleanupTempDir(tempDir);
+}
+
 // =============================================================================
 // Script Compilation Integration Tests
 // =============================================================================
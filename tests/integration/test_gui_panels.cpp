@@ -32,6 +32,7 @@
 // Include asset_browser_panel but NOT curve_editor_panel to avoid conflict
 // (the latter includes editor_app.hpp which redefines AssetEntry)
 #include "NovelMind/editor/asset_browser_panel.hpp"
+#include <thread>
 
 using namespace NovelMind;
 using namespace NovelMind::editor;
@@ -1369,6 +1370,129 @@ TEST_CASE("EventBus - Event subscription and unsubscription", "[gui][event_bus][
     CHECK(!eventReceived);
 }
 
+TEST_CASE("EventBus - Typed buckets keep subscription order", "[gui][event_bus][extended]")
+{
+    EventBus bus;
+    std::vector<int> order;
+
+    bus.subscribe(EditorEventType::PropertyChanged,
+                  [&order](const EditorEvent&) { order.push_back(1); });
+    bus.subscribe([&order](const EditorEvent&) { order.push_back(2); });
+    bus.subscribe(EditorEventType::SelectionChanged,
+                  [&order](const EditorEvent&) { order.push_back(3); });
+    bus.subscribe(EditorEventType::PropertyChanged,
+                  [&order](const EditorEvent&) { order.push_back(4); });
+
+    bus.publish(PropertyChangedEvent());
+    REQUIRE(order == std::vector<int>{1, 2, 4});
+
+    order.clear();
+    bus.publish(SelectionChangedEvent());
+    CHECK(order == std::vector<int>{2, 3});
+}
+
+TEST_CASE("EventBus - Queued events are coalesced per target", "[gui][event_bus][extended]")
+{
+    EventBus bus;
+    bus.setSynchronous(false);
+
+    std::vector<std::string> values;
+    f32 movedX = 0.0f;
+    int moves = 0;
+    bus.subscribe<PropertyChangedEvent>(
+        EditorEventType::PropertyChanged,
+        [&values](const PropertyChangedEvent& e) { values.push_back(e.oldValue + "->" + e.newValue); });
+    bus.subscribe<GraphNodeMovedEvent>(
+        EditorEventType::GraphNodeMoved,
+        [&](const GraphNodeMovedEvent& e) { movedX += e.deltaX; ++moves; });
+
+    for (int i = 0; i < 10; ++i)
+    {
+        PropertyChangedEvent e;
+        e.objectId = "obj";
+        e.propertyName = "x";
+        e.oldValue = std::to_string(i);
+        e.newValue = std::to_string(i + 1);
+        bus.post(e);
+
+        GraphNodeMovedEvent moved;
+        moved.nodeIds = {7};
+        moved.deltaX = 1.0f;
+        bus.post(moved);
+    }
+
+    PropertyChangedEvent other;
+    other.objectId = "obj";
+    other.propertyName = "y";
+    bus.queueEvent(std::make_unique<PropertyChangedEvent>(other));
+
+    CHECK(values.empty());
+    bus.processQueuedEvents();
+
+    REQUIRE(values.size() == 2);
+    CHECK(values[0] == "0->10");
+    CHECK(moves == 1);
+    CHECK(movedX == 10.0f);
+    CHECK(bus.getCoalescedEventCount() == 18);
+}
+
+TEST_CASE("EventBus - Coalesced events keep their latest position", "[gui][event_bus][extended]")
+{
+    EventBus bus;
+    bus.setSynchronous(false);
+
+    std::vector<std::string> order;
+    bus.subscribe<PropertyChangedEvent>(
+        EditorEventType::PropertyChanged,
+        [&order](const PropertyChangedEvent& e) { order.push_back(e.propertyName + "=" + e.newValue); });
+    bus.subscribe(EditorEventType::SelectionChanged,
+                  [&order](const EditorEvent&) { order.push_back("selection"); });
+
+    PropertyChangedEvent first;
+    first.objectId = "obj";
+    first.propertyName = "x";
+    first.newValue = "1";
+    bus.post(first);
+    bus.post(SelectionChangedEvent());
+    PropertyChangedEvent second = first;
+    second.newValue = "2";
+    bus.post(second);
+
+    bus.processQueuedEvents();
+
+    CHECK(order == std::vector<std::string>{"selection", "x=2"});
+    CHECK(bus.getCoalescedEventCount() == 1);
+}
+
+TEST_CASE("EventBus - Events posted from other threads are delivered", "[gui][event_bus][extended]")
+{
+    EventBus bus;
+    bus.setSynchronous(false);
+    bus.setCoalescingEnabled(false);
+
+    int received = 0;
+    bus.subscribe(EditorEventType::AssetImported, [&received](const EditorEvent&) { ++received; });
+    bus.processQueuedEvents(); // make this thread the dispatch thread
+
+    std::vector<std::thread> producers;
+    for (int t = 0; t < 4; ++t)
+    {
+        producers.emplace_back([&bus]() {
+            for (int i = 0; i < 500; ++i)
+            {
+                bus.queueEvent(std::make_unique<AssetEvent>(EditorEventType::AssetImported));
+            }
+        });
+    }
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+
+    bus.processQueuedEvents();
+    CHECK(received == 2000);
+}
+
 // =============================================================================
 // Extended GUI Tests - Selection System
 // =============================================================================
@@ -0,0 +1,90 @@
+#include <catch2/catch_test_macros.hpp>
+#include "NovelMind/editor/asset_pipeline.hpp"
+#include "NovelMind/renderer/raw_texture.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+using namespace NovelMind;
+using namespace NovelMind::editor;
+
+TEST_CASE("ImageImporter - Uncompressed import bakes a raw texture", "[image_importer]")
+{
+    namespace fs = std::filesystem;
+    const fs::path dir = fs::temp_directory_path() / "novelmind_image_importer_test";
+    fs::create_directories(dir);
+    const fs::path source = dir / "red.qoi";
+    const fs::path dest = dir / "imported" / "red.qoi";
+
+    // 4x2 opaque red QOI: one RGB op and a run of seven
+    const std::vector<u8> qoi = {'q', 'o', 'i', 'f', 0, 0, 0, 4, 0, 0, 0, 2, 4, 0,
+                                 0xFE, 255, 0, 0, 0xC6, 0, 0, 0, 0, 0, 0, 0, 1};
+    {
+        std::ofstream out(source, std::ios::binary);
+        out.write(reinterpret_cast<const char*>(qoi.data()),
+                  static_cast<std::streamsize>(qoi.size()));
+    }
+
+    ImageImporter importer;
+    CHECK(importer.canImport(source.string()));
+    ImageImportSettings settings;
+    settings.compression = ImageCompression::None;
+    settings.maxWidth = 2;
+    settings.generateMipmaps = true;
+    importer.setSettings(settings);
+    REQUIRE(importer.import(source.string(), dest.string(), nullptr).isOk());
+
+    std::ifstream in(dest, std::ios::binary);
+    std::vector<u8> baked((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    auto header = renderer::RawTexture::readHeader(baked.data(), baked.size());
+    REQUIRE(header.isOk());
+    CHECK(header.value().width == 2);
+    CHECK(header.value().height == 1);
+    CHECK(header.value().mipCount == 2);
+    CHECK((header.value().flags & renderer::RawTexturePremultiplied) != 0);
+
+    fs::remove_all(dir);
+}
+
+TEST_CASE("ImageImporter - Large images get resolution variants", "[image_importer]")
+{
+    namespace fs = std::filesystem;
+    const fs::path dir = fs::temp_directory_path() / "novelmind_image_variants_test";
+    fs::create_directories(dir);
+    const fs::path source = dir / "wide.qoi";
+    const fs::path dest = dir / "imported" / "wide.qoi";
+
+    // 1024x600 flat QOI: one RGB op, then maximal runs
+    std::vector<u8> qoi = {'q', 'o', 'i', 'f', 0, 0, 4, 0, 0, 0, 2, 88, 4, 0, 0xFE, 30, 60, 90};
+    for (u32 remaining = 1024 * 600 - 1; remaining > 0;)
+    {
+        const u32 run = std::min(remaining, 62u);
+        qoi.push_back(static_cast<u8>(0xC0 | (run - 1)));
+        remaining -= run;
+    }
+    qoi.insert(qoi.end(), {0, 0, 0, 0, 0, 0, 0, 1});
+    {
+        std::ofstream out(source, std::ios::binary);
+        out.write(reinterpret_cast<const char*>(qoi.data()),
+                  static_cast<std::streamsize>(qoi.size()));
+    }
+
+    ImageImporter importer;
+    REQUIRE(importer.import(source.string(), dest.string(), nullptr).isOk());
+
+    // The original is copied; the half-size variant is baked and the
+    // quarter-size one skipped for falling under variantMinSize (150 lines)
+    CHECK(fs::file_size(dest) == qoi.size());
+    REQUIRE(fs::exists(dest.string() + "@2"));
+    CHECK_FALSE(fs::exists(dest.string() + "@4"));
+
+    std::ifstream in(dest.string() + "@2", std::ios::binary);
+    std::vector<u8> baked((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    auto header = renderer::RawTexture::readHeader(baked.data(), baked.size());
+    REQUIRE(header.isOk());
+    CHECK(header.value().width == 512);
+    CHECK(header.value().height == 300);
+
+    fs::remove_all(dir);
+}
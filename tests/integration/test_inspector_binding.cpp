@@ -0,0 +1,179 @@
+#include <catch2/catch_test_macros.hpp>
+#include "NovelMind/editor/event_bus.hpp"
+#include "NovelMind/editor/inspector_binding.hpp"
+#include "NovelMind/editor/undo_system.hpp"
+
+using namespace NovelMind;
+using namespace NovelMind::editor;
+
+namespace
+{
+
+struct Prop
+{
+    std::string id;
+    f32 opacity = 1.0f;
+    i32 layer = 0;
+};
+
+struct Light
+{
+    f32 intensity = 1.0f;
+};
+
+void registerPropType(InspectorBindingManager& manager)
+{
+    PropertyMeta layer("layer", "Layer", PropertyType::None);
+    layer.range = RangeConstraint(0, 10);
+    PropertyMeta id("id", "ID", PropertyType::None);
+    id.flags = PropertyFlags::ReadOnly;
+
+    manager.registerType<Prop>("Prop", TypeInfoBuilder<Prop>("Prop")
+                                           .property<&Prop::opacity>("opacity", "Opacity")
+                                           .property<&Prop::layer>(layer)
+                                           .property<&Prop::id>(id)
+                                           .get());
+}
+
+std::vector<InspectorTarget> targetsFor(std::vector<Prop>& props)
+{
+    std::vector<InspectorTarget> targets;
+    for (auto& prop : props)
+    {
+        targets.emplace_back(InspectorTargetType::SceneObject, prop.id, &prop);
+    }
+    return targets;
+}
+
+} // namespace
+
+TEST_CASE("InspectorBinding sets a property on many objects as one edit", "[inspector_binding]")
+{
+    InspectorBindingManager manager;
+    registerPropType(manager);
+    UndoManager undo;
+    EventBus bus;
+    manager.setUndoManager(&undo);
+    manager.setEventBus(&bus);
+
+    std::vector<PropertyChangedEvent> events;
+    bus.subscribe<PropertyChangedEvent>(EditorEventType::PropertyChanged,
+                                        [&](const PropertyChangedEvent& event) {
+                                            events.push_back(event);
+                                        });
+    i32 afterChanges = 0;
+    manager.onAfterPropertyChange("opacity",
+                                  [&](const PropertyChangeContext&) { ++afterChanges; });
+
+    std::vector<Prop> props(500);
+    for (usize i = 0; i < props.size(); ++i)
+    {
+        props[i].id = "prop" + std::to_string(i);
+        props[i].opacity = static_cast<f32>(i) / 1000.0f;
+    }
+    const auto targets = targetsFor(props);
+    manager.inspectSceneObject(props[3].id, &props[3]);
+
+    REQUIRE_FALSE(manager.setPropertyValueOnTargets(targets, "opacity", PropertyValue(0.5f)));
+    for (const auto& prop : props)
+    {
+        CHECK(prop.opacity == 0.5f);
+    }
+    CHECK(undo.getHistorySize() == 1);
+    CHECK(undo.getNextUndoDescription() == "Set Opacity on 500 objects");
+    CHECK(afterChanges == 1);
+    REQUIRE(events.size() == 1);
+    CHECK(events[0].propertyName == "opacity");
+    CHECK(events[0].objectId.rfind("prop0,prop1,", 0) == 0);
+    CHECK_FALSE(manager.hasPropertyChanged("opacity"));
+
+    REQUIRE(undo.undo());
+    CHECK(props[0].opacity == 0.0f);
+    CHECK(props[499].opacity == 0.499f);
+    REQUIRE(undo.redo());
+    CHECK(props[499].opacity == 0.5f);
+
+    SECTION("A resolved handle skips the name lookup")
+    {
+        const auto layer = manager.getTypeInfo<Prop>()->findHandle<i32>("layer");
+        REQUIRE(layer);
+        REQUIRE_FALSE(manager.setPropertyValueOnTargets(targets, layer, 7));
+        CHECK(props[250].layer == 7);
+        CHECK(undo.getHistorySize() == 2);
+
+        // Validated once against the range, before anything is written
+        CHECK(manager.setPropertyValueOnTargets(targets, layer, 11).has_value());
+        CHECK(props[250].layer == 7);
+        CHECK(undo.getHistorySize() == 2);
+    }
+
+    SECTION("Invalid edits are rejected up front")
+    {
+        CHECK(manager.setPropertyValueOnTargets(targets, "id", PropertyValue(std::string("x")))
+                  .has_value());
+        CHECK(manager.setPropertyValueOnTargets(targets, "opacity", PropertyValue(3)).has_value());
+        CHECK(manager.setPropertyValueOnTargets(targets, "missing", PropertyValue(1.0f))
+                  .has_value());
+        CHECK(manager.setPropertyValueOnTargets({}, "opacity", PropertyValue(1.0f)).has_value());
+
+        Light light;
+        auto mixed = targets;
+        mixed.emplace_back(InspectorTargetType::SceneObject, "light", &light);
+        CHECK(manager.setPropertyValueOnTargets(mixed, "opacity", PropertyValue(1.0f))
+                  .has_value());
+
+        CHECK(props[0].opacity == 0.5f);
+        CHECK(undo.getHistorySize() == 1);
+        CHECK(events.size() == 1);
+    }
+}
+
+TEST_CASE("UndoManager groups transactions and tracks the save point", "[undo_manager]")
+{
+    std::vector<Prop> props(3);
+    const auto opacity = TypeInfoBuilder<Prop>("Prop")
+                             .property<&Prop::opacity>("opacity", "Opacity")
+                             .get();
+    const auto handle = opacity->findHandle<f32>("opacity");
+    auto setAll = [&](f32 value) {
+        std::vector<void*> objects;
+        std::vector<f32> oldValues;
+        for (auto& prop : props)
+        {
+            objects.push_back(&prop);
+            oldValues.push_back(prop.opacity);
+        }
+        return std::make_unique<PropertyBatchCommand<f32>>(handle, objects, oldValues, value);
+    };
+
+    UndoManager undo(2);
+    undo.markSaved();
+    undo.executeCommand(setAll(0.1f));
+    CHECK(undo.hasUnsavedChanges());
+    REQUIRE(undo.undo());
+    CHECK_FALSE(undo.hasUnsavedChanges());
+    CHECK(undo.canRedo());
+
+    {
+        UndoTransaction transaction(&undo, "Fade");
+        undo.executeCommand(setAll(0.2f));
+        undo.executeCommand(setAll(0.3f));
+    }
+    CHECK_FALSE(undo.canRedo());
+    CHECK(undo.getHistorySize() == 1);
+    CHECK(undo.getNextUndoDescription() == "Fade");
+    REQUIRE(undo.undo());
+    CHECK(props[2].opacity == 1.0f);
+
+    undo.beginTransaction("Discarded");
+    undo.executeCommand(setAll(0.4f));
+    undo.rollbackTransaction();
+    CHECK(props[0].opacity == 1.0f);
+
+    // History is capped at two entries
+    undo.executeCommand(setAll(0.5f));
+    undo.executeCommand(setAll(0.6f));
+    undo.executeCommand(setAll(0.7f));
+    CHECK(undo.getHistorySize() == 2);
+    CHECK(undo.hasUnsavedChanges());
+}
@@ -0,0 +1,210 @@
+#include <catch2/catch_test_macros.hpp>
+#include "NovelMind/editor/asset_pipeline.hpp"
+#include "NovelMind/editor/project_manager.hpp"
+#include "NovelMind/editor/project_manifest.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+using namespace NovelMind;
+using namespace NovelMind::editor;
+
+namespace fs = std::filesystem;
+
+namespace
+{
+
+void writeFile(const fs::path& path, const std::string& content)
+{
+    fs::create_directories(path.parent_path());
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file << content;
+}
+
+// 4x2 opaque QOI of one colour: an RGB op and a run of seven
+std::string flatQoi(u8 r, u8 g, u8 b)
+{
+    const u8 bytes[] = {'q', 'o', 'i', 'f', 0, 0, 0, 4, 0, 0, 0, 2, 4, 0,
+                        0xFE, r, g, b, 0xC6, 0, 0, 0, 0, 0, 0, 0, 1};
+    return std::string(reinterpret_cast<const char*>(bytes), sizeof(bytes));
+}
+
+bool contains(const std::vector<std::string>& paths, const std::string& path)
+{
+    return std::find(paths.begin(), paths.end(), path) != paths.end();
+}
+
+} // namespace
+
+TEST_CASE("ProjectManifest rescans only files that changed", "[project_manifest]")
+{
+    const auto root = fs::temp_directory_path() / "nm_manifest_scan";
+    fs::remove_all(root);
+    for (int dir = 0; dir < 8; ++dir)
+    {
+        for (int file = 0; file < 10; ++file)
+        {
+            writeFile(root / "Assets" / ("dir" + std::to_string(dir)) / ("f" + std::to_string(file) + ".png"),
+                      "image " + std::to_string(dir * 10 + file));
+        }
+    }
+    writeFile(root / "Scripts" / "main.nms", "scene intro {}");
+    writeFile(root / ".temp" / "scratch.nms", "ignored");
+    writeFile(root / "Build" / "game.pak", "ignored");
+
+    ManifestScanOptions options;
+    options.threadCount = 4;
+    ProjectManifest manifest;
+    auto first = manifest.scan(root.string(), options);
+    REQUIRE(first.isOk());
+    CHECK(first.value().added.size() == 81);
+    CHECK(first.value().hashedCount == 81);
+    CHECK(manifest.size() == 81);
+    CHECK(manifest.find("Scripts/main.nms") != nullptr);
+    CHECK(manifest.find(".temp/scratch.nms") == nullptr);
+    CHECK(manifest.getFiles(".nms") == std::vector<std::string>{"Scripts/main.nms"});
+    REQUIRE(std::is_sorted(manifest.getEntries().begin(), manifest.getEntries().end(),
+                           [](const auto& a, const auto& b) { return a.path < b.path; }));
+
+    // Nothing changed: nothing is read
+    auto again = manifest.scan(root.string(), options);
+    REQUIRE(again.isOk());
+    CHECK_FALSE(again.value().hasChanges());
+    CHECK(again.value().hashedCount == 0);
+    CHECK(again.value().unchangedCount == 81);
+
+    const auto later = fs::last_write_time(root / "Scripts" / "main.nms") + std::chrono::seconds(5);
+    writeFile(root / "Scripts" / "main.nms", "scene intro { say \"hi\" }");
+    fs::last_write_time(root / "Scripts" / "main.nms", later);
+    writeFile(root / "Assets" / "dir1" / "f1.png", "image 11"); // Same content, new time
+    fs::last_write_time(root / "Assets" / "dir1" / "f1.png", later);
+    writeFile(root / "Assets" / "dir9" / "new.png", "new image");
+    fs::remove(root / "Assets" / "dir2" / "f3.png");
+
+    auto changed = manifest.scan(root.string(), options);
+    REQUIRE(changed.isOk());
+    const auto& result = changed.value();
+    CHECK(result.added == std::vector<std::string>{"Assets/dir9/new.png"});
+    CHECK(result.modified == std::vector<std::string>{"Scripts/main.nms"});
+    CHECK(result.removed == std::vector<std::string>{"Assets/dir2/f3.png"});
+    CHECK(result.hashedCount == 3);
+    CHECK(result.unchangedCount == 79);
+    CHECK(manifest.find("Assets/dir1/f1.png")->modifiedTime ==
+          static_cast<i64>(later.time_since_epoch().count()));
+
+    fs::remove_all(root);
+}
+
+TEST_CASE("ProjectManifest round-trips through its binary format", "[project_manifest]")
+{
+    const auto root = fs::temp_directory_path() / "nm_manifest_format";
+    fs::remove_all(root);
+    writeFile(root / "Assets" / "Images" / "hero.png", "hero");
+    writeFile(root / "Assets" / "Images" / "heroine.png", "heroine");
+    writeFile(root / "Scripts" / "main.nms", "scene intro {}");
+
+    ProjectManifest manifest;
+    REQUIRE(manifest.scan(root.string()).isOk());
+    const auto cachePath = (root / "manifest.bin").string();
+    REQUIRE(manifest.save(cachePath).isOk());
+
+    ProjectManifest loaded;
+    REQUIRE(loaded.load(cachePath).isOk());
+    REQUIRE(loaded.size() == 3);
+    for (const auto& entry : manifest.getEntries())
+    {
+        const ManifestEntry* copy = loaded.find(entry.path);
+        REQUIRE(copy != nullptr);
+        CHECK(copy->size == entry.size);
+        CHECK(copy->modifiedTime == entry.modifiedTime);
+        CHECK(copy->hash == entry.hash);
+    }
+    CHECK(manifest.find("Assets/Images/hero.png")->hash ==
+          ProjectManifest::hashFile((root / "Assets" / "Images" / "hero.png").string()).value());
+
+    auto bytes = manifest.encode();
+    bytes.back() ^= 0x01;
+    CHECK(loaded.decode(bytes.data(), bytes.size()).isError());
+    CHECK(loaded.decode(bytes.data(), 10).isError());
+    CHECK(loaded.size() == 3); // Failed decodes leave the manifest alone
+
+    fs::remove_all(root);
+}
+
+TEST_CASE("ProjectManager validates the cached manifest on open", "[project_manifest]")
+{
+    const auto root = fs::temp_directory_path() / "nm_manifest_project";
+    fs::remove_all(root);
+
+    ProjectManager manager;
+    REQUIRE(manager.createProject(root.string(), "Manifest").isOk());
+    writeFile(root / "Scripts" / "main.nms", "scene intro {}");
+    writeFile(root / "Assets" / "Images" / "bg.png", "bg");
+    REQUIRE(manager.closeProject(true).isOk());
+
+    REQUIRE(manager.openProject(root.string()).isOk());
+    CHECK(fs::exists(manager.getManifestPath()));
+    CHECK(contains(manager.getLastManifestScan().added, "Scripts/main.nms"));
+    const auto scripts = manager.getProjectFiles(".nms");
+    REQUIRE(scripts.size() == 1);
+    CHECK(fs::path(scripts[0]).filename() == "main.nms");
+    REQUIRE(manager.closeProject(true).isOk());
+
+    // Reopening trusts the cache for everything untouched
+    writeFile(root / "Scripts" / "extra.nms", "scene extra {}");
+    REQUIRE(manager.openProject(root.string()).isOk());
+    const auto& scan = manager.getLastManifestScan();
+    CHECK(scan.added == std::vector<std::string>{"Scripts/extra.nms"});
+    CHECK(scan.hashedCount == 1);
+    CHECK(manager.getProjectFiles(".nms").size() == 2);
+    REQUIRE(manager.closeProject(true).isOk());
+
+    fs::remove_all(root);
+}
+
+TEST_CASE("AssetDatabase imports only what a manifest scan reports", "[project_manifest]")
+{
+    const auto root = fs::temp_directory_path() / "nm_manifest_assets";
+    fs::remove_all(root);
+    writeFile(root / "Images" / "red.qoi", flatQoi(255, 0, 0));
+    writeFile(root / "Scripts" / "main.nms", "scene intro {}"); // No importer
+
+    AssetDatabase db;
+    REQUIRE(db.initialize(root.string()).isOk());
+    ProjectManifest manifest;
+
+    auto first = manifest.scan(root.string());
+    REQUIRE(first.isOk());
+    CHECK(db.applyManifestChanges(first.value(), root.string()) == 1);
+    REQUIRE(db.getAllAssets().size() == 1);
+    const AssetMetadata imported = db.getAllAssets().begin()->second;
+    CHECK(fs::exists(imported.importedPath));
+
+    // The import output shows up in the next scan but is not imported again
+    auto output = manifest.scan(root.string());
+    REQUIRE(output.isOk());
+    CHECK(contains(output.value().added, "assets/red.qoi"));
+    CHECK(db.applyManifestChanges(output.value(), root.string()) == 0);
+    CHECK(db.getAllAssets().size() == 1);
+
+    // A changed source is reimported under the same id
+    const auto later = fs::last_write_time(root / "Images" / "red.qoi") + std::chrono::seconds(5);
+    writeFile(root / "Images" / "red.qoi", flatQoi(0, 255, 0));
+    fs::last_write_time(root / "Images" / "red.qoi", later);
+    auto modified = manifest.scan(root.string());
+    REQUIRE(modified.isOk());
+    REQUIRE(modified.value().modified == std::vector<std::string>{"Images/red.qoi"});
+    CHECK(db.applyManifestChanges(modified.value(), root.string()) == 1);
+    REQUIRE(db.getAllAssets().size() == 1);
+    CHECK(db.getAsset(imported.id).has_value());
+
+    // A removed source is unregistered
+    fs::remove(root / "Images" / "red.qoi");
+    auto removed = manifest.scan(root.string());
+    REQUIRE(removed.isOk());
+    CHECK(db.applyManifestChanges(removed.value(), root.string()) == 0);
+    CHECK(db.getAllAssets().empty());
+
+    db.close();
+    fs::remove_all(root);
+}
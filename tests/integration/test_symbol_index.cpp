@@ -0,0 +1,141 @@
+#include <catch2/catch_test_macros.hpp>
+#include "NovelMind/editor/symbol_index.hpp"
+#include <filesystem>
+#include <fstream>
+
+using namespace NovelMind;
+using namespace NovelMind::editor;
+
+namespace fs = std::filesystem;
+
+namespace
+{
+
+const char* kIntroScript = R"(
+character Hero(name="Alex", color="#FFCC00")
+
+scene intro {
+    show background "bg_city"
+    show Hero at center
+    say Hero "Hello!"
+    set met_villain = true
+    set gold = 10
+    play music "theme.ogg"
+    goto chapter1
+}
+)";
+
+const char* kChapterScript = R"(
+scene chapter1 {
+    if met_villain {
+        say Hero "Again?"
+    }
+    set gold = gold + 5
+    goto ending
+}
+)";
+
+void writeFile(const fs::path& path, const std::string& content)
+{
+    std::ofstream file(path, std::ios::binary);
+    file << content;
+}
+
+} // namespace
+
+TEST_CASE("SymbolIndex - Definitions and references across files", "[editor][symbol_index]")
+{
+    SymbolIndex index;
+    REQUIRE(index.indexSource("intro.nms", kIntroScript).isOk());
+    REQUIRE(index.indexSource("chapter1.nms", kChapterScript).isOk());
+
+    auto heroDef = index.findDefinition(SymbolKind::Character, "Hero");
+    REQUIRE(heroDef.has_value());
+    CHECK(heroDef->filePath == "intro.nms");
+    CHECK(heroDef->line == 2);
+    CHECK(index.getUseCount(SymbolKind::Character, "Hero") == 3);
+
+    auto chapterDef = index.findDefinition(SymbolKind::Scene, "chapter1");
+    REQUIRE(chapterDef.has_value());
+    CHECK(chapterDef->filePath == "chapter1.nms");
+    CHECK(index.getUseCount(SymbolKind::Scene, "chapter1") == 1);
+
+    CHECK(index.isDefined(SymbolKind::Flag, "met_villain"));
+    CHECK(index.findReferences(SymbolKind::Flag, "met_villain").size() == 2);
+    CHECK(index.getUseCount(SymbolKind::Variable, "gold") == 1);
+
+    CHECK(index.getSymbols(SymbolKind::Asset) ==
+          std::vector<std::string>{"bg_city", "theme.ogg"});
+    CHECK(index.getUndefinedSymbols(SymbolKind::Scene) == std::vector<std::string>{"ending"});
+}
+
+TEST_CASE("SymbolIndex - Reindexing a file replaces only its sites", "[editor][symbol_index]")
+{
+    SymbolIndex index;
+    REQUIRE(index.indexSource("intro.nms", kIntroScript).isOk());
+    REQUIRE(index.indexSource("chapter1.nms", kChapterScript).isOk());
+
+    REQUIRE(index.indexSource("chapter1.nms", "scene chapter1 {\n    goto intro\n}\n").isOk());
+    CHECK(index.getUseCount(SymbolKind::Character, "Hero") == 2);
+    CHECK(index.getUseCount(SymbolKind::Scene, "intro") == 1);
+    CHECK(index.getUndefinedSymbols(SymbolKind::Scene).empty());
+
+    // A file that fails to parse keeps its previous sites
+    CHECK(index.indexSource("chapter1.nms", "scene chapter1 {").isError());
+    CHECK(index.getUseCount(SymbolKind::Scene, "intro") == 1);
+
+    index.removeFile("chapter1.nms");
+    CHECK_FALSE(index.isDefined(SymbolKind::Scene, "chapter1"));
+    CHECK(index.getIndexedFiles() == std::vector<std::string>{"intro.nms"});
+}
+
+TEST_CASE("SymbolIndex - Persisted index skips unchanged files", "[editor][symbol_index]")
+{
+    fs::path dir = fs::temp_directory_path() / "nm_symbol_index_test";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    const std::string intro = (dir / "intro.nms").string();
+    const std::string chapter = (dir / "chapter1.nms").string();
+    writeFile(intro, kIntroScript);
+    writeFile(chapter, kChapterScript);
+
+    {
+        SymbolIndex index;
+        auto reparsed = index.refresh({intro, chapter});
+        REQUIRE(reparsed.isOk());
+        CHECK(reparsed.value() == 2);
+        REQUIRE(index.save((dir / "symbols.idx").string()).isOk());
+    }
+
+    SymbolIndex restored;
+    REQUIRE(restored.load((dir / "symbols.idx").string()).isOk());
+    CHECK(restored.getUseCount(SymbolKind::Character, "Hero") == 3);
+
+    auto reparsed = restored.refresh({intro, chapter});
+    REQUIRE(reparsed.isOk());
+    CHECK(reparsed.value() == 0);
+
+    writeFile(chapter, "scene chapter1 {\n    goto intro\n}\n");
+    reparsed = restored.refresh({intro, chapter});
+    REQUIRE(reparsed.isOk());
+    CHECK(reparsed.value() == 1);
+    CHECK(restored.getUseCount(SymbolKind::Scene, "intro") == 1);
+
+    // Corrupt counts and truncation are reported, not allocated
+    const std::string indexPath = (dir / "symbols.idx").string();
+    REQUIRE(restored.save(indexPath).isOk());
+    std::string bytes;
+    {
+        std::ifstream in(indexPath, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    auto corrupt = bytes;
+    corrupt.replace(8, 4, "\xFF\xFF\xFF\x7F"); // File count after magic and version
+    writeFile(indexPath, corrupt);
+    CHECK(restored.load(indexPath).isError());
+    writeFile(indexPath, bytes.substr(0, bytes.size() / 2));
+    CHECK(restored.load(indexPath).isError());
+    CHECK(restored.getUseCount(SymbolKind::Scene, "intro") == 1);
+
+    fs::remove_all(dir);
+}
@@ -0,0 +1,62 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "NovelMind/editor/timeline_editor.hpp"
+#include "NovelMind/editor/timeline_playback.hpp"
+#include "NovelMind/scene/scene_graph.hpp"
+
+using namespace NovelMind;
+using namespace NovelMind::editor;
+
+namespace
+{
+
+std::unique_ptr<TimelineClip> moveClip(const std::string& id, f64 start, f32 from, f32 to)
+{
+    auto clip = std::make_unique<TimelineClip>(id, id);
+    clip->setStartTime(start);
+    clip->setDuration(2.0);
+
+    PropertyTrack property;
+    property.propertyName = "position.x";
+    Keyframe first;
+    first.time = 0.0;
+    first.value = from;
+    Keyframe last;
+    last.time = 2.0;
+    last.value = to;
+    property.keyframes = {first, last};
+    clip->addPropertyTrack(property);
+    return clip;
+}
+
+} // namespace
+
+TEST_CASE("TimelinePlaybackEngine - Clips on one track animate in turn", "[timeline_playback]")
+{
+    Timeline timeline("two clips");
+    timeline.setDuration(10.0);
+    auto track = std::make_unique<TimelineTrack>("hero_track", "Hero", TrackType::Character);
+    track->setTargetId("hero");
+    track->addClip(moveClip("b", 5.0, 500.0f, 700.0f));
+    track->addClip(moveClip("a", 0.0, 0.0f, 200.0f));
+    timeline.addTrack(std::move(track));
+
+    scene::SceneGraph graph;
+    graph.showCharacter("hero", "hero", scene::CharacterObject::Position::Center);
+    auto* hero = graph.findObject("hero");
+    REQUIRE(hero != nullptr);
+
+    TimelinePlaybackEngine engine;
+    REQUIRE(engine.loadTimeline(timeline).isOk());
+    REQUIRE(engine.bindScene(&graph) == 1);
+
+    engine.seekTo(1.0);
+    CHECK(hero->getX() == Catch::Approx(100.0f));
+    // Between the clips the first one's end value holds
+    engine.seekTo(3.5);
+    CHECK(hero->getX() == Catch::Approx(200.0f));
+    engine.seekTo(6.0);
+    CHECK(hero->getX() == Catch::Approx(600.0f));
+    engine.seekTo(9.0);
+    CHECK(hero->getX() == Catch::Approx(700.0f));
+}
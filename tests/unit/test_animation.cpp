@@ -2,6 +2,8 @@
 #include <catch2/catch_approx.hpp>
 #include "NovelMind/scene/animation.hpp"
 #include "NovelMind/renderer/color.hpp"
+#include <memory>
+#include <vector>
 
 using namespace NovelMind;
 using namespace NovelMind::scene;
@@ -335,3 +337,58 @@ TEST_CASE("AnimationManager - Stop all animations", "[animation][manager]")
 
     CHECK(manager.count() == 0);
 }
+
+TEST_CASE("EasingCurve - Baking stays within tolerance", "[animation][easing]")
+{
+    auto exact = [](f32 t) { return ease(EaseType::EaseInOutCubic, t); };
+    EasingCurve curve = EasingCurve::bake(exact, 1e-4f);
+
+    CHECK(curve.getMaxError() <= 1e-4f);
+    CHECK(curve.getSampleCount() >= EasingCurve::MIN_SAMPLES);
+
+    for (i32 i = 0; i <= 200; ++i)
+    {
+        f32 t = static_cast<f32>(i) / 200.0f;
+        CHECK(curve.evaluate(t) == Catch::Approx(exact(t)).margin(2e-4));
+    }
+
+    // Linear curves need no extra resolution
+    EasingCurve linear = EasingCurve::bake([](f32 t) { return t; });
+    CHECK(linear.getSampleCount() == EasingCurve::MIN_SAMPLES);
+}
+
+TEST_CASE("EasingCurve - Batch evaluation matches scalar", "[animation][easing]")
+{
+    EasingCurve curve = EasingCurve::bake([](f32 t) { return ease(EaseType::EaseOutBounce, t); });
+
+    std::vector<f32> times;
+    for (i32 i = -5; i <= 105; ++i)
+    {
+        times.push_back(static_cast<f32>(i) / 100.0f);
+    }
+    std::vector<f32> values(times.size());
+    curve.evaluateBatch(times.data(), values.data(), times.size());
+
+    for (usize i = 0; i < times.size(); ++i)
+    {
+        CHECK(values[i] == Catch::Approx(curve.evaluate(times[i])).margin(1e-6));
+    }
+}
+
+TEST_CASE("FloatTween - Baked easing curve overrides EaseType", "[animation][tween]")
+{
+    auto curve = std::make_shared<const EasingCurve>(
+        EasingCurve::bake([](f32 t) { return t * t; }));
+
+    f32 target = 0.0f;
+    FloatTween tween(&target, 0.0f, 100.0f, 1.0f, EaseType::Linear);
+    tween.setEasingCurve(curve);
+    tween.start();
+
+    tween.update(0.5);
+    CHECK(target == Catch::Approx(25.0f).margin(0.05));
+
+    tween.update(0.5);
+    CHECK(tween.isComplete());
+    CHECK(target == Catch::Approx(100.0f));
+}
@@ -0,0 +1,239 @@
+#include <catch2/catch_test_macros.hpp>
+#include "NovelMind/vfs/coalesced_reader.hpp"
+#include "NovelMind/vfs/multi_pack_manager.hpp"
+#include "NovelMind/vfs/pack_reader.hpp"
+#include "NovelMind/vfs/pack_writer.hpp"
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <map>
+
+using namespace NovelMind;
+using namespace NovelMind::vfs;
+
+namespace
+{
+
+std::vector<u8> randomBytes(usize size, u64 seed)
+{
+    std::vector<u8> data(size);
+    for (auto& byte : data)
+    {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        byte = static_cast<u8>(seed >> 56);
+    }
+    return data;
+}
+
+std::string tempPath(const std::string& name)
+{
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+using BatchResults = std::map<std::string, Result<std::vector<u8>>>;
+
+BatchReadCallback collectInto(BatchResults& results)
+{
+    return [&results](const std::string& id, Result<std::vector<u8>> data) {
+        REQUIRE(results.count(id) == 0);
+        results.emplace(id, std::move(data));
+    };
+}
+
+} // namespace
+
+TEST_CASE("CoalescedReader merges nearby segments into spans", "[vfs][batch_read]")
+{
+    std::vector<ReadSegment> segments = {
+        {10000, 100, nullptr, 0},
+        {0, 100, nullptr, 1},
+        {150, 50, nullptr, 2},
+        {120, 10, nullptr, 3},
+        {200000, 8, nullptr, 4},
+    };
+
+    CoalesceOptions options;
+    options.maxGap = 4096;
+    const auto spans = CoalescedReader::plan(segments, options);
+
+    REQUIRE(spans.size() == 3);
+    REQUIRE(spans[0].offset == 0);
+    REQUIRE(spans[0].size == 200);
+    REQUIRE(spans[0].segmentCount == 3);
+    REQUIRE(segments[1].tag == 3);
+    REQUIRE(spans[1].offset == 10000);
+    REQUIRE(spans[2].offset == 200000);
+
+    // A span never grows past maxSpan
+    options.maxSpan = 150;
+    REQUIRE(CoalescedReader::plan(segments, options).size() == 4);
+}
+
+TEST_CASE("CoalescedReader fills gapped and overlapping segments", "[vfs][batch_read]")
+{
+    const auto content = randomBytes(256 * 1024, 3);
+    const std::string path = tempPath("nm_coalesced.bin");
+    {
+        std::ofstream file(path, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(content.data()),
+                   static_cast<std::streamsize>(content.size()));
+    }
+
+    std::vector<std::vector<u8>> buffers = {std::vector<u8>(4096), std::vector<u8>(100),
+                                            std::vector<u8>(100), std::vector<u8>(5000)};
+    const u64 offsets[] = {1000, 9000, 9050, 250000};
+    std::vector<ReadSegment> segments;
+    for (u32 i = 0; i < buffers.size(); ++i)
+    {
+        segments.push_back({offsets[i], buffers[i].size(), buffers[i].data(), i});
+    }
+
+    usize delivered = 0;
+    CoalescedReader::read(path, segments, {}, [&](const ReadSegment& segment, bool ok) {
+        REQUIRE(ok);
+        ++delivered;
+        const auto begin = content.begin() + static_cast<std::ptrdiff_t>(segment.offset);
+        REQUIRE(std::equal(begin, begin + static_cast<std::ptrdiff_t>(segment.size),
+                           buffers[segment.tag].begin()));
+    });
+    REQUIRE(delivered == 4);
+
+    // Past the end of the file every segment of the span fails
+    std::vector<ReadSegment> tooFar = {{content.size() - 10, 100, buffers[1].data(), 0}};
+    CoalescedReader::read(path, tooFar, {}, [](const ReadSegment&, bool ok) { REQUIRE_FALSE(ok); });
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("PackReader batch reads match single reads", "[vfs][batch_read]")
+{
+    const std::string path = tempPath("nm_batch_pack.nmres");
+    std::map<std::string, std::vector<u8>> resources = {
+        {"bg/street.png", randomBytes(200 * 1024, 1)},
+        {"chars/hero.png", randomBytes(30 * 1024, 2)},
+        {"chars/friend.png", randomBytes(20 * 1024, 3)},
+        {"ui/skin.bin", randomBytes(500, 4)},
+        {"data/empty.bin", {}},
+    };
+
+    for (bool chunking : {false, true})
+    {
+        PackWriter writer;
+        writer.setChunkingEnabled(chunking);
+        for (const auto& [id, data] : resources)
+        {
+            writer.addResource(id, ResourceType::Data, data);
+        }
+        // Shares every chunk with the background
+        writer.addResource("bg/street_copy.png", ResourceType::Data, resources["bg/street.png"]);
+        REQUIRE(writer.write(path).isOk());
+
+        PackReader reader;
+        REQUIRE(reader.mount(path).isOk());
+
+        std::vector<std::string> ids = {"missing.png", "bg/street_copy.png"};
+        for (const auto& [id, data] : resources)
+        {
+            ids.push_back(id);
+        }
+
+        BatchResults results;
+        reader.readFiles(ids, collectInto(results));
+        REQUIRE(results.size() == ids.size());
+        REQUIRE(results.at("missing.png").isError());
+        REQUIRE(results.at("bg/street_copy.png").value() == resources["bg/street.png"]);
+        for (const auto& [id, data] : resources)
+        {
+            REQUIRE(results.at(id).value() == data);
+            REQUIRE(results.at(id).value() == reader.readFile(id).value());
+        }
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("MultiPackManager batch reads respect overrides", "[vfs][batch_read]")
+{
+    const std::string basePath = tempPath("nm_batch_base.nmres");
+    const std::string modPath = tempPath("nm_batch_mod.nmres");
+    const auto bg = randomBytes(64 * 1024, 7);
+    const auto hero = randomBytes(8 * 1024, 8);
+    const auto heroMod = randomBytes(8 * 1024, 9);
+
+    PackWriter baseWriter;
+    baseWriter.addResource("bg/room.png", ResourceType::Texture, bg);
+    baseWriter.addResource("chars/hero.png", ResourceType::Texture, hero);
+    REQUIRE(baseWriter.write(basePath).isOk());
+
+    PackWriter modWriter;
+    modWriter.addResource("chars/hero.png", ResourceType::Texture, heroMod);
+    REQUIRE(modWriter.write(modPath).isOk());
+
+    {
+        MultiPackManager manager;
+        REQUIRE(manager.initialize().isOk());
+        REQUIRE(manager.loadBasePack(basePath).success);
+        REQUIRE(manager.loadPack(modPath, PackType::Mod).success);
+
+        BatchResults results;
+        manager.readResources({"chars/hero.png", "bg/room.png", "sfx/none.ogg"},
+                              collectInto(results));
+        REQUIRE(results.size() == 3);
+        REQUIRE(results.at("chars/hero.png").value() == heroMod);
+        REQUIRE(results.at("bg/room.png").value() == bg);
+        REQUIRE(results.at("sfx/none.ogg").isError());
+
+        manager.shutdown();
+    }
+
+    std::filesystem::remove(basePath);
+    std::filesystem::remove(modPath);
+}
+
+TEST_CASE("PackReader batch reads reject corrupt entries", "[vfs][batch_read]")
+{
+    const std::string path = tempPath("nm_batch_corrupt.nmres");
+
+    // Overwrites one field of the only resource entry
+    auto patchEntry = [&path](usize field, u64 value) {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        PackHeader header{};
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        file.seekp(static_cast<std::streamoff>(header.resourceTableOffset + field));
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+    auto readBack = [&path]() {
+        PackReader reader;
+        REQUIRE(reader.mount(path).isOk());
+        BatchResults results;
+        reader.readFiles({"data/blob.bin"}, collectInto(results));
+        REQUIRE(results.size() == 1);
+        return std::move(results.at("data/blob.bin"));
+    };
+
+    for (bool chunking : {false, true})
+    {
+        PackWriter writer;
+        writer.setChunkingEnabled(chunking);
+        writer.addResource("data/blob.bin", ResourceType::Data, randomBytes(4096, 5));
+        REQUIRE(writer.write(path).isOk());
+        REQUIRE(readBack().isOk());
+
+        if (!chunking)
+        {
+            patchEntry(offsetof(PackResourceEntry, compressedSize), u64{1} << 40);
+            CHECK(readBack().isError());
+            continue;
+        }
+
+        patchEntry(offsetof(PackResourceEntry, uncompressedSize), u64{1} << 40);
+        CHECK(readBack().isError());
+
+        // firstRef + refCount wraps to a small value
+        patchEntry(offsetof(PackResourceEntry, dataOffset), ~u64{0});
+        patchEntry(offsetof(PackResourceEntry, compressedSize), 2);
+        CHECK(readBack().isError());
+    }
+
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,150 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "NovelMind/scene/compiled_timeline.hpp"
+#include "NovelMind/scene/scene_graph.hpp"
+
+using namespace NovelMind;
+using namespace NovelMind::scene;
+
+namespace
+{
+
+TimelineKey key(f64 time, f32 value,
+                TimelineInterpolation interp = TimelineInterpolation::Linear)
+{
+    TimelineKey k;
+    k.time = time;
+    k.value = value;
+    k.interpolation = interp;
+    return k;
+}
+
+CompiledTimeline compileSingle(std::vector<TimelineKey> keys,
+                               TimelineCompileOptions options = {})
+{
+    TimelineCompiler compiler(options);
+    u32 track = compiler.addTrack();
+    compiler.addChannel(track, "hero", AnimatableProperty::PositionX, std::move(keys));
+    auto result = compiler.compile();
+    REQUIRE(result.isOk());
+    return std::move(result).value();
+}
+
+} // namespace
+
+TEST_CASE("CompiledTimeline - Linear interpolation between keys", "[animation][timeline]")
+{
+    auto timeline = compileSingle({key(0.0, 0.0f), key(1.0, 100.0f), key(2.0, 50.0f)});
+
+    CHECK(timeline.getDuration() == Catch::Approx(2.0));
+    CHECK(timeline.sample(0, -1.0) == Catch::Approx(0.0f));
+    CHECK(timeline.sample(0, 0.5) == Catch::Approx(50.0f));
+    CHECK(timeline.sample(0, 1.5) == Catch::Approx(75.0f));
+    CHECK(timeline.sample(0, 3.0) == Catch::Approx(50.0f));
+}
+
+TEST_CASE("CompiledTimeline - Keys are sorted at compile time", "[animation][timeline]")
+{
+    auto timeline = compileSingle({key(2.0, 20.0f), key(0.0, 0.0f), key(1.0, 10.0f)});
+
+    CHECK(timeline.sample(0, 1.5) == Catch::Approx(15.0f));
+}
+
+TEST_CASE("CompiledTimeline - Constant interpolation holds value", "[animation][timeline]")
+{
+    auto timeline = compileSingle({key(0.0, 1.0f, TimelineInterpolation::Constant),
+                                   key(1.0, 2.0f)});
+
+    CHECK(timeline.sample(0, 0.99) == Catch::Approx(1.0f));
+    CHECK(timeline.sample(0, 1.0) == Catch::Approx(2.0f));
+}
+
+TEST_CASE("CompiledTimeline - Cursor handles seeks in both directions", "[animation][timeline]")
+{
+    std::vector<TimelineKey> keys;
+    for (i32 i = 0; i <= 100; ++i)
+    {
+        keys.push_back(key(static_cast<f64>(i), static_cast<f32>(i * 2)));
+    }
+    auto timeline = compileSingle(std::move(keys));
+
+    // Forward playback
+    for (i32 frame = 0; frame < 600; ++frame)
+    {
+        f64 t = frame / 6.0;
+        CHECK(timeline.sample(0, t) == Catch::Approx(t * 2.0).margin(0.001));
+    }
+
+    // Random seeks, backwards and forwards
+    CHECK(timeline.sample(0, 10.25) == Catch::Approx(20.5f));
+    CHECK(timeline.sample(0, 90.5) == Catch::Approx(181.0f));
+    CHECK(timeline.sample(0, 89.5) == Catch::Approx(179.0f));
+    CHECK(timeline.sample(0, 3.0) == Catch::Approx(6.0f));
+}
+
+TEST_CASE("CompiledTimeline - Baked Bezier matches exact evaluation", "[animation][timeline]")
+{
+    auto makeKeys = [] {
+        TimelineKey a = key(0.0, 0.0f, TimelineInterpolation::Bezier);
+        a.outTangent = 0.0f;
+        a.outWeight = 0.42f;
+        TimelineKey b = key(2.0, 10.0f);
+        b.inTangent = 0.0f;
+        b.inWeight = 0.42f;
+        return std::vector<TimelineKey>{a, b};
+    };
+
+    TimelineCompileOptions exact;
+    exact.bakeBezier = false;
+    TimelineCompileOptions baked;
+    baked.bezierLutSize = 64;
+
+    auto exactTimeline = compileSingle(makeKeys(), exact);
+    auto bakedTimeline = compileSingle(makeKeys(), baked);
+
+    CHECK(exactTimeline.getBakedSampleCount() == 0);
+    CHECK(bakedTimeline.getBakedSampleCount() == 64);
+
+    for (i32 i = 0; i <= 20; ++i)
+    {
+        f64 t = i * 0.1;
+        CHECK(bakedTimeline.sample(0, t) ==
+              Catch::Approx(exactTimeline.sample(0, t)).margin(0.02));
+    }
+
+    // Ease-in-out shape: symmetric around the midpoint
+    CHECK(exactTimeline.sample(0, 1.0) == Catch::Approx(5.0f).margin(0.01));
+    CHECK(exactTimeline.sample(0, 0.5) < 2.5f);
+}
+
+TEST_CASE("CompiledTimeline - Writes into bound scene objects", "[animation][timeline]")
+{
+    SceneGraph graph;
+    graph.showCharacter("hero", "hero", CharacterObject::Position::Center);
+
+    TimelineCompiler compiler;
+    u32 moveTrack = compiler.addTrack();
+    u32 fadeTrack = compiler.addTrack();
+    compiler.addChannel(moveTrack, "hero", AnimatableProperty::PositionX,
+                        {key(0.0, 0.0f), key(1.0, 200.0f)});
+    compiler.addChannel(fadeTrack, "hero", AnimatableProperty::Alpha,
+                        {key(0.0, 0.0f), key(1.0, 2.0f)});
+    compiler.addChannel(fadeTrack, "missing", AnimatableProperty::Alpha,
+                        {key(0.0, 0.0f)});
+    auto result = compiler.compile();
+    REQUIRE(result.isOk());
+    auto timeline = std::move(result).value();
+
+    CHECK(timeline.bind(graph) == 2);
+
+    timeline.evaluate(0.5);
+    auto* hero = graph.findObject("hero");
+    REQUIRE(hero != nullptr);
+    CHECK(hero->getX() == Catch::Approx(100.0f));
+    CHECK(hero->getAlpha() == Catch::Approx(1.0f)); // Clamped
+
+    timeline.setTrackActive(moveTrack, false);
+    timeline.evaluate(0.25);
+    CHECK(hero->getX() == Catch::Approx(100.0f));
+    CHECK(hero->getAlpha() == Catch::Approx(0.5f));
+}
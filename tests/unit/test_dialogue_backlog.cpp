@@ -0,0 +1,172 @@
+#include <catch2/catch_test_macros.hpp>
+#include "NovelMind/scene/dialogue_backlog.hpp"
+#include "NovelMind/scripting/script_runtime.hpp"
+
+using namespace NovelMind;
+using namespace NovelMind::scene;
+
+TEST_CASE("DialogueBacklog keeps the most recent lines in a ring", "[backlog]")
+{
+    const std::vector<std::string> strings = {"a", "b", "c", "d", "e", "Alice"};
+    DialogueBacklog backlog(3);
+    backlog.setStringTable(&strings);
+
+    CHECK(sizeof(DialogueBacklog::Entry) == 24);
+
+    backlog.push(0, 5, "voice_a");
+    backlog.push(1);
+    backlog.push(2, 5, "voice_c");
+    CHECK(backlog.size() == 3);
+    CHECK(backlog.getText(0) == "a");
+    CHECK(backlog.getSpeaker(0) == "Alice");
+    CHECK(backlog.getSpeaker(1).empty());
+    CHECK(backlog.getVoiceId(0) == "voice_a");
+    CHECK(backlog.getVoiceId(1).empty());
+
+    backlog.push(3);
+    backlog.push(4, DialogueBacklog::NONE, "voice_a");
+    CHECK(backlog.size() == 3);
+    CHECK(backlog.getText(0) == "c");
+    CHECK(backlog.getText(2) == "e");
+    CHECK(backlog.getText(3).empty());
+
+    // The evicted entry's voice slot was released and reused
+    CHECK(backlog.getEntry(2).voiceSlot == 0);
+    CHECK(backlog.getVoiceId(2) == "voice_a");
+    CHECK(backlog.getVoiceId(0) == "voice_c");
+
+    backlog.clear();
+    CHECK(backlog.empty());
+}
+
+TEST_CASE("DialogueBacklog resolves text in the current locale", "[backlog]")
+{
+    const std::vector<std::string> strings = {"Hello, {name}!", "Untranslated"};
+    localization::LocalizationManager localization;
+    localization.setDefaultLocale(localization::LocaleId("en"));
+    localization.setCurrentLocale(localization::LocaleId("en"));
+    localization.setString(localization::LocaleId("ja"), "Hello, {name}!", "Konnichiwa, {name}!");
+
+    DialogueBacklog backlog;
+    backlog.setStringTable(&strings, &localization);
+    backlog.push(0, DialogueBacklog::NONE, {}, {{"name", "Sakura"}});
+    backlog.push(1);
+    backlog.push(0, DialogueBacklog::NONE, {}, {{"name", "Sakura"}});
+
+    CHECK(backlog.getText(0) == "Hello, Sakura!");
+    CHECK(backlog.getText(1) == "Untranslated");
+    CHECK(backlog.getEntry(0).variableHash == backlog.getEntry(2).variableHash);
+
+    localization.setCurrentLocale(localization::LocaleId("ja"));
+    CHECK(backlog.getText(0) == "Konnichiwa, Sakura!");
+    CHECK(backlog.getText(1) == "Untranslated");
+}
+
+TEST_CASE("DialogueBacklog lays out only visible entries", "[backlog]")
+{
+    std::vector<std::string> strings;
+    DialogueBacklog backlog(1000);
+    for (u32 i = 0; i < 1000; ++i)
+    {
+        strings.push_back("Line number " + std::to_string(i));
+        backlog.push(i);
+    }
+    backlog.setStringTable(&strings);
+
+    renderer::TextLayoutEngine engine;
+    backlog.setLayoutEngine(&engine);
+    backlog.setLayoutCacheSize(8);
+
+    const f32 lineHeight = backlog.layout(0).totalHeight;
+    REQUIRE(lineHeight > 0.0f);
+    backlog.invalidateLayouts();
+
+    std::vector<usize> drawn;
+    const usize visited = backlog.forEachVisible(
+        500, lineHeight * 4.5f,
+        [&drawn](usize index, const renderer::TextLayout&) { drawn.push_back(index); });
+
+    CHECK(visited == 5);
+    CHECK(drawn == std::vector<usize>{500, 501, 502, 503, 504});
+    CHECK(backlog.getCachedLayoutCount() == 5);
+
+    // Scrolling past the cache size evicts the least recently used layouts
+    backlog.forEachVisible(505, lineHeight * 4.5f, nullptr);
+    CHECK(backlog.getCachedLayoutCount() == 8);
+}
+
+TEST_CASE("ScriptRuntime records shown lines in the backlog", "[backlog][script_runtime]")
+{
+    using namespace NovelMind::scripting;
+
+    CompiledScript script;
+    script.stringTable = {"Hero", "Hello", "Narration"};
+    script.instructions = {
+        {OpCode::PUSH_STRING, 0},
+        {OpCode::SAY, 1},
+        {OpCode::PUSH_NULL, 0},
+        {OpCode::SAY, 2},
+        {OpCode::HALT, 0},
+    };
+    script.sceneEntryPoints["intro"] = 0;
+
+    DialogueBacklog backlog;
+    ScriptRuntime runtime;
+    runtime.setBacklog(&backlog);
+    REQUIRE(runtime.load(script).isOk());
+    REQUIRE(runtime.gotoScene("intro").isOk());
+    runtime.setSkipMode(true);
+    runtime.update(0.016);
+
+    REQUIRE(backlog.size() == 2);
+    CHECK(backlog.getSpeaker(0) == "Hero");
+    CHECK(backlog.getText(0) == "Hello");
+    CHECK(backlog.getSpeaker(1).empty());
+    CHECK(backlog.getText(1) == "Narration");
+}
+
+TEST_CASE("ScriptRuntime stores voice ids and variables with backlog lines", "[backlog][script_runtime]")
+{
+    using namespace NovelMind::scripting;
+
+    CompiledScript script;
+    script.stringTable = {"gold", "Hero", "You have {gold} coins"};
+    script.instructions = {
+        {OpCode::PUSH_INT, 3},
+        {OpCode::STORE_VAR, 0},
+        {OpCode::PUSH_STRING, 1},
+        {OpCode::SAY, 2},
+        {OpCode::PUSH_INT, 5},
+        {OpCode::STORE_VAR, 0},
+        {OpCode::PUSH_STRING, 1},
+        {OpCode::SAY, 2},
+        {OpCode::HALT, 0},
+    };
+    script.sceneEntryPoints["shop"] = 0;
+
+    DialogueBacklog backlog;
+    audio::VoicePreloader preloader;
+    preloader.setResolver([](const audio::VoiceLineRef& line) {
+        return "vo/" + std::string(line.scene) + "_" + std::to_string(line.sceneLineIndex);
+    });
+    ScriptRuntime runtime;
+    runtime.setBacklog(&backlog);
+    runtime.setVoicePreloader(&preloader);
+    REQUIRE(runtime.load(script).isOk());
+    REQUIRE(runtime.gotoScene("shop").isOk());
+    runtime.setSkipMode(true);
+    runtime.update(0.016);
+
+    REQUIRE(backlog.size() == 2);
+    CHECK(backlog.getVoiceId(0) == preloader.getVoiceId(3));
+    CHECK(backlog.getVoiceId(1) == preloader.getVoiceId(7));
+    CHECK_FALSE(backlog.getVoiceId(0).empty());
+
+    // Each line keeps the variables it was shown with
+    backlog.setTextResolver([](u32, const DialogueBacklog::VariableMap& variables) {
+        auto it = variables.find("gold");
+        return it != variables.end() ? it->second : std::string();
+    });
+    CHECK(backlog.getText(0) == "3");
+    CHECK(backlog.getText(1) == "5");
+}
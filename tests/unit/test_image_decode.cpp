@@ -0,0 +1,916 @@
+#include <catch2/catch_test_macros.hpp>
+#include "NovelMind/renderer/image_decode_service.hpp"
+#include "NovelMind/renderer/image_decoder.hpp"
+#include "NovelMind/renderer/image_kernels.hpp"
+#include "NovelMind/renderer/raw_texture.hpp"
+#include "NovelMind/renderer/texture.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+
+using namespace NovelMind;
+using namespace NovelMind::renderer;
+
+namespace
+{
+
+std::vector<u8> randomPixels(usize count, u32 seed)
+{
+    std::vector<u8> pixels(count * 4);
+    u32 state = seed;
+    for (auto& byte : pixels)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        byte = static_cast<u8>(state >> 24);
+    }
+    return pixels;
+}
+
+// Banded gradients with flat runs, as in UI art and backgrounds
+std::vector<u8> makeImage(u32 width, u32 height)
+{
+    std::vector<u8> pixels(static_cast<usize>(width) * height * 4);
+    for (u32 y = 0; y < height; ++y)
+    {
+        for (u32 x = 0; x < width; ++x)
+        {
+            u8* p = pixels.data() + (static_cast<usize>(y) * width + x) * 4;
+            p[0] = static_cast<u8>((x / 8) * 8 * 255 / width);
+            p[1] = static_cast<u8>(y * 255 / height);
+            p[2] = static_cast<u8>((x / 16 + y / 16) & 1 ? 200 : 40);
+            p[3] = static_cast<u8>(x % 97 == 0 ? 128 : 255);
+        }
+    }
+    return pixels;
+}
+
+void putBE32(std::vector<u8>& out, u32 value)
+{
+    out.push_back(static_cast<u8>(value >> 24));
+    out.push_back(static_cast<u8>(value >> 16));
+    out.push_back(static_cast<u8>(value >> 8));
+    out.push_back(static_cast<u8>(value));
+}
+
+// ---------------------------------------------------------------------------
+// Minimal PNG writer: stored and fixed-Huffman deflate, every filter type
+// ---------------------------------------------------------------------------
+
+class BitWriter
+{
+public:
+    explicit BitWriter(std::vector<u8>& out) : m_out(out) {}
+
+    void put(u32 value, u32 count)
+    {
+        m_buffer |= value << m_count;
+        m_count += count;
+        while (m_count >= 8)
+        {
+            m_out.push_back(static_cast<u8>(m_buffer));
+            m_buffer >>= 8;
+            m_count -= 8;
+        }
+    }
+
+    // Huffman codes are stored most significant bit first
+    void putCode(u32 code, u32 count)
+    {
+        u32 reversed = 0;
+        for (u32 i = 0; i < count; ++i)
+        {
+            reversed = (reversed << 1) | ((code >> i) & 1);
+        }
+        put(reversed, count);
+    }
+
+    void flush()
+    {
+        if (m_count > 0)
+        {
+            m_out.push_back(static_cast<u8>(m_buffer));
+        }
+        m_buffer = 0;
+        m_count = 0;
+    }
+
+private:
+    std::vector<u8>& m_out;
+    u32 m_buffer = 0;
+    u32 m_count = 0;
+};
+
+void putFixedSymbol(BitWriter& writer, u32 symbol)
+{
+    if (symbol < 144)
+    {
+        writer.putCode(0x30 + symbol, 8);
+    }
+    else if (symbol < 256)
+    {
+        writer.putCode(0x190 + symbol - 144, 9);
+    }
+    else if (symbol < 280)
+    {
+        writer.putCode(symbol - 256, 7);
+    }
+    else
+    {
+        writer.putCode(0xC0 + symbol - 280, 8);
+    }
+}
+
+// Literals plus 3..10 byte matches at distance 4 (one RGBA pixel back)
+void writeFixedBlock(BitWriter& writer, const u8* data, usize size, bool last)
+{
+    writer.put(last ? 1 : 0, 1);
+    writer.put(1, 2);
+    usize i = 0;
+    while (i < size)
+    {
+        usize run = 0;
+        while (i >= 4 && i + run < size && run < 10 && data[i + run] == data[i + run - 4])
+        {
+            ++run;
+        }
+        if (run >= 3)
+        {
+            putFixedSymbol(writer, static_cast<u32>(257 + run - 3));
+            writer.putCode(3, 5); // distance 4
+            i += run;
+        }
+        else
+        {
+            putFixedSymbol(writer, data[i++]);
+        }
+    }
+    putFixedSymbol(writer, 256);
+}
+
+enum class Deflate
+{
+    Stored,
+    Fixed,
+    FixedThenStored
+};
+
+std::vector<u8> zlibCompress(const std::vector<u8>& data, Deflate mode)
+{
+    std::vector<u8> out = {0x78, 0x01};
+    BitWriter writer(out);
+    usize storedFrom = 0;
+    if (mode == Deflate::Fixed)
+    {
+        writeFixedBlock(writer, data.data(), data.size(), true);
+        storedFrom = data.size();
+    }
+    else if (mode == Deflate::FixedThenStored)
+    {
+        storedFrom = data.size() / 2;
+        writeFixedBlock(writer, data.data(), storedFrom, false);
+    }
+
+    if (mode != Deflate::Fixed)
+    {
+        usize pos = storedFrom;
+        do
+        {
+            const usize length = std::min<usize>(data.size() - pos, 65535);
+            const bool last = pos + length == data.size();
+            writer.put(last ? 1 : 0, 1);
+            writer.put(0, 2);
+            writer.flush();
+            out.push_back(static_cast<u8>(length));
+            out.push_back(static_cast<u8>(length >> 8));
+            out.push_back(static_cast<u8>(~length));
+            out.push_back(static_cast<u8>(~length >> 8));
+            out.insert(out.end(), data.begin() + static_cast<std::ptrdiff_t>(pos),
+                       data.begin() + static_cast<std::ptrdiff_t>(pos + length));
+            pos += length;
+        } while (pos < data.size());
+    }
+    writer.flush();
+
+    u32 a = 1;
+    u32 b = 0;
+    for (u8 byte : data)
+    {
+        a = (a + byte) % 65521;
+        b = (b + a) % 65521;
+    }
+    putBE32(out, (b << 16) | a);
+    return out;
+}
+
+u32 crc32(const u8* data, usize size)
+{
+    u32 crc = 0xFFFFFFFFu;
+    for (usize i = 0; i < size; ++i)
+    {
+        crc ^= data[i];
+        for (int k = 0; k < 8; ++k)
+        {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+void putChunk(std::vector<u8>& png, const char* type, const std::vector<u8>& data)
+{
+    putBE32(png, static_cast<u32>(data.size()));
+    const usize start = png.size();
+    png.insert(png.end(), type, type + 4);
+    png.insert(png.end(), data.begin(), data.end());
+    putBE32(png, crc32(png.data() + start, png.size() - start));
+}
+
+struct PngSpec
+{
+    u32 width = 0;
+    u32 height = 0;
+    u8 bitDepth = 8;
+    u8 colorType = 6;
+    u8 interlace = 0;
+    std::vector<std::vector<u8>> rows; // Unfiltered scanlines
+    std::vector<u8> palette;
+    std::vector<u8> transparency;
+    Deflate deflate = Deflate::Fixed;
+};
+
+u8 paethPredictor(i32 a, i32 b, i32 c)
+{
+    const i32 p = a + b - c;
+    const i32 pa = std::abs(p - a);
+    const i32 pb = std::abs(p - b);
+    const i32 pc = std::abs(p - c);
+    return static_cast<u8>(pa <= pb && pa <= pc ? a : (pb <= pc ? b : c));
+}
+
+// Row y uses filter y % 5 so every filter type is exercised
+std::vector<u8> writePng(const PngSpec& spec)
+{
+    const usize channels = spec.colorType == 2 ? 3 : spec.colorType == 4 ? 2
+                                                 : spec.colorType == 6   ? 4
+                                                                         : 1;
+    const usize bpp = std::max<usize>(1, channels * spec.bitDepth / 8);
+
+    std::vector<u8> filtered;
+    std::vector<u8> previous(spec.rows.empty() ? 0 : spec.rows[0].size(), 0);
+    for (usize y = 0; y < spec.rows.size(); ++y)
+    {
+        const auto& row = spec.rows[y];
+        const u8 filter = static_cast<u8>(y % 5);
+        filtered.push_back(filter);
+        for (usize i = 0; i < row.size(); ++i)
+        {
+            const i32 a = i >= bpp ? row[i - bpp] : 0;
+            const i32 b = previous[i];
+            const i32 c = i >= bpp ? previous[i - bpp] : 0;
+            const i32 predictions[5] = {0, a, b, (a + b) >> 1, paethPredictor(a, b, c)};
+            filtered.push_back(static_cast<u8>(row[i] - predictions[filter]));
+        }
+        previous = row;
+    }
+
+    std::vector<u8> png = {137, 80, 78, 71, 13, 10, 26, 10};
+    std::vector<u8> header;
+    putBE32(header, spec.width);
+    putBE32(header, spec.height);
+    header.insert(header.end(), {spec.bitDepth, spec.colorType, 0, 0, spec.interlace});
+    putChunk(png, "IHDR", header);
+    if (!spec.palette.empty())
+    {
+        putChunk(png, "PLTE", spec.palette);
+    }
+    if (!spec.transparency.empty())
+    {
+        putChunk(png, "tRNS", spec.transparency);
+    }
+    putChunk(png, "tEXt", {'C', 'o', 'm', 'm', 'e', 'n', 't', 0, 'x'});
+
+    // Split the stream over two IDAT chunks
+    const auto stream = zlibCompress(filtered, spec.deflate);
+    const auto middle = stream.begin() + static_cast<std::ptrdiff_t>(stream.size() / 2);
+    putChunk(png, "IDAT", std::vector<u8>(stream.begin(), middle));
+    putChunk(png, "IDAT", std::vector<u8>(middle, stream.end()));
+    putChunk(png, "IEND", {});
+    return png;
+}
+
+std::vector<u8> packSamples(const std::vector<u32>& samples, u32 bitDepth)
+{
+    std::vector<u8> row;
+    if (bitDepth == 16)
+    {
+        for (u32 sample : samples)
+        {
+            row.push_back(static_cast<u8>(sample >> 8));
+            row.push_back(static_cast<u8>(sample));
+        }
+        return row;
+    }
+    row.assign((samples.size() * bitDepth + 7) / 8, 0);
+    for (usize i = 0; i < samples.size(); ++i)
+    {
+        const usize bit = i * bitDepth;
+        row[bit / 8] |= static_cast<u8>(samples[i] << (8 - bitDepth - bit % 8));
+    }
+    return row;
+}
+
+PngSpec rgbaSpec(const std::vector<u8>& pixels, u32 width, u32 height)
+{
+    PngSpec spec;
+    spec.width = width;
+    spec.height = height;
+    for (u32 y = 0; y < height; ++y)
+    {
+        const auto begin = pixels.begin() + static_cast<std::ptrdiff_t>(y) * width * 4;
+        spec.rows.emplace_back(begin, begin + static_cast<std::ptrdiff_t>(width) * 4);
+    }
+    return spec;
+}
+
+// 24x20 RGBA written by zlib at level 9 (dynamic Huffman blocks), rows
+// filtered with y % 5; pixel (x, y) is {x*10, y*12, x*y, (x+y)%5 ? 255 : 0}
+const u8 ZLIB_DYNAMIC_PNG[] = {
+    0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x14, 0x08, 0x06, 0x00, 0x00, 0x00, 0x97, 0xB5, 0xFD,
+    0x83, 0x00, 0x00, 0x02, 0x39, 0x49, 0x44, 0x41, 0x54, 0x78, 0xDA, 0xBD, 0x94, 0x2B, 0x8F, 0x1A,
+    0x61, 0x14, 0x86, 0x0F, 0x97, 0x19, 0x60, 0x18, 0xAE, 0x3B, 0xDB, 0x8B, 0xE8, 0x98, 0x1A, 0x44,
+    0xD7, 0x20, 0x5A, 0xD1, 0x63, 0x6A, 0x48, 0xD3, 0x35, 0x88, 0x56, 0x74, 0x4C, 0x0D, 0x66, 0x0D,
+    0xA2, 0x35, 0x47, 0x36, 0xA4, 0x49, 0x0D, 0xA6, 0x06, 0x8D, 0xA9, 0x41, 0x1F, 0x4D, 0x9A, 0xD4,
+    0xA0, 0xD1, 0x98, 0x1A, 0x74, 0xFF, 0xC1, 0xDB, 0x77, 0x96, 0x65, 0x97, 0x34, 0x69, 0xD2, 0x76,
+    0xC9, 0x92, 0x3C, 0xF9, 0xCE, 0xF7, 0x24, 0x64, 0x38, 0x3C, 0x01, 0x11, 0xBE, 0x22, 0x11, 0x24,
+    0x24, 0x25, 0x3D, 0xD2, 0xA7, 0x53, 0x9E, 0x03, 0x32, 0x24, 0x19, 0x19, 0xD1, 0x8D, 0x79, 0x1A,
+    0x99, 0x90, 0x29, 0x99, 0xD1, 0xCD, 0x79, 0x2E, 0x88, 0x93, 0x25, 0x59, 0xD1, 0xAD, 0x79, 0x6E,
+    0xC8, 0x96, 0x14, 0x24, 0x16, 0x44, 0x52, 0x90, 0x03, 0x0A, 0xE4, 0x68, 0xAE, 0xC8, 0x07, 0x88,
+    0xC4, 0x05, 0x52, 0x24, 0x25, 0x3E, 0xB0, 0x0C, 0x89, 0x03, 0xCE, 0x21, 0xA9, 0x90, 0x2A, 0x5D,
+    0x8D, 0x8E, 0x7B, 0xC6, 0x75, 0xC2, 0x37, 0xC4, 0x0D, 0xBA, 0x26, 0x5D, 0x8B, 0x73, 0x9B, 0x74,
+    0x48, 0x97, 0xEE, 0x84, 0x8E, 0xDF, 0x45, 0x7C, 0x4A, 0xEE, 0x91, 0xFB, 0x85, 0x92, 0x3C, 0x90,
+    0x8F, 0x41, 0x58, 0x94, 0x20, 0x2C, 0x15, 0x08, 0x82, 0xB0, 0x2C, 0x3B, 0x82, 0x1C, 0xBA, 0x90,
+    0x2E, 0xE4, 0x5C, 0xB9, 0xA2, 0x4A, 0x57, 0xA5, 0xAB, 0xC9, 0x8E, 0x28, 0x87, 0xAE, 0x4E, 0x57,
+    0xE7, 0x1C, 0x5F, 0xD1, 0xA0, 0x6B, 0xA0, 0x7C, 0xB9, 0x01, 0x57, 0x13, 0x29, 0x42, 0xA4, 0xC4,
+    0xB9, 0xBC, 0x87, 0x8E, 0xDB, 0xDC, 0xDC, 0xFF, 0xD3, 0xB1, 0x66, 0xA4, 0x01, 0x12, 0x8D, 0x90,
+    0x6A, 0x0B, 0x3D, 0x4D, 0xD0, 0xD7, 0x87, 0xA2, 0x9A, 0x62, 0xA0, 0x8F, 0x31, 0xD4, 0x1E, 0x32,
+    0x3D, 0xC3, 0x48, 0xFB, 0x32, 0xD6, 0x67, 0x30, 0x55, 0x4C, 0xF4, 0x05, 0xA6, 0x3A, 0xC0, 0x4C,
+    0xCF, 0x65, 0xAE, 0x43, 0x2C, 0xF4, 0x0D, 0x5C, 0x33, 0x2C, 0xF5, 0x1D, 0x56, 0x3A, 0x92, 0xB5,
+    0x5E, 0x60, 0xA3, 0x63, 0x6C, 0xF5, 0x03, 0x23, 0xBF, 0xCC, 0x23, 0x87, 0x72, 0x00, 0x43, 0x85,
+    0x47, 0x73, 0x77, 0x10, 0xF9, 0x69, 0x1E, 0xF9, 0x38, 0x41, 0x83, 0xB0, 0x29, 0x3B, 0x5A, 0x39,
+    0x74, 0xED, 0x3F, 0x45, 0xE6, 0x06, 0x5C, 0x57, 0xA4, 0x42, 0x57, 0xE5, 0x5C, 0xDB, 0x43, 0xC7,
+    0x6D, 0x6E, 0xEE, 0x7F, 0xE1, 0xF8, 0xD3, 0x8C, 0x2C, 0x42, 0x62, 0x09, 0x52, 0x4B, 0xD1, 0xB3,
+    0x1E, 0xFA, 0xD6, 0x17, 0x35, 0xC5, 0xC0, 0x06, 0x18, 0xDA, 0x10, 0x99, 0x65, 0x18, 0xD9, 0x48,
+    0xC6, 0x36, 0x86, 0x99, 0x61, 0x62, 0x13, 0x4C, 0x6D, 0x8A, 0x99, 0xCD, 0x64, 0x6E, 0x73, 0x2C,
+    0x6C, 0x01, 0x37, 0xC7, 0xD2, 0x96, 0x58, 0xD9, 0x4A, 0xD6, 0xB6, 0xC6, 0xC6, 0x36, 0xD8, 0xDA,
+    0x96, 0x91, 0x3F, 0xE5, 0x91, 0xEB, 0x72, 0x00, 0x43, 0xD5, 0x8F, 0xE6, 0xEE, 0x20, 0xF2, 0xEB,
+    0x3C, 0xF2, 0x71, 0x82, 0x12, 0xCE, 0x1D, 0xF2, 0x85, 0x74, 0xE9, 0xBA, 0xFF, 0x12, 0x99, 0x1B,
+    0xF0, 0x2B, 0xE0, 0xC7, 0xA2, 0x6B, 0x70, 0x6E, 0xEE, 0xA1, 0xE3, 0x36, 0xD7, 0xF7, 0xE4, 0x37,
+    0xC7, 0xFF, 0xD9, 0xC8, 0x5B, 0x48, 0x3C, 0x45, 0xEA, 0x67, 0xE8, 0xB9, 0xA2, 0xEF, 0xE7, 0xA2,
+    0x9E, 0x61, 0xE0, 0x17, 0x18, 0xBA, 0x21, 0xF3, 0xCF, 0x18, 0xF9, 0x4C, 0xC6, 0xFE, 0x15, 0xE6,
+    0x8E, 0x89, 0x7F, 0xC7, 0xD4, 0xD7, 0x98, 0xF9, 0x0F, 0x99, 0xFB, 0x4F, 0x2C, 0x1C, 0x70, 0x6F,
+    0x62, 0xE9, 0x8F, 0xB0, 0xF2, 0x27, 0xB2, 0xF6, 0xE7, 0xD8, 0xF8, 0x2B, 0x6C, 0xFD, 0x2D, 0x23,
+    0x7F, 0xCB, 0x23, 0xB7, 0xE5, 0x00, 0x86, 0x6A, 0x1F, 0xCD, 0xDD, 0x41, 0xE4, 0xF7, 0x79, 0xE4,
+    0xDB, 0x04, 0xED, 0x5C, 0x07, 0x0D, 0xC2, 0x13, 0xD9, 0x91, 0xE4, 0xD0, 0x9D, 0xDE, 0x36, 0xF2,
+    0x09, 0x69, 0xD3, 0x75, 0xE8, 0xBA, 0x57, 0xF7, 0x4B, 0xE8, 0xB8, 0x0D, 0xE7, 0x5F, 0x60, 0x37,
+    0x1F, 0x08, 0x15, 0x74, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42,
+    0x60, 0x82
+};
+
+// ---------------------------------------------------------------------------
+// QOI encoder, following the reference implementation
+// ---------------------------------------------------------------------------
+
+std::vector<u8> encodeQoi(const std::vector<u8>& pixels, u32 width, u32 height)
+{
+    std::vector<u8> out = {'q', 'o', 'i', 'f'};
+    putBE32(out, width);
+    putBE32(out, height);
+    out.push_back(4);
+    out.push_back(0);
+
+    u8 index[64 * 4] = {};
+    u8 previous[4] = {0, 0, 0, 255};
+    u32 run = 0;
+    const usize count = static_cast<usize>(width) * height;
+    for (usize i = 0; i < count; ++i)
+    {
+        const u8* p = pixels.data() + i * 4;
+        if (std::memcmp(p, previous, 4) == 0)
+        {
+            ++run;
+            if (run == 62 || i == count - 1)
+            {
+                out.push_back(static_cast<u8>(0xC0 | (run - 1)));
+                run = 0;
+            }
+            continue;
+        }
+        if (run > 0)
+        {
+            out.push_back(static_cast<u8>(0xC0 | (run - 1)));
+            run = 0;
+        }
+
+        const u32 hash = (p[0] * 3u + p[1] * 5u + p[2] * 7u + p[3] * 11u) % 64;
+        if (std::memcmp(index + hash * 4, p, 4) == 0)
+        {
+            out.push_back(static_cast<u8>(hash));
+        }
+        else
+        {
+            std::memcpy(index + hash * 4, p, 4);
+            if (p[3] == previous[3])
+            {
+                const i32 dr = static_cast<i8>(p[0] - previous[0]);
+                const i32 dg = static_cast<i8>(p[1] - previous[1]);
+                const i32 db = static_cast<i8>(p[2] - previous[2]);
+                const i32 drg = dr - dg;
+                const i32 dbg = db - dg;
+                if (dr > -3 && dr < 2 && dg > -3 && dg < 2 && db > -3 && db < 2)
+                {
+                    out.push_back(static_cast<u8>(0x40 | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2)));
+                }
+                else if (drg > -9 && drg < 8 && dg > -33 && dg < 32 && dbg > -9 && dbg < 8)
+                {
+                    out.push_back(static_cast<u8>(0x80 | (dg + 32)));
+                    out.push_back(static_cast<u8>((drg + 8) << 4 | (dbg + 8)));
+                }
+                else
+                {
+                    out.insert(out.end(), {0xFE, p[0], p[1], p[2]});
+                }
+            }
+            else
+            {
+                out.insert(out.end(), {0xFF, p[0], p[1], p[2], p[3]});
+            }
+        }
+        std::memcpy(previous, p, 4);
+    }
+    out.insert(out.end(), {0, 0, 0, 0, 0, 0, 0, 1});
+    return out;
+}
+
+} // namespace
+
+TEST_CASE("ImageKernels match the scalar reference", "[image_decode]")
+{
+    INFO("Kernels built for " << ImageKernels::getInstructionSet());
+
+    SECTION("premultiply rounds to nearest")
+    {
+        // Odd count so the vector loops leave a scalar tail
+        auto pixels = randomPixels(1001, 7);
+        const auto original = pixels;
+        ImageKernels::premultiplyAlpha(pixels.data(), 1001);
+        for (usize i = 0; i < pixels.size(); i += 4)
+        {
+            const u32 a = original[i + 3];
+            for (usize c = 0; c < 3; ++c)
+            {
+                REQUIRE(pixels[i + c] == (original[i + c] * a + 127) / 255);
+            }
+            REQUIRE(pixels[i + 3] == a);
+        }
+    }
+
+    SECTION("red/blue swap")
+    {
+        auto pixels = randomPixels(37, 3);
+        const auto original = pixels;
+        ImageKernels::swapRedBlue(pixels.data(), 37);
+        for (usize i = 0; i < pixels.size(); i += 4)
+        {
+            REQUIRE(pixels[i + 0] == original[i + 2]);
+            REQUIRE(pixels[i + 1] == original[i + 1]);
+            REQUIRE(pixels[i + 2] == original[i + 0]);
+            REQUIRE(pixels[i + 3] == original[i + 3]);
+        }
+    }
+
+    SECTION("sRGB to linear keeps the endpoints and alpha")
+    {
+        std::vector<u8> pixels = {0, 128, 255, 77, 255, 255, 255, 255};
+        ImageKernels::srgbToLinear(pixels.data(), 2);
+        CHECK(pixels[0] == 0);
+        CHECK(pixels[1] >= 54);
+        CHECK(pixels[1] <= 56);
+        CHECK(pixels[2] == 255);
+        CHECK(pixels[3] == 77);
+        CHECK(pixels[7] == 255);
+    }
+
+    SECTION("2x2 box downsample with odd edges")
+    {
+        const u32 width = 37;
+        const u32 height = 9;
+        const u32 stride = width * 4 + 8;
+        const auto source = randomPixels(static_cast<usize>(stride / 4) * height, 11);
+        std::vector<u8> result(18 * 4 * 4);
+        ImageKernels::downsampleHalf(source.data(), width, height, stride, result.data());
+        for (u32 y = 0; y < 4; ++y)
+        {
+            for (u32 x = 0; x < 18; ++x)
+            {
+                for (u32 c = 0; c < 4; ++c)
+                {
+                    auto at = [&](u32 sx, u32 sy) -> u32 {
+                        return source[static_cast<usize>(sy) * stride + sx * 4 + c];
+                    };
+                    const u32 sum = at(x * 2, y * 2) + at(x * 2 + 1, y * 2) +
+                                    at(x * 2, y * 2 + 1) + at(x * 2 + 1, y * 2 + 1);
+                    REQUIRE(result[(static_cast<usize>(y) * 18 + x) * 4 + c] == (sum + 2) / 4);
+                }
+            }
+        }
+
+        // The tent filter clamps at the edges; interior and border pixels
+        // cover both the SIMD and the scalar paths
+        std::vector<u8> tent(18 * 4 * 4);
+        ImageKernels::resampleHalf(source.data(), width, height, stride, tent.data());
+        for (u32 y = 0; y < 4; ++y)
+        {
+            for (u32 x = 0; x < 18; ++x)
+            {
+                for (u32 c = 0; c < 4; ++c)
+                {
+                    auto at = [&](i32 sx, i32 sy) -> u32 {
+                        sx = std::clamp(sx, 0, static_cast<i32>(width) - 1);
+                        sy = std::clamp(sy, 0, static_cast<i32>(height) - 1);
+                        return source[static_cast<usize>(sy) * stride +
+                                      static_cast<usize>(sx) * 4 + c];
+                    };
+                    const i32 weights[4] = {1, 3, 3, 1};
+                    const i32 left = static_cast<i32>(x) * 2 - 1;
+                    const i32 top = static_cast<i32>(y) * 2 - 1;
+                    u32 sum = 0;
+                    for (i32 j = 0; j < 4; ++j)
+                    {
+                        for (i32 k = 0; k < 4; ++k)
+                        {
+                            sum += static_cast<u32>(weights[j] * weights[k]) * at(left + k, top + j);
+                        }
+                    }
+                    REQUIRE(tent[(static_cast<usize>(y) * 18 + x) * 4 + c] == (sum + 32) / 64);
+                }
+            }
+        }
+
+        // A single column is clamped rather than halved
+        std::vector<u8> column = {10, 20, 30, 40, 30, 40, 50, 60};
+        std::vector<u8> single(4);
+        ImageKernels::downsampleHalf(column.data(), 1, 2, 4, single.data());
+        CHECK(single == std::vector<u8>{20, 30, 40, 50});
+    }
+}
+
+TEST_CASE("ImageDecoder decodes PNG color types and bit depths", "[image_decode]")
+{
+    SECTION("RGBA8 with every filter and deflate block type")
+    {
+        const auto pixels = makeImage(41, 13);
+        for (Deflate mode : {Deflate::Stored, Deflate::Fixed, Deflate::FixedThenStored})
+        {
+            PngSpec spec = rgbaSpec(pixels, 41, 13);
+            spec.deflate = mode;
+            const auto png = writePng(spec);
+            REQUIRE(ImageDecoder::detectFormat(png.data(), png.size()) == ImageFormat::PNG);
+
+            auto image = ImageDecoder::decodePNG(png.data(), png.size());
+            REQUIRE(image.isOk());
+            CHECK(image.value().width == 41);
+            CHECK(image.value().height == 13);
+            CHECK_FALSE(image.value().premultiplied);
+            CHECK(image.value().pixels == pixels);
+        }
+    }
+
+    SECTION("dynamic Huffman stream from zlib")
+    {
+        auto image = ImageDecoder::decodePNG(ZLIB_DYNAMIC_PNG, sizeof(ZLIB_DYNAMIC_PNG));
+        REQUIRE(image.isOk());
+        REQUIRE(image.value().width == 24);
+        REQUIRE(image.value().height == 20);
+        for (u32 y = 0; y < 20; ++y)
+        {
+            for (u32 x = 0; x < 24; ++x)
+            {
+                const u8* p = image.value().pixels.data() + (y * 24 + x) * 4;
+                REQUIRE(p[0] == static_cast<u8>(x * 10));
+                REQUIRE(p[1] == static_cast<u8>(y * 12));
+                REQUIRE(p[2] == static_cast<u8>(x * y));
+                REQUIRE(p[3] == ((x + y) % 5 != 0 ? 255 : 0));
+            }
+        }
+    }
+
+    SECTION("RGB8 with a color key")
+    {
+        PngSpec spec;
+        spec.width = 3;
+        spec.height = 2;
+        spec.colorType = 2;
+        spec.rows = {{1, 2, 3, 9, 9, 9, 4, 5, 6}, {9, 9, 9, 7, 8, 9, 0, 0, 0}};
+        spec.transparency = {0, 9, 0, 9, 0, 9};
+        const auto png = writePng(spec);
+
+        auto image = ImageDecoder::decodePNG(png.data(), png.size());
+        REQUIRE(image.isOk());
+        const std::vector<u8> expected = {1, 2, 3, 255, 9, 9, 9, 0,   4, 5, 6, 255,
+                                          9, 9, 9, 0,   7, 8, 9, 255, 0, 0, 0, 255};
+        CHECK(image.value().pixels == expected);
+    }
+
+    SECTION("grayscale at every bit depth")
+    {
+        for (u32 depth : {1u, 2u, 4u, 8u, 16u})
+        {
+            const u32 maxValue = (1u << depth) - 1;
+            const u32 width = 11;
+            PngSpec spec;
+            spec.width = width;
+            spec.height = 3;
+            spec.colorType = 0;
+            spec.bitDepth = static_cast<u8>(depth);
+            for (u32 y = 0; y < 3; ++y)
+            {
+                std::vector<u32> samples;
+                for (u32 x = 0; x < width; ++x)
+                {
+                    samples.push_back((x * 7 + y * 3) % (maxValue + 1));
+                }
+                spec.rows.push_back(packSamples(samples, depth));
+            }
+            const auto png = writePng(spec);
+
+            auto image = ImageDecoder::decodePNG(png.data(), png.size());
+            INFO("bit depth " << depth);
+            REQUIRE(image.isOk());
+            for (u32 y = 0; y < 3; ++y)
+            {
+                for (u32 x = 0; x < width; ++x)
+                {
+                    const u32 sample = (x * 7 + y * 3) % (maxValue + 1);
+                    const u32 expected = depth == 16 ? sample >> 8 : sample * 255 / maxValue;
+                    const u8* p = image.value().pixels.data() + (y * width + x) * 4;
+                    REQUIRE(p[0] == expected);
+                    REQUIRE(p[2] == expected);
+                    REQUIRE(p[3] == 255);
+                }
+            }
+        }
+    }
+
+    SECTION("4-bit palette with transparency")
+    {
+        PngSpec spec;
+        spec.width = 5;
+        spec.height = 2;
+        spec.colorType = 3;
+        spec.bitDepth = 4;
+        spec.palette = {255, 0, 0, 0, 255, 0, 0, 0, 255};
+        spec.transparency = {128};
+        spec.rows = {packSamples({0, 1, 2, 1, 0}, 4), packSamples({2, 2, 1, 0, 1}, 4)};
+        const auto png = writePng(spec);
+
+        auto image = ImageDecoder::decodePNG(png.data(), png.size());
+        REQUIRE(image.isOk());
+        const u8* first = image.value().pixels.data();
+        CHECK(std::vector<u8>(first, first + 8) == std::vector<u8>{255, 0, 0, 128, 0, 255, 0, 255});
+        const u8* last = first + 9 * 4;
+        CHECK(std::vector<u8>(last, last + 4) == std::vector<u8>{0, 255, 0, 255});
+    }
+
+    SECTION("16-bit gray+alpha and RGBA keep the high byte")
+    {
+        PngSpec grayAlpha;
+        grayAlpha.width = 2;
+        grayAlpha.height = 1;
+        grayAlpha.colorType = 4;
+        grayAlpha.bitDepth = 16;
+        grayAlpha.rows = {packSamples({0x1234, 0xFF00, 0xABCD, 0x0101}, 16)};
+        auto png = writePng(grayAlpha);
+        auto image = ImageDecoder::decodePNG(png.data(), png.size());
+        REQUIRE(image.isOk());
+        CHECK(image.value().pixels ==
+              std::vector<u8>{0x12, 0x12, 0x12, 0xFF, 0xAB, 0xAB, 0xAB, 0x01});
+
+        PngSpec rgba;
+        rgba.width = 1;
+        rgba.height = 1;
+        rgba.bitDepth = 16;
+        rgba.rows = {packSamples({0x1000, 0x2000, 0x3000, 0x8000}, 16)};
+        png = writePng(rgba);
+        image = ImageDecoder::decodePNG(png.data(), png.size());
+        REQUIRE(image.isOk());
+        CHECK(image.value().pixels == std::vector<u8>{0x10, 0x20, 0x30, 0x80});
+    }
+
+    SECTION("malformed files are rejected")
+    {
+        const auto pixels = makeImage(16, 8);
+        PngSpec spec = rgbaSpec(pixels, 16, 8);
+        spec.interlace = 1;
+        auto png = writePng(spec);
+        CHECK(ImageDecoder::decodePNG(png.data(), png.size()).isError());
+
+        spec.interlace = 0;
+        png = writePng(spec);
+        CHECK(ImageDecoder::decodePNG(png.data(), png.size() - 20).isError());
+
+        // Damage the deflate data in the first IDAT (after the zlib header)
+        auto corrupt = png;
+        for (usize i = 66; i < 90; ++i)
+        {
+            corrupt[i] = static_cast<u8>(corrupt[i] ^ 0x5A);
+        }
+        CHECK(ImageDecoder::decodePNG(corrupt.data(), corrupt.size()).isError());
+
+        // Too few rows of image data
+        PngSpec shortSpec = rgbaSpec(pixels, 16, 8);
+        shortSpec.rows.pop_back();
+        png = writePng(shortSpec);
+        CHECK(ImageDecoder::decodePNG(png.data(), png.size()).isError());
+
+        const std::vector<u8> garbage = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+        CHECK(ImageDecoder::detectFormat(garbage.data(), garbage.size()) == ImageFormat::Unknown);
+        CHECK(ImageDecoder::decode(garbage.data(), garbage.size()).isError());
+    }
+}
+
+TEST_CASE("ImageDecoder decodes QOI", "[image_decode]")
+{
+    auto pixels = makeImage(67, 29);
+    // Sprinkle noise so every QOI op appears
+    const auto noise = randomPixels(67 * 29, 5);
+    for (usize i = 0; i < pixels.size(); i += 4 * 13)
+    {
+        std::memcpy(pixels.data() + i, noise.data() + i, 4);
+    }
+    const auto qoi = encodeQoi(pixels, 67, 29);
+    REQUIRE(ImageDecoder::detectFormat(qoi.data(), qoi.size()) == ImageFormat::QOI);
+
+    auto image = ImageDecoder::decodeQOI(qoi.data(), qoi.size());
+    REQUIRE(image.isOk());
+    CHECK(image.value().width == 67);
+    CHECK(image.value().height == 29);
+    CHECK(image.value().pixels == pixels);
+
+    CHECK(ImageDecoder::decodeQOI(qoi.data(), qoi.size() / 2).isError());
+    auto badChannels = qoi;
+    badChannels[12] = 2;
+    CHECK(ImageDecoder::decodeQOI(badChannels.data(), badChannels.size()).isError());
+}
+
+TEST_CASE("ImageDecoder post-processing", "[image_decode]")
+{
+    const auto pixels = makeImage(64, 48);
+    const auto qoi = encodeQoi(pixels, 64, 48);
+
+    ImageDecodeOptions options;
+    options.maxWidth = 20;
+    options.pixelOrder = PixelOrder::BGRA;
+    auto image = ImageDecoder::decode(qoi.data(), qoi.size(), options);
+    REQUIRE(image.isOk());
+    const DecodedImage& result = image.value();
+    CHECK(result.width == 16);
+    CHECK(result.height == 12);
+    CHECK(result.pixels.size() == 16 * 12 * 4);
+    CHECK(result.premultiplied);
+    CHECK(result.pixelOrder == PixelOrder::BGRA);
+
+    // Same result as premultiply, two halvings and a swap done by hand
+    auto expected = pixels;
+    ImageKernels::premultiplyAlpha(expected.data(), 64 * 48);
+    std::vector<u8> half(32 * 24 * 4);
+    ImageKernels::resampleHalf(expected.data(), 64, 48, 64 * 4, half.data());
+    std::vector<u8> quarter(16 * 12 * 4);
+    ImageKernels::resampleHalf(half.data(), 32, 24, 32 * 4, quarter.data());
+    ImageKernels::swapRedBlue(quarter.data(), 16 * 12);
+    CHECK(result.pixels == quarter);
+
+    ImageDecodeOptions linear;
+    linear.premultiplyAlpha = false;
+    linear.convertToLinear = true;
+    image = ImageDecoder::decode(qoi.data(), qoi.size(), linear);
+    REQUIRE(image.isOk());
+    CHECK(image.value().linear);
+    CHECK_FALSE(image.value().premultiplied);
+    CHECK(image.value().pixels[1] <= pixels[1]);
+}
+
+TEST_CASE("ImageDecodeService decodes on worker threads", "[image_decode]")
+{
+    ImageDecodeService service;
+    CHECK_FALSE(service.hasPending());
+
+    std::vector<u64> decodedTickets;
+    std::vector<u32> widths;
+    usize errors = 0;
+    std::vector<u64> submitted;
+    for (u32 i = 1; i <= 6; ++i)
+    {
+        const auto pixels = makeImage(8 * i, 4);
+        const u64 ticket =
+            service.submit(encodeQoi(pixels, 8 * i, 4), {}, [&, i](Result<DecodedImage> image) {
+                REQUIRE(image.isOk());
+                CHECK(image.value().width == 8 * i);
+                widths.push_back(image.value().width);
+
+                Texture texture;
+                REQUIRE(ImageDecodeService::upload(image.value(), texture).isOk());
+                CHECK(texture.getWidth() == static_cast<i32>(8 * i));
+                CHECK(texture.isPremultiplied());
+            });
+        submitted.push_back(ticket);
+    }
+    service.submit({1, 2, 3}, {}, [&](Result<DecodedImage> image) {
+        CHECK(image.isError());
+        ++errors;
+    });
+
+    // Tickets are unique and increasing
+    for (usize i = 1; i < submitted.size(); ++i)
+    {
+        CHECK(submitted[i] > submitted[i - 1]);
+    }
+
+    service.waitForAll();
+    CHECK(service.hasPending()); // Finished but not yet handed back
+    CHECK(widths.empty());
+
+    CHECK(service.processCompleted(2) == 2);
+    CHECK(service.processCompleted() == 5);
+    CHECK_FALSE(service.hasPending());
+    CHECK(widths.size() == 6);
+    CHECK(errors == 1);
+
+    // Unprocessed results are dropped on shutdown
+    service.submit(encodeQoi(makeImage(4, 4), 4, 4), {}, [&](Result<DecodedImage>) { ++errors; });
+    service.waitForAll();
+    service.shutdown();
+    CHECK(service.processCompleted() == 0);
+    CHECK(errors == 1);
+}
+
+TEST_CASE("Image decode throughput for a 1080p CG", "[.][benchmark][image_decode]")
+{
+    const u32 width = 1920;
+    const u32 height = 1080;
+    const auto pixels = makeImage(width, height);
+    const auto png = writePng(rgbaSpec(pixels, width, height));
+    const auto qoi = encodeQoi(pixels, width, height);
+    auto raw = RawTexture::encode(pixels.data(), width, height, 0, {});
+    REQUIRE(raw.isOk());
+
+    constexpr int RUNS = 10;
+    auto timeRuns = [](auto&& body) {
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < RUNS; ++i)
+        {
+            body();
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<f64, std::milli>(elapsed).count() / RUNS;
+    };
+
+    const f64 pngMs = timeRuns([&]() {
+        auto image = ImageDecoder::decode(png.data(), png.size());
+        REQUIRE(image.isOk());
+    });
+    const f64 qoiMs = timeRuns([&]() {
+        auto image = ImageDecoder::decode(qoi.data(), qoi.size());
+        REQUIRE(image.isOk());
+    });
+    const f64 rawMs = timeRuns([&]() {
+        Texture texture;
+        REQUIRE(texture.loadFromMemory(raw.value()).isOk());
+    });
+
+    // Four CGs decoded in parallel through the service
+    ImageDecodeService service;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 4; ++i)
+    {
+        service.submit(png, {}, [](Result<DecodedImage> image) { REQUIRE(image.isOk()); });
+    }
+    service.waitForAll();
+    service.processCompleted();
+    const f64 parallelMs =
+        std::chrono::duration<f64, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    const f64 megapixels = static_cast<f64>(width) * height / 1e6;
+    INFO("Kernels: " << ImageKernels::getInstructionSet());
+    INFO("PNG " << pngMs << " ms (" << megapixels / pngMs * 1000.0 << " MP/s, " << png.size()
+                << " bytes)");
+    INFO("QOI " << qoiMs << " ms (" << megapixels / qoiMs * 1000.0 << " MP/s, " << qoi.size()
+                << " bytes)");
+    INFO("Raw LZ4 " << rawMs << " ms (" << raw.value().size() << " bytes)");
+    INFO("4 PNGs on the service " << parallelMs << " ms");
+    CHECK(rawMs < pngMs);
+    CHECK(qoiMs < pngMs);
+}
@@ -0,0 +1,289 @@
+#include <catch2/catch_test_macros.hpp>
+#include "NovelMind/vfs/content_chunker.hpp"
+#include "NovelMind/vfs/multi_pack_manager.hpp"
+#include "NovelMind/vfs/pack_reader.hpp"
+#include "NovelMind/vfs/pack_writer.hpp"
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <unordered_set>
+
+using namespace NovelMind;
+using namespace NovelMind::vfs;
+
+namespace
+{
+
+std::vector<u8> randomBytes(usize size, u64 seed)
+{
+    std::vector<u8> data(size);
+    for (auto& byte : data)
+    {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        byte = static_cast<u8>(seed >> 56);
+    }
+    return data;
+}
+
+std::string tempPackPath(const std::string& name)
+{
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+} // namespace
+
+TEST_CASE("ContentChunker splits deterministically within bounds", "[vfs][chunking]")
+{
+    const auto data = randomBytes(300 * 1024, 1);
+    ChunkerParams params;
+
+    const auto chunks = ContentChunker::split(data.data(), data.size(), params);
+    REQUIRE(chunks.size() > 1);
+
+    usize covered = 0;
+    for (usize i = 0; i < chunks.size(); ++i)
+    {
+        REQUIRE(chunks[i].offset == covered);
+        REQUIRE(chunks[i].size <= params.maxSize);
+        if (i + 1 < chunks.size())
+        {
+            REQUIRE(chunks[i].size >= params.minSize);
+        }
+        covered += chunks[i].size;
+    }
+    REQUIRE(covered == data.size());
+
+    const auto again = ContentChunker::split(data.data(), data.size(), params);
+    REQUIRE(again.size() == chunks.size());
+
+    const auto small = ContentChunker::split(data.data(), 100, params);
+    REQUIRE(small.size() == 1);
+    REQUIRE(small[0].size == 100);
+}
+
+TEST_CASE("ContentChunker boundaries survive an insertion", "[vfs][chunking]")
+{
+    const auto original = randomBytes(256 * 1024, 7);
+    auto edited = original;
+    const std::vector<u8> insertion = {'t', 'y', 'p', 'o'};
+    edited.insert(edited.begin() + 100 * 1024, insertion.begin(), insertion.end());
+
+    auto digests = [](const std::vector<u8>& data) {
+        std::unordered_set<ChunkDigest, ChunkDigestHash> result;
+        for (const auto& span : ContentChunker::split(data.data(), data.size()))
+        {
+            result.insert(ContentChunker::digest(data.data() + span.offset, span.size));
+        }
+        return result;
+    };
+
+    const auto before = digests(original);
+    const auto after = digests(edited);
+    usize shared = 0;
+    for (const auto& digest : after)
+    {
+        shared += before.count(digest);
+    }
+
+    // Only the chunks around the edit change
+    REQUIRE(shared + 3 >= before.size());
+}
+
+TEST_CASE("PackWriter stores shared chunks once and reads back", "[vfs][chunking]")
+{
+    const auto cg = randomBytes(200 * 1024, 3);
+    auto variant = cg;
+    for (usize i = 150 * 1024; i < 152 * 1024; ++i)
+    {
+        variant[i] = static_cast<u8>(variant[i] ^ 0xFF);
+    }
+    const std::vector<u8> tiny = {1, 2, 3};
+
+    PackWriter writer;
+    writer.addResource("cg/day.png", ResourceType::Texture, cg);
+    writer.addResource("cg/night.png", ResourceType::Texture, variant);
+    writer.addResource("data/tiny.bin", ResourceType::Data, tiny);
+
+    const std::string path = tempPackPath("nm_test_chunked.nmres");
+    auto written = writer.write(path);
+    REQUIRE(written.isOk());
+    const PackWriteStats stats = written.value();
+    REQUIRE(stats.resourceCount == 3);
+    REQUIRE(stats.inputBytes == cg.size() + variant.size() + tiny.size());
+    REQUIRE(stats.storedBytes < cg.size() + 64 * 1024);
+    REQUIRE(stats.dedupedBytes + stats.storedBytes == stats.inputBytes);
+
+    PackReader reader;
+    REQUIRE(reader.mount(path).isOk());
+    REQUIRE(reader.readFile("cg/day.png").value() == cg);
+    REQUIRE(reader.readFile("cg/night.png").value() == variant);
+    REQUIRE(reader.readFile("data/tiny.bin").value() == tiny);
+    REQUIRE(reader.getInfo("cg/night.png")->size == variant.size());
+
+    reader.unmountAll();
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("PackWriter without chunking writes the classic layout", "[vfs][chunking]")
+{
+    const auto data = randomBytes(10 * 1024, 9);
+
+    PackWriter writer;
+    writer.setChunkingEnabled(false);
+    writer.addResource("script.nms", ResourceType::Script, data);
+
+    const std::string path = tempPackPath("nm_test_plain.nmres");
+    auto written = writer.write(path);
+    REQUIRE(written.isOk());
+    REQUIRE(written.value().chunkCount == 0);
+
+    PackReader reader;
+    REQUIRE(reader.mount(path).isOk());
+    REQUIRE(reader.readFile("script.nms").value() == data);
+    REQUIRE(reader.getChunkDigests().empty());
+
+    reader.unmountAll();
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Patch packs resolve external chunks from the base pack", "[vfs][chunking]")
+{
+    const auto bundle = randomBytes(256 * 1024, 11);
+    auto fixed = bundle;
+    fixed[128 * 1024] = static_cast<u8>(fixed[128 * 1024] + 1);
+
+    const std::string basePath = tempPackPath("nm_chunk_base.nmres");
+    const std::string patchPath = tempPackPath("nm_chunk_patch.nmres");
+
+    PackWriter baseWriter;
+    baseWriter.addResource("scripts/bundle.nms", ResourceType::Script, bundle);
+    REQUIRE(baseWriter.write(basePath).isOk());
+
+    PackReader baseReader;
+    REQUIRE(baseReader.mount(basePath).isOk());
+
+    PackWriter patchWriter;
+    patchWriter.addBaseChunks(baseReader.getChunkDigests());
+    patchWriter.addResource("scripts/bundle.nms", ResourceType::Script, fixed);
+    auto patchStats = patchWriter.write(patchPath);
+    REQUIRE(patchStats.isOk());
+    REQUIRE(patchStats.value().externalChunkCount > 0);
+    REQUIRE(patchStats.value().storedBytes < bundle.size() / 2);
+    baseReader.unmountAll();
+
+    // Without the base the patch cannot be reassembled
+    PackReader standalone;
+    REQUIRE(standalone.mount(patchPath).isOk());
+    REQUIRE(standalone.readFile("scripts/bundle.nms").isError());
+    standalone.unmountAll();
+
+    {
+        MultiPackManager manager;
+        REQUIRE(manager.initialize().isOk());
+        REQUIRE(manager.loadBasePack(basePath).success);
+        REQUIRE(manager.loadPack(patchPath, PackType::Patch).success);
+
+        REQUIRE(manager.getResourcePack("scripts/bundle.nms") == "nm_chunk_patch");
+        auto data = manager.readResource("scripts/bundle.nms");
+        REQUIRE(data.isOk());
+        REQUIRE(data.value() == fixed);
+
+        manager.shutdown();
+    }
+
+    std::filesystem::remove(basePath);
+    std::filesystem::remove(patchPath);
+}
+
+TEST_CASE("External chunks resolve without holding the reader lock", "[vfs][chunking]")
+{
+    const auto bundle = randomBytes(256 * 1024, 13);
+    auto fixed = bundle;
+    fixed[64 * 1024] = static_cast<u8>(fixed[64 * 1024] + 1);
+
+    const std::string basePath = tempPackPath("nm_chunk_reentry_base.nmres");
+    const std::string patchPath = tempPackPath("nm_chunk_reentry_patch.nmres");
+
+    PackWriter baseWriter;
+    baseWriter.addResource("base/bundle.nms", ResourceType::Script, bundle);
+    REQUIRE(baseWriter.write(basePath).isOk());
+
+    PackReader reader;
+    REQUIRE(reader.mount(basePath).isOk());
+
+    PackWriter patchWriter;
+    patchWriter.addBaseChunks(reader.getChunkDigests());
+    patchWriter.addResource("patch/bundle.nms", ResourceType::Script, fixed);
+    REQUIRE(patchWriter.write(patchPath).isOk());
+    REQUIRE(reader.mount(patchPath).isOk());
+
+    // The resolver calls back into the reader that is mid-read
+    reader.setExternalChunkResolver(
+        [&reader](const ChunkDigest& digest, u8* out, u32 size) {
+            return reader.readChunk(digest, out, size);
+        });
+    auto data = reader.readFile("patch/bundle.nms");
+    REQUIRE(data.isOk());
+    REQUIRE(data.value() == fixed);
+    REQUIRE(reader.readFile("base/bundle.nms").value() == bundle);
+
+    reader.unmountAll();
+    std::filesystem::remove(basePath);
+    std::filesystem::remove(patchPath);
+}
+
+TEST_CASE("PackReader rejects a chunk table larger than the file", "[vfs][chunking]")
+{
+    PackWriter writer;
+    writer.addResource("data/blob.bin", ResourceType::Data, randomBytes(4096, 17));
+    const std::string path = tempPackPath("nm_chunk_corrupt.nmres");
+    REQUIRE(writer.write(path).isOk());
+
+    auto corrupt = [&path](std::streamoff offset, u32 value) {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(offset);
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+    const auto countOffset = static_cast<std::streamoff>(sizeof(PackHeader));
+
+    corrupt(countOffset, 0xFFFFFFFFu);
+    PackReader reader;
+    auto mounted = reader.mount(path);
+    REQUIRE(mounted.isError());
+    REQUIRE(mounted.error() == "Corrupt chunk table");
+
+    corrupt(countOffset, 1);
+    corrupt(countOffset + static_cast<std::streamoff>(sizeof(u32)), 0x40000000u);
+    REQUIRE(reader.mount(path).isError());
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("PackReader rejects entry sizes its data cannot back", "[vfs][chunking]")
+{
+    const std::string path = tempPackPath("nm_chunk_entry_size.nmres");
+    auto patchEntry = [&path](usize field, u64 value) {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        PackHeader header{};
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        file.seekp(static_cast<std::streamoff>(header.resourceTableOffset + field));
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+
+    for (bool chunking : {false, true})
+    {
+        PackWriter writer;
+        writer.setChunkingEnabled(chunking);
+        writer.addResource("data/blob.bin", ResourceType::Data, randomBytes(4096, 19));
+        REQUIRE(writer.write(path).isOk());
+
+        patchEntry(chunking ? offsetof(PackResourceEntry, uncompressedSize)
+                            : offsetof(PackResourceEntry, compressedSize),
+                   u64{1} << 40);
+        PackReader reader;
+        REQUIRE(reader.mount(path).isOk());
+        CHECK(reader.readFile("data/blob.bin").isError());
+    }
+
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,216 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "NovelMind/scene/particle_system.hpp"
+#include "NovelMind/scene/scene_graph.hpp"
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+
+using namespace NovelMind;
+using namespace NovelMind::scene;
+using Catch::Approx;
+
+namespace
+{
+
+class BatchCountingRenderer : public renderer::IRenderer
+{
+public:
+    Result<void> initialize(platform::IWindow&) override { return Result<void>::ok(); }
+    void shutdown() override {}
+    void beginFrame() override {}
+    void endFrame() override {}
+    void clear(const renderer::Color&) override {}
+    void setBlendMode(renderer::BlendMode) override {}
+    void drawSprite(const renderer::Texture&, const renderer::Transform2D&,
+                    const renderer::Color&) override {}
+    void drawSprite(const renderer::Texture&, const renderer::Rect&, const renderer::Transform2D&,
+                    const renderer::Color&) override {}
+    void drawRect(const renderer::Rect&, const renderer::Color&) override {}
+    void fillRect(const renderer::Rect&, const renderer::Color&) override { ++singleRects; }
+    void fillRects(const renderer::Rect*, const renderer::Color* colors, usize count) override
+    {
+        ++batches;
+        batchedRects += count;
+        lastAlpha = count > 0 ? colors[0].a : 0;
+    }
+    void setFade(f32, const renderer::Color&) override {}
+    [[nodiscard]] i32 getWidth() const override { return 1920; }
+    [[nodiscard]] i32 getHeight() const override { return 1080; }
+
+    usize singleRects = 0;
+    usize batches = 0;
+    usize batchedRects = 0;
+    u8 lastAlpha = 0;
+};
+
+ParticleEmitterDef fixedEmitter(u32 capacity)
+{
+    ParticleEmitterDef def;
+    def.maxParticles = capacity;
+    def.emissionRate = 0.0f;
+    def.lifetimeMin = 1.0f;
+    def.lifetimeMax = 1.0f;
+    def.spawnArea = {100.0f, 50.0f, 0.0f, 0.0f};
+    def.velocityMinX = def.velocityMaxX = 10.0f;
+    def.velocityMinY = def.velocityMaxY = 20.0f;
+    def.gravityY = 100.0f;
+    return def;
+}
+
+} // namespace
+
+TEST_CASE("ParticleSystem integrates every particle including the scalar tail", "[scene][particles]")
+{
+    ParticleSystem particles;
+    particles.setEmitter(fixedEmitter(7));
+    particles.burst(10);
+    REQUIRE(particles.getAliveCount() == 7);
+
+    particles.update(0.1f);
+    for (usize i = 0; i < particles.getAliveCount(); ++i)
+    {
+        // Semi-implicit Euler: velocity first, then position
+        REQUIRE(particles.getPositionsX()[i] == Approx(101.0f));
+        REQUIRE(particles.getPositionsY()[i] == Approx(50.0f + (20.0f + 10.0f) * 0.1f));
+    }
+}
+
+TEST_CASE("ParticleSystem recycles expired particles without growing the pool", "[scene][particles]")
+{
+    ParticleEmitterDef def = fixedEmitter(100);
+    def.emissionRate = 1000.0f;
+    def.lifetimeMin = 0.5f;
+    def.lifetimeMax = 1.0f;
+
+    ParticleSystem particles;
+    particles.setEmitter(def);
+    particles.setEmitting(true);
+    for (int frame = 0; frame < 30; ++frame)
+    {
+        particles.update(1.0f / 60.0f);
+    }
+    REQUIRE(particles.getAliveCount() == 100);
+    REQUIRE(particles.getCapacity() == 100);
+
+    // Half intensity keeps the pool below capacity in steady state
+    def.maxParticles = 2000;
+    particles.setEmitter(def);
+    particles.setEmitting(true);
+    particles.setIntensity(0.5f);
+    for (int frame = 0; frame < 120; ++frame)
+    {
+        particles.update(1.0f / 60.0f);
+    }
+    REQUIRE(particles.getAliveCount() > 250);
+    REQUIRE(particles.getAliveCount() <= 500);
+
+    particles.setEmitting(false);
+    particles.update(1.1f);
+    REQUIRE(particles.getAliveCount() == 0);
+    REQUIRE(particles.getCapacity() == 2000);
+}
+
+TEST_CASE("ParticleEmitterDef parses data files", "[scene][particles]")
+{
+    auto def = ParticleEmitterDef::parse(R"({
+        "emissionRate": 40, "maxParticles": 300,
+        "lifetimeMin": 6, "lifetimeMax": 9.5,
+        "spawnWidth": 1280, "gravityY": -5e1,
+        "startColor": "#FFC0D8", "endColor": "#FFC0D800",
+        "comment": "sakura"
+    })");
+    REQUIRE(def.isOk());
+    REQUIRE(def.value().emissionRate == Approx(40.0f));
+    REQUIRE(def.value().maxParticles == 300);
+    REQUIRE(def.value().lifetimeMax == Approx(9.5f));
+    REQUIRE(def.value().spawnArea.width == Approx(1280.0f));
+    REQUIRE(def.value().gravityY == Approx(-50.0f));
+    REQUIRE(def.value().startColor == renderer::Color(255, 192, 216, 255));
+    REQUIRE(def.value().endColor == renderer::Color(255, 192, 216, 0));
+
+    REQUIRE(ParticleEmitterDef::parse("[]").isError());
+    REQUIRE(ParticleEmitterDef::parse(R"({"width": oops})").isError());
+    REQUIRE(ParticleEmitterDef::parse(R"({"startColor": "red"})").isError());
+    REQUIRE(ParticleEmitterDef::parse(R"({"lifetimeMin": 0})").isError());
+    REQUIRE(ParticleEmitterDef::parse(R"({"maxParticles": -1})").isError());
+    REQUIRE(ParticleEmitterDef::parse(R"({"maxParticles": nan})").isError());
+    REQUIRE(ParticleEmitterDef::loadFromFile("does/not/exist.json").isError());
+}
+
+TEST_CASE("EffectOverlayObject renders weather as one batch", "[scene][particles]")
+{
+    EffectOverlayObject overlay("weather");
+    overlay.setEffectType(EffectOverlayObject::EffectType::Rain);
+    overlay.startEffect(0.0f);
+    for (int frame = 0; frame < 10; ++frame)
+    {
+        overlay.update(1.0 / 60.0);
+    }
+
+    BatchCountingRenderer renderer;
+    overlay.render(renderer);
+    REQUIRE(renderer.batches == 1);
+    REQUIRE(renderer.batchedRects == overlay.getParticles().getAliveCount());
+    REQUIRE(renderer.batchedRects > 0);
+    REQUIRE(renderer.singleRects == 0);
+
+    // Drops already in flight finish falling after the effect stops
+    overlay.stopEffect();
+    overlay.update(0.1);
+    overlay.render(renderer);
+    REQUIRE(renderer.batches == 2);
+    overlay.update(2.0);
+    overlay.render(renderer);
+    REQUIRE(renderer.batches == 2);
+}
+
+TEST_CASE("EffectOverlayObject restores a custom emitter from its file", "[scene][particles]")
+{
+    const auto path = (std::filesystem::temp_directory_path() / "nm_petals.json").string();
+    {
+        std::ofstream file(path);
+        file << R"({"emissionRate": 120, "maxParticles": 64, "lifetimeMin": 5, "lifetimeMax": 5})";
+    }
+
+    EffectOverlayObject overlay("petals");
+    REQUIRE(overlay.loadParticleEmitter(path).isOk());
+    overlay.setEffectType(EffectOverlayObject::EffectType::Custom);
+    overlay.startEffect(0.0f);
+    const auto state = overlay.saveState();
+
+    EffectOverlayObject restored("petals");
+    restored.loadState(state);
+    REQUIRE(restored.getParticles().getCapacity() == 64);
+    restored.update(1.0);
+    REQUIRE(restored.getParticles().getAliveCount() == 64);
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("ParticleSystem updates 50k particles within 1 ms", "[.][benchmark][particles]")
+{
+    ParticleEmitterDef def = ParticleEmitterDef::snow();
+    def.maxParticles = 50000;
+    def.lifetimeMin = 1000.0f;
+    def.lifetimeMax = 1000.0f;
+
+    ParticleSystem particles;
+    particles.setEmitter(def);
+    particles.burst(50000);
+    REQUIRE(particles.getAliveCount() == 50000);
+
+    constexpr int FRAMES = 200;
+    const auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < FRAMES; ++frame)
+    {
+        particles.update(1.0f / 60.0f);
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    const f64 perFrameMs =
+        std::chrono::duration<f64, std::milli>(elapsed).count() / static_cast<f64>(FRAMES);
+
+    INFO("Update of 50k particles took " << perFrameMs << " ms");
+    REQUIRE(particles.getAliveCount() == 50000);
+    REQUIRE(perFrameMs < 1.0);
+}
@@ -0,0 +1,152 @@
+#include <catch2/catch_test_macros.hpp>
+#include "NovelMind/vfs/binary_delta.hpp"
+#include "NovelMind/vfs/multi_pack_manager.hpp"
+#include "NovelMind/vfs/pack_writer.hpp"
+#include "NovelMind/vfs/patch_pack_builder.hpp"
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+
+using namespace NovelMind;
+using namespace NovelMind::vfs;
+
+namespace
+{
+
+std::vector<u8> randomBytes(usize size, u64 seed)
+{
+    std::vector<u8> data(size);
+    for (auto& byte : data)
+    {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        byte = static_cast<u8>(seed >> 56);
+    }
+    return data;
+}
+
+std::string tempPackPath(const std::string& name)
+{
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+} // namespace
+
+TEST_CASE("BinaryDelta round-trips edits, insertions and deletions", "[vfs][delta]")
+{
+    const auto base = randomBytes(64 * 1024, 5);
+    auto target = base;
+    target[1000] = static_cast<u8>(target[1000] + 1);
+    target.insert(target.begin() + 20000, {'n', 'e', 'w'});
+    target.erase(target.begin() + 40000, target.begin() + 40500);
+
+    const auto delta = BinaryDelta::create(base, target);
+    REQUIRE(delta.size() < 512);
+
+    auto applied = BinaryDelta::apply(base, delta);
+    REQUIRE(applied.isOk());
+    REQUIRE(applied.value() == target);
+
+    auto header = BinaryDelta::readHeader(delta);
+    REQUIRE(header.isOk());
+    REQUIRE(header.value().targetSize == target.size());
+
+    // Small and empty inputs degrade to a literal
+    const std::vector<u8> empty;
+    REQUIRE(BinaryDelta::apply(empty, BinaryDelta::create(empty, target)).value() == target);
+    REQUIRE(BinaryDelta::apply(base, BinaryDelta::create(base, empty)).value().empty());
+}
+
+TEST_CASE("BinaryDelta rejects a different base", "[vfs][delta]")
+{
+    const auto base = randomBytes(8 * 1024, 6);
+    auto target = base;
+    target[10] = 0;
+
+    const auto delta = BinaryDelta::create(base, target);
+    auto other = base;
+    other[5000] = static_cast<u8>(other[5000] ^ 1);
+
+    REQUIRE(BinaryDelta::apply(other, delta).isError());
+    REQUIRE(BinaryDelta::apply(base, std::vector<u8>{1, 2, 3}).isError());
+}
+
+TEST_CASE("BinaryDelta checks the target size against its instructions", "[vfs][delta]")
+{
+    const auto base = randomBytes(8 * 1024, 7);
+    auto target = base;
+    target[100] = 0;
+    const auto delta = BinaryDelta::create(base, target);
+
+    // A target size the instructions do not add up to is rejected before
+    // the target is allocated
+    for (const u64 size : {u64{0xFFFFFFFFFFFFull}, u64{target.size() + 1}, u64{target.size() - 1}})
+    {
+        auto corrupt = delta;
+        std::memcpy(corrupt.data() + offsetof(DeltaHeader, targetSize), &size, sizeof(size));
+        auto applied = BinaryDelta::apply(base, corrupt);
+        REQUIRE(applied.isError());
+        CHECK(applied.error() != "Delta result does not match its digest");
+    }
+}
+
+TEST_CASE("PatchPackBuilder ships deltas that MultiPackManager applies", "[vfs][delta]")
+{
+    const auto bundle = randomBytes(300 * 1024, 21);
+    auto fixedBundle = bundle;
+    fixedBundle[150 * 1024] = 'x';
+    const auto cg = randomBytes(40 * 1024, 22);
+    const auto extra = randomBytes(2 * 1024, 23);
+
+    const std::string oldPath = tempPackPath("nm_delta_old.nmres");
+    const std::string newPath = tempPackPath("nm_delta_new.nmres");
+    const std::string patchPath = tempPackPath("nm_delta_patch.nmres");
+
+    PackWriter oldWriter;
+    oldWriter.addResource("scripts/bundle.nms", ResourceType::Script, bundle);
+    oldWriter.addResource("cg/intro.png", ResourceType::Texture, cg);
+    oldWriter.addResource("data/removed.bin", ResourceType::Data, extra);
+    REQUIRE(oldWriter.write(oldPath).isOk());
+
+    PackWriter newWriter;
+    newWriter.addResource("scripts/bundle.nms", ResourceType::Script, fixedBundle);
+    newWriter.addResource("cg/intro.png", ResourceType::Texture, cg);
+    newWriter.addResource("data/added.bin", ResourceType::Data, extra);
+    REQUIRE(newWriter.write(newPath).isOk());
+
+    auto built = PatchPackBuilder::build(oldPath, newPath, patchPath);
+    REQUIRE(built.isOk());
+    const PatchBuildStats& stats = built.value();
+    REQUIRE(stats.unchangedCount == 1);
+    REQUIRE(stats.deltaCount == 1);
+    REQUIRE(stats.addedCount == 1);
+    REQUIRE(stats.removedResources == std::vector<std::string>{"data/removed.bin"});
+    REQUIRE(stats.patchBytes < 8 * 1024);
+
+    {
+        MultiPackManager manager;
+        REQUIRE(manager.initialize().isOk());
+        REQUIRE(manager.loadBasePack(oldPath).success);
+        REQUIRE(manager.loadPack(patchPath, PackType::Patch).success);
+
+        auto data = manager.readResource("scripts/bundle.nms");
+        REQUIRE(data.isOk());
+        REQUIRE(data.value() == fixedBundle);
+        REQUIRE(manager.getDeltaCacheUsage() == fixedBundle.size());
+
+        // Served from the cache the second time
+        REQUIRE(manager.readResource("scripts/bundle.nms").value() == fixedBundle);
+        REQUIRE(manager.readResource("cg/intro.png").value() == cg);
+        REQUIRE(manager.readResource("data/added.bin").value() == extra);
+
+        // Without its base the delta cannot be applied
+        manager.setPackEnabled("nm_delta_old", false);
+        REQUIRE(manager.getDeltaCacheUsage() == 0);
+        REQUIRE(manager.readResource("scripts/bundle.nms").isError());
+
+        manager.shutdown();
+    }
+
+    std::filesystem::remove(oldPath);
+    std::filesystem::remove(newPath);
+    std::filesystem::remove(patchPath);
+}
@@ -0,0 +1,95 @@
+#include <catch2/catch_test_macros.hpp>
+#include "NovelMind/core/property_system.hpp"
+
+using namespace NovelMind;
+
+namespace
+{
+
+struct Node
+{
+    std::string name;
+};
+
+struct Sprite : Node
+{
+    Vector2 position;
+    f32 opacity = 1.0f;
+    i32 layer = 0;
+};
+
+std::unique_ptr<TypeInfo> describeSprite()
+{
+    PropertyMeta layer("layer", "Layer", PropertyType::None);
+    layer.range = RangeConstraint(0, 10);
+
+    return TypeInfoBuilder<Sprite>("Sprite")
+        .property<&Sprite::name>("name", "Name")
+        .property<&Sprite::position>("position", "Position")
+        NM_MEMBER_PROPERTY(opacity, &Sprite::opacity)
+        .property<&Sprite::layer>(layer)
+        .property<f32>("halfOpacity", "Half Opacity",
+                       [](const Sprite& s) { return s.opacity / 2.0f; },
+                       [](Sprite& s, const f32& v) { s.opacity = v * 2.0f; })
+        .get();
+}
+
+} // namespace
+
+TEST_CASE("TypeInfoBuilder registers properties from member pointers", "[property_system]")
+{
+    const auto info = describeSprite();
+    REQUIRE(info->getProperties().size() == 5);
+
+    const IPropertyAccessor* name = info->findProperty("name");
+    REQUIRE(name != nullptr);
+    CHECK(name->getMeta().type == PropertyType::String);
+    CHECK(info->findProperty("position")->getMeta().type == PropertyType::Vector2);
+    CHECK(info->findProperty("opacity")->getMeta().displayName == "opacity");
+
+    const auto& layer = info->findProperty("layer")->getMeta();
+    CHECK(layer.type == PropertyType::Int);
+    CHECK(layer.range.max == 10);
+    CHECK(layer.order == 3);
+
+    // The variant interface still works for member-backed properties
+    Sprite sprite;
+    sprite.name = "hero";
+    CHECK(std::get<std::string>(name->getValue(&sprite)) == "hero");
+    name->setValue(&sprite, PropertyValue(std::string("villain")));
+    CHECK(sprite.name == "villain");
+    name->setValue(&sprite, PropertyValue(3)); // Wrong type is ignored
+    CHECK(sprite.name == "villain");
+}
+
+TEST_CASE("PropertyHandle gives typed access resolved once", "[property_system]")
+{
+    const auto info = describeSprite();
+
+    auto opacity = info->findHandle<f32>("opacity");
+    auto position = info->findHandle<Vector2>("position");
+    auto computed = info->findHandle<f32>("halfOpacity");
+    REQUIRE(opacity);
+    REQUIRE(position);
+    REQUIRE(computed);
+    CHECK_FALSE(info->findHandle<i32>("opacity")); // Wrong type
+    CHECK_FALSE(info->findHandle<f32>("missing"));
+    CHECK(opacity.getMeta().name == "opacity");
+
+    std::vector<Sprite> sprites(4);
+    for (auto& sprite : sprites)
+    {
+        opacity.set(&sprite, 0.25f);
+        position.set(&sprite, Vector2(1.0f, 2.0f));
+    }
+    for (const auto& sprite : sprites)
+    {
+        CHECK(sprite.opacity == 0.25f);
+        CHECK(position.get(&sprite) == Vector2(1.0f, 2.0f));
+    }
+
+    // Getter/setter properties resolve to handles too
+    CHECK(computed.get(&sprites[0]) == 0.125f);
+    computed.set(&sprites[0], 0.5f);
+    CHECK(sprites[0].opacity == 1.0f);
+}
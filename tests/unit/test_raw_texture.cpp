@@ -0,0 +1,237 @@
+#include <catch2/catch_test_macros.hpp>
+#include "NovelMind/renderer/raw_texture.hpp"
+#include "NovelMind/renderer/texture.hpp"
+#include "NovelMind/vfs/lz4_block.hpp"
+#include <chrono>
+#include <cstring>
+
+using namespace NovelMind;
+using namespace NovelMind::renderer;
+
+namespace
+{
+
+// Banded gradients with flat runs and sparse translucent pixels
+std::vector<u8> makeImage(u32 width, u32 height, u32 seed = 1)
+{
+    std::vector<u8> pixels(static_cast<usize>(width) * height * 4);
+    u32 state = seed;
+    for (u32 y = 0; y < height; ++y)
+    {
+        for (u32 x = 0; x < width; ++x)
+        {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            u8* p = pixels.data() + (static_cast<usize>(y) * width + x) * 4;
+            p[0] = static_cast<u8>((x / 8) * 8 * 255 / width);
+            p[1] = static_cast<u8>(y * 255 / height);
+            p[2] = static_cast<u8>((x / 16 + y / 16) & 1 ? 200 : 40);
+            p[3] = static_cast<u8>((state & 63) == 0 ? 128 : 255);
+        }
+    }
+    return pixels;
+}
+
+} // namespace
+
+TEST_CASE("LZ4Block round-trips and rejects corrupt blocks", "[lz4]")
+{
+    SECTION("empty and tiny inputs")
+    {
+        for (usize size : {usize{0}, usize{1}, usize{12}, usize{13}, usize{64}})
+        {
+            std::vector<u8> input(size, 0xAB);
+            auto block = vfs::LZ4Block::compress(input.data(), input.size());
+            std::vector<u8> output(size);
+            CHECK(vfs::LZ4Block::decompress(block.data(), block.size(), output.data(), size));
+            CHECK(output == input);
+        }
+    }
+
+    SECTION("repetitive data compresses and long lengths encode")
+    {
+        std::vector<u8> input(100000);
+        for (usize i = 0; i < input.size(); ++i)
+        {
+            input[i] = static_cast<u8>((i % 300) < 280 ? 7 : i);
+        }
+        auto block = vfs::LZ4Block::compress(input.data(), input.size());
+        CHECK(block.size() < input.size() / 10);
+
+        std::vector<u8> output(input.size());
+        REQUIRE(vfs::LZ4Block::decompress(block.data(), block.size(), output.data(),
+                                          output.size()));
+        CHECK(output == input);
+
+        // Wrong expected size and truncation are errors
+        CHECK_FALSE(vfs::LZ4Block::decompress(block.data(), block.size(), output.data(),
+                                              output.size() - 1));
+        CHECK_FALSE(vfs::LZ4Block::decompress(block.data(), block.size() / 2, output.data(),
+                                              output.size()));
+    }
+
+    SECTION("incompressible data")
+    {
+        auto input = makeImage(97, 31, 12345);
+        for (usize i = 0; i < input.size(); ++i)
+        {
+            input[i] = static_cast<u8>(input[i] ^ (i * 2654435761u >> 13));
+        }
+        auto block = vfs::LZ4Block::compress(input.data(), input.size());
+        CHECK(block.size() <= vfs::LZ4Block::compressBound(input.size()));
+        std::vector<u8> output(input.size());
+        REQUIRE(vfs::LZ4Block::decompress(block.data(), block.size(), output.data(),
+                                          output.size()));
+        CHECK(output == input);
+    }
+}
+
+TEST_CASE("RawTexture encodes premultiplied payloads with mip chains", "[raw_texture]")
+{
+    const u32 width = 64;
+    const u32 height = 48;
+    const auto pixels = makeImage(width, height);
+
+    RawTextureOptions options;
+    options.generateMipmaps = true;
+    auto encoded = RawTexture::encode(pixels.data(), width, height, 0, options);
+    REQUIRE(encoded.isOk());
+
+    std::vector<u8> scratch;
+    auto decoded = RawTexture::decode(encoded.value().data(), encoded.value().size(), scratch);
+    REQUIRE(decoded.isOk());
+
+    const RawTextureView& view = decoded.value();
+    CHECK(view.header.width == width);
+    CHECK(view.header.height == height);
+    CHECK(view.header.stride == width * 4);
+    CHECK(view.header.mipCount == 7); // 64x48 down to 1x1
+    CHECK(view.header.encoding == static_cast<u8>(RawTextureEncoding::LZ4));
+    CHECK(view.isPremultiplied());
+    CHECK(view.pixels == scratch.data());
+
+    // Premultiplied level 0
+    for (usize i = 0; i < static_cast<usize>(width) * height * 4; i += 4)
+    {
+        const u32 a = pixels[i + 3];
+        REQUIRE(view.pixels[i + 0] == (pixels[i + 0] * a + 127) / 255);
+        REQUIRE(view.pixels[i + 3] == a);
+    }
+
+    // Last mip is the average of the image
+    const u8* last = view.pixels + view.header.rawSize - 4;
+    CHECK(last[3] > 128);
+    CHECK(last[3] < 255);
+}
+
+TEST_CASE("RawTexture stored payloads decode in place", "[raw_texture]")
+{
+    const u32 width = 5;
+    const u32 height = 3;
+    const auto pixels = makeImage(width, height);
+
+    RawTextureOptions options;
+    options.compress = false;
+    options.premultiplyAlpha = false;
+    options.rowAlignment = 16;
+    auto encoded = RawTexture::encode(pixels.data(), width, height, 0, options);
+    REQUIRE(encoded.isOk());
+    const auto& data = encoded.value();
+
+    std::vector<u8> scratch;
+    auto decoded = RawTexture::decode(data.data(), data.size(), scratch);
+    REQUIRE(decoded.isOk());
+    CHECK(decoded.value().header.stride == 32);
+    CHECK(decoded.value().pixels == data.data() + sizeof(RawTextureHeader));
+    CHECK(scratch.empty());
+    CHECK(std::memcmp(decoded.value().pixels + 32, pixels.data() + width * 4, width * 4) == 0);
+
+    // Truncated and damaged headers are rejected
+    CHECK(RawTexture::decode(data.data(), data.size() - 1, scratch).isError());
+    auto damaged = data;
+    damaged[12] = 0xFF; // height
+    CHECK(RawTexture::decode(damaged.data(), damaged.size(), scratch).isError());
+}
+
+TEST_CASE("RawTexture rejects LZ4 payloads too small for their size", "[raw_texture]")
+{
+    const auto pixels = makeImage(16, 16);
+    auto encoded = RawTexture::encode(pixels.data(), 16, 16, 0, {});
+    REQUIRE(encoded.isOk());
+    auto data = encoded.value();
+
+    // A consistent header for a 16384x16384 texture over the same few bytes
+    RawTextureHeader header;
+    std::memcpy(&header, data.data(), sizeof(header));
+    REQUIRE(header.encoding == static_cast<u8>(RawTextureEncoding::LZ4));
+    header.width = 16384;
+    header.height = 16384;
+    header.stride = header.width * 4;
+    header.mipCount = 1;
+    header.rawSize = RawTexture::payloadSizeFor(header.width, header.height, header.stride, 1);
+    std::memcpy(data.data(), &header, sizeof(header));
+
+    std::vector<u8> scratch;
+    CHECK(RawTexture::readHeader(data.data(), data.size()).isError());
+    CHECK(RawTexture::decode(data.data(), data.size(), scratch).isError());
+    CHECK(scratch.empty());
+}
+
+TEST_CASE("Texture loads raw payloads through loadFromMemory", "[raw_texture]")
+{
+    const auto pixels = makeImage(32, 16);
+    RawTextureOptions options;
+    options.generateMipmaps = true;
+    auto encoded = RawTexture::encode(pixels.data(), 32, 16, 0, options);
+    REQUIRE(encoded.isOk());
+
+    Texture texture;
+    REQUIRE(texture.loadFromMemory(encoded.value()).isOk());
+    CHECK(texture.getWidth() == 32);
+    CHECK(texture.getHeight() == 16);
+    CHECK(texture.isPremultiplied());
+    CHECK(texture.getMipLevelCount() == 6);
+
+    auto corrupt = encoded.value();
+    corrupt.resize(corrupt.size() - 8);
+    Texture other;
+    CHECK(other.loadFromMemory(corrupt).isError());
+}
+
+TEST_CASE("RawTexture load throughput for a 1080p CG", "[.][benchmark][raw_texture]")
+{
+    const u32 width = 1920;
+    const u32 height = 1080;
+    const auto pixels = makeImage(width, height);
+
+    RawTextureOptions lz4;
+    RawTextureOptions stored;
+    stored.compress = false;
+    auto lz4Payload = RawTexture::encode(pixels.data(), width, height, 0, lz4);
+    auto storedPayload = RawTexture::encode(pixels.data(), width, height, 0, stored);
+    REQUIRE(lz4Payload.isOk());
+    REQUIRE(storedPayload.isOk());
+
+    auto timeLoads = [](const std::vector<u8>& payload) {
+        constexpr int LOADS = 20;
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < LOADS; ++i)
+        {
+            Texture texture;
+            REQUIRE(texture.loadFromMemory(payload).isOk());
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<f64, std::milli>(elapsed).count() / LOADS;
+    };
+
+    const f64 lz4Ms = timeLoads(lz4Payload.value());
+    const f64 storedMs = timeLoads(storedPayload.value());
+
+    INFO("1080p raw load: LZ4 " << lz4Ms << " ms (" << lz4Payload.value().size()
+                                << " bytes), stored " << storedMs << " ms ("
+                                << storedPayload.value().size() << " bytes)");
+    CHECK(lz4Payload.value().size() < storedPayload.value().size());
+    CHECK(lz4Ms < 20.0);
+    CHECK(storedMs < 1.0);
+}
@@ -0,0 +1,142 @@
+#include <catch2/catch_test_macros.hpp>
+#include "NovelMind/save/read_history.hpp"
+#include "NovelMind/scripting/script_runtime.hpp"
+#include <filesystem>
+#include <fstream>
+
+using namespace NovelMind;
+using namespace NovelMind::save;
+using namespace NovelMind::scripting;
+
+namespace
+{
+
+std::string tempHistoryPath(const char* name)
+{
+    auto path = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove(path);
+    return path.string();
+}
+
+CompiledScript twoLineScript()
+{
+    CompiledScript script;
+    script.stringTable = {"Hello", "World"};
+    script.instructions = {
+        {OpCode::PUSH_NULL, 0},
+        {OpCode::SAY, 0},
+        {OpCode::PUSH_NULL, 0},
+        {OpCode::SAY, 1},
+        {OpCode::HALT, 0},
+    };
+    script.sceneEntryPoints["intro"] = 0;
+    return script;
+}
+
+} // namespace
+
+TEST_CASE("ReadHistory persists read lines in its mapped file", "[read_history]")
+{
+    const std::string path = tempHistoryPath("nm_read_history_test.nmr");
+    const u64 hello = ReadHistory::lineId("intro", "Hello");
+    const u64 world = ReadHistory::lineId("intro", "World");
+
+    CHECK(hello != world);
+    CHECK(hello == ReadHistory::lineId("intro", "Hello"));
+    CHECK(hello != ReadHistory::lineId("outro", "Hello"));
+
+    {
+        ReadHistory history;
+        CHECK_FALSE(history.isRead(hello));
+        history.markRead(hello); // Closed: ignored
+
+        REQUIRE(history.open(path, 1u << 12).isOk());
+        CHECK(history.getBitCount() == (1u << 12));
+        CHECK_FALSE(history.isRead(hello));
+
+        history.markRead(hello);
+        CHECK(history.isRead(hello));
+        CHECK_FALSE(history.isRead(world));
+    }
+
+    CHECK(std::filesystem::file_size(path) == 16 + (1u << 12) / 8);
+
+    {
+        ReadHistory history;
+        // An existing file keeps the size it was created with
+        REQUIRE(history.open(path).isOk());
+        CHECK(history.getBitCount() == (1u << 12));
+        CHECK(history.isRead(hello));
+        CHECK_FALSE(history.isRead(world));
+
+        history.clear();
+        CHECK_FALSE(history.isRead(hello));
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("ReadHistory rejects files it did not write", "[read_history]")
+{
+    const std::string path = tempHistoryPath("nm_read_history_bad.nmr");
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "definitely not a read history file";
+    }
+
+    ReadHistory history;
+    CHECK(history.open(path).isError());
+    CHECK_FALSE(history.isOpen());
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Skip mode passes read lines and stops at unread ones", "[read_history][script_runtime]")
+{
+    const std::string path = tempHistoryPath("nm_read_history_skip.nmr");
+    ReadHistory history;
+    REQUIRE(history.open(path, 1u << 12).isOk());
+    history.markRead(ReadHistory::lineId("intro", "Hello"));
+
+    ScriptRuntime runtime;
+    runtime.setReadHistory(&history);
+    REQUIRE(runtime.load(twoLineScript()).isOk());
+
+    SECTION("stops at the first unread line")
+    {
+        REQUIRE(runtime.gotoScene("intro").isOk());
+        runtime.setSkipMode(true);
+        runtime.update(0.016);
+
+        CHECK_FALSE(runtime.isSkipMode());
+        CHECK_FALSE(runtime.isCurrentLineRead());
+        CHECK(runtime.getVM().isWaiting());
+        CHECK(runtime.getVM().getIP() == 4);
+
+        // Showing the line marked it read
+        CHECK(history.isRead(ReadHistory::lineId("intro", "World")));
+
+        // A second pass skips both lines to the end
+        REQUIRE(runtime.gotoScene("intro").isOk());
+        runtime.setSkipMode(true);
+        runtime.update(0.016);
+        CHECK(runtime.isSkipMode());
+        CHECK(runtime.isComplete());
+    }
+
+    SECTION("skipUnreadText passes unread lines too")
+    {
+        RuntimeConfig config;
+        config.skipUnreadText = true;
+        runtime.setConfig(config);
+
+        REQUIRE(runtime.gotoScene("intro").isOk());
+        runtime.setSkipMode(true);
+        runtime.update(0.016);
+        CHECK(runtime.isSkipMode());
+        CHECK(runtime.isComplete());
+    }
+
+    history.close();
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,204 @@
+#include <catch2/catch_test_macros.hpp>
+#include "NovelMind/vfs/flat_resource_index.hpp"
+#include "NovelMind/vfs/multi_pack_manager.hpp"
+#include "NovelMind/vfs/pack_reader.hpp"
+#include "NovelMind/vfs/pack_writer.hpp"
+#include "NovelMind/vfs/resource_id.hpp"
+#include <cstddef>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+
+using namespace NovelMind;
+using namespace NovelMind::vfs;
+
+namespace
+{
+
+std::string tempPackPath(const std::string& name)
+{
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+void writePack(const std::string& path,
+               const std::vector<std::pair<std::string, std::string>>& resources)
+{
+    PackWriter writer;
+    for (const auto& [id, content] : resources)
+    {
+        writer.addResource(id, ResourceType::Data, std::vector<u8>(content.begin(), content.end()));
+    }
+    REQUIRE(writer.write(path).isOk());
+}
+
+std::string readString(MultiPackManager& manager, const std::string& id)
+{
+    auto data = manager.readResource(id);
+    REQUIRE(data.isOk());
+    return std::string(data.value().begin(), data.value().end());
+}
+
+} // namespace
+
+TEST_CASE("FlatResourceIndex inserts, finds and erases across growth", "[vfs][resource_index]")
+{
+    FlatResourceIndex<u32> index;
+    std::deque<std::string> ids;
+    for (u32 i = 0; i < 5000; ++i)
+    {
+        ids.push_back("sprites/character_" + std::to_string(i) + ".png");
+        index.assign(VFS::ResourceId::hashOf(ids.back()), &ids.back(), i);
+    }
+    REQUIRE(index.size() == 5000);
+
+    for (u32 i = 0; i < 5000; i += 2)
+    {
+        REQUIRE(index.erase(VFS::ResourceId::hashOf(ids[i]), ids[i]));
+    }
+    REQUIRE(index.size() == 2500);
+
+    for (u32 i = 0; i < 5000; ++i)
+    {
+        const u32* value = index.find(VFS::ResourceId::hashOf(ids[i]), ids[i]);
+        if (i % 2 == 0)
+        {
+            REQUIRE(value == nullptr);
+        }
+        else
+        {
+            REQUIRE(value != nullptr);
+            REQUIRE(*value == i);
+        }
+    }
+
+    // Equal hashes are told apart by the id string
+    const std::string a = "a";
+    const std::string b = "b";
+    FlatResourceIndex<u32> colliding;
+    colliding.assign(42, &a, 1);
+    colliding.assign(42, &b, 2);
+    REQUIRE(*colliding.find(42, "a") == 1);
+    REQUIRE(*colliding.find(42, "b") == 2);
+    REQUIRE(colliding.erase(42, "a"));
+    REQUIRE(colliding.find(42, "a") == nullptr);
+    REQUIRE(*colliding.find(42, "b") == 2);
+}
+
+TEST_CASE("MultiPackManager updates overrides incrementally", "[vfs][resource_index]")
+{
+    const std::string basePath = tempPackPath("nm_index_base.nmres");
+    const std::string modAPath = tempPackPath("nm_index_mod_a.nmres");
+    const std::string modBPath = tempPackPath("nm_index_mod_b.nmres");
+    writePack(basePath, {{"text/a.txt", "base a"}, {"text/b.txt", "base b"}});
+    writePack(modAPath, {{"text/a.txt", "mod a"}, {"text/c.txt", "mod c"}});
+    writePack(modBPath, {{"text/a.txt", "mod b"}});
+
+    {
+        MultiPackManager manager;
+        REQUIRE(manager.initialize().isOk());
+        REQUIRE(manager.loadBasePack(basePath).success);
+        REQUIRE(manager.loadPack(modAPath, PackType::Mod, 0).success);
+        REQUIRE(manager.loadPack(modBPath, PackType::Mod, 1).success);
+
+        REQUIRE(manager.getResourceCount() == 3);
+        REQUIRE(readString(manager, "text/a.txt") == "mod b");
+        REQUIRE(manager.readResource(VFS::ResourceId("text/c.txt")).isOk());
+        REQUIRE(manager.exists(VFS::ResourceId("text/b.txt")));
+
+        manager.setPackEnabled("nm_index_mod_b", false);
+        REQUIRE(readString(manager, "text/a.txt") == "mod a");
+
+        manager.setPackEnabled("nm_index_mod_a", false);
+        REQUIRE(readString(manager, "text/a.txt") == "base a");
+        REQUIRE_FALSE(manager.exists("text/c.txt"));
+        REQUIRE(manager.getResourceCount() == 2);
+
+        manager.setPackEnabled("nm_index_mod_a", true);
+        REQUIRE(readString(manager, "text/a.txt") == "mod a");
+        REQUIRE(manager.getResourcePack("text/c.txt") == "nm_index_mod_a");
+
+        manager.unloadPack("nm_index_mod_a");
+        REQUIRE(readString(manager, "text/a.txt") == "base a");
+        REQUIRE(manager.listResources().size() == 2);
+
+        manager.shutdown();
+    }
+
+    std::filesystem::remove(basePath);
+    std::filesystem::remove(modAPath);
+    std::filesystem::remove(modBPath);
+}
+
+TEST_CASE("MultiPackManager mounts mods asynchronously", "[vfs][resource_index]")
+{
+    const auto root = std::filesystem::temp_directory_path() / "nm_async_mods";
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root / "mods");
+
+    const std::string basePath = (root / "base.nmres").string();
+    writePack(basePath, {{"text/a.txt", "base a"}, {"text/b.txt", "base b"}});
+    writePack((root / "mods" / "mod_one.nmres").string(), {{"text/a.txt", "one"}});
+    writePack((root / "mods" / "mod_two.nmres").string(), {{"text/a.txt", "two"}});
+    writePack((root / "mods" / "mod_three.nmres").string(), {{"text/c.txt", "three"}});
+
+    {
+        MultiPackManager manager;
+        REQUIRE(manager.initialize().isOk());
+        manager.setModsDirectory((root / "mods").string());
+        REQUIRE(manager.loadBasePack(basePath).success);
+
+        usize completed = 0;
+        manager.setOnAsyncLoadCompleted([&completed](const PackLoadResult& result) {
+            completed += result.success ? 1 : 0;
+        });
+
+        // Known mods keep their place in the load order
+        manager.setModLoadOrder({"mod_two", "mod_one"});
+        manager.loadModsAsync();
+
+        // Nothing changes until the owner publishes
+        REQUIRE(readString(manager, "text/a.txt") == "base a");
+
+        manager.waitForAsyncLoads();
+        REQUIRE(manager.hasPendingAsyncLoads());
+        REQUIRE(manager.processAsyncLoads().size() == 3);
+        REQUIRE(completed == 3);
+        REQUIRE_FALSE(manager.hasPendingAsyncLoads());
+
+        REQUIRE(manager.getPackCount() == 4);
+        REQUIRE(readString(manager, "text/a.txt") == "one");
+        REQUIRE(readString(manager, "text/c.txt") == "three");
+        REQUIRE(manager.getModLoadOrder() ==
+                std::vector<std::string>{"mod_two", "mod_one", "mod_three"});
+
+        manager.loadPackAsync(basePath, PackType::Base);
+        manager.waitForAsyncLoads();
+        auto duplicate = manager.processAsyncLoads();
+        REQUIRE(duplicate.size() == 1);
+        REQUIRE_FALSE(duplicate[0].success);
+        REQUIRE(completed == 3);
+
+        manager.shutdown();
+    }
+
+    std::filesystem::remove_all(root);
+}
+
+TEST_CASE("PackReader rejects a resource count larger than the file", "[vfs][resource_index]")
+{
+    const std::string path = tempPackPath("nm_index_corrupt.nmres");
+    writePack(path, {{"data/a.txt", "a"}, {"data/b.txt", "b"}});
+    {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        const u32 count = 0x10000000u;
+        file.seekp(static_cast<std::streamoff>(offsetof(PackHeader, resourceCount)));
+        file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    }
+
+    PackReader reader;
+    auto mounted = reader.mount(path);
+    REQUIRE(mounted.isError());
+    REQUIRE(mounted.error() == "Corrupt resource table");
+
+    std::filesystem::remove(path);
+}
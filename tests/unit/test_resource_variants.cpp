@@ -0,0 +1,133 @@
+#include <catch2/catch_test_macros.hpp>
+#include "NovelMind/vfs/multi_pack_manager.hpp"
+#include "NovelMind/vfs/pack_writer.hpp"
+#include "NovelMind/vfs/resource_variants.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <map>
+#include <tuple>
+
+using namespace NovelMind;
+using namespace NovelMind::vfs;
+
+namespace
+{
+
+std::string tempPackPath(const std::string& name)
+{
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+void writePack(const std::string& path,
+               const std::vector<std::tuple<std::string, ResourceType, std::string>>& resources)
+{
+    PackWriter writer;
+    for (const auto& [id, type, content] : resources)
+    {
+        writer.addResource(id, type, std::vector<u8>(content.begin(), content.end()));
+    }
+    REQUIRE(writer.write(path).isOk());
+}
+
+std::string readString(MultiPackManager& manager, const std::string& id, f32 zoom = 1.0f)
+{
+    auto data = manager.readResource(id, zoom);
+    REQUIRE(data.isOk());
+    return std::string(data.value().begin(), data.value().end());
+}
+
+} // namespace
+
+TEST_CASE("ResourceVariants names and selects variants", "[vfs][variants]")
+{
+    CHECK(ResourceVariants::variantId("bg/park.png", 1) == "bg/park.png");
+    CHECK(ResourceVariants::variantId("bg/park.png", 2) == "bg/park.png@2");
+
+    std::string_view logical;
+    u32 divisor = 0;
+    CHECK(ResourceVariants::parseVariantId("bg/park.png@4", logical, divisor));
+    CHECK(logical == "bg/park.png");
+    CHECK(divisor == 4);
+    CHECK_FALSE(ResourceVariants::parseVariantId("bg/park.png", logical, divisor));
+    CHECK_FALSE(ResourceVariants::parseVariantId("bg/park.png@3", logical, divisor));
+    CHECK_FALSE(ResourceVariants::parseVariantId("user@host.png", logical, divisor));
+    CHECK_FALSE(ResourceVariants::parseVariantId("@2", logical, divisor));
+
+    // 4K originals: 1080p and 720p take half size, 540p a quarter, 1440p the original
+    CHECK(ResourceVariants::divisorForScale(1.0f) == 1);
+    CHECK(ResourceVariants::divisorForScale(1440.0f / 2160.0f) == 1);
+    CHECK(ResourceVariants::divisorForScale(1080.0f / 2160.0f) == 2);
+    CHECK(ResourceVariants::divisorForScale(720.0f / 2160.0f) == 2);
+    CHECK(ResourceVariants::divisorForScale(540.0f / 2160.0f) == 4);
+    CHECK(ResourceVariants::divisorForScale(1100.0f / 2160.0f) == 2);
+}
+
+TEST_CASE("MultiPackManager reads the variant matching the output resolution", "[vfs][variants]")
+{
+    const std::string basePath = tempPackPath("nm_variants_base.nmres");
+    const std::string modPath = tempPackPath("nm_variants_mod.nmres");
+    writePack(basePath, {{"cg/park.png", ResourceType::Texture, "park 4k"},
+                         {"cg/park.png@2", ResourceType::Texture, "park 1080"},
+                         {"cg/park.png@4", ResourceType::Texture, "park 540"},
+                         {"cg/night.png", ResourceType::Texture, "night 4k"},
+                         {"cg/night.png@2", ResourceType::Texture, "night 1080"},
+                         {"ui/frame.png", ResourceType::Texture, "frame"},
+                         {"text/notes.txt", ResourceType::Data, "notes"},
+                         {"text/notes.txt@2", ResourceType::Data, "not an image"}});
+    writePack(modPath, {{"cg/night.png", ResourceType::Texture, "modded night"}});
+
+    {
+        MultiPackManager manager;
+        REQUIRE(manager.initialize().isOk());
+        REQUIRE(manager.loadBasePack(basePath).success);
+
+        // Native output reads originals
+        CHECK(readString(manager, "cg/park.png") == "park 4k");
+
+        manager.setOutputResolution(1920, 1080, 3840, 2160);
+        CHECK(manager.getOutputScale() == 0.5f);
+        CHECK(readString(manager, "cg/park.png") == "park 1080");
+        CHECK(manager.resolveVariant("cg/park.png") == "cg/park.png@2");
+        CHECK(readString(manager, "ui/frame.png") == "frame");
+        CHECK(readString(manager, "text/notes.txt") == "notes");
+
+        // Zoom-in shots upgrade, zoom-out never downgrades
+        CHECK(readString(manager, "cg/park.png", 2.0f) == "park 4k");
+        CHECK(readString(manager, "cg/park.png", 0.5f) == "park 1080");
+        manager.setUpgradeOnZoom(false);
+        CHECK(readString(manager, "cg/park.png", 2.0f) == "park 1080");
+        manager.setUpgradeOnZoom(true);
+
+        // A missing quarter variant falls back to the half one
+        manager.setOutputResolution(960, 540, 3840, 2160);
+        CHECK(readString(manager, "cg/park.png") == "park 540");
+        CHECK(readString(manager, "cg/night.png") == "night 1080");
+
+        // Batch reads report results under the requested ids
+        std::map<std::string, std::string> batch;
+        manager.readResources({"cg/park.png", "ui/frame.png", "cg/missing.png"},
+                              [&](const std::string& id, Result<std::vector<u8>> data) {
+                                  batch[id] = data.isOk() ? std::string(data.value().begin(),
+                                                                        data.value().end())
+                                                          : "error";
+                              });
+        CHECK(batch["cg/park.png"] == "park 540");
+        CHECK(batch["ui/frame.png"] == "frame");
+        CHECK(batch["cg/missing.png"] == "error");
+
+        // Variants are not listed as resources of their own
+        const auto listed = manager.listResources(ResourceType::Texture);
+        CHECK(listed.size() == 3);
+        CHECK(std::find(listed.begin(), listed.end(), "cg/park.png@2") == listed.end());
+
+        // An override without variants is not replaced by the base pack's variants
+        REQUIRE(manager.loadPack(modPath, PackType::Mod, 0).success);
+        CHECK(readString(manager, "cg/night.png") == "modded night");
+        CHECK(manager.resolveVariant("cg/night.png") == "cg/night.png");
+
+        manager.shutdown();
+    }
+
+    std::filesystem::remove(basePath);
+    std::filesystem::remove(modPath);
+}
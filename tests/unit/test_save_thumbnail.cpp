@@ -0,0 +1,191 @@
+#include <catch2/catch_test_macros.hpp>
+#include "NovelMind/save/save_manager.hpp"
+#include "NovelMind/save/save_thumbnail.hpp"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+using namespace NovelMind;
+using namespace NovelMind::save;
+
+namespace
+{
+
+std::string tempSaveDir(const char* name)
+{
+    auto path = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove_all(path);
+    std::filesystem::create_directories(path);
+    return path.string();
+}
+
+// Gradient with a flat band, so every QOI op shows up
+std::vector<u8> testFrame(u32 width, u32 height, u32 stride)
+{
+    std::vector<u8> frame(static_cast<usize>(stride) * height, 0xCD);
+    for (u32 y = 0; y < height; ++y)
+    {
+        for (u32 x = 0; x < width; ++x)
+        {
+            u8* px = frame.data() + static_cast<usize>(y) * stride + x * 4;
+            const bool flat = y < height / 4;
+            px[0] = flat ? 40 : static_cast<u8>(x * 255 / width);
+            px[1] = flat ? 80 : static_cast<u8>(y * 255 / height);
+            px[2] = flat ? 120 : static_cast<u8>((x * 7 + y * 13) & 0xFF);
+            px[3] = 255;
+        }
+    }
+    return frame;
+}
+
+} // namespace
+
+TEST_CASE("SaveThumbnailFormat fits, downscales and round-trips", "[save_thumbnail]")
+{
+    u32 width = 0;
+    u32 height = 0;
+    SaveThumbnailFormat::fitWithin(1920, 1080, 320, 180, width, height);
+    CHECK(width == 320);
+    CHECK(height == 180);
+    SaveThumbnailFormat::fitWithin(1080, 1920, 320, 180, width, height);
+    CHECK(width == 101);
+    CHECK(height == 180);
+    SaveThumbnailFormat::fitWithin(200, 100, 320, 180, width, height);
+    CHECK(width == 200);
+    CHECK(height == 100);
+
+    SECTION("Downscaling averages the covered area")
+    {
+        // 6x6 checkerboard of black and white texels averages to gray
+        std::vector<u8> checker(6 * 6 * 4);
+        for (u32 i = 0; i < 36; ++i)
+        {
+            const u8 v = ((i % 6) + (i / 6)) % 2 ? 255 : 0;
+            std::memset(checker.data() + i * 4, v, 3);
+            checker[i * 4 + 3] = 255;
+        }
+        auto scaled = SaveThumbnailFormat::downscale(checker.data(), 6, 6, 0, 3, 3);
+        REQUIRE(scaled.size() == 3 * 3 * 4);
+        for (u32 i = 0; i < 9; ++i)
+        {
+            CHECK(scaled[i * 4] == 128);
+            CHECK(scaled[i * 4 + 3] == 255);
+        }
+
+        auto odd = SaveThumbnailFormat::downscale(checker.data(), 6, 6, 0, 4, 4);
+        REQUIRE(odd.size() == 4 * 4 * 4);
+        for (u32 i = 0; i < 16; ++i)
+        {
+            CHECK(odd[i * 4] >= 100);
+            CHECK(odd[i * 4] <= 155);
+        }
+    }
+
+    SECTION("Encoded thumbnails decode losslessly")
+    {
+        const auto frame = testFrame(64, 40, 64 * 4);
+        auto encoded = SaveThumbnailFormat::encode(frame.data(), 64, 40, 1234);
+        REQUIRE(encoded.isOk());
+        CHECK(encoded.value().size() < frame.size());
+
+        auto decoded = SaveThumbnailFormat::decode(encoded.value().data(), encoded.value().size());
+        REQUIRE(decoded.isOk());
+        CHECK(decoded.value().width == 64);
+        CHECK(decoded.value().height == 40);
+        CHECK(decoded.value().timestamp == 1234);
+        CHECK(decoded.value().pixels == frame);
+
+        auto corrupt = encoded.value();
+        corrupt.back() ^= 0xFF;
+        CHECK(SaveThumbnailFormat::decode(corrupt.data(), corrupt.size()).isError());
+        CHECK(SaveThumbnailFormat::decode(encoded.value().data(), 20).isError());
+        CHECK(SaveThumbnailFormat::encode(frame.data(), 0, 40, 0).isError());
+    }
+}
+
+TEST_CASE("SaveManager writes thumbnails in the background and caches them", "[save_thumbnail]")
+{
+    const std::string dir = tempSaveDir("nm_save_thumbnail_test");
+    SaveManager saves;
+    saves.setSavePath(dir);
+    saves.setThumbnailSize(32, 32);
+
+    CHECK(saves.getThumbnail(3) == nullptr);
+    CHECK(saves.getThumbnailHeader(3).isError());
+
+    // Padded rows, as a readback buffer would have
+    const u32 stride = 130 * 4 + 16;
+    REQUIRE(saves.captureThumbnail(3, testFrame(130, 70, stride), 130, 70, stride).isOk());
+    CHECK(saves.captureThumbnail(3, std::vector<u8>(16), 130, 70).isError());
+    CHECK(saves.captureThumbnail(-1, testFrame(4, 4, 16), 4, 4).isError());
+    saves.flushThumbnails();
+
+    auto header = saves.getThumbnailHeader(3);
+    REQUIRE(header.isOk());
+    CHECK(header.value().width == 32);
+    CHECK(header.value().height == 17);
+    CHECK(header.value().timestamp > 0);
+
+    const SaveThumbnail* thumbnail = saves.getThumbnail(3);
+    REQUIRE(thumbnail != nullptr);
+    CHECK(thumbnail->width == 32);
+    CHECK(thumbnail->pixels.size() == 32 * 17 * 4);
+    // Flat band color survives filtering; the row padding never leaks in
+    CHECK(thumbnail->pixels[0] == 40);
+    CHECK(thumbnail->pixels[1] == 80);
+    CHECK(thumbnail->pixels[2] == 120);
+    CHECK(saves.getThumbnail(3) == thumbnail);
+
+    // A newer capture replaces the cached image once written
+    saves.setThumbnailSize(16, 16);
+    REQUIRE(saves.captureThumbnail(3, testFrame(130, 70, stride), 130, 70, stride).isOk());
+    saves.flushThumbnails();
+    thumbnail = saves.getThumbnail(3);
+    REQUIRE(thumbnail != nullptr);
+    CHECK(thumbnail->width == 16);
+    CHECK_FALSE(std::filesystem::exists(dir + "/save_3.nmthumb.tmp"));
+
+    SaveData data{};
+    data.sceneId = "intro";
+    REQUIRE(saves.save(3, data).isOk());
+    REQUIRE(saves.deleteSave(3).isOk());
+    CHECK(saves.getThumbnail(3) == nullptr);
+    CHECK_FALSE(std::filesystem::exists(dir + "/save_3.nmthumb"));
+
+    std::filesystem::remove_all(dir);
+}
+
+TEST_CASE("SaveThumbnailCache evicts the least recently used entry", "[save_thumbnail]")
+{
+    const std::string dir = tempSaveDir("nm_save_thumbnail_cache_test");
+    const auto frame = testFrame(8, 8, 32);
+    std::vector<std::string> paths;
+    for (int i = 0; i < 3; ++i)
+    {
+        paths.push_back(dir + "/thumb" + std::to_string(i));
+        auto encoded = SaveThumbnailFormat::encode(frame.data(), 8, 8, static_cast<u64>(i));
+        REQUIRE(encoded.isOk());
+        std::ofstream(paths.back(), std::ios::binary)
+            .write(reinterpret_cast<const char*>(encoded.value().data()),
+                   static_cast<std::streamsize>(encoded.value().size()));
+    }
+
+    SaveThumbnailCache cache(2);
+    const SaveThumbnail* first = cache.get(paths[0]);
+    REQUIRE(first != nullptr);
+    REQUIRE(cache.get(paths[1]) != nullptr);
+    CHECK(cache.get(paths[0]) == first); // Now most recent
+    REQUIRE(cache.get(paths[2]) != nullptr);
+    CHECK(cache.size() == 2);
+    CHECK(cache.get(paths[0]) == first); // paths[1] was evicted instead
+
+    // Misses are remembered until invalidated
+    const std::string missing = dir + "/missing";
+    CHECK(cache.get(missing) == nullptr);
+    std::filesystem::copy_file(paths[0], missing);
+    CHECK(cache.get(missing) == nullptr);
+    cache.invalidate(missing);
+    CHECK(cache.get(missing) != nullptr);
+
+    std::filesystem::remove_all(dir);
+}
@@ -0,0 +1,162 @@
+#include <catch2/catch_test_macros.hpp>
+#include "NovelMind/scripting/lexer.hpp"
+#include "NovelMind/scripting/parser.hpp"
+#include "NovelMind/scripting/script_profiler.hpp"
+#include "NovelMind/scripting/script_runtime.hpp"
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+using namespace NovelMind;
+using namespace NovelMind::scripting;
+
+namespace
+{
+
+const char* const SCRIPT =
+    "scene intro {\n"
+    "    show background \"bg\"\n"
+    "    say \"Hi\"\n"
+    "    goto outro\n"
+    "}\n"
+    "scene outro {\n"
+    "    say \"Bye\"\n"
+    "}\n";
+
+CompiledScript compileScript(const char* source)
+{
+    Lexer lexer;
+    auto tokens = lexer.tokenize(source);
+    REQUIRE(tokens.isOk());
+    Parser parser;
+    auto program = parser.parse(tokens.value());
+    REQUIRE(program.isOk());
+    Compiler compiler;
+    auto compiled = compiler.compile(program.value());
+    REQUIRE(compiled.isOk());
+    return std::move(compiled).value();
+}
+
+// Runs both lines through to HALT
+void playThrough(VirtualMachine& vm)
+{
+    vm.run();
+    vm.signalContinue();
+    vm.signalContinue();
+    REQUIRE(vm.isHalted());
+}
+
+} // namespace
+
+TEST_CASE("ScriptProfiler attributes instructions to scenes and lines", "[script_profiler]")
+{
+    const CompiledScript script = compileScript(SCRIPT);
+    ScriptProfiler profiler;
+    VirtualMachine vm;
+    REQUIRE(vm.load(script.instructions, script.stringTable).isOk());
+    vm.setProfiler(&profiler);
+    vm.registerCallback(OpCode::SHOW_BACKGROUND, [](const std::vector<Value>&) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    });
+    vm.registerCallback(OpCode::SAY, [](const std::vector<Value>&) {});
+
+    playThrough(vm);
+    CHECK(profiler.getTotalInstructions() == script.instructions.size());
+    CHECK(profiler.getInstructionCount(0) == 1);
+    CHECK(profiler.getCallbackStats(OpCode::SAY).calls == 2);
+    CHECK(profiler.getCallbackStats(OpCode::SHOW_BACKGROUND).maxNanos >= 2'000'000);
+    CHECK(profiler.getCallbackStats(OpCode::GOTO_SCENE).calls == 0); // No callback registered
+
+    const ScriptProfileReport report = profiler.buildReport(script);
+    CHECK(report.totalInstructions == script.instructions.size());
+    REQUIRE(report.scenes.size() == 2);
+    CHECK(report.scenes[0].name == "intro"); // Holds the slow background load
+    CHECK(report.scenes[0].instructions == 4);
+    REQUIRE(report.scenes[0].lines.size() == 3);
+    CHECK(report.scenes[0].lines[0].line == 2);
+    CHECK(report.scenes[0].lines[0].callbackCalls == 1);
+    CHECK(report.scenes[0].lines[1].line == 3);
+    CHECK(report.scenes[1].name == "outro");
+    CHECK(report.scenes[1].instructions == 3);
+    REQUIRE_FALSE(report.callbacks.empty());
+    CHECK(report.callbacks.front().opcode == OpCode::SHOW_BACKGROUND);
+    CHECK(report.totalCallbackNanos >= report.callbacks.front().totalNanos);
+
+    SECTION("Folded stacks merge per line and per callback opcode")
+    {
+        CHECK(profiler.toFoldedStacks(script, ScriptProfileMetric::Instructions) ==
+              "intro;line 2 1\n"
+              "intro;line 3 2\n"
+              "intro;line 4 1\n"
+              "outro;line 7 3\n");
+
+        const std::string timed = profiler.toFoldedStacks(
+            script, ScriptProfileMetric::CallbackTime,
+            [](u32 line) { return "main.nms:" + std::to_string(line); });
+        std::istringstream lines(timed);
+        std::string line;
+        std::vector<std::string> stacks;
+        while (std::getline(lines, line))
+        {
+            stacks.push_back(line.substr(0, line.rfind(' ')));
+        }
+        CHECK(stacks == std::vector<std::string>{"intro;main.nms:2;SHOW_BACKGROUND",
+                                                 "intro;main.nms:3;SAY", "outro;main.nms:7;SAY"});
+
+        const auto path = std::filesystem::temp_directory_path() / "nm_script_profile.folded";
+        REQUIRE(profiler.exportToFoldedStacks(path.string(), script,
+                                              ScriptProfileMetric::Instructions));
+        std::ifstream file(path);
+        std::stringstream contents;
+        contents << file.rdbuf();
+        CHECK(contents.str() == profiler.toFoldedStacks(script, ScriptProfileMetric::Instructions));
+        std::filesystem::remove(path);
+    }
+
+    SECTION("Detaching stops counting and reset clears")
+    {
+        vm.setProfiler(nullptr);
+        vm.reset();
+        playThrough(vm);
+        CHECK(profiler.getTotalInstructions() == script.instructions.size());
+
+        profiler.reset();
+        CHECK(profiler.getTotalInstructions() == 0);
+        CHECK(profiler.buildReport(script).scenes.empty());
+    }
+}
+
+TEST_CASE("ScriptProfiler counts on the stepped and checked paths", "[script_profiler]")
+{
+    // Not stack-verified: the jump joins paths at different depths
+    const std::vector<Instruction> program = {
+        {OpCode::PUSH_BOOL, 1},
+        {OpCode::JUMP_IF, 3},
+        {OpCode::PUSH_INT, 1},
+        {OpCode::HALT, 0},
+    };
+    ScriptProfiler profiler;
+    VirtualMachine vm;
+    vm.setProfiler(&profiler);
+    REQUIRE(vm.load(program, {}).isOk());
+    REQUIRE_FALSE(vm.isVerified());
+    vm.run();
+    CHECK(profiler.getTotalInstructions() == 3);
+    CHECK(profiler.getInstructionCount(2) == 0);
+
+    const CompiledScript script = compileScript(SCRIPT);
+    ScriptRuntime runtime;
+    runtime.setProfiler(&profiler);
+    CHECK(runtime.getProfiler() == &profiler);
+    REQUIRE(runtime.load(script).isOk());
+    profiler.reset();
+
+    // Scene changes reload the program; counts carry over
+    REQUIRE(runtime.gotoScene("intro").isOk());
+    runtime.update(0.016);
+    REQUIRE(runtime.gotoScene("intro").isOk());
+    runtime.update(0.016);
+    CHECK(profiler.getInstructionCount(0) == 2);
+    CHECK(profiler.getCallbackStats(OpCode::SHOW_BACKGROUND).calls == 2);
+}
@@ -0,0 +1,640 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "NovelMind/renderer/font.hpp"
+#include "NovelMind/renderer/raw_texture.hpp"
+#include "NovelMind/renderer/sdf_font.hpp"
+#include "NovelMind/renderer/sdf_font_builder.hpp"
+#include "NovelMind/renderer/text_layout.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace NovelMind;
+using namespace NovelMind::renderer;
+using Catch::Approx;
+
+namespace
+{
+
+// ---------------------------------------------------------------------------
+// A minimal TrueType font (1000 units per em) built in memory:
+//   glyph 1 'A'          square ring: clockwise outer, counter-clockwise hole
+//   glyph 2 'O'          circle from four off-curve points only
+//   glyph 3 '-', U+4E00  horizontal bar, one glyph for two codepoints
+//   glyph 4 ' '          no outline
+//   glyph 5 'D'          composite: glyph 1 moved 50 units right
+// plus a kern pair A,O of -50 units.
+// ---------------------------------------------------------------------------
+
+class FontBytes
+{
+public:
+    void byte(u32 v) { m_data.push_back(static_cast<u8>(v)); }
+    void word(u32 v)
+    {
+        byte(v >> 8);
+        byte(v);
+    }
+    void signedWord(i32 v) { word(static_cast<u32>(v) & 0xFFFF); }
+    void dword(u32 v)
+    {
+        word(v >> 16);
+        word(v & 0xFFFF);
+    }
+    void pad()
+    {
+        while (m_data.size() % 4 != 0)
+        {
+            byte(0);
+        }
+    }
+    [[nodiscard]] const std::vector<u8>& data() const { return m_data; }
+    [[nodiscard]] usize size() const { return m_data.size(); }
+
+private:
+    std::vector<u8> m_data;
+};
+
+struct TestPoint
+{
+    i32 x;
+    i32 y;
+    bool onCurve;
+};
+
+void writeSimpleGlyph(FontBytes& out, const std::vector<std::vector<TestPoint>>& contours)
+{
+    i32 minX = 0x7FFF, minY = 0x7FFF, maxX = -0x7FFF, maxY = -0x7FFF;
+    for (const auto& contour : contours)
+    {
+        for (const auto& p : contour)
+        {
+            minX = std::min(minX, p.x);
+            minY = std::min(minY, p.y);
+            maxX = std::max(maxX, p.x);
+            maxY = std::max(maxY, p.y);
+        }
+    }
+    out.signedWord(static_cast<i32>(contours.size()));
+    out.signedWord(minX);
+    out.signedWord(minY);
+    out.signedWord(maxX);
+    out.signedWord(maxY);
+    u32 last = 0;
+    for (const auto& contour : contours)
+    {
+        last += static_cast<u32>(contour.size());
+        out.word(last - 1);
+    }
+    out.word(0); // No instructions
+    for (const auto& contour : contours)
+    {
+        for (const auto& p : contour)
+        {
+            out.byte(p.onCurve ? 1 : 0);
+        }
+    }
+    i32 previous = 0;
+    for (const auto& contour : contours)
+    {
+        for (const auto& p : contour)
+        {
+            out.signedWord(p.x - previous);
+            previous = p.x;
+        }
+    }
+    previous = 0;
+    for (const auto& contour : contours)
+    {
+        for (const auto& p : contour)
+        {
+            out.signedWord(p.y - previous);
+            previous = p.y;
+        }
+    }
+    out.pad();
+}
+
+std::vector<u8> makeTestFont()
+{
+    // glyf and loca
+    FontBytes glyf;
+    std::vector<u32> loca;
+    loca.push_back(static_cast<u32>(glyf.size())); // 0: .notdef, empty
+    loca.push_back(static_cast<u32>(glyf.size()));
+    writeSimpleGlyph(glyf, {{{100, 0, true}, {100, 700, true}, {600, 700, true}, {600, 0, true}},
+                            {{250, 200, true}, {450, 200, true}, {450, 500, true}, {250, 500, true}}});
+    loca.push_back(static_cast<u32>(glyf.size()));
+    writeSimpleGlyph(glyf, {{{50, 50, false}, {50, 650, false}, {650, 650, false}, {650, 50, false}}});
+    loca.push_back(static_cast<u32>(glyf.size()));
+    writeSimpleGlyph(glyf, {{{50, 300, true}, {50, 400, true}, {950, 400, true}, {950, 300, true}}});
+    loca.push_back(static_cast<u32>(glyf.size())); // 4: space, empty
+    loca.push_back(static_cast<u32>(glyf.size()));
+    glyf.signedWord(-1);
+    glyf.signedWord(150);
+    glyf.signedWord(0);
+    glyf.signedWord(650);
+    glyf.signedWord(700);
+    glyf.word(0x0003); // Word args, xy values, last component
+    glyf.word(1);
+    glyf.signedWord(50);
+    glyf.signedWord(0);
+    glyf.pad();
+    loca.push_back(static_cast<u32>(glyf.size()));
+
+    FontBytes locaTable;
+    for (u32 offset : loca)
+    {
+        locaTable.word(offset / 2);
+    }
+
+    FontBytes head;
+    head.dword(0x00010000);
+    head.dword(0x00010000);
+    head.dword(0);
+    head.dword(0x5F0F3CF5);
+    head.word(0);
+    head.word(1000); // unitsPerEm
+    for (int i = 0; i < 16; ++i)
+    {
+        head.byte(0);
+    }
+    head.signedWord(0);
+    head.signedWord(-200);
+    head.signedWord(1000);
+    head.signedWord(800);
+    head.word(0);
+    head.word(8);
+    head.signedWord(2);
+    head.signedWord(0); // Short loca
+    head.signedWord(0);
+
+    FontBytes hhea;
+    hhea.dword(0x00010000);
+    hhea.signedWord(800);
+    hhea.signedWord(-200);
+    hhea.signedWord(0);
+    for (int i = 0; i < 12; ++i)
+    {
+        hhea.word(0);
+    }
+    hhea.word(6); // numberOfHMetrics
+
+    FontBytes maxp;
+    maxp.dword(0x00005000);
+    maxp.word(6);
+
+    FontBytes hmtx;
+    for (u32 advance : {500u, 700u, 700u, 1000u, 250u, 750u})
+    {
+        hmtx.word(advance);
+        hmtx.signedWord(0);
+    }
+
+    const std::vector<std::pair<u32, u32>> mapping = {
+        {0x20, 4}, {0x2D, 3}, {0x41, 1}, {0x44, 5}, {0x4F, 2}, {0x4E00, 3}, {0xFFFF, 0}};
+    FontBytes cmap;
+    cmap.word(0);
+    cmap.word(1);
+    cmap.word(3);
+    cmap.word(1);
+    cmap.dword(12);
+    const u32 segments = static_cast<u32>(mapping.size());
+    cmap.word(4);
+    cmap.word(16 + segments * 8);
+    cmap.word(0);
+    cmap.word(segments * 2);
+    cmap.word(0);
+    cmap.word(0);
+    cmap.word(0);
+    for (const auto& [cp, glyph] : mapping)
+    {
+        cmap.word(cp);
+    }
+    cmap.word(0);
+    for (const auto& [cp, glyph] : mapping)
+    {
+        cmap.word(cp);
+    }
+    for (const auto& [cp, glyph] : mapping)
+    {
+        cmap.word(cp == 0xFFFF ? 1 : (glyph - cp) & 0xFFFF);
+    }
+    for (usize i = 0; i < mapping.size(); ++i)
+    {
+        cmap.word(0);
+    }
+
+    FontBytes kern;
+    kern.word(0);
+    kern.word(1);
+    kern.word(0);
+    kern.word(20);
+    kern.word(0x0001);
+    kern.word(1);
+    kern.word(6);
+    kern.word(0);
+    kern.word(0);
+    kern.word(1);
+    kern.word(2);
+    kern.signedWord(-50);
+
+    const std::vector<std::pair<u32, const FontBytes*>> tables = {
+        {0x636D6170, &cmap}, {0x676C7966, &glyf}, {0x68656164, &head}, {0x68686561, &hhea},
+        {0x686D7478, &hmtx}, {0x6B65726E, &kern}, {0x6C6F6361, &locaTable}, {0x6D617870, &maxp}};
+
+    FontBytes font;
+    font.dword(0x00010000);
+    font.word(static_cast<u32>(tables.size()));
+    font.word(0);
+    font.word(0);
+    font.word(0);
+    u32 offset = 12 + static_cast<u32>(tables.size()) * 16;
+    for (const auto& [tag, table] : tables)
+    {
+        font.dword(tag);
+        font.dword(0);
+        font.dword(offset);
+        font.dword(static_cast<u32>(table->size()));
+        offset += (static_cast<u32>(table->size()) + 3) & ~3u;
+    }
+    std::vector<u8> bytes = font.data();
+    for (const auto& [tag, table] : tables)
+    {
+        bytes.insert(bytes.end(), table->data().begin(), table->data().end());
+        while (bytes.size() % 4 != 0)
+        {
+            bytes.push_back(0);
+        }
+    }
+    return bytes;
+}
+
+SdfFontBuildOptions testOptions()
+{
+    SdfFontBuildOptions options;
+    options.emSize = 32.0f;
+    options.distanceRange = 6.0f;
+    options.pageSize = 256;
+    options.threadCount = 1;
+    return options;
+}
+
+// Field texel under a point given in em units (y up) inside a glyph's quad
+const u8* texelAt(const SdfFontBuild& build, const SdfGlyph& glyph, f32 emX, f32 emY)
+{
+    const f32 u = (emX - glyph.planeLeft) / (glyph.planeRight - glyph.planeLeft);
+    const f32 v = (glyph.planeTop - emY) / (glyph.planeTop - glyph.planeBottom);
+    const u32 x = glyph.atlasX + static_cast<u32>(u * glyph.atlasWidth);
+    const u32 y = glyph.atlasY + static_cast<u32>(v * glyph.atlasHeight);
+    return build.pages[glyph.page].data() + (static_cast<usize>(y) * build.metrics.pageWidth + x) * 4;
+}
+
+f32 medianAt(const SdfFontBuild& build, const SdfGlyph& glyph, f32 emX, f32 emY)
+{
+    const u8* texel = texelAt(build, glyph, emX, emY);
+    return SdfShading::median(texel[0], texel[1], texel[2]) / 255.0f;
+}
+
+} // namespace
+
+TEST_CASE("SdfFontBuilder generates fields and metrics from TrueType outlines", "[renderer][sdf_font]")
+{
+    const std::vector<u8> ttf = makeTestFont();
+    REQUIRE(SdfFontBuilder::isTrueType(ttf.data(), ttf.size()));
+
+    auto built = SdfFontBuilder::build(ttf.data(), ttf.size(), testOptions());
+    REQUIRE(built.isOk());
+    const SdfFontBuild& build = built.value();
+    const SdfFontMetrics& metrics = build.metrics;
+
+    CHECK(metrics.glyphs.size() == 6);
+    CHECK(metrics.ascender == Approx(0.8f));
+    CHECK(metrics.descender == Approx(-0.2f));
+    CHECK(metrics.getLineHeight() == Approx(1.0f));
+    CHECK(metrics.pageCount == 1);
+    REQUIRE(build.pages.size() == 1);
+    CHECK(build.pages[0].size() == static_cast<usize>(metrics.pageWidth) * build.pageHeights[0] * 4);
+    CHECK(build.pageHeights[0] < 256); // Trimmed to the used rows
+
+    const SdfGlyph* ring = metrics.findGlyph('A');
+    const SdfGlyph* circle = metrics.findGlyph('O');
+    const SdfGlyph* bar = metrics.findGlyph('-');
+    const SdfGlyph* ideograph = metrics.findGlyph(0x4E00);
+    const SdfGlyph* space = metrics.findGlyph(' ');
+    const SdfGlyph* composite = metrics.findGlyph('D');
+    REQUIRE(ring);
+    REQUIRE(circle);
+    REQUIRE(bar);
+    REQUIRE(ideograph);
+    REQUIRE(space);
+    REQUIRE(composite);
+    CHECK(metrics.findGlyph('Z') == nullptr);
+
+    CHECK(ring->advance == Approx(0.7f));
+    CHECK(space->advance == Approx(0.25f));
+    CHECK(space->atlasWidth == 0);
+    CHECK(metrics.getKerning('A', 'O') == Approx(-0.05f));
+    CHECK(metrics.getKerning('O', 'A') == 0.0f);
+
+    // Codepoints sharing a glyph share its atlas rectangle
+    CHECK(bar->atlasX == ideograph->atlasX);
+    CHECK(bar->atlasY == ideograph->atlasY);
+    CHECK(ideograph->advance == Approx(1.0f));
+
+    // Plane bounds cover the outline plus padding
+    CHECK(ring->planeLeft < 0.1f);
+    CHECK(ring->planeRight > 0.6f);
+    CHECK(ring->planeTop > 0.7f);
+    CHECK(ring->planeBottom < 0.0f);
+
+    // Inside the ring body, in the hole and outside
+    CHECK(medianAt(build, *ring, 0.175f, 0.35f) > 0.7f);
+    CHECK(medianAt(build, *ring, 0.35f, 0.35f) < 0.3f);
+    CHECK(texelAt(build, *ring, 0.35f, 0.35f)[3] < 80);
+    // 75 units from the nearest edge: 2.4 texels of a 6 texel range
+    CHECK(texelAt(build, *ring, 0.175f, 0.35f)[3] == Approx(229).margin(20));
+
+    // Curves built only from off-curve points
+    CHECK(medianAt(build, *circle, 0.35f, 0.35f) > 0.9f);
+    CHECK(medianAt(build, *circle, circle->planeLeft + 0.01f, circle->planeTop - 0.01f) < 0.1f);
+
+    // Composite glyphs are their components, moved
+    CHECK(composite->advance == Approx(0.75f));
+    CHECK(composite->planeLeft == Approx(ring->planeLeft + 0.05f).margin(1.0f / 32.0f));
+    CHECK(std::abs(static_cast<i32>(composite->atlasWidth) - static_cast<i32>(ring->atlasWidth)) <= 1);
+    CHECK(medianAt(build, *composite, 0.225f, 0.35f) > 0.7f);
+    CHECK(medianAt(build, *composite, 0.4f, 0.35f) < 0.3f);
+}
+
+TEST_CASE("SdfFontBuilder options and errors", "[renderer][sdf_font]")
+{
+    const std::vector<u8> ttf = makeTestFont();
+
+    SECTION("Codepoint subsets skip characters the font lacks")
+    {
+        SdfFontBuildOptions options = testOptions();
+        options.codepoints = {'A', 'Z', 'A'};
+        auto built = SdfFontBuilder::build(ttf.data(), ttf.size(), options);
+        REQUIRE(built.isOk());
+        REQUIRE(built.value().metrics.glyphs.size() == 1);
+        CHECK(built.value().metrics.glyphs[0].codepoint == 'A');
+        CHECK(built.value().metrics.kerning.empty());
+    }
+
+    SECTION("Worker threads produce the same atlas")
+    {
+        SdfFontBuildOptions options = testOptions();
+        auto single = SdfFontBuilder::build(ttf.data(), ttf.size(), options);
+        options.threadCount = 3;
+        auto threaded = SdfFontBuilder::build(ttf.data(), ttf.size(), options);
+        REQUIRE(single.isOk());
+        REQUIRE(threaded.isOk());
+        CHECK(single.value().pages == threaded.value().pages);
+    }
+
+    SECTION("Glyphs spill onto further pages")
+    {
+        SdfFontBuildOptions options = testOptions();
+        options.pageSize = 40;
+        auto built = SdfFontBuilder::build(ttf.data(), ttf.size(), options);
+        REQUIRE(built.isOk());
+        CHECK(built.value().metrics.pageCount > 1);
+        CHECK(built.value().pages.size() == built.value().metrics.pageCount);
+    }
+
+    SECTION("Unsupported input")
+    {
+        const std::vector<u8> garbage(64, 0x42);
+        CHECK_FALSE(SdfFontBuilder::isTrueType(garbage.data(), garbage.size()));
+        CHECK(SdfFontBuilder::build(garbage.data(), garbage.size()).isError());
+
+        std::vector<u8> cff = ttf;
+        cff[0] = 'O';
+        cff[1] = 'T';
+        cff[2] = 'T';
+        cff[3] = 'O';
+        auto result = SdfFontBuilder::build(cff.data(), cff.size());
+        REQUIRE(result.isError());
+        CHECK(result.error().find("CFF") != std::string::npos);
+
+        std::vector<u8> truncated(ttf.begin(), ttf.begin() + 40);
+        CHECK(SdfFontBuilder::build(truncated.data(), truncated.size()).isError());
+    }
+}
+
+TEST_CASE("SdfFontFormat round-trips metrics tables", "[renderer][sdf_font]")
+{
+    const std::vector<u8> ttf = makeTestFont();
+    auto built = SdfFontBuilder::build(ttf.data(), ttf.size(), testOptions());
+    REQUIRE(built.isOk());
+    const SdfFontMetrics& metrics = built.value().metrics;
+
+    auto encoded = SdfFontFormat::encode(metrics);
+    REQUIRE(encoded.isOk());
+    const std::vector<u8>& bytes = encoded.value();
+    CHECK(SdfFontFormat::isSdfFont(bytes.data(), bytes.size()));
+    CHECK(bytes.size() == sizeof(SdfFontHeader) + metrics.glyphs.size() * sizeof(SdfGlyph) +
+                              metrics.kerning.size() * sizeof(SdfKerningPair));
+
+    auto decoded = SdfFontFormat::decode(bytes.data(), bytes.size());
+    REQUIRE(decoded.isOk());
+    const SdfFontMetrics& copy = decoded.value();
+    CHECK(copy.emSize == metrics.emSize);
+    CHECK(copy.distanceRange == metrics.distanceRange);
+    CHECK(copy.pageCount == metrics.pageCount);
+    REQUIRE(copy.glyphs.size() == metrics.glyphs.size());
+    CHECK(copy.glyphs.back().codepoint == 0x4E00);
+    CHECK(copy.findGlyph('O')->atlasX == metrics.findGlyph('O')->atlasX);
+    CHECK(copy.getKerning('A', 'O') == metrics.getKerning('A', 'O'));
+
+    CHECK(SdfFontFormat::decode(bytes.data(), bytes.size() - 1).isError());
+    CHECK_FALSE(SdfFontFormat::isSdfFont(ttf.data(), ttf.size()));
+    CHECK(SdfFontFormat::pageResourceId("fonts/ui.ttf", 3) == "fonts/ui.ttf.page3");
+
+    SdfFontMetrics unsorted = metrics;
+    std::swap(unsorted.glyphs[0], unsorted.glyphs[1]);
+    CHECK(SdfFontFormat::encode(unsorted).isError());
+
+    // Decoding checks what encoding would have: table order and a sane page count
+    auto corrupt = bytes;
+    const auto glyphs = static_cast<std::ptrdiff_t>(sizeof(SdfFontHeader));
+    const auto glyphSize = static_cast<std::ptrdiff_t>(sizeof(SdfGlyph));
+    const auto pairSize = static_cast<std::ptrdiff_t>(sizeof(SdfKerningPair));
+    std::swap_ranges(corrupt.begin() + glyphs, corrupt.begin() + glyphs + glyphSize,
+                     corrupt.begin() + glyphs + glyphSize);
+    CHECK(SdfFontFormat::decode(corrupt.data(), corrupt.size()).isError());
+
+    SdfFontMetrics twoPairs = metrics;
+    twoPairs.kerning.insert(twoPairs.kerning.begin(), {0x4E00, 'A', -0.1f});
+    CHECK(SdfFontFormat::encode(twoPairs).isError());
+    std::swap(twoPairs.kerning[0], twoPairs.kerning[1]);
+    auto twoPairBytes = SdfFontFormat::encode(twoPairs);
+    REQUIRE(twoPairBytes.isOk());
+    corrupt = twoPairBytes.value();
+    const auto kerning = glyphs + static_cast<std::ptrdiff_t>(metrics.glyphs.size()) * glyphSize;
+    std::swap_ranges(corrupt.begin() + kerning, corrupt.begin() + kerning + pairSize,
+                     corrupt.begin() + kerning + pairSize);
+    CHECK(SdfFontFormat::decode(corrupt.data(), corrupt.size()).isError());
+
+    corrupt = bytes;
+    const u32 pages = 0x7FFFFFFF;
+    std::memcpy(corrupt.data() + offsetof(SdfFontHeader, pageCount), &pages, sizeof(pages));
+    CHECK(SdfFontFormat::decode(corrupt.data(), corrupt.size()).isError());
+}
+
+TEST_CASE("Font loads SDF metrics and streams atlas pages", "[renderer][sdf_font]")
+{
+    const std::vector<u8> ttf = makeTestFont();
+    auto built = SdfFontBuilder::build(ttf.data(), ttf.size(), testOptions());
+    REQUIRE(built.isOk());
+    const SdfFontBuild& build = built.value();
+    auto encoded = SdfFontFormat::encode(build.metrics);
+    REQUIRE(encoded.isOk());
+
+    Font font;
+    REQUIRE(font.loadFromMemory(encoded.value(), 24).isOk());
+    CHECK(font.isValid());
+    CHECK(font.hasMetrics());
+    CHECK(font.getAdvance('A', 20.0f) == Approx(14.0f));
+    CHECK(font.getKerning('A', 'O', 20.0f) == Approx(-1.0f));
+    CHECK(font.getLineHeight(20.0f) == Approx(20.0f));
+    CHECK(font.getAscender(20.0f) == Approx(16.0f));
+    // Missing characters fall back to the fixed advance without a '?' glyph
+    CHECK(font.findGlyph('Z') == nullptr);
+    CHECK(font.getAdvance('Z', 20.0f) == Approx(10.0f));
+
+    CHECK(font.getPage(0) == nullptr); // No loader yet
+    int loads = 0;
+    font.setPageLoader([&](u32 page) -> Result<std::vector<u8>> {
+        ++loads;
+        RawTextureOptions options;
+        options.premultiplyAlpha = false;
+        return RawTexture::encode(build.pages[page].data(), build.metrics.pageWidth,
+                                  build.pageHeights[page], 0, options);
+    });
+    CHECK_FALSE(font.isPageLoaded(0));
+    const Texture* page = font.getPage(0);
+    REQUIRE(page);
+    CHECK(page->getWidth() == static_cast<i32>(build.metrics.pageWidth));
+    CHECK_FALSE(page->isPremultiplied());
+    CHECK(font.getPage(0) == page);
+    CHECK(loads == 1);
+    CHECK(font.getPage(1) == nullptr);
+
+    font.releasePages();
+    CHECK_FALSE(font.isPageLoaded(0));
+    CHECK(font.getPage(0) != nullptr);
+    CHECK(loads == 2);
+
+    Font moved = std::move(font);
+    CHECK(moved.hasMetrics());
+    CHECK(moved.isPageLoaded(0));
+    CHECK_FALSE(font.hasMetrics());
+}
+
+TEST_CASE("TextLayoutEngine lays out with SDF font metrics", "[renderer][sdf_font]")
+{
+    const std::vector<u8> ttf = makeTestFont();
+    auto built = SdfFontBuilder::build(ttf.data(), ttf.size(), testOptions());
+    REQUIRE(built.isOk());
+    auto encoded = SdfFontFormat::encode(built.value().metrics);
+    REQUIRE(encoded.isOk());
+    auto font = std::make_shared<Font>();
+    REQUIRE(font->loadFromMemory(encoded.value(), 20).isOk());
+
+    TextLayoutEngine engine;
+    engine.setFont(font);
+    TextStyle style;
+    style.size = 20.0f;
+    style.outlineWidth = 10.0f;
+    style.shadowColor = Color(0, 0, 0, 128);
+    style.shadowOffsetX = 2.0f;
+    style.shadowOffsetY = 3.0f;
+    engine.setDefaultStyle(style);
+
+    SECTION("Advances and kerning")
+    {
+        CHECK(engine.measureText("AO").first == Approx(27.0f));
+        CHECK(engine.measureText("A O").first == Approx(33.0f));
+    }
+
+    SECTION("Ideographs wrap without spaces, keeping closing punctuation attached")
+    {
+        engine.setMaxWidth(50.0f);
+        TextLayout layout = engine.layout("\xE4\xB8\x80\xE4\xB8\x80\xE4\xB8\x80\xE4\xB8\x80");
+        REQUIRE(layout.lines.size() == 2);
+        CHECK(layout.lines[0].width == Approx(40.0f));
+        CHECK(layout.totalCharacters == 12);
+
+        engine.setMaxWidth(40.0f);
+        layout = engine.layout("\xE4\xB8\x80\xE4\xB8\x80\xE3\x80\x82");
+        REQUIRE(layout.lines.size() == 2);
+        CHECK(layout.lines[1].segments.back().text == "\xE4\xB8\x80\xE3\x80\x82");
+    }
+
+    SECTION("Lines place the baseline from the font's ascender")
+    {
+        TextLayout layout = engine.layout("A");
+        REQUIRE(layout.lines.size() == 1);
+        CHECK(layout.lines[0].height == Approx(24.0f));
+        CHECK(layout.lines[0].baseline == Approx(18.0f));
+    }
+
+    SECTION("Glyph quads carry atlas placement and effects")
+    {
+        TextLayout layout = engine.layout("A O");
+        std::vector<SdfGlyphQuad> quads;
+        engine.buildGlyphQuads(layout, quads);
+        REQUIRE(quads.size() == 2);
+
+        const SdfGlyph* ring = font->findGlyph('A');
+        const SdfGlyph* circle = font->findGlyph('O');
+        CHECK(quads[0].screen.x == Approx(ring->planeLeft * 20.0f));
+        CHECK(quads[0].screen.y == Approx(18.0f - ring->planeTop * 20.0f));
+        CHECK(quads[0].screen.width ==
+              Approx((ring->planeRight - ring->planeLeft) * 20.0f));
+        CHECK(quads[0].atlas.width == ring->atlasWidth);
+        CHECK(quads[0].charIndex == 0);
+        CHECK(quads[1].charIndex == 2);
+        CHECK(quads[1].screen.x == Approx(14.0f + 5.0f + circle->planeLeft * 20.0f));
+
+        const f32 pxRange = 6.0f * 20.0f / 32.0f;
+        CHECK(quads[0].pxRange == Approx(pxRange));
+        CHECK(quads[0].outlineWidth == Approx(pxRange * 0.5f));
+        CHECK(quads[0].shadowColor == Color(0, 0, 0, 128));
+        CHECK(quads[0].shadowOffsetY == 3.0f);
+
+        engine.setAlignment(TextAlign::Right);
+        engine.setMaxWidth(100.0f);
+        layout = engine.layout("A");
+        engine.buildGlyphQuads(layout, quads);
+        REQUIRE(quads.size() == 1);
+        CHECK(quads[0].screen.x == Approx(100.0f - 14.0f + ring->planeLeft * 20.0f));
+    }
+}
+
+TEST_CASE("SdfShading evaluates fill and outline coverage", "[renderer][sdf_font]")
+{
+    CHECK(SdfShading::median(0.1f, 0.8f, 0.6f) == Approx(0.6f));
+
+    const u8 inside[4] = {255, 255, 255, 255};
+    const u8 outside[4] = {0, 0, 0, 0};
+    const u8 edge[4] = {128, 128, 128, 128};
+    const u8 corner[4] = {255, 0, 200, 110}; // Median 200: inside despite one channel
+    CHECK(SdfShading::fillCoverage(inside, 4.0f) == 1.0f);
+    CHECK(SdfShading::fillCoverage(outside, 4.0f) == 0.0f);
+    CHECK(SdfShading::fillCoverage(edge, 4.0f) == Approx(0.5f).margin(0.02f));
+    CHECK(SdfShading::fillCoverage(corner, 4.0f) == 1.0f);
+
+    // The outline grows the shape by its width in screen pixels
+    CHECK(SdfShading::outlineCoverage(edge, 4.0f, 0.0f) == Approx(0.5f).margin(0.02f));
+    CHECK(SdfShading::outlineCoverage(edge, 4.0f, 1.0f) == 1.0f);
+    const u8 nearOutside[4] = {96, 96, 96, 96}; // About a pixel outside at range 8
+    CHECK(SdfShading::fillCoverage(nearOutside, 8.0f) == 0.0f);
+    CHECK(SdfShading::outlineCoverage(nearOutside, 8.0f, 1.5f) > 0.9f);
+}
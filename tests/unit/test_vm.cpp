@@ -1,4 +1,9 @@
 #include <catch2/catch_test_macros.hpp>
+#include "NovelMind/scripting/bytecode_verifier.hpp"
+#include "NovelMind/scripting/compiler.hpp"
+#include "NovelMind/scripting/lexer.hpp"
+#include "NovelMind/scripting/parser.hpp"
+#include "NovelMind/scripting/script_runtime.hpp"
 #include "NovelMind/scripting/vm.hpp"
 
 using namespace NovelMind::scripting;
@@ -204,3 +209,148 @@ TEST_CASE("VM reset", "[scripting]")
     REQUIRE_FALSE(vm.isHalted());
     REQUIRE_FALSE(vm.isRunning());
 }
+
+TEST_CASE("VM rejects structurally invalid bytecode", "[scripting][verifier]")
+{
+    VirtualMachine vm;
+
+    REQUIRE(vm.load({{OpCode::JUMP, 5}, {OpCode::HALT, 0}}, {}).isError());
+    REQUIRE(vm.load({{OpCode::PUSH_STRING, 1}, {OpCode::HALT, 0}}, {"only"}).isError());
+    REQUIRE(vm.load({{OpCode::PUSH_BOOL, 7}, {OpCode::HALT, 0}}, {}).isError());
+    REQUIRE(vm.load({{static_cast<OpCode>(0xEE), 0}}, {}).isError());
+
+    // Jumping exactly to the end halts
+    REQUIRE(vm.load({{OpCode::JUMP, 1}}, {}).isOk());
+    vm.run();
+    REQUIRE(vm.isHalted());
+}
+
+TEST_CASE("Verifier bounds stack depth across branches", "[scripting][verifier]")
+{
+    std::vector<Instruction> program = {
+        {OpCode::PUSH_BOOL, 1},
+        {OpCode::JUMP_IF_NOT, 5},
+        {OpCode::PUSH_INT, 1},
+        {OpCode::PUSH_INT, 2},
+        {OpCode::JUMP, 7},
+        {OpCode::PUSH_INT, 3},
+        {OpCode::PUSH_INT, 4},
+        {OpCode::ADD, 0},
+        {OpCode::STORE_VAR, 0},
+        {OpCode::HALT, 0}
+    };
+
+    auto verified = BytecodeVerifier::verify(program, {"sum"});
+    REQUIRE(verified.isOk());
+    REQUIRE(verified.value().stackVerified);
+    REQUIRE(verified.value().maxStackDepth == 2);
+    REQUIRE(verified.value().blockCost[0] == 2);
+    REQUIRE(verified.value().blockCost[2] == 3);
+    REQUIRE(verified.value().blockCost[1] == 0);
+
+    VirtualMachine vm;
+    REQUIRE(vm.load(program, {"sum"}).isOk());
+    REQUIRE(vm.isVerified());
+    vm.run();
+    REQUIRE(std::get<NovelMind::i32>(vm.getVariable("sum")) == 3);
+
+    // Branches that leave different depths at a join are not verified
+    program[3] = {OpCode::NOP, 0};
+    auto unbalanced = BytecodeVerifier::verify(program, {"sum"});
+    REQUIRE(unbalanced.isOk());
+    REQUIRE_FALSE(unbalanced.value().stackVerified);
+
+    // A possible underflow falls back to checked execution
+    REQUIRE(vm.load({{OpCode::POP, 0}, {OpCode::HALT, 0}}, {}).isOk());
+    REQUIRE_FALSE(vm.isVerified());
+    vm.run();
+    REQUIRE(vm.isHalted());
+
+    // Too deep for the limit is not verified either, but still loads
+    VMSecurityLimits limits;
+    limits.maxStackSize = 1;
+    auto deep = BytecodeVerifier::verify({{OpCode::PUSH_INT, 1}, {OpCode::PUSH_INT, 2}}, {}, limits);
+    REQUIRE(deep.isOk());
+    REQUIRE_FALSE(deep.value().stackVerified);
+}
+
+TEST_CASE("VM runs scenes with more lines than the stack limit", "[scripting][verifier]")
+{
+    // Every say leaves its speaker on the stack
+    std::string source = "scene long {\n";
+    for (int i = 0; i < 1100; ++i)
+    {
+        source += "    say \"Line " + std::to_string(i) + "\"\n";
+    }
+    source += "}\n";
+
+    Lexer lexer;
+    auto tokens = lexer.tokenize(source);
+    REQUIRE(tokens.isOk());
+    Parser parser;
+    auto parsed = parser.parse(tokens.value());
+    REQUIRE(parsed.isOk());
+    Compiler compiler;
+    auto compiled = compiler.compile(parsed.value());
+    REQUIRE(compiled.isOk());
+
+    VirtualMachine vm;
+    REQUIRE(vm.load(compiled.value().instructions, compiled.value().stringTable).isOk());
+    REQUIRE_FALSE(vm.isVerified());
+
+    int lines = 0;
+    vm.registerCallback(OpCode::SAY, [&lines](const std::vector<Value>&) { ++lines; });
+    vm.run();
+    while (!vm.isHalted())
+    {
+        vm.signalContinue();
+    }
+    REQUIRE(lines == 1100);
+
+    ScriptRuntime runtime;
+    REQUIRE(runtime.load(compiled.value()).isOk());
+    REQUIRE(runtime.gotoScene("long").isOk());
+}
+
+TEST_CASE("VM charges fuel per basic block and yields when it runs out", "[scripting][verifier]")
+{
+    // counter = counter + 1 forever
+    std::vector<Instruction> program = {
+        {OpCode::LOAD_VAR, 0},
+        {OpCode::PUSH_INT, 1},
+        {OpCode::ADD, 0},
+        {OpCode::STORE_VAR, 0},
+        {OpCode::JUMP, 0}
+    };
+
+    for (bool verified : {true, false})
+    {
+        VirtualMachine vm;
+        VMSecurityLimits limits;
+        limits.maxInstructionsPerStep = 100;
+        vm.setSecurityLimits(limits);
+
+        auto strings = std::vector<std::string>{"counter"};
+        if (!verified)
+        {
+            // A reachable underflow after the loop keeps the program on the checked path
+            program.push_back({OpCode::POP, 0});
+            program[4] = {OpCode::JUMP_IF_NOT, 0};
+            program.insert(program.begin() + 4, {OpCode::PUSH_BOOL, 0});
+        }
+        REQUIRE(vm.load(program, strings).isOk());
+        REQUIRE(vm.isVerified() == verified);
+        vm.setVariable("counter", NovelMind::i32{0});
+
+        // Verified: twenty five-instruction blocks. Checked: one instruction at
+        // a time, so the budget runs out partway through the 17th iteration.
+        const NovelMind::i32 perRun = verified ? 20 : 17;
+        vm.run();
+        REQUIRE(vm.isFuelExhausted());
+        REQUIRE_FALSE(vm.isHalted());
+        REQUIRE(std::get<NovelMind::i32>(vm.getVariable("counter")) == perRun);
+
+        vm.run();
+        REQUIRE(std::get<NovelMind::i32>(vm.getVariable("counter")) > perRun);
+    }
+}
@@ -0,0 +1,215 @@
+#include <catch2/catch_test_macros.hpp>
+#include "NovelMind/scripting/compiler.hpp"
+#include "NovelMind/scripting/lexer.hpp"
+#include "NovelMind/scripting/parser.hpp"
+#include "NovelMind/scripting/script_runtime.hpp"
+#include "NovelMind/scripting/vm.hpp"
+
+using namespace NovelMind;
+using namespace NovelMind::scripting;
+
+namespace
+{
+
+// Line numbers matter: the tests break on lines 2 and 5
+const char* const SCRIPT =
+    "scene intro {\n"
+    "    set points = 3\n"
+    "    say Hero \"Hi\"\n"
+    "    if points > 2 {\n"
+    "        set points = 10\n"
+    "    }\n"
+    "    say \"Bye\"\n"
+    "}\n";
+
+CompiledScript compileScript(const char* source)
+{
+    Lexer lexer;
+    auto tokens = lexer.tokenize(source);
+    REQUIRE(tokens.isOk());
+    Parser parser;
+    auto program = parser.parse(tokens.value());
+    REQUIRE(program.isOk());
+    Compiler compiler;
+    auto compiled = compiler.compile(program.value());
+    REQUIRE(compiled.isOk());
+    return std::move(compiled).value();
+}
+
+CompiledExpression compileCondition(const char* source)
+{
+    Lexer lexer;
+    auto tokens = lexer.tokenize(source);
+    REQUIRE(tokens.isOk());
+    Parser parser;
+    auto expr = parser.parseStandaloneExpression(tokens.value());
+    REQUIRE(expr.isOk());
+    Compiler compiler;
+    auto compiled = compiler.compileStandaloneExpression(*expr.value());
+    REQUIRE(compiled.isOk());
+    return std::move(compiled).value();
+}
+
+} // namespace
+
+TEST_CASE("LineTable delta-encodes statement locations", "[line_table]")
+{
+    LineTable table;
+    CHECK(table.empty());
+    CHECK_FALSE(table.getLocation(0).has_value());
+
+    table.add(0, SourceLocation(3, 5));
+    table.add(2, SourceLocation(4, 5));
+    table.add(2, SourceLocation(5, 9));  // Replaces the statement that emitted nothing
+    table.add(6, SourceLocation(5, 9));  // Same location continues
+    table.add(9, SourceLocation(2, 1));  // Lines may go back
+    table.add(400, SourceLocation(1000, 1));
+
+    const auto entries = table.decode();
+    REQUIRE(entries.size() == 4);
+    CHECK(table.getEntryCount() == 4);
+    CHECK(entries[1].ip == 2);
+    CHECK(entries[1].location.line == 5);
+    CHECK(entries[1].location.column == 9);
+    CHECK(entries[2].location.line == 2);
+    CHECK(entries[3].ip == 400);
+    CHECK(entries[3].location.line == 1000);
+    CHECK(table.getData().size() <= 14);
+
+    REQUIRE(table.getLocation(7).has_value());
+    CHECK(table.getLocation(7)->line == 5);
+    CHECK(table.getLocation(1)->line == 3);
+    CHECK(table.getLocation(5000)->line == 1000);
+    CHECK(table.getInstructions(5) == std::vector<u32>{2});
+    CHECK(table.getInstructions(4).empty());
+}
+
+TEST_CASE("Compiler records where each statement starts", "[line_table]")
+{
+    const CompiledScript script = compileScript(SCRIPT);
+    const LineTable& lines = script.lineTable;
+
+    CHECK(lines.getInstructions(2) == std::vector<u32>{0});
+    REQUIRE(lines.getInstructions(4).size() == 1);
+    REQUIRE(lines.getInstructions(5).size() == 1);
+    const u32 ifStart = lines.getInstructions(4).front();
+    const u32 setStart = lines.getInstructions(5).front();
+    CHECK(script.instructions[ifStart].opcode == OpCode::LOAD_GLOBAL);
+    CHECK(script.instructions[setStart].opcode == OpCode::PUSH_INT);
+    CHECK(lines.getLocation(setStart - 1)->line == 4);
+    CHECK(lines.getInstructions(6).empty());
+}
+
+TEST_CASE("VM pauses at patched breakpoints and runs the original on resume", "[scripting][breakpoint]")
+{
+    const CompiledScript script = compileScript(SCRIPT);
+    const u32 setStart = script.lineTable.getInstructions(5).front();
+
+    VirtualMachine vm;
+    REQUIRE(vm.load(script.instructions, script.stringTable).isOk());
+    REQUIRE(vm.setBreakpoint(setStart).isOk());
+    CHECK(vm.hasBreakpoint(setStart));
+    CHECK(vm.getInstruction(setStart).opcode == OpCode::PUSH_INT);
+    CHECK(vm.setBreakpoint(static_cast<u32>(script.instructions.size())).isError());
+
+    vm.run();
+    REQUIRE(vm.isWaiting()); // First line
+    vm.signalContinue();
+    REQUIRE(vm.isPaused());
+    CHECK(vm.getIP() == setStart);
+    CHECK(asInt(vm.getVariable("points")) == 3);
+
+    vm.resume();
+    CHECK(vm.isWaiting()); // Second line
+    CHECK(asInt(vm.getVariable("points")) == 10);
+    CHECK(vm.hasBreakpoint(setStart));
+
+    SECTION("A handler declines traps whose condition is false")
+    {
+        const CompiledExpression condition = compileCondition("points > 5");
+        u32 trapped = 0;
+        vm.setBreakHandler([&](u32) {
+            ++trapped;
+            auto value = vm.evaluate(condition.instructions, condition.stringTable);
+            return value.isOk() && asBool(value.value());
+        });
+
+        vm.reset();
+        vm.run();
+        vm.signalContinue();
+        CHECK(trapped == 1);
+        CHECK_FALSE(vm.isPaused());
+        CHECK(vm.isWaiting());
+        CHECK(asInt(vm.getVariable("points")) == 10);
+    }
+
+    SECTION("Clearing traps restores the program")
+    {
+        for (u32 ip = 0; ip < script.instructions.size(); ++ip)
+        {
+            REQUIRE(vm.setBreakpoint(ip).isOk());
+        }
+        CHECK(vm.getBreakpointCount() == script.instructions.size());
+        vm.clearBreakpoints();
+        CHECK(vm.getBreakpointCount() == 0);
+
+        vm.reset();
+        vm.run();
+        vm.signalContinue();
+        CHECK_FALSE(vm.isPaused());
+        CHECK(vm.isWaiting());
+    }
+}
+
+TEST_CASE("VM evaluates standalone expressions without disturbing the script", "[scripting][breakpoint]")
+{
+    const CompiledScript script = compileScript(SCRIPT);
+    VirtualMachine vm;
+    REQUIRE(vm.load(script.instructions, script.stringTable).isOk());
+    vm.run();
+    REQUIRE(vm.isWaiting());
+    const u32 ip = vm.getIP();
+
+    const CompiledExpression expr = compileCondition("not (points * 2 != 6)");
+    auto value = vm.evaluate(expr.instructions, expr.stringTable);
+    REQUIRE(value.isOk());
+    CHECK(asBool(value.value()));
+    CHECK(vm.getIP() == ip);
+    CHECK(vm.isWaiting());
+
+    CHECK(vm.evaluate({{OpCode::SAY, 0}}, {"x"}).isError());
+
+    Parser parser;
+    Lexer lexer;
+    auto tokens = lexer.tokenize("points >");
+    REQUIRE(tokens.isOk());
+    CHECK(parser.parseStandaloneExpression(tokens.value()).isError());
+    tokens = lexer.tokenize("points 3");
+    REQUIRE(tokens.isOk());
+    CHECK(parser.parseStandaloneExpression(tokens.value()).isError());
+}
+
+TEST_CASE("ScriptRuntime stops at breakpoint traps", "[script_runtime][breakpoint]")
+{
+    const CompiledScript script = compileScript(SCRIPT);
+    const u32 setStart = script.lineTable.getInstructions(2).front();
+
+    ScriptRuntime runtime;
+    REQUIRE(runtime.load(script).isOk());
+    REQUIRE(runtime.getVM().setBreakpoint(setStart).isOk());
+    // Entering a scene reloads the program; the trap stays
+    REQUIRE(runtime.gotoScene("intro").isOk());
+
+    runtime.update(0.016);
+    REQUIRE(runtime.getState() == RuntimeState::Paused);
+    CHECK(runtime.getVM().getIP() == setStart);
+    runtime.update(0.016);
+    CHECK(runtime.getState() == RuntimeState::Paused);
+
+    // One instruction per update: the original push, then the store
+    runtime.resume();
+    runtime.update(0.016);
+    runtime.update(0.016);
+    CHECK(runtime.getState() == RuntimeState::Running);
+    CHECK(asInt(runtime.getVM().getVariable("points")) == 3);
+}
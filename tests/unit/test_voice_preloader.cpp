@@ -0,0 +1,263 @@
+#include <catch2/catch_test_macros.hpp>
+#include "NovelMind/audio/voice_preloader.hpp"
+#include "NovelMind/scripting/script_runtime.hpp"
+#include <atomic>
+#include <cstring>
+
+using namespace NovelMind;
+using namespace NovelMind::audio;
+using namespace NovelMind::scripting;
+
+namespace
+{
+
+// intro: Alice speaks, then a branch to Bob + narration or straight to
+// Alice again; both paths jump to outro, where Bob speaks
+CompiledScript branchingScript()
+{
+    CompiledScript script;
+    script.stringTable = {"Alice", "Hello", "Bob", "Left", "Narration", "Right", "Bye"};
+    script.instructions = {
+        {OpCode::PUSH_STRING, 0},  // 0
+        {OpCode::SAY, 1},          // 1  intro_Alice_000
+        {OpCode::PUSH_BOOL, 1},    // 2
+        {OpCode::JUMP_IF, 8},      // 3
+        {OpCode::PUSH_STRING, 2},  // 4
+        {OpCode::SAY, 3},          // 5  intro_Bob_001
+        {OpCode::PUSH_NULL, 0},    // 6
+        {OpCode::SAY, 4},          // 7  narration, not voiced
+        {OpCode::PUSH_STRING, 0},  // 8
+        {OpCode::SAY, 5},          // 9  intro_Alice_002
+        {OpCode::GOTO_SCENE, 11},  // 10
+        {OpCode::PUSH_STRING, 2},  // 11
+        {OpCode::SAY, 6},          // 12 outro_Bob_000
+        {OpCode::HALT, 0},         // 13
+    };
+    script.sceneEntryPoints["intro"] = 0;
+    script.sceneEntryPoints["outro"] = 11;
+    return script;
+}
+
+struct CountingLoader
+{
+    std::shared_ptr<std::atomic<int>> calls = std::make_shared<std::atomic<int>>(0);
+
+    VoiceHeadLoader loader(const std::string& failingId = {}) const
+    {
+        auto counter = calls;
+        return [counter, failingId](const std::string& voiceId, f32 seconds) {
+            ++*counter;
+            if (voiceId == failingId)
+            {
+                return Result<VoiceClipHead>::error("missing");
+            }
+            VoiceClipHead head;
+            head.sampleRate = 1000;
+            head.channels = 1;
+            head.samples.assign(static_cast<usize>(seconds * 1000.0f), 7);
+            return Result<VoiceClipHead>::ok(std::move(head));
+        };
+    }
+};
+
+std::vector<u8> wavFile(u16 format, u16 channels, u32 rate, u16 bits, const std::vector<u8>& data)
+{
+    std::vector<u8> out;
+    auto put16 = [&out](u16 v) { out.push_back(static_cast<u8>(v)); out.push_back(static_cast<u8>(v >> 8)); };
+    auto put32 = [&](u32 v) { put16(static_cast<u16>(v)); put16(static_cast<u16>(v >> 16)); };
+    out.insert(out.end(), {'R', 'I', 'F', 'F'});
+    put32(static_cast<u32>(36 + 10 + data.size()));
+    out.insert(out.end(), {'W', 'A', 'V', 'E'});
+    // An unrelated odd-sized chunk first, as some tools write
+    out.insert(out.end(), {'L', 'I', 'S', 'T'});
+    put32(1);
+    out.insert(out.end(), {0, 0});
+    out.insert(out.end(), {'f', 'm', 't', ' '});
+    put32(16);
+    put16(format);
+    put16(channels);
+    put32(rate);
+    put32(rate * channels * (bits / 8));
+    put16(static_cast<u16>(channels * (bits / 8)));
+    put16(bits);
+    out.insert(out.end(), {'d', 'a', 't', 'a'});
+    put32(static_cast<u32>(data.size()));
+    out.insert(out.end(), data.begin(), data.end());
+    return out;
+}
+
+} // namespace
+
+TEST_CASE("VoicePreloader resolves voice ids and walks every branch", "[voice_preloader]")
+{
+    VoicePreloader preloader;
+    preloader.setScript(branchingScript());
+
+    CHECK(preloader.getVoiceId(1) == "intro_Alice_000");
+    CHECK(preloader.getVoiceId(5) == "intro_Bob_001");
+    CHECK(preloader.getVoiceId(7).empty());
+    CHECK(preloader.getVoiceId(9) == "intro_Alice_002");
+    CHECK(preloader.getVoiceId(12) == "outro_Bob_000");
+    CHECK(preloader.getVoiceId(0).empty());
+    CHECK(preloader.getVoiceId(100).empty());
+
+    CHECK(preloader.findUpcomingLines(2) == std::vector<u32>{5, 9, 7, 12});
+    CHECK(preloader.findUpcomingLines(0) == std::vector<u32>{1, 5, 9, 7, 12});
+    CHECK(preloader.findUpcomingLines(13).empty());
+
+    VoicePreloadConfig config;
+    config.lookahead = 1;
+    preloader.setConfig(config);
+    CHECK(preloader.findUpcomingLines(2) == std::vector<u32>{5, 9});
+
+    config.lookahead = 3;
+    config.maxScanInstructions = 5;
+    preloader.setConfig(config);
+    CHECK(preloader.findUpcomingLines(2) == std::vector<u32>{5});
+
+    preloader.setResolver([](const VoiceLineRef& line) {
+        return "vo/" + std::string(line.text) + ".wav";
+    });
+    preloader.setScript(branchingScript());
+    CHECK(preloader.getVoiceId(7) == "vo/Narration.wav");
+
+    // Bound lines resolve to their clip paths; unbound lines are not voiced
+    preloader.setResolver(VoicePreloader::bindingResolver({
+        {"intro_Alice_000", "voice/alice/hello.wav"},
+        {"outro_Bob_000", "voice/bob/bye.wav"},
+    }));
+    preloader.setScript(branchingScript());
+    CHECK(preloader.getVoiceId(1) == "voice/alice/hello.wav");
+    CHECK(preloader.getVoiceId(5).empty());
+    CHECK(preloader.getVoiceId(12) == "voice/bob/bye.wav");
+}
+
+TEST_CASE("VoicePreloader loads upcoming heads into an LRU pool", "[voice_preloader]")
+{
+    VoicePreloader preloader;
+    CountingLoader counting;
+    preloader.setLoader(counting.loader("outro_Bob_000"));
+    preloader.setScript(branchingScript());
+
+    preloader.preloadFrom(2);
+    preloader.waitForAll();
+    CHECK(*counting.calls == 3);
+    CHECK(preloader.isLoaded("intro_Bob_001"));
+    CHECK(preloader.isLoaded("intro_Alice_002"));
+    CHECK_FALSE(preloader.isLoaded("outro_Bob_000"));
+    CHECK_FALSE(preloader.hasPending());
+
+    auto head = preloader.acquire("intro_Bob_001");
+    REQUIRE(head != nullptr);
+    CHECK(head->voiceId == "intro_Bob_001");
+    CHECK(head->samples.size() == 300);
+    CHECK(head->getDuration() > 0.29f);
+    CHECK(preloader.acquire("intro_Alice_000") == nullptr);
+    CHECK(preloader.getHitCount() == 1);
+    CHECK(preloader.getMissCount() == 1);
+
+    // Loaded clips and failed loads are not requested again
+    preloader.preloadFrom(2);
+    preloader.waitForAll();
+    CHECK(*counting.calls == 3);
+
+    // A small pool keeps the nearest lines and evicts what is no longer ahead
+    VoicePreloadConfig config;
+    config.poolSize = 2;
+    preloader.setConfig(config);
+    preloader.preloadFrom(0);
+    preloader.waitForAll();
+    CHECK(*counting.calls == 4);
+    CHECK(preloader.isLoaded("intro_Alice_000"));
+    CHECK(preloader.isLoaded("intro_Bob_001"));
+    CHECK_FALSE(preloader.isLoaded("intro_Alice_002"));
+    // The acquired head outlives its eviction
+    CHECK(head->samples.size() == 300);
+
+    preloader.clear();
+    CHECK_FALSE(preloader.isLoaded("intro_Alice_000"));
+}
+
+TEST_CASE("VoicePreloader decodes the start of PCM WAV files", "[voice_preloader]")
+{
+    std::vector<u8> pcm16(8000 * 2);
+    for (usize i = 0; i < 8000; ++i)
+    {
+        const i16 value = static_cast<i16>(i);
+        std::memcpy(pcm16.data() + i * 2, &value, 2);
+    }
+    auto mono = wavFile(1, 1, 8000, 16, pcm16);
+    auto head = VoicePreloader::decodeWavHead(mono.data(), mono.size(), 0.3f);
+    REQUIRE(head.isOk());
+    CHECK(head.value().sampleRate == 8000);
+    CHECK(head.value().channels == 1);
+    CHECK(head.value().samples.size() == 2400);
+    CHECK(head.value().samples[1234] == 1234);
+    CHECK(head.value().clipDuration == 1.0f);
+
+    auto stereo8 = wavFile(1, 2, 100, 8, {128, 255, 0, 128});
+    head = VoicePreloader::decodeWavHead(stereo8.data(), stereo8.size(), 1.0f);
+    REQUIRE(head.isOk());
+    CHECK(head.value().samples == std::vector<i16>{0, 127 << 8, -32768, 0});
+
+    std::vector<u8> floats(8);
+    const f32 samples[2] = {0.5f, -2.0f};
+    std::memcpy(floats.data(), samples, sizeof(samples));
+    auto float32 = wavFile(3, 1, 100, 32, floats);
+    head = VoicePreloader::decodeWavHead(float32.data(), float32.size(), 1.0f);
+    REQUIRE(head.isOk());
+    CHECK(head.value().samples == std::vector<i16>{16384, -32767});
+
+    auto adpcm = wavFile(2, 1, 100, 4, {0, 0});
+    CHECK(VoicePreloader::decodeWavHead(adpcm.data(), adpcm.size(), 1.0f).isError());
+    const u8 junk[16] = {};
+    CHECK(VoicePreloader::decodeWavHead(junk, sizeof(junk), 1.0f).isError());
+
+    // An odd-sized LIST chunk whose pad byte was cut off ends the walk in bounds
+    const std::vector<u8> truncated = {'R', 'I', 'F', 'F', 15, 0, 0, 0, 'W', 'A', 'V', 'E',
+                                       'L', 'I', 'S', 'T', 3,  0, 0, 0, 'a', 'b', 'c'};
+    CHECK(VoicePreloader::decodeWavHead(truncated.data(), truncated.size(), 1.0f).isError());
+}
+
+TEST_CASE("ScriptRuntime plays voices from the preloaded pool", "[voice_preloader][script_runtime]")
+{
+    AudioManager audio;
+    REQUIRE(audio.initialize().isOk());
+
+    VoicePreloader preloader;
+    CountingLoader counting;
+    preloader.setLoader(counting.loader());
+    audio.setVoicePreloader(&preloader);
+
+    ScriptRuntime runtime;
+    runtime.setAudioManager(&audio);
+    runtime.setVoicePreloader(&preloader);
+    REQUIRE(runtime.load(branchingScript()).isOk());
+
+    // Entering the scene queues its first lines
+    REQUIRE(runtime.gotoScene("intro").isOk());
+    preloader.waitForAll();
+    CHECK(preloader.isLoaded("intro_Alice_000"));
+
+    // One instruction per update: the speaker, then the line
+    runtime.update(0.016);
+    runtime.update(0.016);
+    REQUIRE(runtime.getVM().isWaiting());
+    CHECK(audio.isVoicePlaying());
+    CHECK(preloader.getHitCount() == 1);
+
+    const auto sources = audio.getActiveSources();
+    REQUIRE(sources.size() == 1);
+    const AudioSource* source = audio.getSource(sources.front());
+    REQUIRE(source != nullptr);
+    CHECK(source->trackId == "intro_Alice_000");
+    REQUIRE(source->preloadedHead != nullptr);
+    CHECK(source->preloadedHead->voiceId == "intro_Alice_000");
+
+    // Showing the line queued the lines after it; those queued on entering
+    // the scene already cover them
+    preloader.waitForAll();
+    CHECK(preloader.isLoaded("intro_Alice_002"));
+    CHECK(preloader.isLoaded("outro_Bob_000"));
+    CHECK(*counting.calls == 4);
+}